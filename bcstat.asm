@@ -0,0 +1,1281 @@
+
+_bcstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *qname[NBQ] = { "in", "am" };
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 4c             	sub    $0x4c,%esp
+  13:	89 cb                	mov    %ecx,%ebx
+  struct bcstat st;
+  int i, reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  15:	83 3b 01             	cmpl   $0x1,(%ebx)
+  18:	7e 24                	jle    3e <main+0x3e>
+  1a:	8b 43 04             	mov    0x4(%ebx),%eax
+  1d:	83 c0 04             	add    $0x4,%eax
+  20:	8b 00                	mov    (%eax),%eax
+  22:	83 ec 08             	sub    $0x8,%esp
+  25:	68 2e 09 00 00       	push   $0x92e
+  2a:	50                   	push   %eax
+  2b:	e8 62 01 00 00       	call   192 <strcmp>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	85 c0                	test   %eax,%eax
+  35:	75 07                	jne    3e <main+0x3e>
+  37:	b8 01 00 00 00       	mov    $0x1,%eax
+  3c:	eb 05                	jmp    43 <main+0x43>
+  3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  43:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc > 2 || (argc == 2 && !reset)){
+  46:	83 3b 02             	cmpl   $0x2,(%ebx)
+  49:	7f 0b                	jg     56 <main+0x56>
+  4b:	83 3b 02             	cmpl   $0x2,(%ebx)
+  4e:	75 1d                	jne    6d <main+0x6d>
+  50:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  54:	75 17                	jne    6d <main+0x6d>
+    printf(2, "usage: bcstat [-r]\n");
+  56:	83 ec 08             	sub    $0x8,%esp
+  59:	68 31 09 00 00       	push   $0x931
+  5e:	6a 02                	push   $0x2
+  60:	e8 0a 05 00 00       	call   56f <printf>
+  65:	83 c4 10             	add    $0x10,%esp
+    exit();
+  68:	e8 26 03 00 00       	call   393 <exit>
+  }
+  if(bcstat(&st, reset) < 0){
+  6d:	83 ec 08             	sub    $0x8,%esp
+  70:	ff 75 e0             	push   -0x20(%ebp)
+  73:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  76:	50                   	push   %eax
+  77:	e8 07 04 00 00       	call   483 <bcstat>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	85 c0                	test   %eax,%eax
+  81:	79 17                	jns    9a <main+0x9a>
+    printf(2, "bcstat: failed\n");
+  83:	83 ec 08             	sub    $0x8,%esp
+  86:	68 45 09 00 00       	push   $0x945
+  8b:	6a 02                	push   $0x2
+  8d:	e8 dd 04 00 00       	call   56f <printf>
+  92:	83 c4 10             	add    $0x10,%esp
+    exit();
+  95:	e8 f9 02 00 00       	call   393 <exit>
+  }
+
+  printf(1, "buffers %d ghost hits %d\n", st.nbuf, st.ghosthits);
+  9a:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  9d:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  a0:	52                   	push   %edx
+  a1:	50                   	push   %eax
+  a2:	68 55 09 00 00       	push   $0x955
+  a7:	6a 01                	push   $0x1
+  a9:	e8 c1 04 00 00       	call   56f <printf>
+  ae:	83 c4 10             	add    $0x10,%esp
+  printf(1, "queue len hits misses evicts\n");
+  b1:	83 ec 08             	sub    $0x8,%esp
+  b4:	68 6f 09 00 00       	push   $0x96f
+  b9:	6a 01                	push   $0x1
+  bb:	e8 af 04 00 00       	call   56f <printf>
+  c0:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NBQ; i++)
+  c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  ca:	eb 47                	jmp    113 <main+0x113>
+    printf(1, "%s    %d %d %d %d\n", qname[i], st.len[i], st.hits[i],
+  cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  cf:	83 c0 04             	add    $0x4,%eax
+  d2:	8b 74 85 b8          	mov    -0x48(%ebp,%eax,4),%esi
+  d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d9:	83 c0 04             	add    $0x4,%eax
+  dc:	8b 5c 85 b0          	mov    -0x50(%ebp,%eax,4),%ebx
+  e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  e3:	8b 4c 85 b8          	mov    -0x48(%ebp,%eax,4),%ecx
+  e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  ea:	8b 54 85 b0          	mov    -0x50(%ebp,%eax,4),%edx
+  ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  f1:	8b 04 85 18 0c 00 00 	mov    0xc18(,%eax,4),%eax
+  f8:	83 ec 04             	sub    $0x4,%esp
+  fb:	56                   	push   %esi
+  fc:	53                   	push   %ebx
+  fd:	51                   	push   %ecx
+  fe:	52                   	push   %edx
+  ff:	50                   	push   %eax
+ 100:	68 8d 09 00 00       	push   $0x98d
+ 105:	6a 01                	push   $0x1
+ 107:	e8 63 04 00 00       	call   56f <printf>
+ 10c:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < NBQ; i++)
+ 10f:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 113:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+ 117:	7e b3                	jle    cc <main+0xcc>
+           st.misses[i], st.evicts[i]);
+  printf(1, "log size %d commits %d most ops %d\n", st.logsize,
+ 119:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+ 11c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 11f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 122:	83 ec 0c             	sub    $0xc,%esp
+ 125:	51                   	push   %ecx
+ 126:	52                   	push   %edx
+ 127:	50                   	push   %eax
+ 128:	68 a0 09 00 00       	push   $0x9a0
+ 12d:	6a 01                	push   $0x1
+ 12f:	e8 3b 04 00 00       	call   56f <printf>
+ 134:	83 c4 20             	add    $0x20,%esp
+         st.commits, st.maxops);
+  exit();
+ 137:	e8 57 02 00 00       	call   393 <exit>
+
+0000013c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 13c:	55                   	push   %ebp
+ 13d:	89 e5                	mov    %esp,%ebp
+ 13f:	57                   	push   %edi
+ 140:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 141:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 144:	8b 55 10             	mov    0x10(%ebp),%edx
+ 147:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14a:	89 cb                	mov    %ecx,%ebx
+ 14c:	89 df                	mov    %ebx,%edi
+ 14e:	89 d1                	mov    %edx,%ecx
+ 150:	fc                   	cld
+ 151:	f3 aa                	rep stos %al,%es:(%edi)
+ 153:	89 ca                	mov    %ecx,%edx
+ 155:	89 fb                	mov    %edi,%ebx
+ 157:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 15a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 15d:	90                   	nop
+ 15e:	5b                   	pop    %ebx
+ 15f:	5f                   	pop    %edi
+ 160:	5d                   	pop    %ebp
+ 161:	c3                   	ret
+
+00000162 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 162:	55                   	push   %ebp
+ 163:	89 e5                	mov    %esp,%ebp
+ 165:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 168:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 16e:	90                   	nop
+ 16f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 172:	8d 42 01             	lea    0x1(%edx),%eax
+ 175:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 178:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 17e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 181:	0f b6 12             	movzbl (%edx),%edx
+ 184:	88 10                	mov    %dl,(%eax)
+ 186:	0f b6 00             	movzbl (%eax),%eax
+ 189:	84 c0                	test   %al,%al
+ 18b:	75 e2                	jne    16f <strcpy+0xd>
+    ;
+  return os;
+ 18d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 190:	c9                   	leave
+ 191:	c3                   	ret
+
+00000192 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 192:	55                   	push   %ebp
+ 193:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 195:	eb 08                	jmp    19f <strcmp+0xd>
+    p++, q++;
+ 197:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 19b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a2:	0f b6 00             	movzbl (%eax),%eax
+ 1a5:	84 c0                	test   %al,%al
+ 1a7:	74 10                	je     1b9 <strcmp+0x27>
+ 1a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ac:	0f b6 10             	movzbl (%eax),%edx
+ 1af:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b2:	0f b6 00             	movzbl (%eax),%eax
+ 1b5:	38 c2                	cmp    %al,%dl
+ 1b7:	74 de                	je     197 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bc:	0f b6 00             	movzbl (%eax),%eax
+ 1bf:	0f b6 d0             	movzbl %al,%edx
+ 1c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c5:	0f b6 00             	movzbl (%eax),%eax
+ 1c8:	0f b6 c0             	movzbl %al,%eax
+ 1cb:	29 c2                	sub    %eax,%edx
+ 1cd:	89 d0                	mov    %edx,%eax
+}
+ 1cf:	5d                   	pop    %ebp
+ 1d0:	c3                   	ret
+
+000001d1 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1d1:	55                   	push   %ebp
+ 1d2:	89 e5                	mov    %esp,%ebp
+ 1d4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1de:	eb 04                	jmp    1e4 <strlen+0x13>
+ 1e0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1e4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ea:	01 d0                	add    %edx,%eax
+ 1ec:	0f b6 00             	movzbl (%eax),%eax
+ 1ef:	84 c0                	test   %al,%al
+ 1f1:	75 ed                	jne    1e0 <strlen+0xf>
+    ;
+  return n;
+ 1f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1f6:	c9                   	leave
+ 1f7:	c3                   	ret
+
+000001f8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f8:	55                   	push   %ebp
+ 1f9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1fb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1fe:	50                   	push   %eax
+ 1ff:	ff 75 0c             	push   0xc(%ebp)
+ 202:	ff 75 08             	push   0x8(%ebp)
+ 205:	e8 32 ff ff ff       	call   13c <stosb>
+ 20a:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 20d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 210:	c9                   	leave
+ 211:	c3                   	ret
+
+00000212 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 212:	55                   	push   %ebp
+ 213:	89 e5                	mov    %esp,%ebp
+ 215:	83 ec 04             	sub    $0x4,%esp
+ 218:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 21e:	eb 14                	jmp    234 <strchr+0x22>
+    if(*s == c)
+ 220:	8b 45 08             	mov    0x8(%ebp),%eax
+ 223:	0f b6 00             	movzbl (%eax),%eax
+ 226:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 229:	75 05                	jne    230 <strchr+0x1e>
+      return (char*)s;
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22e:	eb 13                	jmp    243 <strchr+0x31>
+  for(; *s; s++)
+ 230:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 234:	8b 45 08             	mov    0x8(%ebp),%eax
+ 237:	0f b6 00             	movzbl (%eax),%eax
+ 23a:	84 c0                	test   %al,%al
+ 23c:	75 e2                	jne    220 <strchr+0xe>
+  return 0;
+ 23e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+
+00000245 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 245:	55                   	push   %ebp
+ 246:	89 e5                	mov    %esp,%ebp
+ 248:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 24b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 252:	eb 42                	jmp    296 <gets+0x51>
+    cc = read(0, &c, 1);
+ 254:	83 ec 04             	sub    $0x4,%esp
+ 257:	6a 01                	push   $0x1
+ 259:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 25c:	50                   	push   %eax
+ 25d:	6a 00                	push   $0x0
+ 25f:	e8 47 01 00 00       	call   3ab <read>
+ 264:	83 c4 10             	add    $0x10,%esp
+ 267:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 26a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 26e:	7e 33                	jle    2a3 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 270:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 273:	8d 50 01             	lea    0x1(%eax),%edx
+ 276:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 279:	89 c2                	mov    %eax,%edx
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27e:	01 c2                	add    %eax,%edx
+ 280:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 284:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 286:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 28a:	3c 0a                	cmp    $0xa,%al
+ 28c:	74 16                	je     2a4 <gets+0x5f>
+ 28e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 292:	3c 0d                	cmp    $0xd,%al
+ 294:	74 0e                	je     2a4 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 296:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 299:	83 c0 01             	add    $0x1,%eax
+ 29c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 29f:	7f b3                	jg     254 <gets+0xf>
+ 2a1:	eb 01                	jmp    2a4 <gets+0x5f>
+      break;
+ 2a3:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2a4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2aa:	01 d0                	add    %edx,%eax
+ 2ac:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2b4:	55                   	push   %ebp
+ 2b5:	89 e5                	mov    %esp,%ebp
+ 2b7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2ba:	83 ec 08             	sub    $0x8,%esp
+ 2bd:	6a 00                	push   $0x0
+ 2bf:	ff 75 08             	push   0x8(%ebp)
+ 2c2:	e8 0c 01 00 00       	call   3d3 <open>
+ 2c7:	83 c4 10             	add    $0x10,%esp
+ 2ca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2cd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2d1:	79 07                	jns    2da <stat+0x26>
+    return -1;
+ 2d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2d8:	eb 25                	jmp    2ff <stat+0x4b>
+  r = fstat(fd, st);
+ 2da:	83 ec 08             	sub    $0x8,%esp
+ 2dd:	ff 75 0c             	push   0xc(%ebp)
+ 2e0:	ff 75 f4             	push   -0xc(%ebp)
+ 2e3:	e8 03 01 00 00       	call   3eb <fstat>
+ 2e8:	83 c4 10             	add    $0x10,%esp
+ 2eb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2ee:	83 ec 0c             	sub    $0xc,%esp
+ 2f1:	ff 75 f4             	push   -0xc(%ebp)
+ 2f4:	e8 c2 00 00 00       	call   3bb <close>
+ 2f9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2ff:	c9                   	leave
+ 300:	c3                   	ret
+
+00000301 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 301:	55                   	push   %ebp
+ 302:	89 e5                	mov    %esp,%ebp
+ 304:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 307:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 30e:	eb 25                	jmp    335 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 310:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 313:	89 d0                	mov    %edx,%eax
+ 315:	c1 e0 02             	shl    $0x2,%eax
+ 318:	01 d0                	add    %edx,%eax
+ 31a:	01 c0                	add    %eax,%eax
+ 31c:	89 c1                	mov    %eax,%ecx
+ 31e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 321:	8d 50 01             	lea    0x1(%eax),%edx
+ 324:	89 55 08             	mov    %edx,0x8(%ebp)
+ 327:	0f b6 00             	movzbl (%eax),%eax
+ 32a:	0f be c0             	movsbl %al,%eax
+ 32d:	01 c8                	add    %ecx,%eax
+ 32f:	83 e8 30             	sub    $0x30,%eax
+ 332:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 335:	8b 45 08             	mov    0x8(%ebp),%eax
+ 338:	0f b6 00             	movzbl (%eax),%eax
+ 33b:	3c 2f                	cmp    $0x2f,%al
+ 33d:	7e 0a                	jle    349 <atoi+0x48>
+ 33f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 342:	0f b6 00             	movzbl (%eax),%eax
+ 345:	3c 39                	cmp    $0x39,%al
+ 347:	7e c7                	jle    310 <atoi+0xf>
+  return n;
+ 349:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 34c:	c9                   	leave
+ 34d:	c3                   	ret
+
+0000034e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 34e:	55                   	push   %ebp
+ 34f:	89 e5                	mov    %esp,%ebp
+ 351:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 354:	8b 45 08             	mov    0x8(%ebp),%eax
+ 357:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 35a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 360:	eb 17                	jmp    379 <memmove+0x2b>
+    *dst++ = *src++;
+ 362:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 365:	8d 42 01             	lea    0x1(%edx),%eax
+ 368:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 36b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 36e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 371:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 374:	0f b6 12             	movzbl (%edx),%edx
+ 377:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 379:	8b 45 10             	mov    0x10(%ebp),%eax
+ 37c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 37f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 382:	85 c0                	test   %eax,%eax
+ 384:	7f dc                	jg     362 <memmove+0x14>
+  return vdst;
+ 386:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 389:	c9                   	leave
+ 38a:	c3                   	ret
+
+0000038b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <exit>:
+SYSCALL(exit)
+ 393:	b8 02 00 00 00       	mov    $0x2,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <wait>:
+SYSCALL(wait)
+ 39b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <pipe>:
+SYSCALL(pipe)
+ 3a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <read>:
+SYSCALL(read)
+ 3ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <write>:
+SYSCALL(write)
+ 3b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <close>:
+SYSCALL(close)
+ 3bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <kill>:
+SYSCALL(kill)
+ 3c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <exec>:
+SYSCALL(exec)
+ 3cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <open>:
+SYSCALL(open)
+ 3d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mknod>:
+SYSCALL(mknod)
+ 3db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <unlink>:
+SYSCALL(unlink)
+ 3e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <fstat>:
+SYSCALL(fstat)
+ 3eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <link>:
+SYSCALL(link)
+ 3f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <mkdir>:
+SYSCALL(mkdir)
+ 3fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <chdir>:
+SYSCALL(chdir)
+ 403:	b8 09 00 00 00       	mov    $0x9,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <dup>:
+SYSCALL(dup)
+ 40b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getpid>:
+SYSCALL(getpid)
+ 413:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <sbrk>:
+SYSCALL(sbrk)
+ 41b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <sleep>:
+SYSCALL(sleep)
+ 423:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <uptime>:
+SYSCALL(uptime)
+ 42b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <clone>:
+SYSCALL(clone)
+ 433:	b8 16 00 00 00       	mov    $0x16,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <join>:
+SYSCALL(join)
+ 43b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <futex_wait>:
+SYSCALL(futex_wait)
+ 443:	b8 18 00 00 00       	mov    $0x18,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <futex_wake>:
+SYSCALL(futex_wake)
+ 44b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <setaffinity>:
+SYSCALL(setaffinity)
+ 453:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <getaffinity>:
+SYSCALL(getaffinity)
+ 45b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getrusage>:
+SYSCALL(getrusage)
+ 463:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <lockstat>:
+SYSCALL(lockstat)
+ 46b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <statfs>:
+SYSCALL(statfs)
+ 473:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <bcachesize>:
+SYSCALL(bcachesize)
+ 47b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <bcstat>:
+SYSCALL(bcstat)
+ 483:	b8 20 00 00 00       	mov    $0x20,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <sync>:
+SYSCALL(sync)
+ 48b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <fsync>:
+SYSCALL(fsync)
+ 493:	b8 22 00 00 00       	mov    $0x22,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 49b:	55                   	push   %ebp
+ 49c:	89 e5                	mov    %esp,%ebp
+ 49e:	83 ec 18             	sub    $0x18,%esp
+ 4a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a4:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4a7:	83 ec 04             	sub    $0x4,%esp
+ 4aa:	6a 01                	push   $0x1
+ 4ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 4af:	50                   	push   %eax
+ 4b0:	ff 75 08             	push   0x8(%ebp)
+ 4b3:	e8 fb fe ff ff       	call   3b3 <write>
+ 4b8:	83 c4 10             	add    $0x10,%esp
+}
+ 4bb:	90                   	nop
+ 4bc:	c9                   	leave
+ 4bd:	c3                   	ret
+
+000004be <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4be:	55                   	push   %ebp
+ 4bf:	89 e5                	mov    %esp,%ebp
+ 4c1:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4c4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4cb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4cf:	74 17                	je     4e8 <printint+0x2a>
+ 4d1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4d5:	79 11                	jns    4e8 <printint+0x2a>
+    neg = 1;
+ 4d7:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4de:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4e1:	f7 d8                	neg    %eax
+ 4e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4e6:	eb 06                	jmp    4ee <printint+0x30>
+  } else {
+    x = xx;
+ 4e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 500:	f7 f1                	div    %ecx
+ 502:	89 d1                	mov    %edx,%ecx
+ 504:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 507:	8d 50 01             	lea    0x1(%eax),%edx
+ 50a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 50d:	0f b6 91 20 0c 00 00 	movzbl 0xc20(%ecx),%edx
+ 514:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 518:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 51b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 51e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 523:	f7 f1                	div    %ecx
+ 525:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 528:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 52c:	75 c7                	jne    4f5 <printint+0x37>
+  if(neg)
+ 52e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 532:	74 2d                	je     561 <printint+0xa3>
+    buf[i++] = '-';
+ 534:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 537:	8d 50 01             	lea    0x1(%eax),%edx
+ 53a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 53d:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 542:	eb 1d                	jmp    561 <printint+0xa3>
+    putc(fd, buf[i]);
+ 544:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 547:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 54a:	01 d0                	add    %edx,%eax
+ 54c:	0f b6 00             	movzbl (%eax),%eax
+ 54f:	0f be c0             	movsbl %al,%eax
+ 552:	83 ec 08             	sub    $0x8,%esp
+ 555:	50                   	push   %eax
+ 556:	ff 75 08             	push   0x8(%ebp)
+ 559:	e8 3d ff ff ff       	call   49b <putc>
+ 55e:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 561:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 565:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 569:	79 d9                	jns    544 <printint+0x86>
+}
+ 56b:	90                   	nop
+ 56c:	90                   	nop
+ 56d:	c9                   	leave
+ 56e:	c3                   	ret
+
+0000056f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 56f:	55                   	push   %ebp
+ 570:	89 e5                	mov    %esp,%ebp
+ 572:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 575:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 57c:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 57f:	83 c0 04             	add    $0x4,%eax
+ 582:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 585:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 58c:	e9 59 01 00 00       	jmp    6ea <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 591:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 594:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 597:	01 d0                	add    %edx,%eax
+ 599:	0f b6 00             	movzbl (%eax),%eax
+ 59c:	0f be c0             	movsbl %al,%eax
+ 59f:	25 ff 00 00 00       	and    $0xff,%eax
+ 5a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 5a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5ab:	75 2c                	jne    5d9 <printf+0x6a>
+      if(c == '%'){
+ 5ad:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5b1:	75 0c                	jne    5bf <printf+0x50>
+        state = '%';
+ 5b3:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5ba:	e9 27 01 00 00       	jmp    6e6 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5c2:	0f be c0             	movsbl %al,%eax
+ 5c5:	83 ec 08             	sub    $0x8,%esp
+ 5c8:	50                   	push   %eax
+ 5c9:	ff 75 08             	push   0x8(%ebp)
+ 5cc:	e8 ca fe ff ff       	call   49b <putc>
+ 5d1:	83 c4 10             	add    $0x10,%esp
+ 5d4:	e9 0d 01 00 00       	jmp    6e6 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5d9:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5dd:	0f 85 03 01 00 00    	jne    6e6 <printf+0x177>
+      if(c == 'd'){
+ 5e3:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5e7:	75 1e                	jne    607 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5e9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ec:	8b 00                	mov    (%eax),%eax
+ 5ee:	6a 01                	push   $0x1
+ 5f0:	6a 0a                	push   $0xa
+ 5f2:	50                   	push   %eax
+ 5f3:	ff 75 08             	push   0x8(%ebp)
+ 5f6:	e8 c3 fe ff ff       	call   4be <printint>
+ 5fb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5fe:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 602:	e9 d8 00 00 00       	jmp    6df <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 607:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 60b:	74 06                	je     613 <printf+0xa4>
+ 60d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 611:	75 1e                	jne    631 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 613:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 616:	8b 00                	mov    (%eax),%eax
+ 618:	6a 00                	push   $0x0
+ 61a:	6a 10                	push   $0x10
+ 61c:	50                   	push   %eax
+ 61d:	ff 75 08             	push   0x8(%ebp)
+ 620:	e8 99 fe ff ff       	call   4be <printint>
+ 625:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 628:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 62c:	e9 ae 00 00 00       	jmp    6df <printf+0x170>
+      } else if(c == 's'){
+ 631:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 635:	75 43                	jne    67a <printf+0x10b>
+        s = (char*)*ap;
+ 637:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 63a:	8b 00                	mov    (%eax),%eax
+ 63c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 63f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 643:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 647:	75 25                	jne    66e <printf+0xff>
+          s = "(null)";
+ 649:	c7 45 f4 c4 09 00 00 	movl   $0x9c4,-0xc(%ebp)
+        while(*s != 0){
+ 650:	eb 1c                	jmp    66e <printf+0xff>
+          putc(fd, *s);
+ 652:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 655:	0f b6 00             	movzbl (%eax),%eax
+ 658:	0f be c0             	movsbl %al,%eax
+ 65b:	83 ec 08             	sub    $0x8,%esp
+ 65e:	50                   	push   %eax
+ 65f:	ff 75 08             	push   0x8(%ebp)
+ 662:	e8 34 fe ff ff       	call   49b <putc>
+ 667:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 66a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 66e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 671:	0f b6 00             	movzbl (%eax),%eax
+ 674:	84 c0                	test   %al,%al
+ 676:	75 da                	jne    652 <printf+0xe3>
+ 678:	eb 65                	jmp    6df <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 67a:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 67e:	75 1d                	jne    69d <printf+0x12e>
+        putc(fd, *ap);
+ 680:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 683:	8b 00                	mov    (%eax),%eax
+ 685:	0f be c0             	movsbl %al,%eax
+ 688:	83 ec 08             	sub    $0x8,%esp
+ 68b:	50                   	push   %eax
+ 68c:	ff 75 08             	push   0x8(%ebp)
+ 68f:	e8 07 fe ff ff       	call   49b <putc>
+ 694:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 697:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 69b:	eb 42                	jmp    6df <printf+0x170>
+      } else if(c == '%'){
+ 69d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6a1:	75 17                	jne    6ba <printf+0x14b>
+        putc(fd, c);
+ 6a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6a6:	0f be c0             	movsbl %al,%eax
+ 6a9:	83 ec 08             	sub    $0x8,%esp
+ 6ac:	50                   	push   %eax
+ 6ad:	ff 75 08             	push   0x8(%ebp)
+ 6b0:	e8 e6 fd ff ff       	call   49b <putc>
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	eb 25                	jmp    6df <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6ba:	83 ec 08             	sub    $0x8,%esp
+ 6bd:	6a 25                	push   $0x25
+ 6bf:	ff 75 08             	push   0x8(%ebp)
+ 6c2:	e8 d4 fd ff ff       	call   49b <putc>
+ 6c7:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6cd:	0f be c0             	movsbl %al,%eax
+ 6d0:	83 ec 08             	sub    $0x8,%esp
+ 6d3:	50                   	push   %eax
+ 6d4:	ff 75 08             	push   0x8(%ebp)
+ 6d7:	e8 bf fd ff ff       	call   49b <putc>
+ 6dc:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6e6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6f0:	01 d0                	add    %edx,%eax
+ 6f2:	0f b6 00             	movzbl (%eax),%eax
+ 6f5:	84 c0                	test   %al,%al
+ 6f7:	0f 85 94 fe ff ff    	jne    591 <printf+0x22>
+    }
+  }
+}
+ 6fd:	90                   	nop
+ 6fe:	90                   	nop
+ 6ff:	c9                   	leave
+ 700:	c3                   	ret
+
+00000701 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 701:	55                   	push   %ebp
+ 702:	89 e5                	mov    %esp,%ebp
+ 704:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 707:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70a:	83 e8 08             	sub    $0x8,%eax
+ 70d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 710:	a1 3c 0c 00 00       	mov    0xc3c,%eax
+ 715:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 718:	eb 24                	jmp    73e <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 71a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 71d:	8b 00                	mov    (%eax),%eax
+ 71f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 722:	72 12                	jb     736 <free+0x35>
+ 724:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 727:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 72a:	72 24                	jb     750 <free+0x4f>
+ 72c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72f:	8b 00                	mov    (%eax),%eax
+ 731:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 734:	72 1a                	jb     750 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 736:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 739:	8b 00                	mov    (%eax),%eax
+ 73b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 73e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 741:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 744:	73 d4                	jae    71a <free+0x19>
+ 746:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 749:	8b 00                	mov    (%eax),%eax
+ 74b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 74e:	73 ca                	jae    71a <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 750:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 753:	8b 40 04             	mov    0x4(%eax),%eax
+ 756:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 75d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 760:	01 c2                	add    %eax,%edx
+ 762:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 765:	8b 00                	mov    (%eax),%eax
+ 767:	39 c2                	cmp    %eax,%edx
+ 769:	75 24                	jne    78f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 76b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 76e:	8b 50 04             	mov    0x4(%eax),%edx
+ 771:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 774:	8b 00                	mov    (%eax),%eax
+ 776:	8b 40 04             	mov    0x4(%eax),%eax
+ 779:	01 c2                	add    %eax,%edx
+ 77b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 77e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 781:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 784:	8b 00                	mov    (%eax),%eax
+ 786:	8b 10                	mov    (%eax),%edx
+ 788:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 78b:	89 10                	mov    %edx,(%eax)
+ 78d:	eb 0a                	jmp    799 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 78f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 792:	8b 10                	mov    (%eax),%edx
+ 794:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 797:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 799:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 79c:	8b 40 04             	mov    0x4(%eax),%eax
+ 79f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a9:	01 d0                	add    %edx,%eax
+ 7ab:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7ae:	75 20                	jne    7d0 <free+0xcf>
+    p->s.size += bp->s.size;
+ 7b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b3:	8b 50 04             	mov    0x4(%eax),%edx
+ 7b6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7b9:	8b 40 04             	mov    0x4(%eax),%eax
+ 7bc:	01 c2                	add    %eax,%edx
+ 7be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7c4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c7:	8b 10                	mov    (%eax),%edx
+ 7c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cc:	89 10                	mov    %edx,(%eax)
+ 7ce:	eb 08                	jmp    7d8 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7d6:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7db:	a3 3c 0c 00 00       	mov    %eax,0xc3c
+}
+ 7e0:	90                   	nop
+ 7e1:	c9                   	leave
+ 7e2:	c3                   	ret
+
+000007e3 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7e3:	55                   	push   %ebp
+ 7e4:	89 e5                	mov    %esp,%ebp
+ 7e6:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7e9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7f0:	77 07                	ja     7f9 <morecore+0x16>
+    nu = 4096;
+ 7f2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7fc:	c1 e0 03             	shl    $0x3,%eax
+ 7ff:	83 ec 0c             	sub    $0xc,%esp
+ 802:	50                   	push   %eax
+ 803:	e8 13 fc ff ff       	call   41b <sbrk>
+ 808:	83 c4 10             	add    $0x10,%esp
+ 80b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 80e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 812:	75 07                	jne    81b <morecore+0x38>
+    return 0;
+ 814:	b8 00 00 00 00       	mov    $0x0,%eax
+ 819:	eb 26                	jmp    841 <morecore+0x5e>
+  hp = (Header*)p;
+ 81b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 821:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 824:	8b 55 08             	mov    0x8(%ebp),%edx
+ 827:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 82a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 82d:	83 c0 08             	add    $0x8,%eax
+ 830:	83 ec 0c             	sub    $0xc,%esp
+ 833:	50                   	push   %eax
+ 834:	e8 c8 fe ff ff       	call   701 <free>
+ 839:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 83c:	a1 3c 0c 00 00       	mov    0xc3c,%eax
+}
+ 841:	c9                   	leave
+ 842:	c3                   	ret
+
+00000843 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 843:	55                   	push   %ebp
+ 844:	89 e5                	mov    %esp,%ebp
+ 846:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 849:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84c:	83 c0 07             	add    $0x7,%eax
+ 84f:	c1 e8 03             	shr    $0x3,%eax
+ 852:	83 c0 01             	add    $0x1,%eax
+ 855:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 858:	a1 3c 0c 00 00       	mov    0xc3c,%eax
+ 85d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 860:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 864:	75 23                	jne    889 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 866:	c7 45 f0 34 0c 00 00 	movl   $0xc34,-0x10(%ebp)
+ 86d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 870:	a3 3c 0c 00 00       	mov    %eax,0xc3c
+ 875:	a1 3c 0c 00 00       	mov    0xc3c,%eax
+ 87a:	a3 34 0c 00 00       	mov    %eax,0xc34
+    base.s.size = 0;
+ 87f:	c7 05 38 0c 00 00 00 	movl   $0x0,0xc38
+ 886:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 889:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88c:	8b 00                	mov    (%eax),%eax
+ 88e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 891:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 894:	8b 40 04             	mov    0x4(%eax),%eax
+ 897:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 89a:	72 4d                	jb     8e9 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 89c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89f:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a2:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 8a5:	75 0c                	jne    8b3 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 8a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8aa:	8b 10                	mov    (%eax),%edx
+ 8ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8af:	89 10                	mov    %edx,(%eax)
+ 8b1:	eb 26                	jmp    8d9 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 8b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b6:	8b 40 04             	mov    0x4(%eax),%eax
+ 8b9:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8bc:	89 c2                	mov    %eax,%edx
+ 8be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c1:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ca:	c1 e0 03             	shl    $0x3,%eax
+ 8cd:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8d6:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8dc:	a3 3c 0c 00 00       	mov    %eax,0xc3c
+      return (void*)(p + 1);
+ 8e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e4:	83 c0 08             	add    $0x8,%eax
+ 8e7:	eb 3b                	jmp    924 <malloc+0xe1>
+    }
+    if(p == freep)
+ 8e9:	a1 3c 0c 00 00       	mov    0xc3c,%eax
+ 8ee:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8f1:	75 1e                	jne    911 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	ff 75 ec             	push   -0x14(%ebp)
+ 8f9:	e8 e5 fe ff ff       	call   7e3 <morecore>
+ 8fe:	83 c4 10             	add    $0x10,%esp
+ 901:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 904:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 908:	75 07                	jne    911 <malloc+0xce>
+        return 0;
+ 90a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 90f:	eb 13                	jmp    924 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 914:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 917:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 91a:	8b 00                	mov    (%eax),%eax
+ 91c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 91f:	e9 6d ff ff ff       	jmp    891 <malloc+0x4e>
+  }
+}
+ 924:	c9                   	leave
+ 925:	c3                   	ret
@@ -0,0 +1,36 @@
+// Print buffer cache statistics for each 2Q queue, and the
+// log's.
+// With -r, also start counting again from zero.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "bcstat.h"
+
+char *qname[NBQ] = { "in", "am" };
+
+int
+main(int argc, char *argv[])
+{
+  struct bcstat st;
+  int i, reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if(argc > 2 || (argc == 2 && !reset)){
+    printf(2, "usage: bcstat [-r]\n");
+    exit();
+  }
+  if(bcstat(&st, reset) < 0){
+    printf(2, "bcstat: failed\n");
+    exit();
+  }
+
+  printf(1, "buffers %d ghost hits %d\n", st.nbuf, st.ghosthits);
+  printf(1, "queue len hits misses evicts\n");
+  for(i = 0; i < NBQ; i++)
+    printf(1, "%s    %d %d %d %d\n", qname[i], st.len[i], st.hits[i],
+           st.misses[i], st.evicts[i]);
+  printf(1, "log size %d commits %d most ops %d\n", st.logsize,
+         st.commits, st.maxops);
+  exit();
+}
@@ -0,0 +1,17 @@
+// Buffer cache statistics, kept per 2Q queue (see bio.c),
+// and log statistics (see log.c).
+#define BQ_IN  0   // Blocks cached once, oldest evicted first
+#define BQ_AM  1   // Blocks wanted again, least recently used evicted first
+#define NBQ    2
+
+struct bcstat {
+  uint nbuf;          // Buffers in the cache
+  uint len[NBQ];      // Buffers on each queue
+  uint hits[NBQ];     // Lookups that found the block on the queue
+  uint misses[NBQ];   // Blocks read into the cache onto the queue
+  uint evicts[NBQ];   // Blocks evicted from the queue
+  uint ghosthits;     // Misses on blocks evicted from BQ_IN lately
+  uint logsize;       // Blocks a transaction may log
+  uint commits;       // Transactions committed
+  uint maxops;        // Most file system calls in a transaction at once
+};
@@ -4,98 +4,449 @@
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
+//
+// The cache is made of chunks allocated with kalloc(): a page
+// of buf headers whose data are carved out of further pages.
+// It starts with a share of free memory and can be resized
+// with bresize().
+//
+// Replacement is 2Q.  A block read for the first time goes
+// on queue in, from which the oldest block is evicted.  The
+// numbers of blocks evicted from in are kept for a while in
+// a ghost list; a block read again while still a ghost goes
+// on queue am, from which the least recently used block is
+// evicted.  A sequential scan thus passes through in without
+// pushing out the hot blocks in am.
 // 
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
-// * After changing buffer data, call bwrite to write it to disk.
+// * After changing buffer data, call bwrite to write it to disk,
+//     or, for file data, bdwrite to have it written back later.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
+// * To only read a block, call breadshared instead of bread:
+//     any number of readers can hold a buffer at once.
 // 
-// The implementation uses three state flags internally:
-// * B_BUSY: the block has been returned from bread
-//     and has not been passed back to brelse.  
+// The implementation uses two state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_DELWRI: the buffer holds file data that bflush()
+//     will write back.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "mmu.h"
+#include "rusage.h"
+#include "proc.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcstat.h"
+
+#define NBHASH 257
+#define BHASH(dev, blockno) (((dev) * 31 + (blockno)) % NBHASH)
+
+// A chunk of buffers: a page holding this header and the bufs,
+// whose data are carved per to a page from other pages.
+struct bchunk {
+  struct bchunk *next;
+  int n;             // Buffers in buf[]
+  int per;           // Buffers per data page
+  struct buf buf[];
+};
+
+#define BCHUNKMAX ((PGSIZE - sizeof(struct bchunk)) / sizeof(struct buf))
+
+#define NGHOST 512  // most ghosts kept; see ghostadd()
+#define FLUSHBATCH 16  // blocks bflush() writes at once
 
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct bchunk *chunks;
+  int nbuf;          // Buffers in all chunks
+  int minbuf;        // Never shrink below this many
+  int ndelwri;       // Buffers with B_DELWRI set
+
+  // The 2Q queues, BQ_IN and BQ_AM, through prev/next.
+  // q[i].next is the newest or most recently used.
+  struct buf q[NBQ];
+
+  // Cached blocks by (dev, blockno), through hnext.
+  struct buf *hash[NBHASH];
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  // Blocks evicted from in lately, a ring; ghostnext is
+  // where the next one goes.
+  struct {
+    uint dev;
+    uint blockno;
+  } ghost[NGHOST];
+  int ghostnext;
+
+  struct bcstat st;
 } bcache;
 
+static void bput(struct buf*);
+static void bstart(struct buf*, uint, int);
+static int bbudget(void);
+static int bgrow(void);
+static void bqinit(void);
+
+// Block size of the file system.  Starts at the smallest
+// size, enough to read the super block, and is then set
+// from the super block by bsetsize().
+uint blocksize = MINBSIZE;
+
+// Called after kinit2(), so that the cache can be
+// sized from all of memory.
 void
 binit(void)
 {
-  struct buf *b;
-
-  initlock(&bcache.lock, "bcache");
+  initmcslock(&bcache.lock, "bcache");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  bqinit();
+  bcache.minbuf = NBUF;
+  while(bcache.nbuf < bbudget())
+    if(bgrow() < 0)
+      break;
+  if(bcache.nbuf < bcache.minbuf)
+    panic("binit");
+}
+
+// Empty the queues and forget the ghosts.
+static void
+bqinit(void)
+{
+  int i;
+
+  for(i = 0; i < NBQ; i++){
+    bcache.q[i].prev = bcache.q[i].next = &bcache.q[i];
+    bcache.st.len[i] = 0;
+  }
+  for(i = 0; i < NGHOST; i++)
+    bcache.ghost[i].dev = -1;
+}
+
+// Add b to queue q, as newest if first, else as oldest.
+// Caller holds bcache.lock.
+static void
+bqadd(struct buf *b, int q, int first)
+{
+  struct buf *h;
+
+  h = &bcache.q[q];
+  b->q = q;
+  if(first){
+    b->next = h->next;
+    b->prev = h;
+  } else {
+    b->next = h;
+    b->prev = h->prev;
+  }
+  b->next->prev = b;
+  b->prev->next = b;
+  bcache.st.len[q]++;
+}
+
+// Take b off its queue.  Caller holds bcache.lock.
+static void
+bqremove(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  bcache.st.len[b->q]--;
+}
+
+// Remember that block blockno of dev was evicted from in.
+static void
+ghostadd(uint dev, uint blockno)
+{
+  bcache.ghost[bcache.ghostnext].dev = dev;
+  bcache.ghost[bcache.ghostnext].blockno = blockno;
+  bcache.ghostnext = (bcache.ghostnext + 1) % NGHOST;
+}
+
+// Was block blockno of dev evicted from in lately?  Only the
+// latest nbuf/2 evictions count.  Forget it if so.
+static int
+ghostfind(uint dev, uint blockno)
+{
+  int i, n, g;
+
+  n = bcache.nbuf / 2;
+  if(n > NGHOST)
+    n = NGHOST;
+  for(i = 1; i <= n; i++){
+    g = (bcache.ghostnext - i + NGHOST) % NGHOST;
+    if(bcache.ghost[g].dev == dev && bcache.ghost[g].blockno == blockno){
+      bcache.ghost[g].dev = -1;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Number of buffers to start with: 1/BCACHEDIV of free
+// memory, but no more than the blocks a disk can have.
+static int
+bbudget(void)
+{
+  int n;
+
+  n = kfreepages() / BCACHEDIV * (PGSIZE / blocksize);
+  if(n > FSSIZE)
+    n = FSSIZE;
+  if(n < bcache.minbuf)
+    n = bcache.minbuf;
+  return n;
+}
+
+// Free the pages of chunk c, which is in no list.
+static void
+bfreechunk(struct bchunk *c)
+{
+  int i;
+
+  for(i = 0; i < c->n; i += c->per)
+    kfree((char*)c->buf[i].data);
+  kfree((char*)c);
+}
+
+// Add a chunk of buffers to the cache, as least recently
+// used.  Return 0, or -1 if out of memory.
+static int
+bgrow(void)
+{
+  struct bchunk *c;
+  struct buf *b;
+  char *page;
+  int i;
+
+  if((c = (struct bchunk*)kalloc()) == 0)
+    return -1;
+  c->per = PGSIZE / blocksize;
+  c->n = 0;
+  page = 0;
+  for(i = 0; i < BCHUNKMAX / c->per * c->per; i++){
+    if(i % c->per == 0 && (page = kalloc()) == 0){
+      bfreechunk(c);
+      return -1;
+    }
+    b = &c->buf[i];
+    b->data = (uchar*)page + (i % c->per) * blocksize;
+    b->flags = 0;
     b->dev = -1;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->blockno = 0;
+    b->refcnt = 0;
+    b->gen = 0;
+    b->hnext = 0;
+    initsleeplock(&b->lock, "buffer");
+    c->n++;
   }
+
+  acquire(&bcache.lock);
+  for(i = 0; i < c->n; i++)
+    bqadd(&c->buf[i], BQ_IN, 0);  // empty, so evict first
+  c->next = bcache.chunks;
+  bcache.chunks = c;
+  bcache.nbuf += c->n;
+  release(&bcache.lock);
+  return 0;
+}
+
+// Take b out of its hash chain.  Caller holds bcache.lock.
+static void
+bunhash(struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bcache.hash[BHASH(b->dev, b->blockno)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == b){
+      *pp = b->hnext;
+      return;
+    }
+  }
+}
+
+// Take an idle chunk out of the cache and free it, if at
+// least n buffers are left.  Return 0, or -1 if there is no
+// such chunk.
+static int
+bshrink(int n)
+{
+  struct bchunk *c, **pp;
+  struct buf *b;
+  int i;
+
+  acquire(&bcache.lock);
+  for(pp = &bcache.chunks; (c = *pp) != 0; pp = &c->next){
+    if(bcache.nbuf - c->n < n)
+      continue;
+    for(i = 0; i < c->n; i++)
+      if(c->buf[i].refcnt != 0 || (c->buf[i].flags & (B_DIRTY|B_DELWRI)))
+        break;
+    if(i == c->n)
+      break;
+  }
+  if(c == 0){
+    release(&bcache.lock);
+    return -1;
+  }
+  *pp = c->next;
+  bcache.nbuf -= c->n;
+  for(i = 0; i < c->n; i++){
+    b = &c->buf[i];
+    bunhash(b);
+    b->gen++;
+    bqremove(b);
+  }
+  release(&bcache.lock);
+
+  // bpeek() readers may still be looking at c.
+  rcuwait(rcustart());
+  bfreechunk(c);
+  return 0;
+}
+
+// Resize the cache to about n buffers, no fewer than it
+// needs, and return the number it has.  Buffers that are
+// in use or dirty stay.  If n <= 0, just return the number.
+int
+bresize(int n)
+{
+  if(n <= 0)
+    return bcache.nbuf;
+  if(n < bcache.minbuf)
+    n = bcache.minbuf;
+  while(bcache.nbuf < n)
+    if(bgrow() < 0)
+      break;
+  while(bcache.nbuf > n)
+    if(bshrink(n) < 0)
+      break;
+  return bcache.nbuf;
+}
+
+// Keep at least n more buffers than the cache needs
+// already.  The log calls this for the blocks it pins.
+void
+breserve(int n)
+{
+  bcache.minbuf += n;
+  if(bresize(bcache.nbuf) < bcache.minbuf)
+    panic("breserve");
+}
+
+// Find the buffer for block blockno of dev, or return 0.
+// Caller holds bcache.lock.
+static struct buf*
+blookup(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bcache.hash[BHASH(dev, blockno)]; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Return the oldest unused and clean buffer on queue q, or 0.
+// "clean" because B_DIRTY and not in use means log.c hasn't
+// yet committed the changes to the buffer, and B_DELWRI
+// means bflush() hasn't yet written it back.
+static struct buf*
+bvictim(int q)
+{
+  struct buf *b;
+
+  for(b = bcache.q[q].prev; b != &bcache.q[q]; b = b->prev)
+    if(b->refcnt == 0 && (b->flags & (B_DIRTY|B_DELWRI)) == 0)
+      return b;
+  return 0;
+}
+
+// Recycle some unused and clean buffer for block blockno of
+// dev, or return 0.  Evict from in while it holds more than
+// a quarter of the cache, else from am.  Caller holds
+// bcache.lock.
+static struct buf*
+brecycle(uint dev, uint blockno)
+{
+  struct buf *b;
+  int q;
+
+  q = bcache.st.len[BQ_IN] > bcache.nbuf/4 ? BQ_IN : BQ_AM;
+  if((b = bvictim(q)) == 0 && (b = bvictim(!q)) == 0)
+    return 0;
+  if(b->dev != -1){
+    bcache.st.evicts[b->q]++;
+    if(b->q == BQ_IN)
+      ghostadd(b->dev, b->blockno);
+  }
+  b->gen++;
+  __sync_synchronize();
+  bunhash(b);
+  bqremove(b);
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->hnext = bcache.hash[BHASH(dev, blockno)];
+  bcache.hash[BHASH(dev, blockno)] = b;
+  if(ghostfind(dev, blockno)){
+    bcache.st.ghosthits++;
+    q = BQ_AM;
+  } else
+    q = BQ_IN;
+  bqadd(b, q, 1);
+  bcache.st.misses[q]++;
+  return b;
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
-// In either case, return B_BUSY buffer.
+// In either case, return the buffer, referenced but not
+// locked.
 static struct buf*
-bget(uint dev, uint blockno)
+bref(uint dev, uint blockno)
 {
   struct buf *b;
 
   acquire(&bcache.lock);
 
- loop:
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      if(!(b->flags & B_BUSY)){
-        b->flags |= B_BUSY;
-        release(&bcache.lock);
-        return b;
-      }
-      sleep(b, &bcache.lock);
-      goto loop;
-    }
+  if((b = blookup(dev, blockno)) != 0){
+    bcache.st.hits[b->q]++;
+    b->refcnt++;
+    release(&bcache.lock);
+    return b;
   }
 
-  // Not cached; recycle some non-busy and clean buffer.
-  // "clean" because B_DIRTY and !B_BUSY means log.c
-  // hasn't yet committed the changes to the buffer.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if((b->flags & B_BUSY) == 0 && (b->flags & B_DIRTY) == 0){
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = B_BUSY;
-      release(&bcache.lock);
-      return b;
-    }
-  }
-  panic("bget: no buffers");
+  if((b = brecycle(dev, blockno)) == 0)
+    panic("bget: no buffers");
+  release(&bcache.lock);
+  return b;
 }
 
-// Return a B_BUSY buf with the contents of the indicated block.
+// Return the locked buffer for block blockno of dev.  Its
+// contents are only valid if B_VALID is set; callers that
+// will overwrite the whole block can skip reading it.
+struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bref(dev, blockno);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Return a locked buf with the contents of the indicated block.
 struct buf*
 bread(uint dev, uint blockno)
 {
@@ -103,41 +454,373 @@ bread(uint dev, uint blockno)
 
   b = bget(dev, blockno);
   if(!(b->flags & B_VALID)) {
-    iderw(b);
+    bsubmit(b, 0);
+    bwait(&b, 1);
   }
   return b;
 }
 
-// Write b's contents to disk.  Must be B_BUSY.
+// Return a buf with the contents of the indicated block,
+// held shared: other readers may hold it at the same time,
+// so the caller must not change it or start I/O on it.
+// Release it with brelse().
+struct buf*
+breadshared(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bref(dev, blockno);
+  for(;;){
+    acquiresleepshared(&b->lock);
+    if(b->flags & B_VALID)
+      return b;
+    // Read it holding it exclusively, then try again.
+    releasesleep(&b->lock);
+    acquiresleep(&b->lock);
+    if(!(b->flags & B_VALID)){
+      bsubmit(b, 0);
+      bwait(&b, 1);
+    }
+    releasesleep(&b->lock);
+  }
+}
+
+// Start reading (write == 0) or writing b, which the caller
+// has locked, and return without waiting.  Before using or
+// releasing b the caller must bwait() for it.  Submitting
+// several buffers before waiting keeps the disk busy.
+void
+bsubmit(struct buf *b, int write)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bsubmit");
+  if(write)
+    b->flags |= B_DIRTY;
+  else if(b->flags & B_VALID)
+    return;  // nothing to read
+  bstart(b, b->blockno, write);
+}
+
+// Start writing the contents of b, which the caller has
+// locked, to block blockno of b's device rather than to b's
+// own block, and return without waiting, like bsubmit().
+// b stays in the cache as its own block.  The log uses this
+// to write cached blocks straight into the log.
+void
+bsubmitat(struct buf *b, uint blockno)
+{
+  if(!holdingsleep(&b->lock) || !(b->flags & B_VALID))
+    panic("bsubmitat");
+  b->flags |= B_DIRTY;
+  bstart(b, blockno, 1);
+}
+
+// Hand b to the disk driver for block blockno.  Reads are
+// charged to the process doing them.  Most writes are done by
+// the flusher, so bdwrite() and log_write() charge them to
+// the process that dirtied the block instead.
+static void
+bstart(struct buf *b, uint blockno, int write)
+{
+  b->ioblockno = blockno;
+  idesubmit(b);
+  if(proc && !write)
+    proc->ru.inblock++;
+}
+
+// Wait for all n buffers in v, started by bsubmit(), to finish.
+void
+bwait(struct buf **v, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    ideawait(v[i]);
+}
+
+// Wait for any of the n buffers in v, started by bsubmit(),
+// to finish, and return its index.  Buffers that have already
+// finished count, so the caller should take them out of v.
+int
+bwaitany(struct buf **v, int n)
+{
+  return ideawaitany(v, n);
+}
+
+// Start reading block blockno of dev into the cache, unless
+// it is there already, and return without waiting.  The disk
+// driver unlocks and releases the buffer when the read is
+// done, through bdone().  Does nothing if there is no free
+// buffer: read-ahead is only a hint.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  acquire(&bcache.lock);
+  if(blookup(dev, blockno)){
+    release(&bcache.lock);
+    return;
+  }
+  b = brecycle(dev, blockno);
+  release(&bcache.lock);
+  if(b == 0)
+    return;
+  // A bread() of the same block may find b and read it
+  // before we lock it; then there is nothing to do.
+  acquiresleep(&b->lock);
+  if(b->flags & B_VALID){
+    brelse(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  bsubmit(b, 0);
+}
+
+// Return the cached buffer for block blockno of device dev
+// if its contents are valid, or 0, without locking it, for
+// lock-free readers (see namerc in fs.c).  The buffer may be
+// reused for another block at any time; set *gen so that the
+// caller can check with bpeekok() after reading b->data.
+struct buf*
+bpeek(uint dev, uint blockno, uint *gen)
+{
+  struct buf *b;
+  int n;
+
+  // The chain can change under us, so give up after
+  // nbuf steps rather than risk following a cycle.
+  b = bcache.hash[BHASH(dev, blockno)];
+  for(n = 0; b && n < bcache.nbuf; b = b->hnext, n++){
+    *gen = b->gen;
+    __sync_synchronize();
+    if(b->dev == dev && b->blockno == blockno && (b->flags & B_VALID))
+      return b;
+  }
+  return 0;
+}
+
+// Does b still hold the block bpeek() found, as of *gen?
+int
+bpeekok(struct buf *b, uint gen)
+{
+  __sync_synchronize();
+  return b->gen == gen;
+}
+
+// Set the block size to size.  Called once the super block
+// has been read and before any other block is used.  Blocks
+// cached so far were read at the old size, so forget them,
+// and carve the cache again for the new size.
+void
+bsetsize(uint size)
+{
+  struct bchunk *c, *next;
+  int i;
+
+  if(size < MINBSIZE || size > MAXBSIZE || (size & (size-1)))
+    panic("bsetsize");
+  acquire(&bcache.lock);
+  for(c = bcache.chunks; c; c = c->next)
+    for(i = 0; i < c->n; i++)
+      if(c->buf[i].refcnt != 0 || (c->buf[i].flags & (B_DIRTY|B_DELWRI)))
+        panic("bsetsize: busy");
+  c = bcache.chunks;
+  bcache.chunks = 0;
+  bcache.nbuf = 0;
+  bqinit();
+  memset(bcache.hash, 0, sizeof(bcache.hash));
+  blocksize = size;
+  release(&bcache.lock);
+
+  // No one can be looking at the old chunks yet.
+  for(; c; c = next){
+    next = c->next;
+    bfreechunk(c);
+  }
+  bresize(bbudget());
+  if(bcache.nbuf < bcache.minbuf)
+    panic("bsetsize: no memory");
+}
+
+// Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
 {
-  if((b->flags & B_BUSY) == 0)
+  if(!holdingsleep(&b->lock))
     panic("bwrite");
+  bsubmit(b, 1);
+  bwait(&b, 1);
+}
+
+// Mark b, which the caller has locked and changed, to be
+// written back later by bflush(), and release it.  Repeated
+// changes to a block thus cost one write.  If half of the
+// cache is waiting to be written back already, write b now.
+void
+bdwrite(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bdwrite");
+  b->flags |= B_VALID;  // the caller may have filled a new buffer
+  if(!(b->flags & B_DELWRI))
+    proc->ru.oublock++;  // b will be written once more
+  acquire(&bcache.lock);
+  if(bcache.ndelwri >= bcache.nbuf/2 && !(b->flags & B_DELWRI)){
+    release(&bcache.lock);
+    bwrite(b);
+    brelse(b);
+    return;
+  }
+  if(!(b->flags & B_DELWRI)){
+    b->flags |= B_DELWRI;
+    b->dirtied = ticks;
+    bcache.ndelwri++;
+  }
+  release(&bcache.lock);
+  brelse(b);
+}
+
+// b, which the caller has locked, now belongs to the log:
+// pin it in the cache until the log writes it, and stop
+// treating it as file data to write back.
+void
+blogged(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("blogged");
+  acquire(&bcache.lock);
+  if(b->flags & B_DELWRI){
+    b->flags &= ~B_DELWRI;
+    bcache.ndelwri--;
+  }
   b->flags |= B_DIRTY;
-  iderw(b);
+  release(&bcache.lock);
+}
+
+// Should bflush() write b back?  All of them if all, else
+// those dirtied FLUSHTICKS*2 ticks ago, or any while more
+// than a quarter of the cache is dirty.  Caller holds
+// bcache.lock.
+static int
+bflushable(struct buf *b, int all)
+{
+  if(!(b->flags & B_DELWRI))
+    return 0;
+  return all || ticks - b->dirtied >= FLUSHTICKS*2 ||
+    bcache.ndelwri > bcache.nbuf/4;
+}
+
+// Write back file data marked by bdwrite(), FLUSHBATCH
+// blocks at a time in block order, and wait for it: all of
+// it if all, else as bflushable() says.  The log flusher
+// calls this; commit() calls it with all set so that file
+// data reaches the disk before the commit that refers to it.
+void
+bflush(int all)
+{
+  struct buf *v[FLUSHBATCH], *b;
+  struct bchunk *c;
+  int i, j, n, w;
+
+  do {
+    // Take a reference to a batch of candidates.
+    n = 0;
+    acquire(&bcache.lock);
+    for(c = bcache.chunks; c && n < FLUSHBATCH; c = c->next){
+      for(i = 0; i < c->n && n < FLUSHBATCH; i++){
+        b = &c->buf[i];
+        if(bflushable(b, all)){
+          b->refcnt++;
+          v[n++] = b;
+        }
+      }
+    }
+    release(&bcache.lock);
+
+    // Sort by block number, so the disk sweeps once.
+    for(i = 1; i < n; i++){
+      b = v[i];
+      for(j = i; j > 0 && v[j-1]->blockno > b->blockno; j--)
+        v[j] = v[j-1];
+      v[j] = b;
+    }
+
+    // Lock each and start writing those still dirty.
+    w = 0;
+    for(i = 0; i < n; i++){
+      b = v[i];
+      acquiresleep(&b->lock);
+      acquire(&bcache.lock);
+      if(b->flags & B_DELWRI){
+        b->flags &= ~B_DELWRI;
+        bcache.ndelwri--;
+        release(&bcache.lock);
+        bsubmit(b, 1);
+        v[w++] = b;
+      } else {
+        release(&bcache.lock);
+        brelse(b);
+      }
+    }
+    bwait(v, w);
+    for(i = 0; i < w; i++)
+      brelse(v[i]);
+  } while(n == FLUSHBATCH);
 }
 
-// Release a B_BUSY buffer.
-// Move to the head of the MRU list.
+// Release a locked buffer, held exclusively or shared.
 void
 brelse(struct buf *b)
 {
-  if((b->flags & B_BUSY) == 0)
+  if(!holdingsleep(&b->lock) && !holdingsleepshared(&b->lock))
     panic("brelse");
 
-  acquire(&bcache.lock);
+  releasesleep(&b->lock);
+  bput(b);
+}
 
-  b->next->prev = b->prev;
-  b->prev->next = b->next;
-  b->next = bcache.head.next;
-  b->prev = &bcache.head;
-  bcache.head.next->prev = b;
-  bcache.head.next = b;
+// Finish an asynchronous read started by breadahead().
+// Called by the disk driver, perhaps from an interrupt,
+// so it cannot check who holds b.
+void
+bdone(struct buf *b)
+{
+  releasesleep(&b->lock);
+  bput(b);
+}
+
+// Drop a reference to b, which has been unlocked.  If it is
+// unused and on am, make it the most recently used there;
+// in is kept in the order blocks were read.
+static void
+bput(struct buf *b)
+{
+  acquire(&bcache.lock);
+  b->refcnt--;
+  if(b->refcnt == 0 && b->q == BQ_AM){
+    // no one is waiting for it.
+    bqremove(b);
+    bqadd(b, BQ_AM, 1);
+  }
+  release(&bcache.lock);
+}
 
-  b->flags &= ~B_BUSY;
-  wakeup(b);
+// Copy the cache statistics to st and, if reset, start
+// counting again from zero.
+void
+bstat(struct bcstat *st, int reset)
+{
+  int i;
 
+  acquire(&bcache.lock);
+  bcache.st.nbuf = bcache.nbuf;
+  *st = bcache.st;
+  if(reset){
+    for(i = 0; i < NBQ; i++)
+      bcache.st.hits[i] = bcache.st.misses[i] = bcache.st.evicts[i] = 0;
+    bcache.st.ghosthits = 0;
+  }
   release(&bcache.lock);
 }
 //PAGEBREAK!
@@ -2,12 +2,20 @@ struct buf {
   int flags;
   uint dev;
   uint blockno;
+  uint ioblockno; // block the disk request is for (see bsubmitat)
+  struct sleeplock lock;
+  uint refcnt;
+  volatile uint gen; // Bumped when reused for another block (see bpeek)
   struct buf *prev; // LRU cache list
   struct buf *next;
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  struct buf *hnext; // hash chain (see blookup)
+  int q;             // 2Q queue it is on (see bio.c)
+  uint dirtied;      // ticks when B_DELWRI was set
+  uchar *data;       // blocksize bytes, in a page of the cache
 };
-#define B_BUSY  0x1  // buffer is locked by some process
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // read ahead: disk driver unlocks buffer when done
+#define B_DELWRI 0x10  // file data to write back later (see bdwrite)
 
@@ -7,10 +7,12 @@
 #include "param.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "x86.h"
 
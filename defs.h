@@ -1,19 +1,42 @@
+struct bcstat;
 struct buf;
 struct context;
 struct file;
 struct inode;
+struct lockstat;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct rusage;
+struct sleeplock;
 struct spinlock;
 struct stat;
+struct statfs;
 struct superblock;
 
 // bio.c
 void            binit(void);
+struct buf*     bget(uint, uint);
 struct buf*     bread(uint, uint);
+struct buf*     breadshared(uint, uint);
 void            brelse(struct buf*);
+struct buf*     bpeek(uint, uint, uint*);
+int             bpeekok(struct buf*, uint);
+void            bsetsize(uint);
+int             bresize(int);
+void            breserve(int);
+void            bstat(struct bcstat*, int);
+void            bdwrite(struct buf*);
+void            blogged(struct buf*);
+void            bflush(int);
+void            breadahead(uint, uint);
+void            bdone(struct buf*);
+void            bsubmit(struct buf*, int);
+void            bsubmitat(struct buf*, uint);
+void            bwait(struct buf**, int);
+int             bwaitany(struct buf**, int);
 void            bwrite(struct buf*);
+extern uint     blocksize;
 
 // console.c
 void            consoleinit(void);
@@ -37,7 +60,12 @@ int             filewrite(struct file*, char*, int n);
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
-struct inode*   ialloc(uint, short);
+void            dcacheinval(struct inode*, char*);
+void            fsstat(uint, struct statfs*);
+void            bfreecommitted(void);
+int             bfreeheld(int);
+int             iputblocks(void);
+struct inode*   ialloc(uint, short, uint);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
@@ -45,6 +73,7 @@ void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
+void            ireadahead(struct inode*, uint, uint);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
@@ -55,7 +84,9 @@ int             writei(struct inode*, char*, uint, uint);
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
-void            iderw(struct buf*);
+void            idesubmit(struct buf*);
+void            ideawait(struct buf*);
+int             ideawaitany(struct buf**, int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -67,6 +98,7 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             kfreepages(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -77,6 +109,7 @@ int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(uchar, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -84,7 +117,10 @@ void            microdelay(int);
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
+void            begin_opn(int);
 void            end_op();
+void            log_sync(void);
+void            logstat(struct bcstat*, int);
 
 // mp.c
 extern int      ismp;
@@ -104,17 +140,27 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(void(*)(void*), void*, void*);
 struct proc*    copyproc(struct proc*);
+void            endsyscall(void);
 void            exit(void);
 int             fork(void);
+int             futexwait(uint*, uint);
+int             futexwake(uint*, int);
+int             getaffinity(int);
+int             getrusage(int, struct rusage*);
 int             growproc(int);
+int             join(void**);
 int             kill(int);
 void            pinit(void);
 void            procdump(void);
+void            putvm(pde_t*);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setaffinity(int, uint);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
+void            kproc(char*, void(*)(void));
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
@@ -122,11 +168,29 @@ void            yield(void);
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// rcu.c
+void            rcuinit(void);
+int             rcudone(uint);
+void            rcuquiescent(void);
+uint            rcustart(void);
+void            rcuwait(uint);
+
+// sleeplock.c
+void            acquiresleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+void            releasesleep(struct sleeplock*);
+int             holdingsleep(struct sleeplock*);
+int             holdingsleepshared(struct sleeplock*);
+void            initsleeplock(struct sleeplock*, char*);
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            initmcslock(struct spinlock*, char*);
+int             lockstat(struct lockstat*, int, int);
+void            lockstatsleep(struct spinlock*);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
@@ -173,6 +237,7 @@ int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
+void            unmapuvm(pde_t*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
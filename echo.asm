@@ -0,0 +1,1195 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 4f 08 00 00       	mov    $0x84f,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 51 08 00 00       	mov    $0x851,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 53 08 00 00       	push   $0x853
+  4b:	6a 01                	push   $0x1
+  4d:	e8 46 04 00 00       	call   498 <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 57 02 00 00       	call   2bc <exit>
+
+00000065 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+    ;
+  return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  be:	eb 08                	jmp    c8 <strcmp+0xd>
+    p++, q++;
+  c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  cb:	0f b6 00             	movzbl (%eax),%eax
+  ce:	84 c0                	test   %al,%al
+  d0:	74 10                	je     e2 <strcmp+0x27>
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	0f b6 10             	movzbl (%eax),%edx
+  d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	38 c2                	cmp    %al,%dl
+  e0:	74 de                	je     c0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	0f b6 d0             	movzbl %al,%edx
+  eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 c0             	movzbl %al,%eax
+  f4:	29 c2                	sub    %eax,%edx
+  f6:	89 d0                	mov    %edx,%eax
+}
+  f8:	5d                   	pop    %ebp
+  f9:	c3                   	ret
+
+000000fa <strlen>:
+
+uint
+strlen(char *s)
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 107:	eb 04                	jmp    10d <strlen+0x13>
+ 109:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	01 d0                	add    %edx,%eax
+ 115:	0f b6 00             	movzbl (%eax),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	75 ed                	jne    109 <strlen+0xf>
+    ;
+  return n;
+ 11c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 124:	8b 45 10             	mov    0x10(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	ff 75 0c             	push   0xc(%ebp)
+ 12b:	ff 75 08             	push   0x8(%ebp)
+ 12e:	e8 32 ff ff ff       	call   65 <stosb>
+ 133:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 136:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 144:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 147:	eb 14                	jmp    15d <strchr+0x22>
+    if(*s == c)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 152:	75 05                	jne    159 <strchr+0x1e>
+      return (char*)s;
+ 154:	8b 45 08             	mov    0x8(%ebp),%eax
+ 157:	eb 13                	jmp    16c <strchr+0x31>
+  for(; *s; s++)
+ 159:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 e2                	jne    149 <strchr+0xe>
+  return 0;
+ 167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+0000016e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 174:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17b:	eb 42                	jmp    1bf <gets+0x51>
+    cc = read(0, &c, 1);
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	6a 01                	push   $0x1
+ 182:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 185:	50                   	push   %eax
+ 186:	6a 00                	push   $0x0
+ 188:	e8 47 01 00 00       	call   2d4 <read>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 193:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 197:	7e 33                	jle    1cc <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19c:	8d 50 01             	lea    0x1(%eax),%edx
+ 19f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a2:	89 c2                	mov    %eax,%edx
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	01 c2                	add    %eax,%edx
+ 1a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ad:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1af:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 16                	je     1cd <gets+0x5f>
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	74 0e                	je     1cd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1c8:	7f b3                	jg     17d <gets+0xf>
+ 1ca:	eb 01                	jmp    1cd <gets+0x5f>
+      break;
+ 1cc:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	01 d0                	add    %edx,%eax
+ 1d5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	ff 75 08             	push   0x8(%ebp)
+ 1eb:	e8 0c 01 00 00       	call   2fc <open>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1fa:	79 07                	jns    203 <stat+0x26>
+    return -1;
+ 1fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 201:	eb 25                	jmp    228 <stat+0x4b>
+  r = fstat(fd, st);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	ff 75 0c             	push   0xc(%ebp)
+ 209:	ff 75 f4             	push   -0xc(%ebp)
+ 20c:	e8 03 01 00 00       	call   314 <fstat>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+ 21a:	ff 75 f4             	push   -0xc(%ebp)
+ 21d:	e8 c2 00 00 00       	call   2e4 <close>
+ 222:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 230:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 237:	eb 25                	jmp    25e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 239:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23c:	89 d0                	mov    %edx,%eax
+ 23e:	c1 e0 02             	shl    $0x2,%eax
+ 241:	01 d0                	add    %edx,%eax
+ 243:	01 c0                	add    %eax,%eax
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f be c0             	movsbl %al,%eax
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	83 e8 30             	sub    $0x30,%eax
+ 25b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 25e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	3c 2f                	cmp    $0x2f,%al
+ 266:	7e 0a                	jle    272 <atoi+0x48>
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	3c 39                	cmp    $0x39,%al
+ 270:	7e c7                	jle    239 <atoi+0xf>
+  return n;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 280:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 283:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 286:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 289:	eb 17                	jmp    2a2 <memmove+0x2b>
+    *dst++ = *src++;
+ 28b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 28e:	8d 42 01             	lea    0x1(%edx),%eax
+ 291:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 297:	8d 48 01             	lea    0x1(%eax),%ecx
+ 29a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 29d:	0f b6 12             	movzbl (%edx),%edx
+ 2a0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2a2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a5:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2a8:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	7f dc                	jg     28b <memmove+0x14>
+  return vdst;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <exit>:
+SYSCALL(exit)
+ 2bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <wait>:
+SYSCALL(wait)
+ 2c4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <pipe>:
+SYSCALL(pipe)
+ 2cc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <read>:
+SYSCALL(read)
+ 2d4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <write>:
+SYSCALL(write)
+ 2dc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <close>:
+SYSCALL(close)
+ 2e4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <kill>:
+SYSCALL(kill)
+ 2ec:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <exec>:
+SYSCALL(exec)
+ 2f4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <open>:
+SYSCALL(open)
+ 2fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <mknod>:
+SYSCALL(mknod)
+ 304:	b8 11 00 00 00       	mov    $0x11,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <unlink>:
+SYSCALL(unlink)
+ 30c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <fstat>:
+SYSCALL(fstat)
+ 314:	b8 08 00 00 00       	mov    $0x8,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <link>:
+SYSCALL(link)
+ 31c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <mkdir>:
+SYSCALL(mkdir)
+ 324:	b8 14 00 00 00       	mov    $0x14,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <chdir>:
+SYSCALL(chdir)
+ 32c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <dup>:
+SYSCALL(dup)
+ 334:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <getpid>:
+SYSCALL(getpid)
+ 33c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <sbrk>:
+SYSCALL(sbrk)
+ 344:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <sleep>:
+SYSCALL(sleep)
+ 34c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <uptime>:
+SYSCALL(uptime)
+ 354:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <clone>:
+SYSCALL(clone)
+ 35c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <join>:
+SYSCALL(join)
+ 364:	b8 17 00 00 00       	mov    $0x17,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <futex_wait>:
+SYSCALL(futex_wait)
+ 36c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <futex_wake>:
+SYSCALL(futex_wake)
+ 374:	b8 19 00 00 00       	mov    $0x19,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <setaffinity>:
+SYSCALL(setaffinity)
+ 37c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <getaffinity>:
+SYSCALL(getaffinity)
+ 384:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <getrusage>:
+SYSCALL(getrusage)
+ 38c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <lockstat>:
+SYSCALL(lockstat)
+ 394:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <statfs>:
+SYSCALL(statfs)
+ 39c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <bcachesize>:
+SYSCALL(bcachesize)
+ 3a4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <bcstat>:
+SYSCALL(bcstat)
+ 3ac:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <sync>:
+SYSCALL(sync)
+ 3b4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <fsync>:
+SYSCALL(fsync)
+ 3bc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3c4:	55                   	push   %ebp
+ 3c5:	89 e5                	mov    %esp,%ebp
+ 3c7:	83 ec 18             	sub    $0x18,%esp
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	6a 01                	push   $0x1
+ 3d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 3d8:	50                   	push   %eax
+ 3d9:	ff 75 08             	push   0x8(%ebp)
+ 3dc:	e8 fb fe ff ff       	call   2dc <write>
+ 3e1:	83 c4 10             	add    $0x10,%esp
+}
+ 3e4:	90                   	nop
+ 3e5:	c9                   	leave
+ 3e6:	c3                   	ret
+
+000003e7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3e7:	55                   	push   %ebp
+ 3e8:	89 e5                	mov    %esp,%ebp
+ 3ea:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 3ed:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 3f4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 3f8:	74 17                	je     411 <printint+0x2a>
+ 3fa:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 3fe:	79 11                	jns    411 <printint+0x2a>
+    neg = 1;
+ 400:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 407:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40a:	f7 d8                	neg    %eax
+ 40c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 40f:	eb 06                	jmp    417 <printint+0x30>
+  } else {
+    x = xx;
+ 411:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 414:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 417:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 41e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 421:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 424:	ba 00 00 00 00       	mov    $0x0,%edx
+ 429:	f7 f1                	div    %ecx
+ 42b:	89 d1                	mov    %edx,%ecx
+ 42d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 430:	8d 50 01             	lea    0x1(%eax),%edx
+ 433:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 436:	0f b6 91 a8 0a 00 00 	movzbl 0xaa8(%ecx),%edx
+ 43d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 441:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 444:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 447:	ba 00 00 00 00       	mov    $0x0,%edx
+ 44c:	f7 f1                	div    %ecx
+ 44e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 451:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 455:	75 c7                	jne    41e <printint+0x37>
+  if(neg)
+ 457:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 45b:	74 2d                	je     48a <printint+0xa3>
+    buf[i++] = '-';
+ 45d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 460:	8d 50 01             	lea    0x1(%eax),%edx
+ 463:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 466:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 46b:	eb 1d                	jmp    48a <printint+0xa3>
+    putc(fd, buf[i]);
+ 46d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 470:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 473:	01 d0                	add    %edx,%eax
+ 475:	0f b6 00             	movzbl (%eax),%eax
+ 478:	0f be c0             	movsbl %al,%eax
+ 47b:	83 ec 08             	sub    $0x8,%esp
+ 47e:	50                   	push   %eax
+ 47f:	ff 75 08             	push   0x8(%ebp)
+ 482:	e8 3d ff ff ff       	call   3c4 <putc>
+ 487:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 48a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 48e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 492:	79 d9                	jns    46d <printint+0x86>
+}
+ 494:	90                   	nop
+ 495:	90                   	nop
+ 496:	c9                   	leave
+ 497:	c3                   	ret
+
+00000498 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 498:	55                   	push   %ebp
+ 499:	89 e5                	mov    %esp,%ebp
+ 49b:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 49e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 4a5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 4a8:	83 c0 04             	add    $0x4,%eax
+ 4ab:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 4ae:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 4b5:	e9 59 01 00 00       	jmp    613 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 4ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4c0:	01 d0                	add    %edx,%eax
+ 4c2:	0f b6 00             	movzbl (%eax),%eax
+ 4c5:	0f be c0             	movsbl %al,%eax
+ 4c8:	25 ff 00 00 00       	and    $0xff,%eax
+ 4cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4d4:	75 2c                	jne    502 <printf+0x6a>
+      if(c == '%'){
+ 4d6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4da:	75 0c                	jne    4e8 <printf+0x50>
+        state = '%';
+ 4dc:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 4e3:	e9 27 01 00 00       	jmp    60f <printf+0x177>
+      } else {
+        putc(fd, c);
+ 4e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4eb:	0f be c0             	movsbl %al,%eax
+ 4ee:	83 ec 08             	sub    $0x8,%esp
+ 4f1:	50                   	push   %eax
+ 4f2:	ff 75 08             	push   0x8(%ebp)
+ 4f5:	e8 ca fe ff ff       	call   3c4 <putc>
+ 4fa:	83 c4 10             	add    $0x10,%esp
+ 4fd:	e9 0d 01 00 00       	jmp    60f <printf+0x177>
+      }
+    } else if(state == '%'){
+ 502:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 506:	0f 85 03 01 00 00    	jne    60f <printf+0x177>
+      if(c == 'd'){
+ 50c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 510:	75 1e                	jne    530 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 512:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 515:	8b 00                	mov    (%eax),%eax
+ 517:	6a 01                	push   $0x1
+ 519:	6a 0a                	push   $0xa
+ 51b:	50                   	push   %eax
+ 51c:	ff 75 08             	push   0x8(%ebp)
+ 51f:	e8 c3 fe ff ff       	call   3e7 <printint>
+ 524:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 527:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 52b:	e9 d8 00 00 00       	jmp    608 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 530:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 534:	74 06                	je     53c <printf+0xa4>
+ 536:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 53a:	75 1e                	jne    55a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 53c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 53f:	8b 00                	mov    (%eax),%eax
+ 541:	6a 00                	push   $0x0
+ 543:	6a 10                	push   $0x10
+ 545:	50                   	push   %eax
+ 546:	ff 75 08             	push   0x8(%ebp)
+ 549:	e8 99 fe ff ff       	call   3e7 <printint>
+ 54e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 551:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 555:	e9 ae 00 00 00       	jmp    608 <printf+0x170>
+      } else if(c == 's'){
+ 55a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 55e:	75 43                	jne    5a3 <printf+0x10b>
+        s = (char*)*ap;
+ 560:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 563:	8b 00                	mov    (%eax),%eax
+ 565:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 568:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 56c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 570:	75 25                	jne    597 <printf+0xff>
+          s = "(null)";
+ 572:	c7 45 f4 58 08 00 00 	movl   $0x858,-0xc(%ebp)
+        while(*s != 0){
+ 579:	eb 1c                	jmp    597 <printf+0xff>
+          putc(fd, *s);
+ 57b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 57e:	0f b6 00             	movzbl (%eax),%eax
+ 581:	0f be c0             	movsbl %al,%eax
+ 584:	83 ec 08             	sub    $0x8,%esp
+ 587:	50                   	push   %eax
+ 588:	ff 75 08             	push   0x8(%ebp)
+ 58b:	e8 34 fe ff ff       	call   3c4 <putc>
+ 590:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 593:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 597:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 59a:	0f b6 00             	movzbl (%eax),%eax
+ 59d:	84 c0                	test   %al,%al
+ 59f:	75 da                	jne    57b <printf+0xe3>
+ 5a1:	eb 65                	jmp    608 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 5a3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 5a7:	75 1d                	jne    5c6 <printf+0x12e>
+        putc(fd, *ap);
+ 5a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ac:	8b 00                	mov    (%eax),%eax
+ 5ae:	0f be c0             	movsbl %al,%eax
+ 5b1:	83 ec 08             	sub    $0x8,%esp
+ 5b4:	50                   	push   %eax
+ 5b5:	ff 75 08             	push   0x8(%ebp)
+ 5b8:	e8 07 fe ff ff       	call   3c4 <putc>
+ 5bd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5c0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5c4:	eb 42                	jmp    608 <printf+0x170>
+      } else if(c == '%'){
+ 5c6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5ca:	75 17                	jne    5e3 <printf+0x14b>
+        putc(fd, c);
+ 5cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5cf:	0f be c0             	movsbl %al,%eax
+ 5d2:	83 ec 08             	sub    $0x8,%esp
+ 5d5:	50                   	push   %eax
+ 5d6:	ff 75 08             	push   0x8(%ebp)
+ 5d9:	e8 e6 fd ff ff       	call   3c4 <putc>
+ 5de:	83 c4 10             	add    $0x10,%esp
+ 5e1:	eb 25                	jmp    608 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5e3:	83 ec 08             	sub    $0x8,%esp
+ 5e6:	6a 25                	push   $0x25
+ 5e8:	ff 75 08             	push   0x8(%ebp)
+ 5eb:	e8 d4 fd ff ff       	call   3c4 <putc>
+ 5f0:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 5f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5f6:	0f be c0             	movsbl %al,%eax
+ 5f9:	83 ec 08             	sub    $0x8,%esp
+ 5fc:	50                   	push   %eax
+ 5fd:	ff 75 08             	push   0x8(%ebp)
+ 600:	e8 bf fd ff ff       	call   3c4 <putc>
+ 605:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 608:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 60f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 613:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 616:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 619:	01 d0                	add    %edx,%eax
+ 61b:	0f b6 00             	movzbl (%eax),%eax
+ 61e:	84 c0                	test   %al,%al
+ 620:	0f 85 94 fe ff ff    	jne    4ba <printf+0x22>
+    }
+  }
+}
+ 626:	90                   	nop
+ 627:	90                   	nop
+ 628:	c9                   	leave
+ 629:	c3                   	ret
+
+0000062a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 62a:	55                   	push   %ebp
+ 62b:	89 e5                	mov    %esp,%ebp
+ 62d:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 630:	8b 45 08             	mov    0x8(%ebp),%eax
+ 633:	83 e8 08             	sub    $0x8,%eax
+ 636:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 639:	a1 c4 0a 00 00       	mov    0xac4,%eax
+ 63e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 641:	eb 24                	jmp    667 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 643:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 646:	8b 00                	mov    (%eax),%eax
+ 648:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 64b:	72 12                	jb     65f <free+0x35>
+ 64d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 650:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 653:	72 24                	jb     679 <free+0x4f>
+ 655:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 658:	8b 00                	mov    (%eax),%eax
+ 65a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 65d:	72 1a                	jb     679 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 65f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 662:	8b 00                	mov    (%eax),%eax
+ 664:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 667:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 66a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 66d:	73 d4                	jae    643 <free+0x19>
+ 66f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 672:	8b 00                	mov    (%eax),%eax
+ 674:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 677:	73 ca                	jae    643 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 679:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 67c:	8b 40 04             	mov    0x4(%eax),%eax
+ 67f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 686:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 689:	01 c2                	add    %eax,%edx
+ 68b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68e:	8b 00                	mov    (%eax),%eax
+ 690:	39 c2                	cmp    %eax,%edx
+ 692:	75 24                	jne    6b8 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 694:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 697:	8b 50 04             	mov    0x4(%eax),%edx
+ 69a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 69d:	8b 00                	mov    (%eax),%eax
+ 69f:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a2:	01 c2                	add    %eax,%edx
+ 6a4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6a7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6aa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ad:	8b 00                	mov    (%eax),%eax
+ 6af:	8b 10                	mov    (%eax),%edx
+ 6b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6b4:	89 10                	mov    %edx,(%eax)
+ 6b6:	eb 0a                	jmp    6c2 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6bb:	8b 10                	mov    (%eax),%edx
+ 6bd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6c0:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 6c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c5:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d2:	01 d0                	add    %edx,%eax
+ 6d4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6d7:	75 20                	jne    6f9 <free+0xcf>
+    p->s.size += bp->s.size;
+ 6d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6dc:	8b 50 04             	mov    0x4(%eax),%edx
+ 6df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e2:	8b 40 04             	mov    0x4(%eax),%eax
+ 6e5:	01 c2                	add    %eax,%edx
+ 6e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ea:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6ed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f0:	8b 10                	mov    (%eax),%edx
+ 6f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f5:	89 10                	mov    %edx,(%eax)
+ 6f7:	eb 08                	jmp    701 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 6f9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fc:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6ff:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 701:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 704:	a3 c4 0a 00 00       	mov    %eax,0xac4
+}
+ 709:	90                   	nop
+ 70a:	c9                   	leave
+ 70b:	c3                   	ret
+
+0000070c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 70c:	55                   	push   %ebp
+ 70d:	89 e5                	mov    %esp,%ebp
+ 70f:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 712:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 719:	77 07                	ja     722 <morecore+0x16>
+    nu = 4096;
+ 71b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 722:	8b 45 08             	mov    0x8(%ebp),%eax
+ 725:	c1 e0 03             	shl    $0x3,%eax
+ 728:	83 ec 0c             	sub    $0xc,%esp
+ 72b:	50                   	push   %eax
+ 72c:	e8 13 fc ff ff       	call   344 <sbrk>
+ 731:	83 c4 10             	add    $0x10,%esp
+ 734:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 737:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 73b:	75 07                	jne    744 <morecore+0x38>
+    return 0;
+ 73d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 742:	eb 26                	jmp    76a <morecore+0x5e>
+  hp = (Header*)p;
+ 744:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 747:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 74a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 74d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 750:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 753:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 756:	83 c0 08             	add    $0x8,%eax
+ 759:	83 ec 0c             	sub    $0xc,%esp
+ 75c:	50                   	push   %eax
+ 75d:	e8 c8 fe ff ff       	call   62a <free>
+ 762:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 765:	a1 c4 0a 00 00       	mov    0xac4,%eax
+}
+ 76a:	c9                   	leave
+ 76b:	c3                   	ret
+
+0000076c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 76c:	55                   	push   %ebp
+ 76d:	89 e5                	mov    %esp,%ebp
+ 76f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 772:	8b 45 08             	mov    0x8(%ebp),%eax
+ 775:	83 c0 07             	add    $0x7,%eax
+ 778:	c1 e8 03             	shr    $0x3,%eax
+ 77b:	83 c0 01             	add    $0x1,%eax
+ 77e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 781:	a1 c4 0a 00 00       	mov    0xac4,%eax
+ 786:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 789:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 78d:	75 23                	jne    7b2 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 78f:	c7 45 f0 bc 0a 00 00 	movl   $0xabc,-0x10(%ebp)
+ 796:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 799:	a3 c4 0a 00 00       	mov    %eax,0xac4
+ 79e:	a1 c4 0a 00 00       	mov    0xac4,%eax
+ 7a3:	a3 bc 0a 00 00       	mov    %eax,0xabc
+    base.s.size = 0;
+ 7a8:	c7 05 c0 0a 00 00 00 	movl   $0x0,0xac0
+ 7af:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b5:	8b 00                	mov    (%eax),%eax
+ 7b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 7ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bd:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 7c3:	72 4d                	jb     812 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 7c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c8:	8b 40 04             	mov    0x4(%eax),%eax
+ 7cb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 7ce:	75 0c                	jne    7dc <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d3:	8b 10                	mov    (%eax),%edx
+ 7d5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7d8:	89 10                	mov    %edx,(%eax)
+ 7da:	eb 26                	jmp    802 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 7dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7df:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7e5:	89 c2                	mov    %eax,%edx
+ 7e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ea:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f0:	8b 40 04             	mov    0x4(%eax),%eax
+ 7f3:	c1 e0 03             	shl    $0x3,%eax
+ 7f6:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 7f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7fc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7ff:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 802:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 805:	a3 c4 0a 00 00       	mov    %eax,0xac4
+      return (void*)(p + 1);
+ 80a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80d:	83 c0 08             	add    $0x8,%eax
+ 810:	eb 3b                	jmp    84d <malloc+0xe1>
+    }
+    if(p == freep)
+ 812:	a1 c4 0a 00 00       	mov    0xac4,%eax
+ 817:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 81a:	75 1e                	jne    83a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 81c:	83 ec 0c             	sub    $0xc,%esp
+ 81f:	ff 75 ec             	push   -0x14(%ebp)
+ 822:	e8 e5 fe ff ff       	call   70c <morecore>
+ 827:	83 c4 10             	add    $0x10,%esp
+ 82a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 82d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 831:	75 07                	jne    83a <malloc+0xce>
+        return 0;
+ 833:	b8 00 00 00 00       	mov    $0x0,%eax
+ 838:	eb 13                	jmp    84d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 83a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 840:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 843:	8b 00                	mov    (%eax),%eax
+ 845:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 848:	e9 6d ff ff ff       	jmp    7ba <malloc+0x4e>
+  }
+}
+ 84d:	c9                   	leave
+ 84e:	c3                   	ret
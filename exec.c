@@ -2,6 +2,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
@@ -18,7 +19,7 @@ exec(char *path, char **argv)
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
 
-  begin_op();
+  begin_opn(iputblocks());
   if((ip = namei(path)) == 0){
     end_op();
     return -1;
@@ -90,10 +91,11 @@ exec(char *path, char **argv)
   oldpgdir = proc->pgdir;
   proc->pgdir = pgdir;
   proc->sz = sz;
+  proc->vmtop = 0;
   proc->tf->eip = elf.entry;  // main
   proc->tf->esp = sp;
   switchuvm(proc);
-  freevm(oldpgdir);
+  putvm(oldpgdir);
   return 0;
 
  bad:
@@ -6,8 +6,9 @@
 #include "defs.h"
 #include "param.h"
 #include "fs.h"
-#include "file.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
 
 struct devsw devsw[NDEV];
 struct {
@@ -72,7 +73,7 @@ fileclose(struct file *f)
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
-    begin_op();
+    begin_opn(iputblocks());
     iput(ff.ip);
     end_op();
   }
@@ -103,8 +104,17 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
+    // Read further ahead the longer the reads stay sequential.
+    if(f->off == f->raoff)
+      f->rawin = f->rawin == 0 ? 1 :
+                 2*f->rawin > NREADAHEAD ? NREADAHEAD : 2*f->rawin;
+    else
+      f->rawin = 0;
     if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
+    f->raoff = f->off;
+    if(f->rawin)
+      ireadahead(f->ip, f->off, f->rawin);
     iunlock(f->ip);
     return r;
   }
@@ -123,13 +133,17 @@ filewrite(struct file *f, char *addr, int n)
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // write in pieces small enough not to exceed the
+    // maximum log transaction size.  file data is not
+    // logged, only the i-node, allocation blocks, and
+    // the indirect blocks mapping the data.  max keeps
+    // the blocks a piece allocates below MAXOPALLOC;
+    // writei() itself stops short of the log space the
+    // operation reserved, for instance when the piece's
+    // blocks are spread over many bitmap blocks.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((LOGSIZE-1-1-2) / 2) * 512;
+    int max = (MAXOPBLOCKS-1-2-4-1) * (blocksize/sizeof(uint)) * blocksize;
     int i = 0;
     while(i < n){
       int n1 = n - i;
@@ -143,10 +157,8 @@ filewrite(struct file *f, char *addr, int n)
       iunlock(f->ip);
       end_op();
 
-      if(r < 0)
+      if(r <= 0)
         break;
-      if(r != n1)
-        panic("short filewrite");
       i += r;
     }
     return i == n ? n : -1;
@@ -6,6 +6,8 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint raoff;  // off after the last read, to spot sequential reads
+  uint rawin;  // blocks to read ahead
 };
 
 
@@ -14,16 +16,22 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
-  int flags;          // I_BUSY, I_VALID
+  struct sleeplock lock;
+  int flags;          // I_VALID
+  volatile uint seq;  // Odd while changing (see namerc in fs.c)
+  uint rcugen;        // Unused entry may be reused after this grace period
+  uint goal;          // Block for bmap to try to allocate next
+  struct inode *hnext;  // icache hash chain
+  struct inode *lprev;  // icache LRU list of unused entries
+  struct inode *lnext;
 
   short type;         // copy of disk inode
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+3];
 };
-#define I_BUSY 0x1
 #define I_VALID 0x2
 
 // table mapping major device number to
@@ -14,8 +14,10 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
@@ -30,8 +32,8 @@ readsb(int dev, struct superblock *sb)
 {
   struct buf *bp;
   
-  bp = bread(dev, 1);
-  memmove(sb, bp->data, sizeof(*sb));
+  bp = bread(dev, SBOFF / blocksize);
+  memmove(sb, bp->data + SBOFF % blocksize, sizeof(*sb));
   brelse(bp);
 }
 
@@ -42,32 +44,167 @@ bzero(int dev, int bno)
   struct buf *bp;
   
   bp = bread(dev, bno);
-  memset(bp->data, 0, BSIZE);
+  memset(bp->data, 0, sb.bsize);
   log_write(bp);
   brelse(bp);
 }
 
 // Blocks. 
 
-// Allocate a zeroed disk block.
+// Free-space summary, counted from the bitmap when the file
+// system is mounted and then kept up to date by balloc() and
+// bfree().  balloc() skips bitmap blocks with no free bits
+// without reading them.
+struct {
+  struct spinlock lock;
+  uint nbmap;   // Number of bitmap blocks
+  uint *nfree;  // Free blocks under each bitmap block
+  uint bfree;   // Free blocks
+  uint ifree;   // Free inodes
+  uint nfreed;  // Free blocks in freed[], not to be reused yet
+  uint next;    // Where to start looking without a goal
+  uint *imap;   // Inode bitmap: bit set if the inode is in use
+} fsum;
+
+// Blocks freed by the transaction being built.  File data is
+// written straight to its home (see writei), so a block must
+// not be reused until the transaction that freed it commits:
+// after a crash the block would still belong to its old file.
+static uint freed[FSSIZE/32 + 1];
+
+#define ISFREED(b) (freed[(b)/32] & (1 << ((b) % 32)))
+
+// The most blocks one operation may allocate: the data of a
+// filewrite() piece, and the blocks indexing it, which it logs.
+#define MAXOPALLOC ((MAXOPBLOCKS-1-2-4-1) * NINDIRECT(sb) + MAXOPBLOCKS)
+
+// Return the first clear bit in the bitmap w from bit from
+// up to but not including bit n, or -1.  Looks at a word at
+// a time where it can.  Bit i of a bitmap is bit i%8 of
+// byte i/8, which on x86 is bit i%32 of word i/32.
+static int
+bitscan(uint *w, int from, int n)
+{
+  int bi;
+
+  for(bi = from; bi < n; bi++){
+    if(bi % 32 == 0 && bi + 32 <= n && w[bi/32] == ~0U){
+      bi += 31;
+      continue;
+    }
+    if((w[bi/32] & (1 << (bi % 32))) == 0)
+      return bi;
+  }
+  return -1;
+}
+
+// Return the first clear bit in bitmap block bp in [from, n).
+static int
+bmapscan(struct buf *bp, int from, int n)
+{
+  return bitscan((uint*)bp->data, from, n);
+}
+
+// Count the free blocks and inodes on dev, and build the
+// inode bitmap, which is only kept in memory.
+static void
+fsuminit(uint dev)
+{
+  struct buf *bp;
+  struct dinode *dip;
+  uint i, b, n, inum;
+
+  initlock(&fsum.lock, "fsum");
+  if(sb.size > FSSIZE)
+    panic("fsuminit: file system too big");
+  fsum.nbmap = (sb.size + BPB(sb) - 1) / BPB(sb);
+  if(fsum.nbmap > PGSIZE / sizeof(uint) || (fsum.nfree = (uint*)kalloc()) == 0)
+    panic("fsuminit");
+  if(sb.ninodes > PGSIZE * 8 || (fsum.imap = (uint*)kalloc()) == 0)
+    panic("fsuminit: imap");
+  memset(fsum.imap, 0, PGSIZE);
+  fsum.imap[0] = 1;  // inode 0 is never used
+  for(i = 0; i < fsum.nbmap; i++){
+    bp = bread(dev, sb.bmapstart + i);
+    n = 0;
+    for(b = 0; b < BPB(sb) && i*BPB(sb) + b < sb.size; b++)
+      if((bp->data[b/8] & (1 << (b % 8))) == 0)
+        n++;
+    brelse(bp);
+    fsum.nfree[i] = n;
+    fsum.bfree += n;
+  }
+  fsum.next = sb.size - sb.nblocks;  // first data block
+  for(inum = 1; inum < sb.ninodes; inum++){
+    bp = bread(dev, IBLOCK(inum, sb));
+    dip = (struct dinode*)bp->data + inum%IPB(sb);
+    if(dip->type == 0)
+      fsum.ifree++;
+    else
+      fsum.imap[inum/32] |= 1 << (inum % 32);
+    brelse(bp);
+  }
+}
+
+// Claim a free inode number in the inode bitmap, the first
+// at or after near, wrapping around.  Return -1 if none.
+static int
+imapalloc(uint near)
+{
+  int inum;
+
+  if(near == 0 || near >= sb.ninodes)
+    near = 1;
+  acquire(&fsum.lock);
+  if((inum = bitscan(fsum.imap, near, sb.ninodes)) < 0)
+    inum = bitscan(fsum.imap, 1, near);
+  if(inum >= 0){
+    fsum.imap[inum/32] |= 1 << (inum % 32);
+    fsum.ifree--;
+  }
+  release(&fsum.lock);
+  return inum;
+}
+
+// Allocate a disk block, at goal or as soon after it as
+// possible; with no goal (0), after the last block allocated.
+// Zero it if zero is set.  File data blocks need not be
+// zeroed: only the part of a block below the file's size is
+// ever read, and writei() writes that part first.
 static uint
-balloc(uint dev)
+balloc(uint dev, uint goal, int zero)
 {
-  int b, bi, m;
+  int b, bi, n, i, start, end;
   struct buf *bp;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
+  if(goal == 0 || goal >= sb.size)
+    goal = fsum.next;
+  start = goal / BPB(sb);
+
+  // Visit the bitmap block holding goal, the ones after
+  // it, and finally the start of goal's block again.
+  for(n = 0; n <= fsum.nbmap; n++){
+    i = (start + n) % fsum.nbmap;
+    if(fsum.nfree[i] == 0)
+      continue;
+    b = i * BPB(sb);
+    bp = bread(dev, sb.bmapstart + i);
+    end = n == fsum.nbmap ? goal % BPB(sb) : min(BPB(sb), sb.size - b);
+    bi = bmapscan(bp, n == 0 ? goal % BPB(sb) : 0, end);
+    while(bi >= 0 && ISFREED(b + bi))
+      bi = bmapscan(bp, bi + 1, end);
+    if(bi >= 0){
+      bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+      log_write(bp);
+      brelse(bp);
+      acquire(&fsum.lock);
+      fsum.nfree[i]--;
+      fsum.bfree--;
+      fsum.next = b + bi + 1;
+      release(&fsum.lock);
+      if(zero)
         bzero(dev, b + bi);
-        return b + bi;
-      }
+      return b + bi;
     }
     brelse(bp);
   }
@@ -81,15 +218,68 @@ bfree(int dev, uint b)
   struct buf *bp;
   int bi, m;
 
-  readsb(dev, &sb);
   bp = bread(dev, BBLOCK(b, sb));
-  bi = b % BPB;
+  bi = b % BPB(sb);
   m = 1 << (bi % 8);
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  acquire(&fsum.lock);
+  fsum.nfree[b / BPB(sb)]++;
+  fsum.bfree++;
+  freed[b/32] |= 1 << (b % 32);
+  fsum.nfreed++;
+  release(&fsum.lock);
+}
+
+// Called by the log once a transaction has committed: the
+// blocks it freed may now be reused.
+void
+bfreecommitted(void)
+{
+  acquire(&fsum.lock);
+  memset(freed, 0, sizeof(freed));
+  fsum.nfreed = 0;
+  release(&fsum.lock);
+}
+
+// Could nop operations between them need blocks that are
+// free but held until the current transaction commits?  If
+// so, the log should commit before another operation starts.
+int
+bfreeheld(int nop)
+{
+  int held;
+
+  acquire(&fsum.lock);
+  held = fsum.nfreed > 0 && fsum.bfree - fsum.nfreed < nop * MAXOPALLOC;
+  release(&fsum.lock);
+  return held;
+}
+
+// The most blocks an operation that only looks up names and
+// drops inode references can log: the last iput() of an
+// unlinked inode may free blocks under every bitmap block,
+// and writes the inode.  Such operations use begin_opn().
+int
+iputblocks(void)
+{
+  return min(fsum.nbmap + 1, MAXOPBLOCKS);
+}
+
+// Report the size and free space of the file system on dev.
+void
+fsstat(uint dev, struct statfs *st)
+{
+  acquire(&fsum.lock);
+  st->bsize = sb.bsize;
+  st->blocks = sb.nblocks;
+  st->bfree = fsum.bfree - fsum.nfreed;  // held blocks aren't usable yet
+  st->files = sb.ninodes - 1;
+  st->ffree = fsum.ifree;
+  release(&fsum.lock);
 }
 
 // Inodes.
@@ -118,11 +308,12 @@ bfree(int dev, uint b)
 //   the link count has fallen to zero.
 //
 // * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
+//   is unused if ip->ref is zero. Otherwise ip->ref tracks
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() to find or
 //   create a cache entry and increment its ref, iput()
-//   to decrement ref.
+//   to decrement ref. Unused entries keep their contents
+//   on an LRU list and are recycled oldest first.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when the I_VALID bit
@@ -132,9 +323,8 @@ bfree(int dev, uint b)
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
-//   has first locked the inode. The I_BUSY flag indicates
-//   that the inode is locked. ilock() sets I_BUSY,
-//   while iunlock clears it.
+//   has first locked the inode's sleep lock with ilock();
+//   iunlock() releases it.
 //
 // Thus a typical sequence is:
 //   ip = iget(dev, inum)
@@ -154,35 +344,117 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 
+#define NIHASH 61
+#define IHASH(dev, inum) (((dev) * 31 + (inum)) % NIHASH)
+
 struct {
   struct spinlock lock;
   struct inode inode[NINODE];
+  struct inode *hash[NIHASH];  // Entries by (dev, inum), through hnext
+
+  // Entries with ref 0, through lprev/lnext, least recently
+  // used first.  They keep their contents until recycled.
+  struct inode lru;
 } icache;
 
+// Append ip to the LRU list, or put it first if it is
+// worth nothing.  Caller holds icache.lock.
+static void
+lruadd(struct inode *ip, int first)
+{
+  struct inode *p;
+
+  p = first ? &icache.lru : icache.lru.lprev;
+  ip->lnext = p->lnext;
+  ip->lprev = p;
+  p->lnext->lprev = ip;
+  p->lnext = ip;
+}
+
+static void
+lruremove(struct inode *ip)
+{
+  ip->lprev->lnext = ip->lnext;
+  ip->lnext->lprev = ip->lprev;
+}
+
+// Remove ip from its hash chain.  Caller holds icache.lock.
+static void
+ihashremove(struct inode *ip)
+{
+  struct inode **pp;
+
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == ip){
+      *pp = ip->hnext;
+      return;
+    }
+  }
+}
+
+// Directory name lookup cache: maps (directory, name) to the
+// inode number of the entry and its offset in the directory,
+// or records that the name is not there.  Entries are added by
+// dirlookup(), which holds the directory's lock, and dropped
+// by code that changes the directory, also holding its lock,
+// before the change.
+#define NDCACHE 128
+#define NDCHASH 61
+
+struct dcentry {
+  uint dev;
+  uint dinum;            // Directory's inode number, 0 if unused
+  char name[DIRSIZ];
+  uint inum;             // Entry's inode number, 0 if no such entry
+  uint off;              // Byte offset of the entry in the directory
+  struct dcentry *next;  // Hash chain
+};
+
+struct {
+  struct spinlock lock;
+  struct dcentry ent[NDCACHE];
+  struct dcentry *hash[NDCHASH];
+  int hand;              // Next entry to replace
+} dcache;
+
 void
 iinit(int dev)
 {
-  initlock(&icache.lock, "icache");
+  int i;
+
+  initmcslock(&icache.lock, "icache");
+  initmcslock(&dcache.lock, "dcache");
+  icache.lru.lprev = icache.lru.lnext = &icache.lru;
+  for(i = 0; i < NINODE; i++){
+    initsleeplock(&icache.inode[i].lock, "inode");
+    lruadd(&icache.inode[i], 0);
+  }
   readsb(dev, &sb);
-  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d inodestart %d bmap start %d\n", sb.size,
+  bsetsize(sb.bsize);
+  fsuminit(dev);
+  cprintf("sb: bsize %d size %d nblocks %d ninodes %d nlog %d logstart %d inodestart %d bmap start %d\n", sb.bsize, sb.size,
           sb.nblocks, sb.ninodes, sb.nlog, sb.logstart, sb.inodestart, sb.bmapstart);
 }
 
 static struct inode* iget(uint dev, uint inum);
+static void dcachepurge(uint dev, uint dinum);
 
 //PAGEBREAK!
-// Allocate a new inode with the given type on device dev.
-// A free inode has a type of zero.
+// Allocate a new inode with the given type on device dev,
+// as close after inode near as possible: passing the parent
+// directory keeps a directory's inodes in few inode blocks.
+// A free inode has a type of zero; the inode bitmap says
+// which inodes are free without reading the inode blocks.
 struct inode*
-ialloc(uint dev, short type)
+ialloc(uint dev, short type, uint near)
 {
   int inum;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
+  while((inum = imapalloc(near)) >= 0){
     bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
+    dip = (struct dinode*)bp->data + inum%IPB(sb);
     if(dip->type == 0){  // a free inode
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
@@ -190,7 +462,7 @@ ialloc(uint dev, short type)
       brelse(bp);
       return iget(dev, inum);
     }
-    brelse(bp);
+    brelse(bp);   // in use after all; leave its bit set
   }
   panic("ialloc: no inodes");
 }
@@ -203,7 +475,7 @@ iupdate(struct inode *ip)
   struct dinode *dip;
 
   bp = bread(ip->dev, IBLOCK(ip->inum, sb));
-  dip = (struct dinode*)bp->data + ip->inum%IPB;
+  dip = (struct dinode*)bp->data + ip->inum%IPB(sb);
   dip->type = ip->type;
   dip->major = ip->major;
   dip->minor = ip->minor;
@@ -214,37 +486,77 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// namerc() reads inodes without locking them.  Changes to an
+// inode's identity or to what namerc() reads (type, size,
+// addrs and directory contents) are bracketed by these, so
+// that ip->seq is odd during a change and differs after it.
+static void
+iseqbegin(struct inode *ip)
+{
+  ip->seq++;
+  __sync_synchronize();
+}
+
+static void
+iseqend(struct inode *ip)
+{
+  __sync_synchronize();
+  ip->seq++;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
+// An unused entry still holds the inode it last held, so
+// there is never more than one entry for an inode, and an
+// inode reopened soon after its last iput() is still valid.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
+  uint gp;
 
   acquire(&icache.lock);
 
+ loop:
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = icache.hash[IHASH(dev, inum)]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        lruremove(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+  // Recycle the least recently used unused entry.  Lock-free
+  // lookups may still be reading entries that fell out of use
+  // in the current grace period; if there are only such
+  // entries, wait for the lookups to finish.
+  for(ip = icache.lru.lnext; ip != &icache.lru; ip = ip->lnext)
+    if(rcudone(ip->rcugen))
+      break;
+  if(ip == &icache.lru){
+    if(icache.lru.lnext == &icache.lru)
+      panic("iget: no inodes");
+    gp = icache.lru.lnext->rcugen;
+    release(&icache.lock);
+    rcuwait(gp);
+    acquire(&icache.lock);
+    goto loop;
+  }
 
-  ip = empty;
+  lruremove(ip);
+  iseqbegin(ip);
+  if(ip->inum != 0)
+    ihashremove(ip);
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->flags = 0;
+  ip->hnext = icache.hash[IHASH(dev, inum)];
+  icache.hash[IHASH(dev, inum)] = ip;
+  iseqend(ip);
   release(&icache.lock);
 
   return ip;
@@ -272,15 +584,12 @@ ilock(struct inode *ip)
   if(ip == 0 || ip->ref < 1)
     panic("ilock");
 
-  acquire(&icache.lock);
-  while(ip->flags & I_BUSY)
-    sleep(ip, &icache.lock);
-  ip->flags |= I_BUSY;
-  release(&icache.lock);
+  acquiresleep(&ip->lock);
 
   if(!(ip->flags & I_VALID)){
-    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
-    dip = (struct dinode*)bp->data + ip->inum%IPB;
+    bp = breadshared(ip->dev, IBLOCK(ip->inum, sb));
+    dip = (struct dinode*)bp->data + ip->inum%IPB(sb);
+    iseqbegin(ip);
     ip->type = dip->type;
     ip->major = dip->major;
     ip->minor = dip->minor;
@@ -288,7 +597,9 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->goal = 0;
     ip->flags |= I_VALID;
+    iseqend(ip);
     if(ip->type == 0)
       panic("ilock: no type");
   }
@@ -298,13 +609,10 @@ ilock(struct inode *ip)
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !(ip->flags & I_BUSY) || ip->ref < 1)
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
     panic("iunlock");
 
-  acquire(&icache.lock);
-  ip->flags &= ~I_BUSY;
-  wakeup(ip);
-  release(&icache.lock);
+  releasesleep(&ip->lock);
 }
 
 // Drop a reference to an in-memory inode.
@@ -320,18 +628,30 @@ iput(struct inode *ip)
   acquire(&icache.lock);
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
-    if(ip->flags & I_BUSY)
+    // No one else can find ip, so the lock must be free.
+    if(ip->lock.locked)
       panic("iput busy");
-    ip->flags |= I_BUSY;
+    iseqbegin(ip);  // before namerc() can take a reference
     release(&icache.lock);
+    acquiresleep(&ip->lock);
+    if(ip->type == T_DIR)
+      dcachepurge(ip->dev, ip->inum);
     itrunc(ip);
     ip->type = 0;
     iupdate(ip);
-    acquire(&icache.lock);
     ip->flags = 0;
-    wakeup(ip);
+    iseqend(ip);
+    acquire(&fsum.lock);
+    fsum.imap[ip->inum/32] &= ~(1 << (ip->inum % 32));
+    fsum.ifree++;
+    release(&fsum.lock);
+    releasesleep(&ip->lock);
+    acquire(&icache.lock);
+  }
+  if(--ip->ref == 0){
+    ip->rcugen = rcustart();
+    lruadd(ip, !(ip->flags & I_VALID));
   }
-  ip->ref--;
   release(&icache.lock);
 }
 
@@ -349,38 +669,124 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are 
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], the next NDINDIRECT
+// in the blocks listed in block ip->addrs[NDIRECT+1], and
+// the last NTINDIRECT one level further down, below
+// ip->addrs[NDIRECT+2].  Mapping a block reads at most
+// three indirect blocks.
+
+// Allocate a block for ip, following the last one it got,
+// so that files tend to be laid out contiguously.  Zero it
+// unless it is to hold file data.
+static uint
+iballoc(struct inode *ip, int data)
+{
+  uint addr;
+
+  addr = balloc(ip->dev, ip->goal, !data || ip->type != T_FILE);
+  ip->goal = addr + 1;
+  return addr;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, *a, level, span;
   struct buf *bp;
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = iballoc(ip, 1);
     return addr;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
+  // Find the level of indirection that covers bn.
+  span = NINDIRECT(sb);
+  for(level = 0; bn >= span; level++){
+    if(level == 2)
+      panic("bmap: out of range");
+    bn -= span;
+    span *= NINDIRECT(sb);
+  }
+
+  // Walk down the indirect blocks, allocating as necessary.
+  if((addr = ip->addrs[NDIRECT+level]) == 0)
+    ip->addrs[NDIRECT+level] = addr = iballoc(ip, 0);
+  do {
+    span /= NINDIRECT(sb);
+    bp = breadshared(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
+    if(a[bn / span] == 0){
+      // Allocate holding the block exclusively.
+      brelse(bp);
+      bp = bread(ip->dev, addr);
+      a = (uint*)bp->data;
+      if(a[bn / span] == 0){
+        a[bn / span] = iballoc(ip, span == 1);
+        log_write(bp);
+      }
     }
+    addr = a[bn / span];
     brelse(bp);
-    return addr;
+    bn %= span;
+  } while(span > 1);
+  return addr;
+}
+
+// The most blocks that allocating block bn of a file can add
+// to the log: the bitmap block for it and for each indirect
+// block above it, those indirect blocks, and the inode.  The
+// bitmap blocks may all differ on a fragmented file system.
+static int
+bmaplogblocks(uint bn)
+{
+  uint span;
+  int n;
+
+  n = 2;
+  if(bn < NDIRECT)
+    return n;
+  bn -= NDIRECT;
+  for(span = NINDIRECT(sb);; span *= NINDIRECT(sb)){
+    n += 2;
+    if(bn < span)
+      return n;
+    bn -= span;
   }
+}
 
-  panic("bmap: out of range");
+// Free indirect block addr and the blocks below it,
+// level levels of indirect blocks deep.  The indirect
+// blocks below are read ahead, so that the disk reads
+// the next ones while this walks the current one.
+static void
+itruncind(uint dev, uint addr, int level)
+{
+  struct buf *bp;
+  uint *a;
+  int j, ra;
+
+  bp = bread(dev, addr);
+  a = (uint*)bp->data;
+  ra = 0;
+  for(j = 0; j < NINDIRECT(sb); j++){
+    if(level > 0){
+      for(; ra < NINDIRECT(sb) && ra <= j + NREADAHEAD; ra++)
+        if(a[ra])
+          breadahead(dev, a[ra]);
+    }
+    if(a[j] == 0)
+      continue;
+    if(level > 0)
+      itruncind(dev, a[j], level-1);
+    else
+      bfree(dev, a[j]);
+  }
+  brelse(bp);
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -391,9 +797,7 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -402,22 +806,32 @@ itrunc(struct inode *ip)
     }
   }
   
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+  for(i = 0; i < 3; i++){
+    if(ip->addrs[NDIRECT+i]){
+      itruncind(ip->dev, ip->addrs[NDIRECT+i], i);
+      ip->addrs[NDIRECT+i] = 0;
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
 
   ip->size = 0;
   iupdate(ip);
 }
 
+// Start reading up to n blocks of ip, from the one holding
+// byte off, into the buffer cache without waiting, for a
+// sequential reader.  Caller must hold ip->lock.
+void
+ireadahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end;
+
+  if(ip->type == T_DEV)
+    return;
+  end = (ip->size + sb.bsize - 1) / sb.bsize;
+  for(bn = off / sb.bsize; bn < end && n > 0; bn++, n--)
+    breadahead(ip->dev, bmap(ip, bn));
+}
+
 // Copy stat information from inode.
 void
 stati(struct inode *ip, struct stat *st)
@@ -449,9 +863,9 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
+    bp = breadshared(ip->dev, bmap(ip, off/sb.bsize));
+    m = min(n - tot, sb.bsize - off%sb.bsize);
+    memmove(dst, bp->data + off%sb.bsize, m);
     brelse(bp);
   }
   return n;
@@ -459,6 +873,9 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 
 // PAGEBREAK!
 // Write data to inode.
+// A file write stops early, and returns how much it wrote,
+// when its FS operation could not log the blocks the next
+// block of data may need (see bmaplogblocks).
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
@@ -473,22 +890,41 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if((uint64)off + n > (uint64)MAXFILE(sb) * sb.bsize)
     return -1;
 
+  if(ip->type == T_DIR)
+    iseqbegin(ip);
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
-    brelse(bp);
+    m = min(n - tot, sb.bsize - off%sb.bsize);
+    if(ip->type != T_FILE){
+      bp = bread(ip->dev, bmap(ip, off/sb.bsize));
+      memmove(bp->data + off%sb.bsize, src, m);
+      log_write(bp);
+      brelse(bp);
+      continue;
+    }
+    // File data is not logged but written back later, and
+    // always before the transaction that makes it part of
+    // the file commits (see commit() in log.c).  A block
+    // written whole need not be read first.
+    if(tot > 0 && proc->logres < bmaplogblocks(off/sb.bsize))
+      break;
+    if(m == sb.bsize)
+      bp = bget(ip->dev, bmap(ip, off/sb.bsize));
+    else
+      bp = bread(ip->dev, bmap(ip, off/sb.bsize));
+    memmove(bp->data + off%sb.bsize, src, m);
+    bdwrite(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  if(ip->type == T_DIR)
+    iseqend(ip);
+  return tot;
 }
 
 //PAGEBREAK!
@@ -500,6 +936,447 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+static struct dcentry**
+dcachebucket(uint dev, uint dinum, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dinum;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return &dcache.hash[h % NDCHASH];
+}
+
+// Look up name in directory (dev, dinum) in the dcache.
+// If cached, set *inum (0 if the name is known to be absent)
+// and *off, and return 1; otherwise return 0.
+static int
+dcachelookup(uint dev, uint dinum, char *name, uint *inum, uint *off)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  for(e = *dcachebucket(dev, dinum, name); e; e = e->next){
+    if(e->dev == dev && e->dinum == dinum && namecmp(e->name, name) == 0){
+      *inum = e->inum;
+      *off = e->off;
+      release(&dcache.lock);
+      return 1;
+    }
+  }
+  release(&dcache.lock);
+  return 0;
+}
+
+// Remove e from its hash chain.  Caller holds dcache.lock.
+static void
+dcacheunlink(struct dcentry *e)
+{
+  struct dcentry **pp;
+
+  for(pp = dcachebucket(e->dev, e->dinum, e->name); *pp; pp = &(*pp)->next){
+    if(*pp == e){
+      *pp = e->next;
+      break;
+    }
+  }
+  e->dinum = 0;
+}
+
+// Record that name in directory dp has inode number inum
+// (0 if absent) at offset off.  Caller holds dp's lock and
+// has found that name is not cached.
+static void
+dcacheinsert(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dcentry *e, **b;
+
+  acquire(&dcache.lock);
+  e = &dcache.ent[dcache.hand];
+  dcache.hand = (dcache.hand + 1) % NDCACHE;
+  if(e->dinum)
+    dcacheunlink(e);
+  e->dev = dp->dev;
+  e->dinum = dp->inum;
+  strncpy(e->name, name, DIRSIZ);
+  e->inum = inum;
+  e->off = off;
+  b = dcachebucket(e->dev, e->dinum, e->name);
+  e->next = *b;
+  *b = e;
+  release(&dcache.lock);
+}
+
+// Forget what is cached about name in directory dp, before
+// dp's entry for name changes.  Caller holds dp's lock.
+void
+dcacheinval(struct inode *dp, char *name)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  for(e = *dcachebucket(dp->dev, dp->inum, name); e; e = e->next){
+    if(e->dev == dp->dev && e->dinum == dp->inum && namecmp(e->name, name) == 0){
+      dcacheunlink(e);
+      break;
+    }
+  }
+  release(&dcache.lock);
+}
+
+// Forget everything cached about directory (dev, dinum),
+// which is being freed.
+static void
+dcachepurge(uint dev, uint dinum)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  for(e = dcache.ent; e < &dcache.ent[NDCACHE]; e++)
+    if(e->dinum == dinum && e->dev == dev)
+      dcacheunlink(e);
+  release(&dcache.lock);
+}
+
+//PAGEBREAK!
+// Indexed directories (see fs.h).  The caller holds the
+// directory's lock.  The code changes directory blocks in
+// place rather than with writei(), so callers bracket
+// changes with iseqbegin() and iseqend().
+
+// Read index block blk of dp and set *h to its header.
+// Hold the block shared if shared, to look at it only.
+static struct buf*
+dxread(struct inode *dp, uint blk, struct dxhead **h, int shared)
+{
+  struct buf *bp;
+
+  if(blk >= dp->size / sb.bsize)
+    panic("dxread");
+  if(shared)
+    bp = breadshared(dp->dev, bmap(dp, blk));
+  else
+    bp = bread(dp->dev, bmap(dp, blk));
+  *h = (struct dxhead*)(bp->data + (blk == 0 ? DXROOTOFF : 0));
+  return bp;
+}
+
+// Is dp an indexed directory?
+static int
+dxindexed(struct inode *dp)
+{
+  struct buf *bp;
+  struct dxhead *h;
+  int r;
+
+  if(dp->size < sb.bsize)
+    return 0;
+  bp = dxread(dp, 0, &h, 1);
+  r = h->inum == 0 && h->magic == DX_MAGIC;
+  brelse(bp);
+  return r;
+}
+
+// Return the block of the entry in index block blk that
+// covers hash: the last whose hash is not above it.
+static uint
+dxsearch(struct inode *dp, uint blk, uint hash, int *levels)
+{
+  struct buf *bp;
+  struct dxhead *h;
+  struct dxentry *e;
+  int i;
+
+  bp = dxread(dp, blk, &h, 1);
+  e = (struct dxentry*)(h + 1);
+  for(i = 1; i < h->count && e[i].hash <= hash; i++)
+    ;
+  blk = e[i-1].block;
+  if(levels)
+    *levels = h->levels;
+  brelse(bp);
+  return blk;
+}
+
+// Return the leaf block of dp for names with the given hash,
+// and set *node to the index block that points at it.
+static uint
+dxleaf(struct inode *dp, uint hash, uint *node)
+{
+  uint blk;
+  int levels;
+
+  *node = 0;
+  blk = dxsearch(dp, 0, hash, &levels);
+  if(levels > 0){
+    *node = blk;
+    blk = dxsearch(dp, blk, hash, 0);
+  }
+  return blk;
+}
+
+// Look for name in indexed directory dp.  Return its inode
+// number and set *poff, or return 0.
+static uint
+dxlookup(struct inode *dp, char *name, uint *poff)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint blk, node, inum;
+  int i;
+
+  blk = dxleaf(dp, dxhash(name), &node);
+  bp = breadshared(dp->dev, bmap(dp, blk));
+  de = (struct dirent*)bp->data;
+  inum = 0;
+  for(i = 0; i < DIRPB(sb); i++){
+    if(de[i].inum != 0 && namecmp(name, de[i].name) == 0){
+      inum = de[i].inum;
+      *poff = blk*sb.bsize + i*sizeof(*de);
+      break;
+    }
+  }
+  brelse(bp);
+  return inum;
+}
+
+// Append a zeroed block to dp and return its number,
+// or -1 if dp is as big as it can be.
+static int
+dxnewblock(struct inode *dp)
+{
+  struct buf *bp;
+  uint blk;
+
+  blk = dp->size / sb.bsize;
+  if(blk >= MAXFILE(sb) || dp->size + sb.bsize < dp->size)
+    return -1;
+  bp = bread(dp->dev, bmap(dp, blk));
+  memset(bp->data, 0, sb.bsize);
+  log_write(bp);
+  brelse(bp);
+  dp->size += sb.bsize;
+  iupdate(dp);
+  return blk;
+}
+
+// Add an entry for child, covering hashes from hash, to
+// index block node, which must have room.
+static void
+dxinsert(struct inode *dp, uint node, uint hash, uint child)
+{
+  struct buf *bp;
+  struct dxhead *h;
+  struct dxentry *e;
+  int i;
+
+  bp = dxread(dp, node, &h, 0);
+  if(h->count >= h->limit)
+    panic("dxinsert");
+  e = (struct dxentry*)(h + 1);
+  for(i = h->count; i > 0 && e[i-1].hash > hash; i--)
+    e[i] = e[i-1];
+  memset(&e[i], 0, sizeof(e[i]));
+  e[i].hash = hash;
+  e[i].block = child;
+  h->count++;
+  log_write(bp);
+  brelse(bp);
+}
+
+// Turn dp, a linear directory filling exactly one block, into
+// an indexed directory with one leaf holding its entries.
+static int
+dxconvert(struct inode *dp)
+{
+  struct buf *bp, *lbp;
+  struct dxhead *h;
+  struct dxentry *e;
+  int blk;
+
+  if((blk = dxnewblock(dp)) < 0)
+    return -1;
+  bp = bread(dp->dev, bmap(dp, 0));
+  lbp = bread(dp->dev, bmap(dp, blk));
+  memmove(lbp->data, bp->data + DXROOTOFF, sb.bsize - DXROOTOFF);
+  memset(bp->data + DXROOTOFF, 0, sb.bsize - DXROOTOFF);
+  h = (struct dxhead*)(bp->data + DXROOTOFF);
+  h->magic = DX_MAGIC;
+  h->levels = 0;
+  h->count = 1;
+  h->limit = DXROOTMAX(sb);
+  e = (struct dxentry*)(h + 1);
+  e[0].hash = 0;
+  e[0].block = blk;
+  log_write(lbp);
+  log_write(bp);
+  brelse(lbp);
+  brelse(bp);
+  dcachepurge(dp->dev, dp->inum);   // entries moved
+  return 0;
+}
+
+// Make room for one more entry in index block node of dp,
+// which is full.  A full root gets a level of interior
+// blocks below it; a full interior block is split in two.
+static int
+dxgrow(struct inode *dp, uint node)
+{
+  struct buf *bp, *nbp;
+  struct dxhead *h, *nh;
+  struct dxentry *e;
+  uint half, hash;
+  int blk;
+
+  if(node == 0){
+    bp = dxread(dp, 0, &h, 0);
+    blk = h->levels == 0 ? dxnewblock(dp) : -1;
+    brelse(bp);
+    if(blk < 0)
+      return -1;
+    bp = dxread(dp, 0, &h, 0);
+    nbp = dxread(dp, blk, &nh, 0);
+    nh->magic = DX_MAGIC;
+    nh->count = h->count;
+    nh->limit = DXNODEMAX(sb);
+    memmove(nh + 1, h + 1, h->count*sizeof(struct dxentry));
+    memset(h + 1, 0, h->limit*sizeof(struct dxentry));
+    h->levels = 1;
+    h->count = 1;
+    e = (struct dxentry*)(h + 1);
+    e[0].hash = 0;
+    e[0].block = blk;
+    log_write(nbp);
+    log_write(bp);
+    brelse(nbp);
+    brelse(bp);
+    return 0;
+  }
+
+  // Split an interior block; the root needs room for the new half.
+  bp = dxread(dp, 0, &h, 0);
+  blk = h->count < h->limit ? dxnewblock(dp) : -1;
+  brelse(bp);
+  if(blk < 0)
+    return -1;
+  bp = dxread(dp, node, &h, 0);
+  nbp = dxread(dp, blk, &nh, 0);
+  half = h->count / 2;
+  e = (struct dxentry*)(h + 1);
+  nh->magic = DX_MAGIC;
+  nh->count = h->count - half;
+  nh->limit = DXNODEMAX(sb);
+  hash = e[half].hash;
+  memmove(nh + 1, e + half, nh->count*sizeof(struct dxentry));
+  memset(e + half, 0, nh->count*sizeof(struct dxentry));
+  h->count = half;
+  log_write(nbp);
+  log_write(bp);
+  brelse(nbp);
+  brelse(bp);
+  dxinsert(dp, 0, hash, blk);
+  return 0;
+}
+
+// Split full leaf block blk of dp, moving the entries with the
+// larger hashes to a new leaf, and add the new leaf to index
+// block node, which must have room.  Names with equal hashes
+// stay together, so a lookup need only search one leaf.
+static int
+dxsplit(struct inode *dp, uint blk, uint node)
+{
+  struct buf *bp, *nbp;
+  struct dirent *de, *nde;
+  uint *hash, *sorted, split, t;
+  int i, j, k, nblk;
+
+  // Too big for the stack with large blocks.
+  if((hash = (uint*)kalloc()) == 0)
+    return -1;
+  sorted = hash + DIRPB(sb);
+  bp = bread(dp->dev, bmap(dp, blk));
+  de = (struct dirent*)bp->data;
+  for(i = 0; i < DIRPB(sb); i++){
+    hash[i] = sorted[i] = dxhash(de[i].name);
+    for(j = i; j > 0 && sorted[j-1] > sorted[j]; j--){
+      t = sorted[j];
+      sorted[j] = sorted[j-1];
+      sorted[j-1] = t;
+    }
+  }
+  // Split as near the middle as equal hashes allow.
+  for(k = DIRPB(sb)/2; k < DIRPB(sb) && sorted[k] == sorted[k-1]; k++)
+    ;
+  if(k == DIRPB(sb))
+    for(k = DIRPB(sb)/2; k > 0 && sorted[k] == sorted[k-1]; k--)
+      ;
+  if(k == 0 || (nblk = dxnewblock(dp)) < 0){
+    brelse(bp);
+    kfree((char*)hash);
+    return -1;
+  }
+  split = sorted[k];
+
+  nbp = bread(dp->dev, bmap(dp, nblk));
+  nde = (struct dirent*)nbp->data;
+  for(i = j = 0; i < DIRPB(sb); i++){
+    if(hash[i] >= split){
+      nde[j++] = de[i];
+      memset(&de[i], 0, sizeof(de[i]));
+    }
+  }
+  kfree((char*)hash);
+  log_write(nbp);
+  log_write(bp);
+  brelse(nbp);
+  brelse(bp);
+  dxinsert(dp, node, split, nblk);
+  dcachepurge(dp->dev, dp->inum);   // entries moved
+  return 0;
+}
+
+// Add (name, inum) to indexed directory dp, splitting its
+// leaf and growing the index as needed.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+  struct buf *bp;
+  struct dxhead *h;
+  struct dirent *de;
+  uint hash, blk, node;
+  int i, full;
+
+  hash = dxhash(name);
+  for(;;){
+    blk = dxleaf(dp, hash, &node);
+    bp = bread(dp->dev, bmap(dp, blk));
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DIRPB(sb); i++){
+      if(de[i].inum == 0){
+        memset(&de[i], 0, sizeof(de[i]));
+        strncpy(de[i].name, name, DIRSIZ);
+        de[i].inum = inum;
+        log_write(bp);
+        brelse(bp);
+        return 0;
+      }
+    }
+    brelse(bp);
+
+    // The leaf is full.  Make sure its index block can
+    // take one more entry, then split the leaf.
+    bp = dxread(dp, node, &h, 0);
+    full = h->count >= h->limit;
+    brelse(bp);
+    if(full){
+      if(dxgrow(dp, node) < 0)
+        return -1;
+    } else if(dxsplit(dp, blk, node) < 0)
+      return -1;
+  }
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
@@ -511,28 +1388,51 @@ dirlookup(struct inode *dp, char *name, uint *poff)
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
+  if(dcachelookup(dp->dev, dp->inum, name, &inum, &off)){
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+
+  inum = 0;
+  if(dxindexed(dp) && namecmp(name, ".") != 0 && namecmp(name, "..") != 0)
+    inum = dxlookup(dp, name, &off);
+  else if(dxindexed(dp)){
+    // "." and ".." stay at the start of block 0, ahead of the
+    // index, and are not hashed.
+    off = name[1] ? sizeof(de) : 0;
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+      panic("dirlookup read");
+    inum = de.inum;
+  } else {
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        continue;
+      if(namecmp(name, de.name) == 0){
+        // entry matches path element
+        inum = de.inum;
+        break;
+      }
     }
   }
 
-  return 0;
+  dcacheinsert(dp, name, inum, off);
+  if(inum == 0)
+    return 0;
+  if(poff)
+    *poff = off;
+  return iget(dp->dev, inum);
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  int off, r;
   struct dirent de;
   struct inode *ip;
 
@@ -541,21 +1441,38 @@ dirlink(struct inode *dp, char *name, uint inum)
     iput(ip);
     return -1;
   }
+  dcacheinval(dp, name);
+
+  if(!dxindexed(dp)){
+    // Look for an empty dirent.
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        break;
+    }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+    // A directory that has filled its first block becomes
+    // indexed; larger linear ones (from older file systems)
+    // just grow.
+    if(off != sb.bsize || dp->size != sb.bsize){
+      strncpy(de.name, name, DIRSIZ);
+      de.inum = inum;
+      if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink");
+      return 0;
+    }
+    iseqbegin(dp);
+    r = dxconvert(dp);
+    iseqend(dp);
+    if(r < 0)
+      return -1;
   }
 
-  strncpy(de.name, name, DIRSIZ);
-  de.inum = inum;
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("dirlink");
-  
-  return 0;
+  iseqbegin(dp);
+  r = dxlink(dp, name, inum);
+  iseqend(dp);
+  return r;
 }
 
 //PAGEBREAK!
@@ -598,6 +1515,135 @@ skipelem(char *path, char *name)
   return path;
 }
 
+// Lock-free path lookup.
+//
+// namerc() walks a path the way namex() does, but without
+// locking inodes or buffers, so that lookups in the same
+// directories don't serialize on the directories' locks.
+// It runs as an RCU reader, with interrupts off, and only
+// looks at directory inodes and blocks that are already
+// cached.  Each inode's seq tells it whether the inode
+// changed while it was reading it, and each buffer's gen
+// whether the buffer was reused.  When it can't be sure of
+// the answer (a missing name, an uncached block or inode,
+// or a concurrent change) it gives up and namex() takes the
+// locks.
+
+// Return the cached inode for (dev, inum) if it is valid and
+// not being changed, setting *seq for iseqok().
+static struct inode*
+icachepeek(uint dev, uint inum, uint *seq)
+{
+  struct inode *ip;
+  int n;
+
+  // The chain can change under us, so give up after
+  // NINODE steps rather than risk following a cycle.
+  ip = icache.hash[IHASH(dev, inum)];
+  for(n = 0; ip && n < NINODE; ip = ip->hnext, n++){
+    *seq = ip->seq;
+    __sync_synchronize();
+    if((*seq & 1) == 0 && ip->dev == dev && ip->inum == inum &&
+       (ip->flags & I_VALID))
+      return ip;
+  }
+  return 0;
+}
+
+// Has ip stayed unchanged since icachepeek() set seq?
+static int
+iseqok(struct inode *ip, uint seq)
+{
+  __sync_synchronize();
+  return ip->seq == seq;
+}
+
+// Look for name in directory dp using only cached blocks.
+// Return the entry's inode number, or 0 if there is no such
+// entry or a block is not cached.  The caller must check
+// that dp did not change meanwhile.
+static uint
+dirpeek(struct inode *dp, char *name)
+{
+  struct buf *bp;
+  struct dirent *de, *end;
+  uint off, size, gen, inum;
+
+  size = dp->size;
+  for(off = 0; off < size; off += sb.bsize){
+    if(off/sb.bsize >= NDIRECT || dp->addrs[off/sb.bsize] == 0)
+      return 0;
+    if((bp = bpeek(dp->dev, dp->addrs[off/sb.bsize], &gen)) == 0)
+      return 0;
+    inum = 0;
+    end = (struct dirent*)(bp->data + min(size - off, sb.bsize));
+    for(de = (struct dirent*)bp->data; de < end; de++){
+      if(de->inum != 0 && namecmp(name, de->name) == 0){
+        inum = de->inum;
+        break;
+      }
+    }
+    if(!bpeekok(bp, gen))
+      return 0;
+    if(inum != 0)
+      return inum;
+  }
+  return 0;
+}
+
+// Like namex(), but return 0 if the lookup can't be done
+// without locking.
+static struct inode*
+namerc(char *path, int nameiparent, char *name)
+{
+  struct inode *ip;
+  uint dev, inum, off, seq;
+
+  pushcli();  // RCU read-side critical section
+  if(*path == '/')
+    ip = icachepeek(ROOTDEV, ROOTINO, &seq);
+  else
+    ip = icachepeek(proc->cwd->dev, proc->cwd->inum, &seq);
+  if(ip == 0)
+    goto fail;
+
+  while((path = skipelem(path, name)) != 0){
+    if(ip->type != T_DIR || (nameiparent && *path == '\0'))
+      break;
+    if(!dcachelookup(ip->dev, ip->inum, name, &inum, &off))
+      inum = dirpeek(ip, name);
+    if(inum == 0 || !iseqok(ip, seq))
+      goto fail;
+    if((ip = icachepeek(ip->dev, inum, &seq)) == 0)
+      goto fail;
+  }
+  // Let namex() handle failures.
+  if(path == 0 ? nameiparent : ip->type != T_DIR)
+    goto fail;
+  dev = ip->dev;
+  inum = ip->inum;
+  if(!iseqok(ip, seq))
+    goto fail;
+  popcli();
+
+  // Take a reference, as iget() would, unless the entry has
+  // been reused or the inode freed meanwhile.  iget() and
+  // iput() change seq under icache.lock before doing either.
+  acquire(&icache.lock);
+  if(ip->dev == dev && ip->inum == inum && iseqok(ip, seq) &&
+     (ip->flags & I_VALID) && ip->type != 0){
+    if(ip->ref++ == 0)
+      lruremove(ip);
+  } else
+    ip = 0;
+  release(&icache.lock);
+  return ip;
+
+fail:
+  popcli();
+  return 0;
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
@@ -607,6 +1653,9 @@ namex(char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
 
+  if((ip = namerc(path, nameiparent, name)) != 0)
+    return ip;
+
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
@@ -3,13 +3,17 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#define MINBSIZE 512   // block sizes: a power of two from MINBSIZE
+#define MAXBSIZE 4096  // to MAXBSIZE, chosen by mkfs
+#define SBOFF 512  // byte offset of the super block on disk
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks | free bit map | data blocks ]
 //
 // mkfs computes the super block and builds an initial file system. The super describes
-// the disk layout:
+// the disk layout.  The super block is always at byte SBOFF, so it
+// can be found before the block size is known; with blocks bigger
+// than SBOFF it shares block 0 with the boot block.
 struct superblock {
   uint size;         // Size of file system image (blocks)
   uint nblocks;      // Number of data blocks
@@ -18,11 +22,16 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint bsize;        // Block size (bytes)
 };
 
-#define NDIRECT 12
-#define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+// Block addresses: NDIRECT direct, then one single, one
+// double and one triple indirect block.
+#define NDIRECT 10
+#define NINDIRECT(sb) ((sb).bsize / sizeof(uint))
+#define NDINDIRECT(sb) (NINDIRECT(sb) * NINDIRECT(sb))
+#define NTINDIRECT(sb) (NDINDIRECT(sb) * NINDIRECT(sb))
+#define MAXFILE(sb) (NDIRECT + NINDIRECT(sb) + NDINDIRECT(sb) + NTINDIRECT(sb))
 
 // On-disk inode structure
 struct dinode {
@@ -31,20 +40,20 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+3];   // Data block addresses
 };
 
 // Inodes per block.
-#define IPB           (BSIZE / sizeof(struct dinode))
+#define IPB(sb)       ((sb).bsize / sizeof(struct dinode))
 
 // Block containing inode i
-#define IBLOCK(i, sb)     ((i) / IPB + sb.inodestart)
+#define IBLOCK(i, sb)     ((i) / IPB(sb) + sb.inodestart)
 
 // Bitmap bits per block
-#define BPB           (BSIZE*8)
+#define BPB(sb)       ((sb).bsize*8)
 
 // Block of free map containing bit for block b
-#define BBLOCK(b, sb) (b/BPB + sb.bmapstart)
+#define BBLOCK(b, sb) (b/BPB(sb) + sb.bmapstart)
 
 // Directory is a file containing a sequence of dirent structures.
 #define DIRSIZ 14
@@ -54,3 +63,50 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Directory entries per block.
+#define DIRPB(sb) ((sb).bsize / sizeof(struct dirent))
+
+// Indexed directories.  A directory that outgrows its first
+// block is turned into a tree indexed by a hash of the names:
+// block 0 keeps "." and ".." and then holds the root of the
+// index, entries pointing at leaf blocks (or, one level down,
+// at interior index blocks) by the least hash they cover.
+// Leaf blocks are plain arrays of dirents.  Every index slot
+// is the size of a dirent and has inum 0, so programs that
+// read a directory as an array of dirents, like ls, skip them.
+#define DX_MAGIC 0x78646e69  // "indx"
+
+struct dxhead {      // At DXROOTOFF in block 0; at 0 in interior blocks
+  ushort inum;       // Always 0
+  ushort levels;     // Root only: levels of interior blocks (0 or 1)
+  uint magic;        // DX_MAGIC
+  ushort count;      // Entries in use
+  ushort limit;      // Entries that fit
+  uint unused;
+};
+
+struct dxentry {     // Entries follow the dxhead, sorted by hash
+  ushort inum;       // Always 0
+  ushort unused;
+  uint hash;         // Least hash of the names below this entry
+  uint block;        // Directory block number
+  uint unused2;
+};
+
+#define DXROOTOFF  (2*sizeof(struct dirent))  // after "." and ".."
+#define DXROOTMAX(sb)  (DIRPB(sb) - 3)   // entries in the root
+#define DXNODEMAX(sb)  (DIRPB(sb) - 1)   // entries in an interior block
+
+// Hash of a directory entry name (FNV-1a).
+static inline uint
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
+
@@ -5,10 +5,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
@@ -20,6 +22,9 @@
 
 #define IDE_CMD_READ  0x20
 #define IDE_CMD_WRITE 0x30
+#define IDE_CMD_RDMUL 0xc4
+#define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
@@ -62,6 +67,15 @@ ideinit(void)
       break;
     }
   }
+
+  // Let READ/WRITE MULTIPLE move the largest block
+  // with one interrupt.
+  if(havedisk1){
+    idewait(0);
+    outb(0x1f2, MAXBSIZE/SECTOR_SIZE);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    idewait(0);
+  }
   
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
@@ -73,12 +87,14 @@ idestart(struct buf *b)
 {
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(b->ioblockno >= FSSIZE)
     panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
+  int sector_per_block =  blocksize/SECTOR_SIZE;
+  int sector = b->ioblockno * sector_per_block;
+  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (sector_per_block > MAXBSIZE/SECTOR_SIZE) panic("idestart");
   
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
@@ -88,10 +104,10 @@ idestart(struct buf *b)
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
-    outb(0x1f7, IDE_CMD_WRITE);
-    outsl(0x1f0, b->data, BSIZE/4);
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, blocksize/4);
   } else {
-    outb(0x1f7, IDE_CMD_READ);
+    outb(0x1f7, read_cmd);
   }
 }
 
@@ -112,12 +128,17 @@ ideintr(void)
 
   // Read data if needed.
   if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+    insl(0x1f0, b->data, blocksize/4);
   
-  // Wake process waiting for this buf.
+  // Wake process waiting for this buf, or finish read-ahead.
   b->flags |= B_VALID;
   b->flags &= ~B_DIRTY;
-  wakeup(b);
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    bdone(b);
+  } else
+    wakeup(b);
+  wakeup(&idequeue);  // for ideawaitany()
   
   // Start disk on next buf in queue.
   if(idequeue != 0)
@@ -127,20 +148,22 @@ ideintr(void)
 }
 
 //PAGEBREAK!
-// Sync buf with disk. 
+// Start syncing buf with disk, without waiting.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Wait with ideawait(), unless B_ASYNC is set, in which case
+// ideintr() calls bdone() when done.
 void
-iderw(struct buf *b)
+idesubmit(struct buf *b)
 {
   struct buf **pp;
 
-  if(!(b->flags & B_BUSY))
-    panic("iderw: buf not busy");
+  if(!holdingsleep(&b->lock))
+    panic("idesubmit: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
+    panic("idesubmit: nothing to do");
   if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+    panic("idesubmit: ide disk 1 not present");
 
   acquire(&idelock);  //DOC:acquire-lock
 
@@ -153,11 +176,39 @@ iderw(struct buf *b)
   // Start disk if necessary.
   if(idequeue == b)
     idestart(b);
-  
-  // Wait for request to finish.
+
+  release(&idelock);
+}
+
+// Wait for the request for b to finish.
+void
+ideawait(struct buf *b)
+{
+  acquire(&idelock);
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
-
   release(&idelock);
 }
+
+// Wait for any of the n requests for bufs in v to finish and
+// return the index of one that has.  ideintr() wakes
+// ideawaitany() whenever a request finishes.
+int
+ideawaitany(struct buf **v, int n)
+{
+  int i;
+
+  if(n <= 0)
+    panic("ideawaitany");
+  acquire(&idelock);
+  for(;;){
+    for(i = 0; i < n; i++){
+      if((v[i]->flags & (B_VALID|B_DIRTY)) == B_VALID){
+        release(&idelock);
+        return i;
+      }
+    }
+    sleep(&idequeue, &idelock);
+  }
+}
@@ -0,0 +1,1254 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 ee 08 00 00       	push   $0x8ee
+  1b:	e8 78 03 00 00       	call   398 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 ee 08 00 00       	push   $0x8ee
+  33:	e8 68 03 00 00       	call   3a0 <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 ee 08 00 00       	push   $0x8ee
+  45:	e8 4e 03 00 00       	call   398 <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 79 03 00 00       	call   3d0 <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 6c 03 00 00       	call   3d0 <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 f6 08 00 00       	push   $0x8f6
+  6f:	6a 01                	push   $0x1
+  71:	e8 be 04 00 00       	call   534 <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  79:	e8 d2 02 00 00       	call   350 <fork>
+  7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+  81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  85:	79 17                	jns    9e <main+0x9e>
+      printf(1, "init: fork failed\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 09 09 00 00       	push   $0x909
+  8f:	6a 01                	push   $0x1
+  91:	e8 9e 04 00 00       	call   534 <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+      exit();
+  99:	e8 ba 02 00 00       	call   358 <exit>
+    }
+    if(pid == 0){
+  9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a2:	75 3e                	jne    e2 <main+0xe2>
+      exec("sh", argv);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 88 0b 00 00       	push   $0xb88
+  ac:	68 eb 08 00 00       	push   $0x8eb
+  b1:	e8 da 02 00 00       	call   390 <exec>
+  b6:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 1c 09 00 00       	push   $0x91c
+  c1:	6a 01                	push   $0x1
+  c3:	e8 6c 04 00 00       	call   534 <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+  cb:	e8 88 02 00 00       	call   358 <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 32 09 00 00       	push   $0x932
+  d8:	6a 01                	push   $0x1
+  da:	e8 55 04 00 00       	call   534 <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  e2:	e8 79 02 00 00       	call   360 <wait>
+  e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+  f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  fa:	75 d4                	jne    d0 <main+0xd0>
+    printf(1, "init: starting sh\n");
+  fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 101:	55                   	push   %ebp
+ 102:	89 e5                	mov    %esp,%ebp
+ 104:	57                   	push   %edi
+ 105:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 10             	mov    0x10(%ebp),%edx
+ 10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10f:	89 cb                	mov    %ecx,%ebx
+ 111:	89 df                	mov    %ebx,%edi
+ 113:	89 d1                	mov    %edx,%ecx
+ 115:	fc                   	cld
+ 116:	f3 aa                	rep stos %al,%es:(%edi)
+ 118:	89 ca                	mov    %ecx,%edx
+ 11a:	89 fb                	mov    %edi,%ebx
+ 11c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 11f:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 122:	90                   	nop
+ 123:	5b                   	pop    %ebx
+ 124:	5f                   	pop    %edi
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+
+00000127 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 133:	90                   	nop
+ 134:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 137:	8d 42 01             	lea    0x1(%edx),%eax
+ 13a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 13d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 140:	8d 48 01             	lea    0x1(%eax),%ecx
+ 143:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 146:	0f b6 12             	movzbl (%edx),%edx
+ 149:	88 10                	mov    %dl,(%eax)
+ 14b:	0f b6 00             	movzbl (%eax),%eax
+ 14e:	84 c0                	test   %al,%al
+ 150:	75 e2                	jne    134 <strcpy+0xd>
+    ;
+  return os;
+ 152:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 155:	c9                   	leave
+ 156:	c3                   	ret
+
+00000157 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 157:	55                   	push   %ebp
+ 158:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 15a:	eb 08                	jmp    164 <strcmp+0xd>
+    p++, q++;
+ 15c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 160:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 164:	8b 45 08             	mov    0x8(%ebp),%eax
+ 167:	0f b6 00             	movzbl (%eax),%eax
+ 16a:	84 c0                	test   %al,%al
+ 16c:	74 10                	je     17e <strcmp+0x27>
+ 16e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 171:	0f b6 10             	movzbl (%eax),%edx
+ 174:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 c2                	cmp    %al,%dl
+ 17c:	74 de                	je     15c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	0f b6 00             	movzbl (%eax),%eax
+ 184:	0f b6 d0             	movzbl %al,%edx
+ 187:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18a:	0f b6 00             	movzbl (%eax),%eax
+ 18d:	0f b6 c0             	movzbl %al,%eax
+ 190:	29 c2                	sub    %eax,%edx
+ 192:	89 d0                	mov    %edx,%eax
+}
+ 194:	5d                   	pop    %ebp
+ 195:	c3                   	ret
+
+00000196 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 19c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1a3:	eb 04                	jmp    1a9 <strlen+0x13>
+ 1a5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1a9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1af:	01 d0                	add    %edx,%eax
+ 1b1:	0f b6 00             	movzbl (%eax),%eax
+ 1b4:	84 c0                	test   %al,%al
+ 1b6:	75 ed                	jne    1a5 <strlen+0xf>
+    ;
+  return n;
+ 1b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+
+000001bd <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1c0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1c3:	50                   	push   %eax
+ 1c4:	ff 75 0c             	push   0xc(%ebp)
+ 1c7:	ff 75 08             	push   0x8(%ebp)
+ 1ca:	e8 32 ff ff ff       	call   101 <stosb>
+ 1cf:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1d5:	c9                   	leave
+ 1d6:	c3                   	ret
+
+000001d7 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+ 1da:	83 ec 04             	sub    $0x4,%esp
+ 1dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e0:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1e3:	eb 14                	jmp    1f9 <strchr+0x22>
+    if(*s == c)
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e8:	0f b6 00             	movzbl (%eax),%eax
+ 1eb:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1ee:	75 05                	jne    1f5 <strchr+0x1e>
+      return (char*)s;
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	eb 13                	jmp    208 <strchr+0x31>
+  for(; *s; s++)
+ 1f5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	0f b6 00             	movzbl (%eax),%eax
+ 1ff:	84 c0                	test   %al,%al
+ 201:	75 e2                	jne    1e5 <strchr+0xe>
+  return 0;
+ 203:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+
+0000020a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+ 20d:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 210:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 217:	eb 42                	jmp    25b <gets+0x51>
+    cc = read(0, &c, 1);
+ 219:	83 ec 04             	sub    $0x4,%esp
+ 21c:	6a 01                	push   $0x1
+ 21e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 221:	50                   	push   %eax
+ 222:	6a 00                	push   $0x0
+ 224:	e8 47 01 00 00       	call   370 <read>
+ 229:	83 c4 10             	add    $0x10,%esp
+ 22c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 22f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 233:	7e 33                	jle    268 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 235:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 238:	8d 50 01             	lea    0x1(%eax),%edx
+ 23b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 23e:	89 c2                	mov    %eax,%edx
+ 240:	8b 45 08             	mov    0x8(%ebp),%eax
+ 243:	01 c2                	add    %eax,%edx
+ 245:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 249:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 24b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 24f:	3c 0a                	cmp    $0xa,%al
+ 251:	74 16                	je     269 <gets+0x5f>
+ 253:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 257:	3c 0d                	cmp    $0xd,%al
+ 259:	74 0e                	je     269 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 25b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25e:	83 c0 01             	add    $0x1,%eax
+ 261:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 264:	7f b3                	jg     219 <gets+0xf>
+ 266:	eb 01                	jmp    269 <gets+0x5f>
+      break;
+ 268:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 269:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26f:	01 d0                	add    %edx,%eax
+ 271:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 274:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+ 27c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 27f:	83 ec 08             	sub    $0x8,%esp
+ 282:	6a 00                	push   $0x0
+ 284:	ff 75 08             	push   0x8(%ebp)
+ 287:	e8 0c 01 00 00       	call   398 <open>
+ 28c:	83 c4 10             	add    $0x10,%esp
+ 28f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 292:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 296:	79 07                	jns    29f <stat+0x26>
+    return -1;
+ 298:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 29d:	eb 25                	jmp    2c4 <stat+0x4b>
+  r = fstat(fd, st);
+ 29f:	83 ec 08             	sub    $0x8,%esp
+ 2a2:	ff 75 0c             	push   0xc(%ebp)
+ 2a5:	ff 75 f4             	push   -0xc(%ebp)
+ 2a8:	e8 03 01 00 00       	call   3b0 <fstat>
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2b3:	83 ec 0c             	sub    $0xc,%esp
+ 2b6:	ff 75 f4             	push   -0xc(%ebp)
+ 2b9:	e8 c2 00 00 00       	call   380 <close>
+ 2be:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2d3:	eb 25                	jmp    2fa <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2d8:	89 d0                	mov    %edx,%eax
+ 2da:	c1 e0 02             	shl    $0x2,%eax
+ 2dd:	01 d0                	add    %edx,%eax
+ 2df:	01 c0                	add    %eax,%eax
+ 2e1:	89 c1                	mov    %eax,%ecx
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	8d 50 01             	lea    0x1(%eax),%edx
+ 2e9:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2ec:	0f b6 00             	movzbl (%eax),%eax
+ 2ef:	0f be c0             	movsbl %al,%eax
+ 2f2:	01 c8                	add    %ecx,%eax
+ 2f4:	83 e8 30             	sub    $0x30,%eax
+ 2f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	0f b6 00             	movzbl (%eax),%eax
+ 300:	3c 2f                	cmp    $0x2f,%al
+ 302:	7e 0a                	jle    30e <atoi+0x48>
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+ 307:	0f b6 00             	movzbl (%eax),%eax
+ 30a:	3c 39                	cmp    $0x39,%al
+ 30c:	7e c7                	jle    2d5 <atoi+0xf>
+  return n;
+ 30e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 311:	c9                   	leave
+ 312:	c3                   	ret
+
+00000313 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 313:	55                   	push   %ebp
+ 314:	89 e5                	mov    %esp,%ebp
+ 316:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 31f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 322:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 325:	eb 17                	jmp    33e <memmove+0x2b>
+    *dst++ = *src++;
+ 327:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 32a:	8d 42 01             	lea    0x1(%edx),%eax
+ 32d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 330:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 333:	8d 48 01             	lea    0x1(%eax),%ecx
+ 336:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 339:	0f b6 12             	movzbl (%edx),%edx
+ 33c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 33e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 341:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 344:	89 55 10             	mov    %edx,0x10(%ebp)
+ 347:	85 c0                	test   %eax,%eax
+ 349:	7f dc                	jg     327 <memmove+0x14>
+  return vdst;
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 34e:	c9                   	leave
+ 34f:	c3                   	ret
+
+00000350 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 350:	b8 01 00 00 00       	mov    $0x1,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <exit>:
+SYSCALL(exit)
+ 358:	b8 02 00 00 00       	mov    $0x2,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <wait>:
+SYSCALL(wait)
+ 360:	b8 03 00 00 00       	mov    $0x3,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <pipe>:
+SYSCALL(pipe)
+ 368:	b8 04 00 00 00       	mov    $0x4,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <read>:
+SYSCALL(read)
+ 370:	b8 05 00 00 00       	mov    $0x5,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <write>:
+SYSCALL(write)
+ 378:	b8 10 00 00 00       	mov    $0x10,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <close>:
+SYSCALL(close)
+ 380:	b8 15 00 00 00       	mov    $0x15,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <kill>:
+SYSCALL(kill)
+ 388:	b8 06 00 00 00       	mov    $0x6,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <exec>:
+SYSCALL(exec)
+ 390:	b8 07 00 00 00       	mov    $0x7,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <open>:
+SYSCALL(open)
+ 398:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <mknod>:
+SYSCALL(mknod)
+ 3a0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <unlink>:
+SYSCALL(unlink)
+ 3a8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <fstat>:
+SYSCALL(fstat)
+ 3b0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <link>:
+SYSCALL(link)
+ 3b8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <mkdir>:
+SYSCALL(mkdir)
+ 3c0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <chdir>:
+SYSCALL(chdir)
+ 3c8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <dup>:
+SYSCALL(dup)
+ 3d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <getpid>:
+SYSCALL(getpid)
+ 3d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <sbrk>:
+SYSCALL(sbrk)
+ 3e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <sleep>:
+SYSCALL(sleep)
+ 3e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <uptime>:
+SYSCALL(uptime)
+ 3f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <clone>:
+SYSCALL(clone)
+ 3f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <join>:
+SYSCALL(join)
+ 400:	b8 17 00 00 00       	mov    $0x17,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <futex_wait>:
+SYSCALL(futex_wait)
+ 408:	b8 18 00 00 00       	mov    $0x18,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <futex_wake>:
+SYSCALL(futex_wake)
+ 410:	b8 19 00 00 00       	mov    $0x19,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <setaffinity>:
+SYSCALL(setaffinity)
+ 418:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <getaffinity>:
+SYSCALL(getaffinity)
+ 420:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <getrusage>:
+SYSCALL(getrusage)
+ 428:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <lockstat>:
+SYSCALL(lockstat)
+ 430:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <statfs>:
+SYSCALL(statfs)
+ 438:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <bcachesize>:
+SYSCALL(bcachesize)
+ 440:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <bcstat>:
+SYSCALL(bcstat)
+ 448:	b8 20 00 00 00       	mov    $0x20,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <sync>:
+SYSCALL(sync)
+ 450:	b8 21 00 00 00       	mov    $0x21,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <fsync>:
+SYSCALL(fsync)
+ 458:	b8 22 00 00 00       	mov    $0x22,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	83 ec 18             	sub    $0x18,%esp
+ 466:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 469:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 46c:	83 ec 04             	sub    $0x4,%esp
+ 46f:	6a 01                	push   $0x1
+ 471:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 474:	50                   	push   %eax
+ 475:	ff 75 08             	push   0x8(%ebp)
+ 478:	e8 fb fe ff ff       	call   378 <write>
+ 47d:	83 c4 10             	add    $0x10,%esp
+}
+ 480:	90                   	nop
+ 481:	c9                   	leave
+ 482:	c3                   	ret
+
+00000483 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 483:	55                   	push   %ebp
+ 484:	89 e5                	mov    %esp,%ebp
+ 486:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 489:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 490:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 494:	74 17                	je     4ad <printint+0x2a>
+ 496:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 49a:	79 11                	jns    4ad <printint+0x2a>
+    neg = 1;
+ 49c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a6:	f7 d8                	neg    %eax
+ 4a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4ab:	eb 06                	jmp    4b3 <printint+0x30>
+  } else {
+    x = xx;
+ 4ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4b3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4ba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4c5:	f7 f1                	div    %ecx
+ 4c7:	89 d1                	mov    %edx,%ecx
+ 4c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4cc:	8d 50 01             	lea    0x1(%eax),%edx
+ 4cf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4d2:	0f b6 91 90 0b 00 00 	movzbl 0xb90(%ecx),%edx
+ 4d9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4dd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4e0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4e3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4e8:	f7 f1                	div    %ecx
+ 4ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4f1:	75 c7                	jne    4ba <printint+0x37>
+  if(neg)
+ 4f3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4f7:	74 2d                	je     526 <printint+0xa3>
+    buf[i++] = '-';
+ 4f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4fc:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ff:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 502:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 507:	eb 1d                	jmp    526 <printint+0xa3>
+    putc(fd, buf[i]);
+ 509:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 50c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 50f:	01 d0                	add    %edx,%eax
+ 511:	0f b6 00             	movzbl (%eax),%eax
+ 514:	0f be c0             	movsbl %al,%eax
+ 517:	83 ec 08             	sub    $0x8,%esp
+ 51a:	50                   	push   %eax
+ 51b:	ff 75 08             	push   0x8(%ebp)
+ 51e:	e8 3d ff ff ff       	call   460 <putc>
+ 523:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 526:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 52a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 52e:	79 d9                	jns    509 <printint+0x86>
+}
+ 530:	90                   	nop
+ 531:	90                   	nop
+ 532:	c9                   	leave
+ 533:	c3                   	ret
+
+00000534 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 534:	55                   	push   %ebp
+ 535:	89 e5                	mov    %esp,%ebp
+ 537:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 53a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 541:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 544:	83 c0 04             	add    $0x4,%eax
+ 547:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 54a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 551:	e9 59 01 00 00       	jmp    6af <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 556:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 559:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 55c:	01 d0                	add    %edx,%eax
+ 55e:	0f b6 00             	movzbl (%eax),%eax
+ 561:	0f be c0             	movsbl %al,%eax
+ 564:	25 ff 00 00 00       	and    $0xff,%eax
+ 569:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 56c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 570:	75 2c                	jne    59e <printf+0x6a>
+      if(c == '%'){
+ 572:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 576:	75 0c                	jne    584 <printf+0x50>
+        state = '%';
+ 578:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 57f:	e9 27 01 00 00       	jmp    6ab <printf+0x177>
+      } else {
+        putc(fd, c);
+ 584:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 587:	0f be c0             	movsbl %al,%eax
+ 58a:	83 ec 08             	sub    $0x8,%esp
+ 58d:	50                   	push   %eax
+ 58e:	ff 75 08             	push   0x8(%ebp)
+ 591:	e8 ca fe ff ff       	call   460 <putc>
+ 596:	83 c4 10             	add    $0x10,%esp
+ 599:	e9 0d 01 00 00       	jmp    6ab <printf+0x177>
+      }
+    } else if(state == '%'){
+ 59e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5a2:	0f 85 03 01 00 00    	jne    6ab <printf+0x177>
+      if(c == 'd'){
+ 5a8:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5ac:	75 1e                	jne    5cc <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5ae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5b1:	8b 00                	mov    (%eax),%eax
+ 5b3:	6a 01                	push   $0x1
+ 5b5:	6a 0a                	push   $0xa
+ 5b7:	50                   	push   %eax
+ 5b8:	ff 75 08             	push   0x8(%ebp)
+ 5bb:	e8 c3 fe ff ff       	call   483 <printint>
+ 5c0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5c3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5c7:	e9 d8 00 00 00       	jmp    6a4 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5cc:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5d0:	74 06                	je     5d8 <printf+0xa4>
+ 5d2:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5d6:	75 1e                	jne    5f6 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5d8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5db:	8b 00                	mov    (%eax),%eax
+ 5dd:	6a 00                	push   $0x0
+ 5df:	6a 10                	push   $0x10
+ 5e1:	50                   	push   %eax
+ 5e2:	ff 75 08             	push   0x8(%ebp)
+ 5e5:	e8 99 fe ff ff       	call   483 <printint>
+ 5ea:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5ed:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5f1:	e9 ae 00 00 00       	jmp    6a4 <printf+0x170>
+      } else if(c == 's'){
+ 5f6:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5fa:	75 43                	jne    63f <printf+0x10b>
+        s = (char*)*ap;
+ 5fc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ff:	8b 00                	mov    (%eax),%eax
+ 601:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 604:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 608:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 60c:	75 25                	jne    633 <printf+0xff>
+          s = "(null)";
+ 60e:	c7 45 f4 3b 09 00 00 	movl   $0x93b,-0xc(%ebp)
+        while(*s != 0){
+ 615:	eb 1c                	jmp    633 <printf+0xff>
+          putc(fd, *s);
+ 617:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 61a:	0f b6 00             	movzbl (%eax),%eax
+ 61d:	0f be c0             	movsbl %al,%eax
+ 620:	83 ec 08             	sub    $0x8,%esp
+ 623:	50                   	push   %eax
+ 624:	ff 75 08             	push   0x8(%ebp)
+ 627:	e8 34 fe ff ff       	call   460 <putc>
+ 62c:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 62f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 633:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 636:	0f b6 00             	movzbl (%eax),%eax
+ 639:	84 c0                	test   %al,%al
+ 63b:	75 da                	jne    617 <printf+0xe3>
+ 63d:	eb 65                	jmp    6a4 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 63f:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 643:	75 1d                	jne    662 <printf+0x12e>
+        putc(fd, *ap);
+ 645:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 648:	8b 00                	mov    (%eax),%eax
+ 64a:	0f be c0             	movsbl %al,%eax
+ 64d:	83 ec 08             	sub    $0x8,%esp
+ 650:	50                   	push   %eax
+ 651:	ff 75 08             	push   0x8(%ebp)
+ 654:	e8 07 fe ff ff       	call   460 <putc>
+ 659:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 65c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 660:	eb 42                	jmp    6a4 <printf+0x170>
+      } else if(c == '%'){
+ 662:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 666:	75 17                	jne    67f <printf+0x14b>
+        putc(fd, c);
+ 668:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 66b:	0f be c0             	movsbl %al,%eax
+ 66e:	83 ec 08             	sub    $0x8,%esp
+ 671:	50                   	push   %eax
+ 672:	ff 75 08             	push   0x8(%ebp)
+ 675:	e8 e6 fd ff ff       	call   460 <putc>
+ 67a:	83 c4 10             	add    $0x10,%esp
+ 67d:	eb 25                	jmp    6a4 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 67f:	83 ec 08             	sub    $0x8,%esp
+ 682:	6a 25                	push   $0x25
+ 684:	ff 75 08             	push   0x8(%ebp)
+ 687:	e8 d4 fd ff ff       	call   460 <putc>
+ 68c:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 68f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 692:	0f be c0             	movsbl %al,%eax
+ 695:	83 ec 08             	sub    $0x8,%esp
+ 698:	50                   	push   %eax
+ 699:	ff 75 08             	push   0x8(%ebp)
+ 69c:	e8 bf fd ff ff       	call   460 <putc>
+ 6a1:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6a4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6ab:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6af:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6b5:	01 d0                	add    %edx,%eax
+ 6b7:	0f b6 00             	movzbl (%eax),%eax
+ 6ba:	84 c0                	test   %al,%al
+ 6bc:	0f 85 94 fe ff ff    	jne    556 <printf+0x22>
+    }
+  }
+}
+ 6c2:	90                   	nop
+ 6c3:	90                   	nop
+ 6c4:	c9                   	leave
+ 6c5:	c3                   	ret
+
+000006c6 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6c6:	55                   	push   %ebp
+ 6c7:	89 e5                	mov    %esp,%ebp
+ 6c9:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cf:	83 e8 08             	sub    $0x8,%eax
+ 6d2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d5:	a1 ac 0b 00 00       	mov    0xbac,%eax
+ 6da:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6dd:	eb 24                	jmp    703 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e2:	8b 00                	mov    (%eax),%eax
+ 6e4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6e7:	72 12                	jb     6fb <free+0x35>
+ 6e9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6ec:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6ef:	72 24                	jb     715 <free+0x4f>
+ 6f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f4:	8b 00                	mov    (%eax),%eax
+ 6f6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6f9:	72 1a                	jb     715 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fe:	8b 00                	mov    (%eax),%eax
+ 700:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 703:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 706:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 709:	73 d4                	jae    6df <free+0x19>
+ 70b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 70e:	8b 00                	mov    (%eax),%eax
+ 710:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 713:	73 ca                	jae    6df <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 715:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 718:	8b 40 04             	mov    0x4(%eax),%eax
+ 71b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 722:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 725:	01 c2                	add    %eax,%edx
+ 727:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72a:	8b 00                	mov    (%eax),%eax
+ 72c:	39 c2                	cmp    %eax,%edx
+ 72e:	75 24                	jne    754 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 730:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 733:	8b 50 04             	mov    0x4(%eax),%edx
+ 736:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 739:	8b 00                	mov    (%eax),%eax
+ 73b:	8b 40 04             	mov    0x4(%eax),%eax
+ 73e:	01 c2                	add    %eax,%edx
+ 740:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 743:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 746:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 749:	8b 00                	mov    (%eax),%eax
+ 74b:	8b 10                	mov    (%eax),%edx
+ 74d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 750:	89 10                	mov    %edx,(%eax)
+ 752:	eb 0a                	jmp    75e <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 754:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 757:	8b 10                	mov    (%eax),%edx
+ 759:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 75c:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 75e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 761:	8b 40 04             	mov    0x4(%eax),%eax
+ 764:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 76b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76e:	01 d0                	add    %edx,%eax
+ 770:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 773:	75 20                	jne    795 <free+0xcf>
+    p->s.size += bp->s.size;
+ 775:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 778:	8b 50 04             	mov    0x4(%eax),%edx
+ 77b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 77e:	8b 40 04             	mov    0x4(%eax),%eax
+ 781:	01 c2                	add    %eax,%edx
+ 783:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 786:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 789:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 78c:	8b 10                	mov    (%eax),%edx
+ 78e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 791:	89 10                	mov    %edx,(%eax)
+ 793:	eb 08                	jmp    79d <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 795:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 798:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 79b:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 79d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a0:	a3 ac 0b 00 00       	mov    %eax,0xbac
+}
+ 7a5:	90                   	nop
+ 7a6:	c9                   	leave
+ 7a7:	c3                   	ret
+
+000007a8 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7a8:	55                   	push   %ebp
+ 7a9:	89 e5                	mov    %esp,%ebp
+ 7ab:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7ae:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7b5:	77 07                	ja     7be <morecore+0x16>
+    nu = 4096;
+ 7b7:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c1:	c1 e0 03             	shl    $0x3,%eax
+ 7c4:	83 ec 0c             	sub    $0xc,%esp
+ 7c7:	50                   	push   %eax
+ 7c8:	e8 13 fc ff ff       	call   3e0 <sbrk>
+ 7cd:	83 c4 10             	add    $0x10,%esp
+ 7d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7d3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7d7:	75 07                	jne    7e0 <morecore+0x38>
+    return 0;
+ 7d9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7de:	eb 26                	jmp    806 <morecore+0x5e>
+  hp = (Header*)p;
+ 7e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7e9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7ec:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f2:	83 c0 08             	add    $0x8,%eax
+ 7f5:	83 ec 0c             	sub    $0xc,%esp
+ 7f8:	50                   	push   %eax
+ 7f9:	e8 c8 fe ff ff       	call   6c6 <free>
+ 7fe:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 801:	a1 ac 0b 00 00       	mov    0xbac,%eax
+}
+ 806:	c9                   	leave
+ 807:	c3                   	ret
+
+00000808 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 808:	55                   	push   %ebp
+ 809:	89 e5                	mov    %esp,%ebp
+ 80b:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 80e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 811:	83 c0 07             	add    $0x7,%eax
+ 814:	c1 e8 03             	shr    $0x3,%eax
+ 817:	83 c0 01             	add    $0x1,%eax
+ 81a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 81d:	a1 ac 0b 00 00       	mov    0xbac,%eax
+ 822:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 825:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 829:	75 23                	jne    84e <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 82b:	c7 45 f0 a4 0b 00 00 	movl   $0xba4,-0x10(%ebp)
+ 832:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 835:	a3 ac 0b 00 00       	mov    %eax,0xbac
+ 83a:	a1 ac 0b 00 00       	mov    0xbac,%eax
+ 83f:	a3 a4 0b 00 00       	mov    %eax,0xba4
+    base.s.size = 0;
+ 844:	c7 05 a8 0b 00 00 00 	movl   $0x0,0xba8
+ 84b:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 84e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 851:	8b 00                	mov    (%eax),%eax
+ 853:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 856:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 859:	8b 40 04             	mov    0x4(%eax),%eax
+ 85c:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 85f:	72 4d                	jb     8ae <malloc+0xa6>
+      if(p->s.size == nunits)
+ 861:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 864:	8b 40 04             	mov    0x4(%eax),%eax
+ 867:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 86a:	75 0c                	jne    878 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 86c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86f:	8b 10                	mov    (%eax),%edx
+ 871:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 874:	89 10                	mov    %edx,(%eax)
+ 876:	eb 26                	jmp    89e <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 878:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87b:	8b 40 04             	mov    0x4(%eax),%eax
+ 87e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 881:	89 c2                	mov    %eax,%edx
+ 883:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 886:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 889:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88c:	8b 40 04             	mov    0x4(%eax),%eax
+ 88f:	c1 e0 03             	shl    $0x3,%eax
+ 892:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 898:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 89b:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 89e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8a1:	a3 ac 0b 00 00       	mov    %eax,0xbac
+      return (void*)(p + 1);
+ 8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a9:	83 c0 08             	add    $0x8,%eax
+ 8ac:	eb 3b                	jmp    8e9 <malloc+0xe1>
+    }
+    if(p == freep)
+ 8ae:	a1 ac 0b 00 00       	mov    0xbac,%eax
+ 8b3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8b6:	75 1e                	jne    8d6 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8b8:	83 ec 0c             	sub    $0xc,%esp
+ 8bb:	ff 75 ec             	push   -0x14(%ebp)
+ 8be:	e8 e5 fe ff ff       	call   7a8 <morecore>
+ 8c3:	83 c4 10             	add    $0x10,%esp
+ 8c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8cd:	75 07                	jne    8d6 <malloc+0xce>
+        return 0;
+ 8cf:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8d4:	eb 13                	jmp    8e9 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8df:	8b 00                	mov    (%eax),%eax
+ 8e1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8e4:	e9 6d ff ff ff       	jmp    856 <malloc+0x4e>
+  }
+}
+ 8e9:	c9                   	leave
+ 8ea:	c3                   	ret
@@ -20,6 +20,7 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;  // pages on freelist
 } kmem;
 
 // Initialization happens in two phases.
@@ -30,7 +31,7 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
-  initlock(&kmem.lock, "kmem");
+  initmcslock(&kmem.lock, "kmem");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -72,6 +73,7 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -87,10 +89,19 @@ kalloc(void)
   if(kmem.use_lock)
     acquire(&kmem.lock);
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+
+// Number of free pages, for sizing caches.
+int
+kfreepages(void)
+{
+  return kmem.nfree;
+}
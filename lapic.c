@@ -124,6 +124,20 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send a fixed interrupt with the given vector to the
+// processor whose local APIC id is apicid.
+// Interrupts must be off so that the ICR writes are not split.
+void
+lapicipi(uchar apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -0,0 +1,1436 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct lockstat st[NLOCKSTAT];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  17:	89 cb                	mov    %ecx,%ebx
+  struct lockstat t;
+  int i, j, k, n, reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  19:	83 3b 01             	cmpl   $0x1,(%ebx)
+  1c:	7e 24                	jle    42 <main+0x42>
+  1e:	8b 43 04             	mov    0x4(%ebx),%eax
+  21:	83 c0 04             	add    $0x4,%eax
+  24:	8b 00                	mov    (%eax),%eax
+  26:	83 ec 08             	sub    $0x8,%esp
+  29:	68 e4 0a 00 00       	push   $0xae4
+  2e:	50                   	push   %eax
+  2f:	e8 1c 03 00 00       	call   350 <strcmp>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	85 c0                	test   %eax,%eax
+  39:	75 07                	jne    42 <main+0x42>
+  3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  40:	eb 05                	jmp    47 <main+0x47>
+  42:	b8 00 00 00 00       	mov    $0x0,%eax
+  47:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  if(argc > 2 || (argc == 2 && !reset)){
+  4a:	83 3b 02             	cmpl   $0x2,(%ebx)
+  4d:	7f 0b                	jg     5a <main+0x5a>
+  4f:	83 3b 02             	cmpl   $0x2,(%ebx)
+  52:	75 1d                	jne    71 <main+0x71>
+  54:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  58:	75 17                	jne    71 <main+0x71>
+    printf(2, "usage: lockstat [-r]\n");
+  5a:	83 ec 08             	sub    $0x8,%esp
+  5d:	68 e7 0a 00 00       	push   $0xae7
+  62:	6a 02                	push   $0x2
+  64:	e8 c4 06 00 00       	call   72d <printf>
+  69:	83 c4 10             	add    $0x10,%esp
+    exit();
+  6c:	e8 e0 04 00 00       	call   551 <exit>
+  }
+  if((n = lockstat(st, NLOCKSTAT, reset)) < 0){
+  71:	83 ec 04             	sub    $0x4,%esp
+  74:	ff 75 d8             	push   -0x28(%ebp)
+  77:	6a 20                	push   $0x20
+  79:	68 00 0e 00 00       	push   $0xe00
+  7e:	e8 a6 05 00 00       	call   629 <lockstat>
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  89:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8d:	79 17                	jns    a6 <main+0xa6>
+    printf(2, "lockstat: failed\n");
+  8f:	83 ec 08             	sub    $0x8,%esp
+  92:	68 fd 0a 00 00       	push   $0xafd
+  97:	6a 02                	push   $0x2
+  99:	e8 8f 06 00 00       	call   72d <printf>
+  9e:	83 c4 10             	add    $0x10,%esp
+    exit();
+  a1:	e8 ab 04 00 00       	call   551 <exit>
+  }
+
+  // Sort by total cycles spent waiting.
+  for(i = 1; i < n; i++){
+  a6:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  ad:	e9 9b 00 00 00       	jmp    14d <main+0x14d>
+    t = st[i];
+  b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  b5:	6b c0 54             	imul   $0x54,%eax,%eax
+  b8:	8d 90 00 0e 00 00    	lea    0xe00(%eax),%edx
+  be:	8d 45 80             	lea    -0x80(%ebp),%eax
+  c1:	89 d3                	mov    %edx,%ebx
+  c3:	ba 15 00 00 00       	mov    $0x15,%edx
+  c8:	89 c7                	mov    %eax,%edi
+  ca:	89 de                	mov    %ebx,%esi
+  cc:	89 d1                	mov    %edx,%ecx
+  ce:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+  d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  d6:	eb 2d                	jmp    105 <main+0x105>
+      st[j] = st[j-1];
+  d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  db:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  e1:	6b c0 54             	imul   $0x54,%eax,%eax
+  e4:	8d 90 00 0e 00 00    	lea    0xe00(%eax),%edx
+  ea:	6b c1 54             	imul   $0x54,%ecx,%eax
+  ed:	05 00 0e 00 00       	add    $0xe00,%eax
+  f2:	89 c3                	mov    %eax,%ebx
+  f4:	b8 15 00 00 00       	mov    $0x15,%eax
+  f9:	89 d7                	mov    %edx,%edi
+  fb:	89 de                	mov    %ebx,%esi
+  fd:	89 c1                	mov    %eax,%ecx
+  ff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+ 101:	83 6d e0 01          	subl   $0x1,-0x20(%ebp)
+ 105:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+ 109:	7e 21                	jle    12c <main+0x12c>
+ 10b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 10e:	83 e8 01             	sub    $0x1,%eax
+ 111:	6b c0 54             	imul   $0x54,%eax,%eax
+ 114:	05 18 0e 00 00       	add    $0xe18,%eax
+ 119:	8b 08                	mov    (%eax),%ecx
+ 11b:	8b 58 04             	mov    0x4(%eax),%ebx
+ 11e:	8b 45 98             	mov    -0x68(%ebp),%eax
+ 121:	8b 55 9c             	mov    -0x64(%ebp),%edx
+ 124:	39 c1                	cmp    %eax,%ecx
+ 126:	89 de                	mov    %ebx,%esi
+ 128:	19 d6                	sbb    %edx,%esi
+ 12a:	72 ac                	jb     d8 <main+0xd8>
+    st[j] = t;
+ 12c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 12f:	6b c0 54             	imul   $0x54,%eax,%eax
+ 132:	05 00 0e 00 00       	add    $0xe00,%eax
+ 137:	89 c3                	mov    %eax,%ebx
+ 139:	8d 45 80             	lea    -0x80(%ebp),%eax
+ 13c:	ba 15 00 00 00       	mov    $0x15,%edx
+ 141:	89 df                	mov    %ebx,%edi
+ 143:	89 c6                	mov    %eax,%esi
+ 145:	89 d1                	mov    %edx,%ecx
+ 147:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 1; i < n; i++){
+ 149:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 14d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 150:	3b 45 d4             	cmp    -0x2c(%ebp),%eax
+ 153:	0f 8c 59 ff ff ff    	jl     b2 <main+0xb2>
+  }
+
+  printf(1, "lock        acquires contended spin-kcyc max-spin hold-kcyc max-hold sleeps\n");
+ 159:	83 ec 08             	sub    $0x8,%esp
+ 15c:	68 10 0b 00 00       	push   $0xb10
+ 161:	6a 01                	push   $0x1
+ 163:	e8 c5 05 00 00       	call   72d <printf>
+ 168:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 16b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 172:	e9 72 01 00 00       	jmp    2e9 <main+0x2e9>
+    printf(1, "%s", st[i].name);
+ 177:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 17a:	6b c0 54             	imul   $0x54,%eax,%eax
+ 17d:	05 00 0e 00 00       	add    $0xe00,%eax
+ 182:	83 ec 04             	sub    $0x4,%esp
+ 185:	50                   	push   %eax
+ 186:	68 5d 0b 00 00       	push   $0xb5d
+ 18b:	6a 01                	push   $0x1
+ 18d:	e8 9b 05 00 00       	call   72d <printf>
+ 192:	83 c4 10             	add    $0x10,%esp
+    for(j = strlen(st[i].name); j < 12; j++)
+ 195:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 198:	6b c0 54             	imul   $0x54,%eax,%eax
+ 19b:	05 00 0e 00 00       	add    $0xe00,%eax
+ 1a0:	83 ec 0c             	sub    $0xc,%esp
+ 1a3:	50                   	push   %eax
+ 1a4:	e8 e6 01 00 00       	call   38f <strlen>
+ 1a9:	83 c4 10             	add    $0x10,%esp
+ 1ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 1af:	eb 16                	jmp    1c7 <main+0x1c7>
+      printf(1, " ");
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	68 60 0b 00 00       	push   $0xb60
+ 1b9:	6a 01                	push   $0x1
+ 1bb:	e8 6d 05 00 00       	call   72d <printf>
+ 1c0:	83 c4 10             	add    $0x10,%esp
+    for(j = strlen(st[i].name); j < 12; j++)
+ 1c3:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 1c7:	83 7d e0 0b          	cmpl   $0xb,-0x20(%ebp)
+ 1cb:	7e e4                	jle    1b1 <main+0x1b1>
+    printf(1, "%d %d %d %d %d %d %d\n", st[i].acquires, st[i].contended,
+ 1cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1d0:	6b c0 54             	imul   $0x54,%eax,%eax
+ 1d3:	05 30 0e 00 00       	add    $0xe30,%eax
+ 1d8:	8b 30                	mov    (%eax),%esi
+ 1da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1dd:	6b c0 54             	imul   $0x54,%eax,%eax
+ 1e0:	05 2c 0e 00 00       	add    $0xe2c,%eax
+ 1e5:	8b 18                	mov    (%eax),%ebx
+           (uint)(st[i].spin >> 10), st[i].maxspin,
+           (uint)(st[i].hold >> 10), st[i].maxhold, st[i].sleeps);
+ 1e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1ea:	6b c0 54             	imul   $0x54,%eax,%eax
+ 1ed:	05 20 0e 00 00       	add    $0xe20,%eax
+ 1f2:	8b 50 08             	mov    0x8(%eax),%edx
+ 1f5:	8b 40 04             	mov    0x4(%eax),%eax
+ 1f8:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 1fc:	c1 ea 0a             	shr    $0xa,%edx
+    printf(1, "%d %d %d %d %d %d %d\n", st[i].acquires, st[i].contended,
+ 1ff:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%ebp)
+ 205:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 208:	6b c0 54             	imul   $0x54,%eax,%eax
+ 20b:	05 20 0e 00 00       	add    $0xe20,%eax
+ 210:	8b 08                	mov    (%eax),%ecx
+           (uint)(st[i].spin >> 10), st[i].maxspin,
+ 212:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 215:	6b c0 54             	imul   $0x54,%eax,%eax
+ 218:	05 18 0e 00 00       	add    $0xe18,%eax
+ 21d:	8b 50 04             	mov    0x4(%eax),%edx
+ 220:	8b 00                	mov    (%eax),%eax
+ 222:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 226:	c1 ea 0a             	shr    $0xa,%edx
+    printf(1, "%d %d %d %d %d %d %d\n", st[i].acquires, st[i].contended,
+ 229:	89 c7                	mov    %eax,%edi
+ 22b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 22e:	6b c0 54             	imul   $0x54,%eax,%eax
+ 231:	05 14 0e 00 00       	add    $0xe14,%eax
+ 236:	8b 10                	mov    (%eax),%edx
+ 238:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 23b:	6b c0 54             	imul   $0x54,%eax,%eax
+ 23e:	05 10 0e 00 00       	add    $0xe10,%eax
+ 243:	8b 00                	mov    (%eax),%eax
+ 245:	83 ec 0c             	sub    $0xc,%esp
+ 248:	56                   	push   %esi
+ 249:	53                   	push   %ebx
+ 24a:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+ 250:	51                   	push   %ecx
+ 251:	57                   	push   %edi
+ 252:	52                   	push   %edx
+ 253:	50                   	push   %eax
+ 254:	68 62 0b 00 00       	push   $0xb62
+ 259:	6a 01                	push   $0x1
+ 25b:	e8 cd 04 00 00       	call   72d <printf>
+ 260:	83 c4 30             	add    $0x30,%esp
+    for(k = 0; k < NLOCKSITE && st[i].sitecount[k]; k++)
+ 263:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 26a:	eb 51                	jmp    2bd <main+0x2bd>
+      printf(1, "    %x  %d\n", st[i].site[k], st[i].sitecount[k]);
+ 26c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 26f:	89 d0                	mov    %edx,%eax
+ 271:	c1 e0 02             	shl    $0x2,%eax
+ 274:	01 d0                	add    %edx,%eax
+ 276:	c1 e0 02             	shl    $0x2,%eax
+ 279:	01 d0                	add    %edx,%eax
+ 27b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 27e:	01 d0                	add    %edx,%eax
+ 280:	83 c0 10             	add    $0x10,%eax
+ 283:	8b 0c 85 04 0e 00 00 	mov    0xe04(,%eax,4),%ecx
+ 28a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 28d:	89 d0                	mov    %edx,%eax
+ 28f:	c1 e0 02             	shl    $0x2,%eax
+ 292:	01 d0                	add    %edx,%eax
+ 294:	c1 e0 02             	shl    $0x2,%eax
+ 297:	01 d0                	add    %edx,%eax
+ 299:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 29c:	01 d0                	add    %edx,%eax
+ 29e:	83 c0 0c             	add    $0xc,%eax
+ 2a1:	8b 04 85 04 0e 00 00 	mov    0xe04(,%eax,4),%eax
+ 2a8:	51                   	push   %ecx
+ 2a9:	50                   	push   %eax
+ 2aa:	68 78 0b 00 00       	push   $0xb78
+ 2af:	6a 01                	push   $0x1
+ 2b1:	e8 77 04 00 00       	call   72d <printf>
+ 2b6:	83 c4 10             	add    $0x10,%esp
+    for(k = 0; k < NLOCKSITE && st[i].sitecount[k]; k++)
+ 2b9:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+ 2bd:	83 7d dc 03          	cmpl   $0x3,-0x24(%ebp)
+ 2c1:	7f 22                	jg     2e5 <main+0x2e5>
+ 2c3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2c6:	89 d0                	mov    %edx,%eax
+ 2c8:	c1 e0 02             	shl    $0x2,%eax
+ 2cb:	01 d0                	add    %edx,%eax
+ 2cd:	c1 e0 02             	shl    $0x2,%eax
+ 2d0:	01 d0                	add    %edx,%eax
+ 2d2:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 2d5:	01 d0                	add    %edx,%eax
+ 2d7:	83 c0 10             	add    $0x10,%eax
+ 2da:	8b 04 85 04 0e 00 00 	mov    0xe04(,%eax,4),%eax
+ 2e1:	85 c0                	test   %eax,%eax
+ 2e3:	75 87                	jne    26c <main+0x26c>
+  for(i = 0; i < n; i++){
+ 2e5:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 2e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2ec:	3b 45 d4             	cmp    -0x2c(%ebp),%eax
+ 2ef:	0f 8c 82 fe ff ff    	jl     177 <main+0x177>
+  }
+  exit();
+ 2f5:	e8 57 02 00 00       	call   551 <exit>
+
+000002fa <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 2fa:	55                   	push   %ebp
+ 2fb:	89 e5                	mov    %esp,%ebp
+ 2fd:	57                   	push   %edi
+ 2fe:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 2ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 302:	8b 55 10             	mov    0x10(%ebp),%edx
+ 305:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 308:	89 cb                	mov    %ecx,%ebx
+ 30a:	89 df                	mov    %ebx,%edi
+ 30c:	89 d1                	mov    %edx,%ecx
+ 30e:	fc                   	cld
+ 30f:	f3 aa                	rep stos %al,%es:(%edi)
+ 311:	89 ca                	mov    %ecx,%edx
+ 313:	89 fb                	mov    %edi,%ebx
+ 315:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 318:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 31b:	90                   	nop
+ 31c:	5b                   	pop    %ebx
+ 31d:	5f                   	pop    %edi
+ 31e:	5d                   	pop    %ebp
+ 31f:	c3                   	ret
+
+00000320 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 326:	8b 45 08             	mov    0x8(%ebp),%eax
+ 329:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 32c:	90                   	nop
+ 32d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 330:	8d 42 01             	lea    0x1(%edx),%eax
+ 333:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 336:	8b 45 08             	mov    0x8(%ebp),%eax
+ 339:	8d 48 01             	lea    0x1(%eax),%ecx
+ 33c:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 33f:	0f b6 12             	movzbl (%edx),%edx
+ 342:	88 10                	mov    %dl,(%eax)
+ 344:	0f b6 00             	movzbl (%eax),%eax
+ 347:	84 c0                	test   %al,%al
+ 349:	75 e2                	jne    32d <strcpy+0xd>
+    ;
+  return os;
+ 34b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 34e:	c9                   	leave
+ 34f:	c3                   	ret
+
+00000350 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 353:	eb 08                	jmp    35d <strcmp+0xd>
+    p++, q++;
+ 355:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 359:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 35d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 360:	0f b6 00             	movzbl (%eax),%eax
+ 363:	84 c0                	test   %al,%al
+ 365:	74 10                	je     377 <strcmp+0x27>
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36a:	0f b6 10             	movzbl (%eax),%edx
+ 36d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 370:	0f b6 00             	movzbl (%eax),%eax
+ 373:	38 c2                	cmp    %al,%dl
+ 375:	74 de                	je     355 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 377:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37a:	0f b6 00             	movzbl (%eax),%eax
+ 37d:	0f b6 d0             	movzbl %al,%edx
+ 380:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 383:	0f b6 00             	movzbl (%eax),%eax
+ 386:	0f b6 c0             	movzbl %al,%eax
+ 389:	29 c2                	sub    %eax,%edx
+ 38b:	89 d0                	mov    %edx,%eax
+}
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+
+0000038f <strlen>:
+
+uint
+strlen(char *s)
+{
+ 38f:	55                   	push   %ebp
+ 390:	89 e5                	mov    %esp,%ebp
+ 392:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 395:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 39c:	eb 04                	jmp    3a2 <strlen+0x13>
+ 39e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3a2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a8:	01 d0                	add    %edx,%eax
+ 3aa:	0f b6 00             	movzbl (%eax),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	75 ed                	jne    39e <strlen+0xf>
+    ;
+  return n;
+ 3b1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3b4:	c9                   	leave
+ 3b5:	c3                   	ret
+
+000003b6 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3b6:	55                   	push   %ebp
+ 3b7:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3b9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3bc:	50                   	push   %eax
+ 3bd:	ff 75 0c             	push   0xc(%ebp)
+ 3c0:	ff 75 08             	push   0x8(%ebp)
+ 3c3:	e8 32 ff ff ff       	call   2fa <stosb>
+ 3c8:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3cb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3ce:	c9                   	leave
+ 3cf:	c3                   	ret
+
+000003d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	83 ec 04             	sub    $0x4,%esp
+ 3d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d9:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3dc:	eb 14                	jmp    3f2 <strchr+0x22>
+    if(*s == c)
+ 3de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e1:	0f b6 00             	movzbl (%eax),%eax
+ 3e4:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3e7:	75 05                	jne    3ee <strchr+0x1e>
+      return (char*)s;
+ 3e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ec:	eb 13                	jmp    401 <strchr+0x31>
+  for(; *s; s++)
+ 3ee:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f5:	0f b6 00             	movzbl (%eax),%eax
+ 3f8:	84 c0                	test   %al,%al
+ 3fa:	75 e2                	jne    3de <strchr+0xe>
+  return 0;
+ 3fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 401:	c9                   	leave
+ 402:	c3                   	ret
+
+00000403 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 403:	55                   	push   %ebp
+ 404:	89 e5                	mov    %esp,%ebp
+ 406:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 409:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 410:	eb 42                	jmp    454 <gets+0x51>
+    cc = read(0, &c, 1);
+ 412:	83 ec 04             	sub    $0x4,%esp
+ 415:	6a 01                	push   $0x1
+ 417:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 41a:	50                   	push   %eax
+ 41b:	6a 00                	push   $0x0
+ 41d:	e8 47 01 00 00       	call   569 <read>
+ 422:	83 c4 10             	add    $0x10,%esp
+ 425:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 428:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 42c:	7e 33                	jle    461 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 42e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 431:	8d 50 01             	lea    0x1(%eax),%edx
+ 434:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 437:	89 c2                	mov    %eax,%edx
+ 439:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43c:	01 c2                	add    %eax,%edx
+ 43e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 442:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 444:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 448:	3c 0a                	cmp    $0xa,%al
+ 44a:	74 16                	je     462 <gets+0x5f>
+ 44c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 450:	3c 0d                	cmp    $0xd,%al
+ 452:	74 0e                	je     462 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 457:	83 c0 01             	add    $0x1,%eax
+ 45a:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 45d:	7f b3                	jg     412 <gets+0xf>
+ 45f:	eb 01                	jmp    462 <gets+0x5f>
+      break;
+ 461:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 462:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 465:	8b 45 08             	mov    0x8(%ebp),%eax
+ 468:	01 d0                	add    %edx,%eax
+ 46a:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 46d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 470:	c9                   	leave
+ 471:	c3                   	ret
+
+00000472 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 472:	55                   	push   %ebp
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 478:	83 ec 08             	sub    $0x8,%esp
+ 47b:	6a 00                	push   $0x0
+ 47d:	ff 75 08             	push   0x8(%ebp)
+ 480:	e8 0c 01 00 00       	call   591 <open>
+ 485:	83 c4 10             	add    $0x10,%esp
+ 488:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 48b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 48f:	79 07                	jns    498 <stat+0x26>
+    return -1;
+ 491:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 496:	eb 25                	jmp    4bd <stat+0x4b>
+  r = fstat(fd, st);
+ 498:	83 ec 08             	sub    $0x8,%esp
+ 49b:	ff 75 0c             	push   0xc(%ebp)
+ 49e:	ff 75 f4             	push   -0xc(%ebp)
+ 4a1:	e8 03 01 00 00       	call   5a9 <fstat>
+ 4a6:	83 c4 10             	add    $0x10,%esp
+ 4a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4ac:	83 ec 0c             	sub    $0xc,%esp
+ 4af:	ff 75 f4             	push   -0xc(%ebp)
+ 4b2:	e8 c2 00 00 00       	call   579 <close>
+ 4b7:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4bd:	c9                   	leave
+ 4be:	c3                   	ret
+
+000004bf <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4bf:	55                   	push   %ebp
+ 4c0:	89 e5                	mov    %esp,%ebp
+ 4c2:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 4c5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4cc:	eb 25                	jmp    4f3 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4ce:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4d1:	89 d0                	mov    %edx,%eax
+ 4d3:	c1 e0 02             	shl    $0x2,%eax
+ 4d6:	01 d0                	add    %edx,%eax
+ 4d8:	01 c0                	add    %eax,%eax
+ 4da:	89 c1                	mov    %eax,%ecx
+ 4dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4df:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e2:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4e5:	0f b6 00             	movzbl (%eax),%eax
+ 4e8:	0f be c0             	movsbl %al,%eax
+ 4eb:	01 c8                	add    %ecx,%eax
+ 4ed:	83 e8 30             	sub    $0x30,%eax
+ 4f0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f6:	0f b6 00             	movzbl (%eax),%eax
+ 4f9:	3c 2f                	cmp    $0x2f,%al
+ 4fb:	7e 0a                	jle    507 <atoi+0x48>
+ 4fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 500:	0f b6 00             	movzbl (%eax),%eax
+ 503:	3c 39                	cmp    $0x39,%al
+ 505:	7e c7                	jle    4ce <atoi+0xf>
+  return n;
+ 507:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 50a:	c9                   	leave
+ 50b:	c3                   	ret
+
+0000050c <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 50c:	55                   	push   %ebp
+ 50d:	89 e5                	mov    %esp,%ebp
+ 50f:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 512:	8b 45 08             	mov    0x8(%ebp),%eax
+ 515:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 518:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 51b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 51e:	eb 17                	jmp    537 <memmove+0x2b>
+    *dst++ = *src++;
+ 520:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 523:	8d 42 01             	lea    0x1(%edx),%eax
+ 526:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 529:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 52c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 52f:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 532:	0f b6 12             	movzbl (%edx),%edx
+ 535:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 537:	8b 45 10             	mov    0x10(%ebp),%eax
+ 53a:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 53d:	89 55 10             	mov    %edx,0x10(%ebp)
+ 540:	85 c0                	test   %eax,%eax
+ 542:	7f dc                	jg     520 <memmove+0x14>
+  return vdst;
+ 544:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 547:	c9                   	leave
+ 548:	c3                   	ret
+
+00000549 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 549:	b8 01 00 00 00       	mov    $0x1,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <exit>:
+SYSCALL(exit)
+ 551:	b8 02 00 00 00       	mov    $0x2,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <wait>:
+SYSCALL(wait)
+ 559:	b8 03 00 00 00       	mov    $0x3,%eax
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <pipe>:
+SYSCALL(pipe)
+ 561:	b8 04 00 00 00       	mov    $0x4,%eax
+ 566:	cd 40                	int    $0x40
+ 568:	c3                   	ret
+
+00000569 <read>:
+SYSCALL(read)
+ 569:	b8 05 00 00 00       	mov    $0x5,%eax
+ 56e:	cd 40                	int    $0x40
+ 570:	c3                   	ret
+
+00000571 <write>:
+SYSCALL(write)
+ 571:	b8 10 00 00 00       	mov    $0x10,%eax
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <close>:
+SYSCALL(close)
+ 579:	b8 15 00 00 00       	mov    $0x15,%eax
+ 57e:	cd 40                	int    $0x40
+ 580:	c3                   	ret
+
+00000581 <kill>:
+SYSCALL(kill)
+ 581:	b8 06 00 00 00       	mov    $0x6,%eax
+ 586:	cd 40                	int    $0x40
+ 588:	c3                   	ret
+
+00000589 <exec>:
+SYSCALL(exec)
+ 589:	b8 07 00 00 00       	mov    $0x7,%eax
+ 58e:	cd 40                	int    $0x40
+ 590:	c3                   	ret
+
+00000591 <open>:
+SYSCALL(open)
+ 591:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 596:	cd 40                	int    $0x40
+ 598:	c3                   	ret
+
+00000599 <mknod>:
+SYSCALL(mknod)
+ 599:	b8 11 00 00 00       	mov    $0x11,%eax
+ 59e:	cd 40                	int    $0x40
+ 5a0:	c3                   	ret
+
+000005a1 <unlink>:
+SYSCALL(unlink)
+ 5a1:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a6:	cd 40                	int    $0x40
+ 5a8:	c3                   	ret
+
+000005a9 <fstat>:
+SYSCALL(fstat)
+ 5a9:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ae:	cd 40                	int    $0x40
+ 5b0:	c3                   	ret
+
+000005b1 <link>:
+SYSCALL(link)
+ 5b1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b6:	cd 40                	int    $0x40
+ 5b8:	c3                   	ret
+
+000005b9 <mkdir>:
+SYSCALL(mkdir)
+ 5b9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5be:	cd 40                	int    $0x40
+ 5c0:	c3                   	ret
+
+000005c1 <chdir>:
+SYSCALL(chdir)
+ 5c1:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5c6:	cd 40                	int    $0x40
+ 5c8:	c3                   	ret
+
+000005c9 <dup>:
+SYSCALL(dup)
+ 5c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5ce:	cd 40                	int    $0x40
+ 5d0:	c3                   	ret
+
+000005d1 <getpid>:
+SYSCALL(getpid)
+ 5d1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5d6:	cd 40                	int    $0x40
+ 5d8:	c3                   	ret
+
+000005d9 <sbrk>:
+SYSCALL(sbrk)
+ 5d9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <sleep>:
+SYSCALL(sleep)
+ 5e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5e6:	cd 40                	int    $0x40
+ 5e8:	c3                   	ret
+
+000005e9 <uptime>:
+SYSCALL(uptime)
+ 5e9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5ee:	cd 40                	int    $0x40
+ 5f0:	c3                   	ret
+
+000005f1 <clone>:
+SYSCALL(clone)
+ 5f1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f6:	cd 40                	int    $0x40
+ 5f8:	c3                   	ret
+
+000005f9 <join>:
+SYSCALL(join)
+ 5f9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5fe:	cd 40                	int    $0x40
+ 600:	c3                   	ret
+
+00000601 <futex_wait>:
+SYSCALL(futex_wait)
+ 601:	b8 18 00 00 00       	mov    $0x18,%eax
+ 606:	cd 40                	int    $0x40
+ 608:	c3                   	ret
+
+00000609 <futex_wake>:
+SYSCALL(futex_wake)
+ 609:	b8 19 00 00 00       	mov    $0x19,%eax
+ 60e:	cd 40                	int    $0x40
+ 610:	c3                   	ret
+
+00000611 <setaffinity>:
+SYSCALL(setaffinity)
+ 611:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 616:	cd 40                	int    $0x40
+ 618:	c3                   	ret
+
+00000619 <getaffinity>:
+SYSCALL(getaffinity)
+ 619:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 61e:	cd 40                	int    $0x40
+ 620:	c3                   	ret
+
+00000621 <getrusage>:
+SYSCALL(getrusage)
+ 621:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 626:	cd 40                	int    $0x40
+ 628:	c3                   	ret
+
+00000629 <lockstat>:
+SYSCALL(lockstat)
+ 629:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 62e:	cd 40                	int    $0x40
+ 630:	c3                   	ret
+
+00000631 <statfs>:
+SYSCALL(statfs)
+ 631:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 636:	cd 40                	int    $0x40
+ 638:	c3                   	ret
+
+00000639 <bcachesize>:
+SYSCALL(bcachesize)
+ 639:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 63e:	cd 40                	int    $0x40
+ 640:	c3                   	ret
+
+00000641 <bcstat>:
+SYSCALL(bcstat)
+ 641:	b8 20 00 00 00       	mov    $0x20,%eax
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <sync>:
+SYSCALL(sync)
+ 649:	b8 21 00 00 00       	mov    $0x21,%eax
+ 64e:	cd 40                	int    $0x40
+ 650:	c3                   	ret
+
+00000651 <fsync>:
+SYSCALL(fsync)
+ 651:	b8 22 00 00 00       	mov    $0x22,%eax
+ 656:	cd 40                	int    $0x40
+ 658:	c3                   	ret
+
+00000659 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 659:	55                   	push   %ebp
+ 65a:	89 e5                	mov    %esp,%ebp
+ 65c:	83 ec 18             	sub    $0x18,%esp
+ 65f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 662:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 665:	83 ec 04             	sub    $0x4,%esp
+ 668:	6a 01                	push   $0x1
+ 66a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 66d:	50                   	push   %eax
+ 66e:	ff 75 08             	push   0x8(%ebp)
+ 671:	e8 fb fe ff ff       	call   571 <write>
+ 676:	83 c4 10             	add    $0x10,%esp
+}
+ 679:	90                   	nop
+ 67a:	c9                   	leave
+ 67b:	c3                   	ret
+
+0000067c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 67c:	55                   	push   %ebp
+ 67d:	89 e5                	mov    %esp,%ebp
+ 67f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 682:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 689:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 68d:	74 17                	je     6a6 <printint+0x2a>
+ 68f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 693:	79 11                	jns    6a6 <printint+0x2a>
+    neg = 1;
+ 695:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 69c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 69f:	f7 d8                	neg    %eax
+ 6a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6a4:	eb 06                	jmp    6ac <printint+0x30>
+  } else {
+    x = xx;
+ 6a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6b3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6b9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6be:	f7 f1                	div    %ecx
+ 6c0:	89 d1                	mov    %edx,%ecx
+ 6c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c5:	8d 50 01             	lea    0x1(%eax),%edx
+ 6c8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6cb:	0f b6 91 dc 0d 00 00 	movzbl 0xddc(%ecx),%edx
+ 6d2:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6d6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6dc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6e1:	f7 f1                	div    %ecx
+ 6e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6ea:	75 c7                	jne    6b3 <printint+0x37>
+  if(neg)
+ 6ec:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6f0:	74 2d                	je     71f <printint+0xa3>
+    buf[i++] = '-';
+ 6f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f5:	8d 50 01             	lea    0x1(%eax),%edx
+ 6f8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6fb:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 700:	eb 1d                	jmp    71f <printint+0xa3>
+    putc(fd, buf[i]);
+ 702:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 705:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 708:	01 d0                	add    %edx,%eax
+ 70a:	0f b6 00             	movzbl (%eax),%eax
+ 70d:	0f be c0             	movsbl %al,%eax
+ 710:	83 ec 08             	sub    $0x8,%esp
+ 713:	50                   	push   %eax
+ 714:	ff 75 08             	push   0x8(%ebp)
+ 717:	e8 3d ff ff ff       	call   659 <putc>
+ 71c:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 71f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 723:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 727:	79 d9                	jns    702 <printint+0x86>
+}
+ 729:	90                   	nop
+ 72a:	90                   	nop
+ 72b:	c9                   	leave
+ 72c:	c3                   	ret
+
+0000072d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 72d:	55                   	push   %ebp
+ 72e:	89 e5                	mov    %esp,%ebp
+ 730:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 733:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 73a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 73d:	83 c0 04             	add    $0x4,%eax
+ 740:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 743:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 74a:	e9 59 01 00 00       	jmp    8a8 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 74f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 752:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 755:	01 d0                	add    %edx,%eax
+ 757:	0f b6 00             	movzbl (%eax),%eax
+ 75a:	0f be c0             	movsbl %al,%eax
+ 75d:	25 ff 00 00 00       	and    $0xff,%eax
+ 762:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 765:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 769:	75 2c                	jne    797 <printf+0x6a>
+      if(c == '%'){
+ 76b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 76f:	75 0c                	jne    77d <printf+0x50>
+        state = '%';
+ 771:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 778:	e9 27 01 00 00       	jmp    8a4 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 77d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 780:	0f be c0             	movsbl %al,%eax
+ 783:	83 ec 08             	sub    $0x8,%esp
+ 786:	50                   	push   %eax
+ 787:	ff 75 08             	push   0x8(%ebp)
+ 78a:	e8 ca fe ff ff       	call   659 <putc>
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	e9 0d 01 00 00       	jmp    8a4 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 797:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 79b:	0f 85 03 01 00 00    	jne    8a4 <printf+0x177>
+      if(c == 'd'){
+ 7a1:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7a5:	75 1e                	jne    7c5 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7aa:	8b 00                	mov    (%eax),%eax
+ 7ac:	6a 01                	push   $0x1
+ 7ae:	6a 0a                	push   $0xa
+ 7b0:	50                   	push   %eax
+ 7b1:	ff 75 08             	push   0x8(%ebp)
+ 7b4:	e8 c3 fe ff ff       	call   67c <printint>
+ 7b9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7bc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7c0:	e9 d8 00 00 00       	jmp    89d <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 7c5:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7c9:	74 06                	je     7d1 <printf+0xa4>
+ 7cb:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7cf:	75 1e                	jne    7ef <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 7d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7d4:	8b 00                	mov    (%eax),%eax
+ 7d6:	6a 00                	push   $0x0
+ 7d8:	6a 10                	push   $0x10
+ 7da:	50                   	push   %eax
+ 7db:	ff 75 08             	push   0x8(%ebp)
+ 7de:	e8 99 fe ff ff       	call   67c <printint>
+ 7e3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7e6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7ea:	e9 ae 00 00 00       	jmp    89d <printf+0x170>
+      } else if(c == 's'){
+ 7ef:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7f3:	75 43                	jne    838 <printf+0x10b>
+        s = (char*)*ap;
+ 7f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7fd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 801:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 805:	75 25                	jne    82c <printf+0xff>
+          s = "(null)";
+ 807:	c7 45 f4 84 0b 00 00 	movl   $0xb84,-0xc(%ebp)
+        while(*s != 0){
+ 80e:	eb 1c                	jmp    82c <printf+0xff>
+          putc(fd, *s);
+ 810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 813:	0f b6 00             	movzbl (%eax),%eax
+ 816:	0f be c0             	movsbl %al,%eax
+ 819:	83 ec 08             	sub    $0x8,%esp
+ 81c:	50                   	push   %eax
+ 81d:	ff 75 08             	push   0x8(%ebp)
+ 820:	e8 34 fe ff ff       	call   659 <putc>
+ 825:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 828:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 82c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 82f:	0f b6 00             	movzbl (%eax),%eax
+ 832:	84 c0                	test   %al,%al
+ 834:	75 da                	jne    810 <printf+0xe3>
+ 836:	eb 65                	jmp    89d <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 838:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 83c:	75 1d                	jne    85b <printf+0x12e>
+        putc(fd, *ap);
+ 83e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 841:	8b 00                	mov    (%eax),%eax
+ 843:	0f be c0             	movsbl %al,%eax
+ 846:	83 ec 08             	sub    $0x8,%esp
+ 849:	50                   	push   %eax
+ 84a:	ff 75 08             	push   0x8(%ebp)
+ 84d:	e8 07 fe ff ff       	call   659 <putc>
+ 852:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 855:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 859:	eb 42                	jmp    89d <printf+0x170>
+      } else if(c == '%'){
+ 85b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 85f:	75 17                	jne    878 <printf+0x14b>
+        putc(fd, c);
+ 861:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 864:	0f be c0             	movsbl %al,%eax
+ 867:	83 ec 08             	sub    $0x8,%esp
+ 86a:	50                   	push   %eax
+ 86b:	ff 75 08             	push   0x8(%ebp)
+ 86e:	e8 e6 fd ff ff       	call   659 <putc>
+ 873:	83 c4 10             	add    $0x10,%esp
+ 876:	eb 25                	jmp    89d <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 878:	83 ec 08             	sub    $0x8,%esp
+ 87b:	6a 25                	push   $0x25
+ 87d:	ff 75 08             	push   0x8(%ebp)
+ 880:	e8 d4 fd ff ff       	call   659 <putc>
+ 885:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 888:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 88b:	0f be c0             	movsbl %al,%eax
+ 88e:	83 ec 08             	sub    $0x8,%esp
+ 891:	50                   	push   %eax
+ 892:	ff 75 08             	push   0x8(%ebp)
+ 895:	e8 bf fd ff ff       	call   659 <putc>
+ 89a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 89d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8a4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8ae:	01 d0                	add    %edx,%eax
+ 8b0:	0f b6 00             	movzbl (%eax),%eax
+ 8b3:	84 c0                	test   %al,%al
+ 8b5:	0f 85 94 fe ff ff    	jne    74f <printf+0x22>
+    }
+  }
+}
+ 8bb:	90                   	nop
+ 8bc:	90                   	nop
+ 8bd:	c9                   	leave
+ 8be:	c3                   	ret
+
+000008bf <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8bf:	55                   	push   %ebp
+ 8c0:	89 e5                	mov    %esp,%ebp
+ 8c2:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c8:	83 e8 08             	sub    $0x8,%eax
+ 8cb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ce:	a1 88 18 00 00       	mov    0x1888,%eax
+ 8d3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8d6:	eb 24                	jmp    8fc <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8db:	8b 00                	mov    (%eax),%eax
+ 8dd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8e0:	72 12                	jb     8f4 <free+0x35>
+ 8e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8e8:	72 24                	jb     90e <free+0x4f>
+ 8ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ed:	8b 00                	mov    (%eax),%eax
+ 8ef:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8f2:	72 1a                	jb     90e <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f7:	8b 00                	mov    (%eax),%eax
+ 8f9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8fc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ff:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 902:	73 d4                	jae    8d8 <free+0x19>
+ 904:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 907:	8b 00                	mov    (%eax),%eax
+ 909:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 90c:	73 ca                	jae    8d8 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 90e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 911:	8b 40 04             	mov    0x4(%eax),%eax
+ 914:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 91b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91e:	01 c2                	add    %eax,%edx
+ 920:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 923:	8b 00                	mov    (%eax),%eax
+ 925:	39 c2                	cmp    %eax,%edx
+ 927:	75 24                	jne    94d <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 929:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92c:	8b 50 04             	mov    0x4(%eax),%edx
+ 92f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 932:	8b 00                	mov    (%eax),%eax
+ 934:	8b 40 04             	mov    0x4(%eax),%eax
+ 937:	01 c2                	add    %eax,%edx
+ 939:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 93c:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 93f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 942:	8b 00                	mov    (%eax),%eax
+ 944:	8b 10                	mov    (%eax),%edx
+ 946:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 949:	89 10                	mov    %edx,(%eax)
+ 94b:	eb 0a                	jmp    957 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 94d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 950:	8b 10                	mov    (%eax),%edx
+ 952:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 955:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 957:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95a:	8b 40 04             	mov    0x4(%eax),%eax
+ 95d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 964:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 967:	01 d0                	add    %edx,%eax
+ 969:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 96c:	75 20                	jne    98e <free+0xcf>
+    p->s.size += bp->s.size;
+ 96e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 971:	8b 50 04             	mov    0x4(%eax),%edx
+ 974:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 977:	8b 40 04             	mov    0x4(%eax),%eax
+ 97a:	01 c2                	add    %eax,%edx
+ 97c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 982:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 985:	8b 10                	mov    (%eax),%edx
+ 987:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98a:	89 10                	mov    %edx,(%eax)
+ 98c:	eb 08                	jmp    996 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 98e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 991:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 994:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 996:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 999:	a3 88 18 00 00       	mov    %eax,0x1888
+}
+ 99e:	90                   	nop
+ 99f:	c9                   	leave
+ 9a0:	c3                   	ret
+
+000009a1 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9a1:	55                   	push   %ebp
+ 9a2:	89 e5                	mov    %esp,%ebp
+ 9a4:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 9a7:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 9ae:	77 07                	ja     9b7 <morecore+0x16>
+    nu = 4096;
+ 9b0:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 9b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ba:	c1 e0 03             	shl    $0x3,%eax
+ 9bd:	83 ec 0c             	sub    $0xc,%esp
+ 9c0:	50                   	push   %eax
+ 9c1:	e8 13 fc ff ff       	call   5d9 <sbrk>
+ 9c6:	83 c4 10             	add    $0x10,%esp
+ 9c9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 9cc:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9d0:	75 07                	jne    9d9 <morecore+0x38>
+    return 0;
+ 9d2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9d7:	eb 26                	jmp    9ff <morecore+0x5e>
+  hp = (Header*)p;
+ 9d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9dc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9e5:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9eb:	83 c0 08             	add    $0x8,%eax
+ 9ee:	83 ec 0c             	sub    $0xc,%esp
+ 9f1:	50                   	push   %eax
+ 9f2:	e8 c8 fe ff ff       	call   8bf <free>
+ 9f7:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9fa:	a1 88 18 00 00       	mov    0x1888,%eax
+}
+ 9ff:	c9                   	leave
+ a00:	c3                   	ret
+
+00000a01 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a01:	55                   	push   %ebp
+ a02:	89 e5                	mov    %esp,%ebp
+ a04:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a07:	8b 45 08             	mov    0x8(%ebp),%eax
+ a0a:	83 c0 07             	add    $0x7,%eax
+ a0d:	c1 e8 03             	shr    $0x3,%eax
+ a10:	83 c0 01             	add    $0x1,%eax
+ a13:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a16:	a1 88 18 00 00       	mov    0x1888,%eax
+ a1b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a1e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a22:	75 23                	jne    a47 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a24:	c7 45 f0 80 18 00 00 	movl   $0x1880,-0x10(%ebp)
+ a2b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a2e:	a3 88 18 00 00       	mov    %eax,0x1888
+ a33:	a1 88 18 00 00       	mov    0x1888,%eax
+ a38:	a3 80 18 00 00       	mov    %eax,0x1880
+    base.s.size = 0;
+ a3d:	c7 05 84 18 00 00 00 	movl   $0x0,0x1884
+ a44:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a47:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a4a:	8b 00                	mov    (%eax),%eax
+ a4c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a52:	8b 40 04             	mov    0x4(%eax),%eax
+ a55:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a58:	72 4d                	jb     aa7 <malloc+0xa6>
+      if(p->s.size == nunits)
+ a5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5d:	8b 40 04             	mov    0x4(%eax),%eax
+ a60:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a63:	75 0c                	jne    a71 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a68:	8b 10                	mov    (%eax),%edx
+ a6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a6d:	89 10                	mov    %edx,(%eax)
+ a6f:	eb 26                	jmp    a97 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a74:	8b 40 04             	mov    0x4(%eax),%eax
+ a77:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a7a:	89 c2                	mov    %eax,%edx
+ a7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7f:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a85:	8b 40 04             	mov    0x4(%eax),%eax
+ a88:	c1 e0 03             	shl    $0x3,%eax
+ a8b:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a91:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a94:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a97:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9a:	a3 88 18 00 00       	mov    %eax,0x1888
+      return (void*)(p + 1);
+ a9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa2:	83 c0 08             	add    $0x8,%eax
+ aa5:	eb 3b                	jmp    ae2 <malloc+0xe1>
+    }
+    if(p == freep)
+ aa7:	a1 88 18 00 00       	mov    0x1888,%eax
+ aac:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ aaf:	75 1e                	jne    acf <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ab1:	83 ec 0c             	sub    $0xc,%esp
+ ab4:	ff 75 ec             	push   -0x14(%ebp)
+ ab7:	e8 e5 fe ff ff       	call   9a1 <morecore>
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ac2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ac6:	75 07                	jne    acf <malloc+0xce>
+        return 0;
+ ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+ acd:	eb 13                	jmp    ae2 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ acf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ad5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad8:	8b 00                	mov    (%eax),%eax
+ ada:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ add:	e9 6d ff ff ff       	jmp    a4f <malloc+0x4e>
+  }
+}
+ ae2:	c9                   	leave
+ ae3:	c3                   	ret
@@ -0,0 +1,47 @@
+// Print lock contention statistics, most contended first.
+// With -r, also start counting again from zero.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+struct lockstat st[NLOCKSTAT];
+
+int
+main(int argc, char *argv[])
+{
+  struct lockstat t;
+  int i, j, k, n, reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if(argc > 2 || (argc == 2 && !reset)){
+    printf(2, "usage: lockstat [-r]\n");
+    exit();
+  }
+  if((n = lockstat(st, NLOCKSTAT, reset)) < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+
+  // Sort by total cycles spent waiting.
+  for(i = 1; i < n; i++){
+    t = st[i];
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+      st[j] = st[j-1];
+    st[j] = t;
+  }
+
+  printf(1, "lock        acquires contended spin-kcyc max-spin hold-kcyc max-hold sleeps\n");
+  for(i = 0; i < n; i++){
+    printf(1, "%s", st[i].name);
+    for(j = strlen(st[i].name); j < 12; j++)
+      printf(1, " ");
+    printf(1, "%d %d %d %d %d %d %d\n", st[i].acquires, st[i].contended,
+           (uint)(st[i].spin >> 10), st[i].maxspin,
+           (uint)(st[i].hold >> 10), st[i].maxhold, st[i].sleeps);
+    for(k = 0; k < NLOCKSITE && st[i].sitecount[k]; k++)
+      printf(1, "    %x  %d\n", st[i].site[k], st[i].sitecount[k]);
+  }
+  exit();
+}
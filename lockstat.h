@@ -0,0 +1,17 @@
+// Lock contention statistics, kept per class of spinlock.
+// Locks with the same name (e.g. every pipe's lock) share a class.
+#define NLOCKSTAT  32  // maximum number of lock classes
+#define NLOCKSITE  4   // contending call sites kept per class
+
+struct lockstat {
+  char name[16];              // Lock name
+  uint acquires;              // Times acquired
+  uint contended;             // Times a CPU had to wait
+  uint64 spin;                // Total cycles spent waiting
+  uint maxspin;               // Longest wait, in cycles
+  uint64 hold;                // Total cycles held
+  uint maxhold;               // Longest hold, in cycles
+  uint sleeps;                // Times a process slept waiting (sleep locks)
+  uint site[NLOCKSITE];       // Callers of contended acquires
+  uint sitecount[NLOCKSITE];  // Contended acquires from each
+};
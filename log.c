@@ -1,9 +1,14 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "rusage.h"
+#include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcstat.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
@@ -17,30 +22,73 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// asks for a commit and sleeps until it is done.
+// Each operation reserves as many log blocks as it may add,
+// MAXOPBLOCKS unless it starts with begin_opn(), and the
+// blocks it adds to the transaction come out of its
+// reservation, so begin_op() counts only the blocks that
+// outstanding operations may still add.
+//
+// The size of the log comes from the super block.
+//
+// Commits are made by the flusher, a kernel process, not by
+// the system calls: when the transaction is COMMITTICKS old,
+// when the log is half full, when begin_op() runs out of log
+// space, or when log_sync() asks.  A transaction thus groups
+// the operations of many system calls.  Between commits the
+// flusher writes back file data that bdwrite() left dirty.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+//   header block, containing block #s for block A, B, C, ...,
+//     a sequence number and a checksum
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Writing the header commits a transaction; it is not erased
+// after the blocks are installed.  The next transaction's
+// blocks overwrite the old ones in the log before its header
+// is written, so the checksum, over the whole header and the
+// logged blocks, tells recovery whether the log still holds
+// the transaction the header describes.  A header larger than
+// a sector may be torn by a crash; the checksum catches that
+// too.  Installing a transaction again is harmless.
+//
+// Log appends are synchronous.  Logged blocks are written to
+// the log and then installed from their pinned cache buffers;
+// the log is only read back from disk by recovery.
+//
+// Only metadata is logged: inodes, bitmaps, directories and
+// indirect blocks.  writei() leaves file data to be written
+// straight to its home location, and commit() writes all of
+// it before the log, and so before the commit that makes the
+// data part of the file (ordered data).
+
+#define LOGBATCH 4  // log blocks in flight at once
+#define LOGMAX (MAXBSIZE/sizeof(int) - 3)  // most blocks a header can list
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;   
-  int block[LOGSIZE];
+  uint seq;    // sequence number of the transaction
+  uint cksum;  // of the header and the logged blocks; see logsum()
+  int block[LOGMAX];
 };
 
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int size;        // blocks a transaction may log
   int outstanding; // how many FS sys calls are executing.
+  int maxops;      // most outstanding at once; see logstat().
+  int reserved;    // blocks they may still add; see begin_op().
   int committing;  // in commit(), please wait.
+  int want;        // commits asked for; see log_sync().
+  int done;        // commits made
+  uint since;      // ticks when the transaction logged its first block
+  volatile int kick; // wake the flusher
   int dev;
   struct logheader lh;
 };
@@ -48,35 +96,92 @@ struct log log;
 
 static void recover_from_log(void);
 static void commit();
+static void flusher(void);
+static void logwant(int);
+
+// Add the n bytes at p to checksum sum (FNV-1a, a word at a time).
+static uint
+logsum(uint sum, void *p, uint n)
+{
+  uint *w;
+
+  for(w = p; w < (uint*)p + n/sizeof(uint); w++)
+    sum = (sum ^ *w) * 16777619;
+  return sum;
+}
+
+// Start a checksum over the header's fields other than cksum.
+static uint
+loghdrsum(void)
+{
+  uint sum;
+
+  sum = logsum(2166136261, &log.lh.n, sizeof(log.lh.n));
+  sum = logsum(sum, &log.lh.seq, sizeof(log.lh.seq));
+  return logsum(sum, log.lh.block, log.lh.n*sizeof(log.lh.block[0]));
+}
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  log.size = sb.nlog - 1;  // less the header block
+  if (log.size > blocksize/sizeof(int) - 3)
+    log.size = blocksize/sizeof(int) - 3;  // header must fit in a block
+  if (log.size < MAXOPBLOCKS)
+    panic("initlog: log too small");
   log.dev = dev;
+  breserve(log.size);  // the cache must hold the blocks the log pins
   recover_from_log();
+  kproc("flusher", flusher);
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks to their home locations, LOGBATCH at
+// a time.  After a commit the blocks are still pinned in the
+// cache, so they are written from there.  When recovering
+// after a crash, read a batch of log blocks and write each to
+// its home as soon as it arrives, keeping the disk busy.  The
+// home blocks are overwritten whole, so they are not read
+// first.  Each home block is released as soon as its write
+// finishes, so that a process waiting for it need not wait
+// for the whole batch.
 static void 
-install_trans(void)
+install_trans(int recovering)
 {
-  int tail;
+  struct buf *lbuf[LOGBATCH], *dbuf[LOGBATCH];
+  int tail, i, n, left;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf); 
-    brelse(dbuf);
+  for (tail = 0; tail < log.lh.n; tail += n) {
+    n = log.lh.n - tail;
+    if (n > LOGBATCH)
+      n = LOGBATCH;
+    if (recovering) {
+      for (i = 0; i < n; i++) {
+        lbuf[i] = bget(log.dev, log.start+tail+i+1); // read log block
+        bsubmit(lbuf[i], 0);
+      }
+      for (left = n; left > 0; left--) {
+        i = bwaitany(lbuf, left);
+        dbuf[n-left] = bget(log.dev, log.lh.block[lbuf[i]->blockno-log.start-1]); // dst
+        memmove(dbuf[n-left]->data, lbuf[i]->data, blocksize);  // copy block to dst
+        bsubmit(dbuf[n-left], 1);  // write dst to disk
+        brelse(lbuf[i]);
+        lbuf[i] = lbuf[left-1];
+      }
+    } else {
+      for (i = 0; i < n; i++) {
+        dbuf[i] = bget(log.dev, log.lh.block[tail+i]); // dst
+        bsubmit(dbuf[i], 1);  // write dst to disk
+      }
+    }
+    for (left = n; left > 0; left--) {
+      i = bwaitany(dbuf, left);
+      brelse(dbuf[i]);
+      dbuf[i] = dbuf[left-1];
+    }
   }
 }
 
@@ -88,6 +193,10 @@ read_head(void)
   struct logheader *lh = (struct logheader *) (buf->data);
   int i;
   log.lh.n = lh->n;
+  log.lh.seq = lh->seq;
+  log.lh.cksum = lh->cksum;
+  if (log.lh.n < 0 || log.lh.n > log.size)
+    log.lh.n = 0;
   for (i = 0; i < log.lh.n; i++) {
     log.lh.block[i] = lh->block[i];
   }
@@ -100,10 +209,12 @@ read_head(void)
 static void
 write_head(void)
 {
-  struct buf *buf = bread(log.dev, log.start);
+  struct buf *buf = bget(log.dev, log.start);  // overwritten, not read
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
   hb->n = log.lh.n;
+  hb->seq = log.lh.seq;
+  hb->cksum = log.lh.cksum;
   for (i = 0; i < log.lh.n; i++) {
     hb->block[i] = log.lh.block[i];
   }
@@ -111,28 +222,61 @@ write_head(void)
   brelse(buf);
 }
 
+// Does the log still hold the transaction its header describes?
+// The blocks read stay in the cache for install_trans().
+static int
+log_intact(void)
+{
+  struct buf *b;
+  uint sum;
+  int i;
+
+  sum = loghdrsum();
+  for (i = 0; i < log.lh.n; i++) {
+    b = bread(log.dev, log.start+i+1);
+    sum = logsum(sum, b->data, blocksize);
+    brelse(b);
+  }
+  return sum == log.lh.cksum;
+}
+
 static void
 recover_from_log(void)
 {
   read_head();      
-  install_trans(); // if committed, copy from log to disk
+  if (log.lh.n > 0 && log_intact())
+    install_trans(1); // if committed, copy from log to disk
   log.lh.n = 0;
-  write_head(); // clear the log
 }
 
 // called at the start of each FS system call.
 void
 begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
+// called instead of begin_op() by a system call that adds
+// at most n blocks to the transaction.
+void
+begin_opn(int n)
 {
   acquire(&log.lock);
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    } else if(log.lh.n + log.reserved + n > log.size ||
+              (log.lh.n > 0 && bfreeheld(log.outstanding + 1))){
+      // this op might exhaust log space, or free space
+      // held until commit; wait for commit.
+      logwant(log.done + 1);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      if(log.outstanding > log.maxops)
+        log.maxops = log.outstanding;
+      log.reserved += n;
+      proc->logres = n;
       release(&log.lock);
       break;
     }
@@ -140,61 +284,144 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// The flusher commits once no operation is outstanding.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+  log.reserved -= proc->logres;  // return what this op did not use
+  proc->logres = 0;
+  if(log.outstanding == 0 && log.committing){
+    // the flusher is waiting to commit.
+    wakeup(&log.committing);
   } else {
     // begin_op() may be waiting for log space.
     wakeup(&log);
   }
   release(&log.lock);
+}
+
+// Ask the flusher for commit number n and wake it.
+// Caller holds log.lock.
+static void
+logwant(int n)
+{
+  if(log.want < n)
+    log.want = n;
+  log.kick = 1;
+  wakeup(&ticks);
+}
+
+// Commit the transaction, and all file data written so far,
+// and wait until it is on disk.  A commit in progress
+// includes the caller's finished operations, so wait for
+// the next one to end.
+void
+log_sync(void)
+{
+  int n;
+
+  acquire(&log.lock);
+  n = log.done + 1;
+  logwant(n);
+  while(log.done < n)
+    sleep(&log, &log.lock);
+  release(&log.lock);
+}
+
+// Is a commit due?  Caller holds log.lock.
+static int
+commitdue(void)
+{
+  if(log.want > log.done)
+    return 1;
+  if(log.lh.n == 0)
+    return 0;
+  return ticks - log.since >= COMMITTICKS || log.lh.n*2 >= log.size;
+}
+
+// The flusher, a kernel process started by initlog().
+// Every FLUSHTICKS, or sooner when kicked, it commits the
+// transaction if one is due or else writes back old file
+// data.
+static void
+flusher(void)
+{
+  uint t0;
+
+  for(;;){
+    // The kick is not checked under tickslock, so one can be
+    // missed, but only until the next tick wakes us.
+    acquire(&tickslock);
+    t0 = ticks;
+    while(ticks - t0 < FLUSHTICKS && !log.kick)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    acquire(&log.lock);
+    log.kick = 0;
+    if(!commitdue()){
+      release(&log.lock);
+      bflush(0);
+      continue;
+    }
+    // Keep new operations out and wait for the
+    // outstanding ones to end.
+    log.committing = 1;
+    while(log.outstanding > 0)
+      sleep(&log.committing, &log.lock);
+    release(&log.lock);
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
     commit();
+
     acquire(&log.lock);
     log.committing = 0;
+    log.done++;
     wakeup(&log);
     release(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Write modified blocks from the cache straight to the log,
+// LOGBATCH at a time, and compute the header's checksum.
+// The blocks stay pinned in the cache with B_DIRTY until
+// install_trans() writes them home.
 static void 
 write_log(void)
 {
-  int tail;
+  struct buf *b[LOGBATCH];
+  int tail, i, n;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from); 
-    brelse(to);
+  log.lh.cksum = loghdrsum();
+  for (tail = 0; tail < log.lh.n; tail += n) {
+    n = log.lh.n - tail;
+    if (n > LOGBATCH)
+      n = LOGBATCH;
+    for (i = 0; i < n; i++) {
+      b[i] = bget(log.dev, log.lh.block[tail+i]); // cache block
+      log.lh.cksum = logsum(log.lh.cksum, b[i]->data, blocksize);
+      bsubmitat(b[i], log.start+tail+i+1);  // write it to the log
+    }
+    bwait(b, n);
+    for (i = 0; i < n; i++) {
+      b[i]->flags |= B_DIRTY;  // not home yet; keep pinned
+      brelse(b[i]);
+    }
   }
 }
 
 static void
 commit()
 {
+  bflush(1);         // File data first (ordered data)
   if (log.lh.n > 0) {
+    log.lh.seq++;
     write_log();     // Write modified blocks from cache to log
     write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0; 
-    write_head();    // Erase the transaction from the log
+    install_trans(0); // Now install writes to home locations
+    log.lh.n = 0;    // No need to erase it from the log
+    bfreecommitted(); // Blocks it freed may be reused
   }
 }
 
@@ -212,8 +439,6 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
-    panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
@@ -222,10 +447,32 @@ log_write(struct buf *b)
     if (log.lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
-  b->flags |= B_DIRTY; // prevent eviction
+  if (i == log.lh.n) {
+    if (log.lh.n >= log.size)
+      panic("too big a transaction");
+    log.lh.block[i] = b->blockno;
+    if (log.lh.n++ == 0)
+      log.since = ticks;
+    proc->ru.oublock++;  // the commit will write it
+    if (proc->logres > 0) {
+      proc->logres--;
+      log.reserved--;
+    }
+  }
   release(&log.lock);
+  blogged(b); // prevent eviction
 }
 
+// Add the log's statistics to st and, if reset, start
+// counting the most outstanding operations again.
+void
+logstat(struct bcstat *st, int reset)
+{
+  acquire(&log.lock);
+  st->logsize = log.size;
+  st->commits = log.done;
+  st->maxops = log.maxops;
+  if(reset)
+    log.maxops = log.outstanding;
+  release(&log.lock);
+}
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -28,14 +29,15 @@ main(void)
   consoleinit();   // I/O devices & their interrupts
   uartinit();      // serial port
   pinit();         // process table
+  rcuinit();       // read-copy-update grace periods
   tvinit();        // trap vectors
-  binit();         // buffer cache
   fileinit();      // file table
   ideinit();       // disk
   if(!ismp)
     timerinit();   // uniprocessor timer
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized from free memory
   userinit();      // first user process
   // Finish setting up this processor in mpmain.
   mpmain();
@@ -5,23 +5,25 @@
 #include "defs.h"
 #include "param.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
-extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
+extern uchar _binary_fsmem_img_start[], _binary_fsmem_img_size[];
 
-static int disksize;
+static int disksize;  // bytes
 static uchar *memdisk;
 
 void
 ideinit(void)
 {
-  memdisk = _binary_fs_img_start;
-  disksize = (uint)_binary_fs_img_size/BSIZE;
+  memdisk = _binary_fsmem_img_start;
+  disksize = (uint)_binary_fsmem_img_size;
 }
 
 // Interrupt handler.
@@ -34,26 +36,50 @@ ideintr(void)
 // Sync buf with disk. 
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// The memory disk is done at once, so there is never anything
+// to wait for.
 void
-iderw(struct buf *b)
+idesubmit(struct buf *b)
 {
   uchar *p;
 
-  if(!(b->flags & B_BUSY))
-    panic("iderw: buf not busy");
+  if(!holdingsleep(&b->lock))
+    panic("idesubmit: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
+    panic("idesubmit: nothing to do");
   if(b->dev != 1)
-    panic("iderw: request not for disk 1");
-  if(b->blockno >= disksize)
-    panic("iderw: block out of range");
+    panic("idesubmit: request not for disk 1");
+  if(b->ioblockno >= disksize/blocksize)
+    panic("idesubmit: block out of range");
 
-  p = memdisk + b->blockno*BSIZE;
+  p = memdisk + b->ioblockno*blocksize;
   
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
-    memmove(p, b->data, BSIZE);
+    memmove(p, b->data, blocksize);
   } else
-    memmove(b->data, p, BSIZE);
+    memmove(b->data, p, blocksize);
   b->flags |= B_VALID;
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    bdone(b);
+  }
+}
+
+void
+ideawait(struct buf *b)
+{
+  if((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    panic("ideawait");
+}
+
+int
+ideawaitany(struct buf **v, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if((v[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      return i;
+  panic("ideawaitany");
 }
@@ -20,17 +20,22 @@
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
-int ninodeblocks = NINODES / IPB + 1;
+int bsize = MINBSIZE;  // Block size
+int nbitmap;  // Number of free map blocks
+int ninodeblocks;  // Number of inode blocks
 int nlog = LOGSIZE;  
+int fssize = FSSIZE;  // Size of the file system in blocks
+int nsb;      // Number of blocks up to and including the super block
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
 int fsfd;
 struct superblock sb;
-char zeroes[BSIZE];
+char zeroes[MAXBSIZE];
 uint freeinode = 1;
 uint freeblock;
+struct dirent rootents[NINODES];  // root entries other than . and ..
+int nrootents;
 
 
 void balloc(int);
@@ -40,6 +45,8 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+uint bmap(struct dinode *din, uint fbn);
+void rootdir(uint rootino);
 
 // convert to intel byte order
 ushort
@@ -69,20 +76,32 @@ main(int argc, char *argv[])
 {
   int i, cc, fd;
   uint rootino, inum, off;
-  struct dirent de;
-  char buf[BSIZE];
+  struct dirent dot, *de;
+  char buf[MAXBSIZE];
   struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  for(; argc >= 3 && argv[1][0] == '-'; argc -= 2, argv += 2){
+    if(strcmp(argv[1], "-b") == 0)
+      bsize = atoi(argv[2]);
+    else if(strcmp(argv[1], "-l") == 0)
+      nlog = atoi(argv[2]);
+    else if(strcmp(argv[1], "-s") == 0)
+      fssize = atoi(argv[2]);
+    else
+      break;
+  }
+  if(argc < 2 || bsize < MINBSIZE || bsize > MAXBSIZE || (bsize & (bsize-1)) ||
+     fssize > FSSIZE || nlog <= MAXOPBLOCKS || nlog > fssize/2){
+    fprintf(stderr, "Usage: mkfs [-b bsize] [-l nlog] [-s size] fs.img files...\n");
     exit(1);
   }
+  sb.bsize = xint(bsize);
 
-  assert((BSIZE % sizeof(struct dinode)) == 0);
-  assert((BSIZE % sizeof(struct dirent)) == 0);
+  assert((bsize % sizeof(struct dinode)) == 0);
+  assert((bsize % sizeof(struct dirent)) == 0);
 
   fsfd = open(argv[1], O_RDWR|O_CREAT|O_TRUNC, 0666);
   if(fsfd < 0){
@@ -90,42 +109,45 @@ main(int argc, char *argv[])
     exit(1);
   }
 
-  // 1 fs block = 1 disk sector
-  nmeta = 2 + nlog + ninodeblocks + nbitmap;
-  nblocks = FSSIZE - nmeta;
+  // 1 fs block = bsize/512 disk sectors
+  nsb = SBOFF/bsize + 1;
+  nbitmap = fssize/(bsize*8) + 1;
+  ninodeblocks = NINODES / IPB(sb) + 1;
+  nmeta = nsb + nlog + ninodeblocks + nbitmap;
+  nblocks = fssize - nmeta;
 
-  sb.size = xint(FSSIZE);
+  sb.size = xint(fssize);
   sb.nblocks = xint(nblocks);
   sb.ninodes = xint(NINODES);
   sb.nlog = xint(nlog);
-  sb.logstart = xint(2);
-  sb.inodestart = xint(2+nlog);
-  sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.logstart = xint(nsb);
+  sb.inodestart = xint(nsb+nlog);
+  sb.bmapstart = xint(nsb+nlog+ninodeblocks);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  printf("bsize %d nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
+         bsize, nmeta, nlog, ninodeblocks, nbitmap, nblocks, fssize);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
+  for(i = 0; i < fssize; i++)
     wsect(i, zeroes);
 
   memset(buf, 0, sizeof(buf));
-  memmove(buf, &sb, sizeof(sb));
-  wsect(1, buf);
+  memmove(buf + SBOFF%bsize, &sb, sizeof(sb));
+  wsect(SBOFF/bsize, buf);
 
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
+  bzero(&dot, sizeof(dot));
+  dot.inum = xshort(rootino);
+  strcpy(dot.name, ".");
+  iappend(rootino, &dot, sizeof(dot));
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  bzero(&dot, sizeof(dot));
+  dot.inum = xshort(rootino);
+  strcpy(dot.name, "..");
+  iappend(rootino, &dot, sizeof(dot));
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -144,10 +166,10 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    assert(nrootents < NINODES);
+    de = &rootents[nrootents++];
+    de->inum = xshort(inum);
+    strncpy(de->name, argv[i], DIRSIZ);
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,10 +177,12 @@ main(int argc, char *argv[])
     close(fd);
   }
 
+  rootdir(rootino);
+
   // fix size of root inode dir
   rinode(rootino, &din);
   off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
+  off = ((off + bsize - 1) / bsize) * bsize;
   din.size = xint(off);
   winode(rootino, &din);
 
@@ -170,11 +194,11 @@ main(int argc, char *argv[])
 void
 wsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, sec * bsize, 0) != sec * bsize){
     perror("lseek");
     exit(1);
   }
-  if(write(fsfd, buf, BSIZE) != BSIZE){
+  if(write(fsfd, buf, bsize) != bsize){
     perror("write");
     exit(1);
   }
@@ -183,13 +207,13 @@ wsect(uint sec, void *buf)
 void
 winode(uint inum, struct dinode *ip)
 {
-  char buf[BSIZE];
+  char buf[MAXBSIZE];
   uint bn;
   struct dinode *dip;
 
   bn = IBLOCK(inum, sb);
   rsect(bn, buf);
-  dip = ((struct dinode*)buf) + (inum % IPB);
+  dip = ((struct dinode*)buf) + (inum % IPB(sb));
   *dip = *ip;
   wsect(bn, buf);
 }
@@ -197,24 +221,24 @@ winode(uint inum, struct dinode *ip)
 void
 rinode(uint inum, struct dinode *ip)
 {
-  char buf[BSIZE];
+  char buf[MAXBSIZE];
   uint bn;
   struct dinode *dip;
 
   bn = IBLOCK(inum, sb);
   rsect(bn, buf);
-  dip = ((struct dinode*)buf) + (inum % IPB);
+  dip = ((struct dinode*)buf) + (inum % IPB(sb));
   *ip = *dip;
 }
 
 void
 rsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, sec * bsize, 0) != sec * bsize){
     perror("lseek");
     exit(1);
   }
-  if(read(fsfd, buf, BSIZE) != BSIZE){
+  if(read(fsfd, buf, bsize) != bsize){
     perror("read");
     exit(1);
   }
@@ -237,12 +261,12 @@ ialloc(ushort type)
 void
 balloc(int used)
 {
-  uchar buf[BSIZE];
+  uchar buf[MAXBSIZE];
   int i;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
+  assert(used < bsize*8);
+  bzero(buf, bsize);
   for(i = 0; i < used; i++){
     buf[i/8] = buf[i/8] | (0x1 << (i%8));
   }
@@ -252,41 +276,64 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the block holding block fbn of the file with
+// inode din, allocating it and any indirect blocks.
+uint
+bmap(struct dinode *din, uint fbn)
+{
+  uint indirect[MAXBSIZE/sizeof(uint)];
+  uint x, level, span;
+
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0){
+      din->addrs[fbn] = xint(freeblock++);
+    }
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+
+  span = NINDIRECT(sb);
+  for(level = 0; fbn >= span; level++){
+    assert(level < 2);
+    fbn -= span;
+    span *= NINDIRECT(sb);
+  }
+  if(xint(din->addrs[NDIRECT+level]) == 0){
+    din->addrs[NDIRECT+level] = xint(freeblock++);
+  }
+  x = xint(din->addrs[NDIRECT+level]);
+  do {
+    span /= NINDIRECT(sb);
+    rsect(x, (char*)indirect);
+    if(indirect[fbn / span] == 0){
+      indirect[fbn / span] = xint(freeblock++);
+      wsect(x, (char*)indirect);
+    }
+    x = xint(indirect[fbn / span]);
+    fbn %= span;
+  } while(span > 1);
+  return x;
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
   char *p = (char*)xp;
   uint fbn, off, n1;
   struct dinode din;
-  char buf[BSIZE];
-  uint indirect[NINDIRECT];
+  char buf[MAXBSIZE];
   uint x;
 
   rinode(inum, &din);
   off = xint(din.size);
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
   while(n > 0){
-    fbn = off / BSIZE;
-    assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
-    n1 = min(n, (fbn + 1) * BSIZE - off);
+    fbn = off / bsize;
+    assert(fbn < MAXFILE(sb));
+    x = bmap(&din, fbn);
+    n1 = min(n, (fbn + 1) * bsize - off);
     rsect(x, buf);
-    bcopy(p, buf + off - (fbn * BSIZE), n1);
+    bcopy(p, buf + off - (fbn * bsize), n1);
     wsect(x, buf);
     n -= n1;
     off += n1;
@@ -295,3 +342,67 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+int
+dxcmp(const void *a, const void *b)
+{
+  uint x = dxhash(((struct dirent*)a)->name);
+  uint y = dxhash(((struct dirent*)b)->name);
+
+  return x < y ? -1 : x > y;
+}
+
+// Write the root directory's entries: linear if they fit in
+// one block, else as an indexed directory (see fs.h) whose
+// leaves are left part empty so that the first additions
+// do not split them.
+void
+rootdir(uint rootino)
+{
+  char buf[MAXBSIZE];
+  struct dxhead *h;
+  struct dxentry *e;
+  struct dirent leaf[MAXBSIZE/sizeof(struct dirent)];
+  int i, j, n, nleaf, start[MAXBSIZE/sizeof(struct dirent)];
+
+  if(2 + nrootents <= DIRPB(sb)){
+    for(i = 0; i < nrootents; i++)
+      iappend(rootino, &rootents[i], sizeof(rootents[i]));
+    return;
+  }
+
+  // Pack the entries, sorted by hash, into leaves, keeping
+  // names with equal hashes in the same leaf.
+  qsort(rootents, nrootents, sizeof(rootents[0]), dxcmp);
+  nleaf = 0;
+  for(i = 0; i < nrootents; i++){
+    if(i == 0 || (i - start[nleaf-1] >= DIRPB(sb)*3/4 &&
+       dxhash(rootents[i].name) != dxhash(rootents[i-1].name))){
+      assert(nleaf < DXROOTMAX(sb));
+      start[nleaf++] = i;
+    }
+    assert(i - start[nleaf-1] < DIRPB(sb));
+  }
+  start[nleaf] = nrootents;
+
+  // Rest of block 0: the index root.
+  bzero(buf, sizeof(buf));
+  h = (struct dxhead*)buf;
+  h->magic = xint(DX_MAGIC);
+  h->count = xshort(nleaf);
+  h->limit = xshort(DXROOTMAX(sb));
+  e = (struct dxentry*)(h + 1);
+  for(i = 0; i < nleaf; i++){
+    e[i].hash = xint(i == 0 ? 0 : dxhash(rootents[start[i]].name));
+    e[i].block = xint(1 + i);
+  }
+  iappend(rootino, buf, bsize - DXROOTOFF);
+
+  for(i = 0; i < nleaf; i++){
+    bzero(leaf, sizeof(leaf));
+    n = start[i+1] - start[i];
+    for(j = 0; j < n; j++)
+      leaf[j] = rootents[start[i] + j];
+    iappend(rootino, leaf, bsize);
+  }
+}
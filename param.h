@@ -3,12 +3,17 @@
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE      200  // maximum number of cached i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define LOGSIZE      (MAXOPBLOCKS*12)  // blocks in on-disk log made by mkfs
+#define NBUF         (MAXOPBLOCKS*4)  // minimum size of disk block cache
+#define BCACHEDIV     8  // disk block cache starts with 1/BCACHEDIV of free memory
+#define FSSIZE      20000  // size of file system in blocks, and the most the kernel handles
+#define NREADAHEAD    8  // max blocks to read ahead of a sequential reader
+#define NSHLOCK       8  // max sleep locks a process holds shared at once
+#define COMMITTICKS 100  // commit a log transaction once it is this old
+#define FLUSHTICKS   10  // ticks between log flusher runs
 
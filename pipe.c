@@ -2,10 +2,12 @@
 #include "defs.h"
 #include "param.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "fs.h"
-#include "file.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
 
 #define PIPESIZE 512
 
@@ -4,16 +4,26 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "rusage.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "traps.h"
+
+#define NPIDHASH 64
+#define PIDHASH(pid) ((uint)(pid) % NPIDHASH)
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct proc *freelist;            // UNUSED procs
+  struct proc *pidhash[NPIDHASH];   // Allocated procs by pid
 } ptable;
 
 static struct proc *initproc;
 
+// Protects the user words that processes sleep on in futexwait().
+static struct spinlock futexlock;
+
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
@@ -23,12 +33,48 @@ static void wakeup1(void *chan);
 void
 pinit(void)
 {
-  initlock(&ptable.lock, "ptable");
+  struct proc *p;
+
+  initmcslock(&ptable.lock, "ptable");
+  initlock(&futexlock, "futex");
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--){
+    p->next = ptable.freelist;
+    ptable.freelist = p;
+  }
+}
+
+// Return the allocated proc with the given pid, or 0.
+// Caller must hold ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[PIDHASH(pid)]; p != 0; p = p->next)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+static void freeproc(struct proc*);
+
+// Add the resource usage in b to a.
+static void
+addrusage(struct rusage *a, struct rusage *b)
+{
+  a->utime += b->utime;
+  a->stime += b->stime;
+  a->nvcsw += b->nvcsw;
+  a->nivcsw += b->nivcsw;
+  a->nsyscall += b->nsyscall;
+  a->inblock += b->inblock;
+  a->oublock += b->oublock;
+  a->pgfault += b->pgfault;
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Take an UNUSED proc off the free list.
+// If there is one, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
@@ -38,20 +84,29 @@ allocproc(void)
   char *sp;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-  release(&ptable.lock);
-  return 0;
+  if((p = ptable.freelist) == 0){
+    release(&ptable.lock);
+    return 0;
+  }
+  ptable.freelist = p->next;
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->next = ptable.pidhash[PIDHASH(p->pid)];
+  ptable.pidhash[PIDHASH(p->pid)] = p;
+  p->vmnext = p;
+  p->vmtop = 0;
+  p->cpumask = ~0;
+  p->lastcpu = -1;
+  memset(&p->ru, 0, sizeof p->ru);
+  memset(&p->cru, 0, sizeof p->cru);
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -102,26 +157,269 @@ userinit(void)
   p->state = RUNNABLE;
 }
 
+// Start a kernel process running fn, which must not return.
+// It has the kernel's page table only, no parent and no
+// files; forkret() "returns" to fn instead of to user space.
+void
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kproc");
+  *(uint*)(p->context + 1) = (uint)fn;  // in place of trapret
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+}
+
+// A process and the threads it created with clone() share
+// a page table; p->vmnext links them in a ring.
+// Remove p from its ring and return 1 if others remain on it.
+// Caller must hold ptable.lock.
+static int
+vmunlink(struct proc *p)
+{
+  struct proc *q;
+
+  if(p->vmnext == p)
+    return 0;
+  for(q = p->vmnext; q->vmnext != p; q = q->vmnext)
+    ;
+  q->vmnext = p->vmnext;
+  p->vmnext = p;
+  return 1;
+}
+
+// Set the size, and the top of the mapped pages, of every
+// process using the current process's page table pgdir.
+// Caller must hold ptable.lock.
+static void
+setvmsize(pde_t *pgdir, uint sz, uint top)
+{
+  struct proc *p;
+
+  p = proc;
+  do {
+    if(p->pgdir == pgdir){
+      p->sz = sz;
+      p->vmtop = top;
+    }
+    p = p->vmnext;
+  } while(p != proc);
+}
+
+// Is a process using the current process's page table pgdir
+// resizing it?  Caller must hold ptable.lock.
+static int
+vmresizing(pde_t *pgdir)
+{
+  struct proc *p;
+
+  p = proc;
+  do {
+    if(p->pgdir == pgdir && p->vmresizing)
+      return 1;
+    p = p->vmnext;
+  } while(p != proc);
+  return 0;
+}
+
+// Is a thread other than the current one sharing its page
+// table pgdir still inside a system call that may use user
+// memory?  Caller must hold ptable.lock.
+static int
+vmbusythreads(pde_t *pgdir)
+{
+  struct proc *p;
+
+  for(p = proc->vmnext; p != proc; p = p->vmnext)
+    if(p->pgdir == pgdir && p->insyscall && p->state != ZOMBIE)
+      return 1;
+  return 0;
+}
+
+// Flush stale TLB entries for pgdir on this CPU and on every
+// other CPU that is running a thread sharing pgdir.
+// The other CPUs get a T_TLBFLUSH IPI; wait until all have
+// handled it.  Must not hold any locks, since a target CPU
+// may be spinning for one with interrupts disabled.
+static void
+tlbshootdown(pde_t *pgdir)
+{
+  struct cpu *c;
+
+  acquire(&ptable.lock);
+  lcr3(rcr3());
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(c == cpu || c->proc == 0 || c->proc->pgdir != pgdir)
+      continue;
+    c->tlbflush = 1;
+    lapicipi(c->id, T_TLBFLUSH);
+  }
+  release(&ptable.lock);
+
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(c->tlbflush)
+      ;
+}
+
+// Free the pages that the current process's address space
+// keeps mapped above its size, unless another thread sharing
+// it is in a system call that may still use them.  Caller
+// must hold ptable.lock and be resizing the address space.
+static void
+vmfree(void)
+{
+  uint sz, top;
+
+  sz = proc->sz;
+  top = proc->vmtop;
+  __sync_synchronize();  // read insyscall after setting sz
+  if(top <= sz || vmbusythreads(proc->pgdir))
+    return;
+  release(&ptable.lock);
+  unmapuvm(proc->pgdir, top, sz);
+  tlbshootdown(proc->pgdir);
+  deallocuvm(proc->pgdir, top, sz);
+  acquire(&ptable.lock);
+  setvmsize(proc->pgdir, sz, sz);
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
+// Threads created by clone() share the page table, so only
+// one of them may resize it at a time, and all of them see
+// the new size.  Another thread may be in a system call that
+// checked its pointers against the old size, so a shrink
+// leaves the pages it gives up mapped, up to vmtop, until no
+// other thread is in the kernel; vmfree() then frees them.
+// A grow reuses any such pages first.
 int
 growproc(int n)
 {
-  uint sz;
+  uint sz, newsz, top, a;
   
-  sz = proc->sz;
+  acquire(&ptable.lock);
+  if(proc->vmnext == proc && proc->vmtop <= proc->sz){
+    release(&ptable.lock);
+    sz = proc->sz;
+    if(n > 0){
+      if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+        return -1;
+    } else if(n < 0){
+      if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
+        return -1;
+    }
+    proc->sz = sz;
+    switchuvm(proc);
+    return 0;
+  }
+
+  while(vmresizing(proc->pgdir))
+    sleep(proc->pgdir, &ptable.lock);
+  proc->vmresizing = 1;
+
+  sz = newsz = proc->sz;
+  top = proc->vmtop > sz ? proc->vmtop : sz;
   if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
-      return -1;
-  } else if(n < 0){
-    if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
-      return -1;
+    release(&ptable.lock);
+    newsz = sz + n;
+    for(a = PGROUNDUP(sz); a < top && a < newsz; a += PGSIZE)
+      memset(uva2ka(proc->pgdir, (char*)a), 0, PGSIZE);
+    if(newsz > top && allocuvm(proc->pgdir, top, newsz) == 0)
+      newsz = 0;
+    acquire(&ptable.lock);
+    if(newsz != 0)
+      setvmsize(proc->pgdir, newsz, newsz > top ? newsz : top);
+  } else if(n < 0 && sz + n < sz){
+    // New system calls check pointers against the new size.
+    newsz = sz + n;
+    setvmsize(proc->pgdir, newsz, top);
+    vmfree();
   }
-  proc->sz = sz;
+  proc->vmresizing = 0;
+  wakeup1(proc->pgdir);
+  release(&ptable.lock);
+
+  if(newsz == 0)
+    return -1;
   switchuvm(proc);
   return 0;
 }
 
+// Called by trap() when a system call returns to user space.
+// If this was the last thread using pages a shrink left
+// mapped, free them.
+void
+endsyscall(void)
+{
+  xchg(&proc->insyscall, 0);
+  if(proc->vmtop <= proc->sz)
+    return;
+  acquire(&ptable.lock);
+  if(!vmresizing(proc->pgdir)){
+    proc->vmresizing = 1;
+    vmfree();
+    proc->vmresizing = 0;
+    wakeup1(proc->pgdir);
+  }
+  release(&ptable.lock);
+}
+
+// Called by exec() after giving the current process a new
+// page table: stop sharing the old one, pgdir, with threads,
+// and free it unless another process (a thread created by
+// clone(), or the process that created it) is still using it.
+void
+putvm(pde_t *pgdir)
+{
+  int shared;
+
+  acquire(&ptable.lock);
+  shared = vmunlink(proc);
+  release(&ptable.lock);
+  if(!shared)
+    freevm(pgdir);
+}
+
+// Free the kernel stack and, if no other thread is using it,
+// the page table of p, unlink p from its parent's children
+// and the pid hash, mark it UNUSED and put it on the free list.
+// Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  if(p->kstack)
+    kfree(p->kstack);
+  p->kstack = 0;
+  if(!vmunlink(p) && p->pgdir)
+    freevm(p->pgdir);
+  p->pgdir = 0;
+  if(p->parent){
+    for(pp = &p->parent->children; *pp != p; pp = &(*pp)->sibling)
+      ;
+    *pp = p->sibling;
+  }
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->next)
+    ;
+  *pp = p->next;
+  p->state = UNUSED;
+  p->pid = 0;
+  p->parent = 0;
+  p->sibling = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->thread = 0;
+  p->ustack = 0;
+  p->next = ptable.freelist;
+  ptable.freelist = p;
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -137,13 +435,12 @@ fork(void)
 
   // Copy process state from p.
   if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = proc->sz;
-  np->parent = proc;
   *np->tf = *proc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -155,11 +452,80 @@ fork(void)
   np->cwd = idup(proc->cwd);
 
   safestrcpy(np->name, proc->name, sizeof(proc->name));
+  np->cpumask = proc->cpumask;
  
   pid = np->pid;
 
   // lock to force the compiler to emit the np->state write last.
   acquire(&ptable.lock);
+  np->parent = proc;
+  np->sibling = proc->children;
+  proc->children = np;
+  np->state = RUNNABLE;
+  release(&ptable.lock);
+  
+  return pid;
+}
+
+// Create a new thread that runs fcn(arg) on the one-page
+// user stack at stack.  Unlike fork(), the thread shares the
+// caller's address space; it holds its own references to the
+// caller's open files and current directory.
+// The caller reaps the thread with join().
+int
+clone(void (*fcn)(void*), void *arg, void *stack)
+{
+  int i, pid;
+  struct proc *np;
+  uint sp, ustack[2];
+
+  if((uint)stack % PGSIZE != 0)
+    return -1;
+
+  // Allocate process.
+  if((np = allocproc()) == 0)
+    return -1;
+
+  // Share the address space.  Hold ptable.lock so that a
+  // concurrent growproc() in another thread sees np.
+  acquire(&ptable.lock);
+  np->pgdir = proc->pgdir;
+  np->sz = proc->sz;
+  np->vmtop = proc->vmtop;
+  np->vmnext = proc->vmnext;
+  proc->vmnext = np;
+  release(&ptable.lock);
+  np->thread = 1;
+  np->ustack = stack;
+  *np->tf = *proc->tf;
+
+  // Start at fcn with arg on the new stack, as if called.
+  ustack[0] = 0xffffffff;  // fake return PC
+  ustack[1] = (uint)arg;
+  sp = (uint)stack + PGSIZE - sizeof(ustack);
+  if(copyout(np->pgdir, sp, ustack, sizeof(ustack)) < 0){
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+  np->tf->eip = (uint)fcn;
+  np->tf->esp = sp;
+
+  for(i = 0; i < NOFILE; i++)
+    if(proc->ofile[i])
+      np->ofile[i] = filedup(proc->ofile[i]);
+  np->cwd = idup(proc->cwd);
+
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+  np->cpumask = proc->cpumask;
+ 
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+  np->parent = proc;
+  np->sibling = proc->children;
+  proc->children = np;
   np->state = RUNNABLE;
   release(&ptable.lock);
   
@@ -186,7 +552,7 @@ exit(void)
     }
   }
 
-  begin_op();
+  begin_opn(iputblocks());
   iput(proc->cwd);
   end_op();
   proc->cwd = 0;
@@ -196,13 +562,27 @@ exit(void)
   // Parent might be sleeping in wait().
   wakeup1(proc->parent);
 
-  // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == proc){
+  // Pass abandoned children to init.  Threads are passed to
+  // the parent of an exiting thread, so they stay joinable;
+  // otherwise they are killed and become ordinary children
+  // of init, since a process's threads don't outlive it.
+  while((p = proc->children) != 0){
+    proc->children = p->sibling;
+    if(p->thread && proc->thread && proc->parent->state != ZOMBIE){
+      p->parent = proc->parent;
+    } else {
       p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
+      if(p->thread){
+        p->thread = 0;
+        p->killed = 1;
+        if(p->state == SLEEPING)
+          p->state = RUNNABLE;
+      }
     }
+    p->sibling = p->parent->children;
+    p->parent->children = p;
+    if(p->state == ZOMBIE)
+      wakeup1(p->parent);
   }
 
   // Jump into the scheduler, never to return.
@@ -221,23 +601,18 @@ wait(void)
 
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for zombie children.
+    // Scan through children looking for zombies.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != proc)
+    for(p = proc->children; p != 0; p = p->sibling){
+      if(p->thread)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->state = UNUSED;
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
+        addrusage(&proc->cru, &p->ru);
+        addrusage(&proc->cru, &p->cru);
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -254,6 +629,64 @@ wait(void)
   }
 }
 
+// Wait for a thread created by clone() to exit and return its
+// pid, storing the user stack it was given in *stack.
+// Return -1 if this process has no threads.
+int
+join(void **stack)
+{
+  struct proc *p;
+  int havekids, pid;
+
+  acquire(&ptable.lock);
+  for(;;){
+    // Scan through children looking for zombie threads.
+    havekids = 0;
+    for(p = proc->children; p != 0; p = p->sibling){
+      if(!p->thread)
+        continue;
+      havekids = 1;
+      if(p->state == ZOMBIE){
+        // Found one.
+        pid = p->pid;
+        *stack = p->ustack;
+        addrusage(&proc->cru, &p->ru);
+        addrusage(&proc->cru, &p->cru);
+        freeproc(p);
+        release(&ptable.lock);
+        return pid;
+      }
+    }
+
+    // No point waiting if we don't have any threads.
+    if(!havekids || proc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+
+    // Wait for threads to exit.  (See wakeup1 call in proc_exit.)
+    sleep(proc, &ptable.lock);
+  }
+}
+
+// Should this CPU run RUNNABLE process p?  Only if p's
+// CPU mask allows it.  To keep p's cache state warm, prefer
+// the CPU p last ran on: take p from another CPU only if that
+// CPU is busy running something else or p may no longer run there.
+// Caller must hold ptable.lock.
+static int
+runhere(struct proc *p)
+{
+  int me;
+
+  me = cpu - cpus;
+  if((p->cpumask & (1 << me)) == 0)
+    return 0;
+  if(p->lastcpu < 0 || p->lastcpu == me)
+    return 1;
+  return cpus[p->lastcpu].proc != 0 || (p->cpumask & (1 << p->lastcpu)) == 0;
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -271,10 +704,13 @@ scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
+    // Between processes, this CPU is in an RCU quiescent state.
+    rcuquiescent();
+
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+      if(p->state != RUNNABLE || !runhere(p))
         continue;
 
       // Switch to chosen process.  It is the process's job
@@ -283,6 +719,7 @@ scheduler(void)
       proc = p;
       switchuvm(p);
       p->state = RUNNING;
+      p->lastcpu = cpu - cpus;
       swtch(&cpu->scheduler, proc->context);
       switchkvm();
 
@@ -369,6 +806,7 @@ sleep(void *chan, struct spinlock *lk)
   }
 
   // Go to sleep.
+  proc->ru.nvcsw++;
   proc->chan = chan;
   proc->state = SLEEPING;
   sched();
@@ -405,6 +843,69 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Futexes let user code sleep until another thread or process
+// changes a word of shared memory.  The sleep channel is the
+// kernel address of the word's physical memory, so every
+// address space that maps the word agrees on it.
+static void*
+futexchan(uint *addr)
+{
+  char *ka;
+
+  if((ka = uva2ka(proc->pgdir, (char*)PGROUNDDOWN((uint)addr))) == 0)
+    return 0;
+  return ka + (uint)addr % PGSIZE;
+}
+
+// If the user word at addr still holds val, sleep until
+// futexwake() is called on it.  The check and the sleep are
+// atomic with respect to futexwake().
+// Return 0 when woken (possibly spuriously), -1 if the word
+// did not hold val or the process was killed.
+int
+futexwait(uint *addr, uint val)
+{
+  uint *chan;
+
+  if((chan = futexchan(addr)) == 0)
+    return -1;
+  acquire(&futexlock);
+  if(*chan != val){
+    release(&futexlock);
+    return -1;
+  }
+  sleep(chan, &futexlock);
+  release(&futexlock);
+  if(proc->killed)
+    return -1;
+  return 0;
+}
+
+// Wake up to n processes sleeping in futexwait() on the
+// user word at addr.  Return the number woken.
+int
+futexwake(uint *addr, int n)
+{
+  struct proc *p;
+  void *chan;
+  int woken;
+
+  if((chan = futexchan(addr)) == 0)
+    return -1;
+  woken = 0;
+  acquire(&futexlock);
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && woken < n; p++){
+    if(p->state == SLEEPING && p->chan == chan){
+      p->state = RUNNABLE;
+      woken++;
+    }
+  }
+  release(&ptable.lock);
+  release(&futexlock);
+  return woken;
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -414,18 +915,81 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+    p->state = RUNNABLE;
+  release(&ptable.lock);
+  return 0;
+}
+
+// Set the mask of CPUs that may run the process with the given
+// pid (0 means the current process).  Bit i stands for cpus[i].
+// Return -1 if there is no such process or the mask names no CPU.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+
+  if(pid == 0)
+    pid = proc->pid;
+  mask &= (1 << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  p->cpumask = mask;
+  release(&ptable.lock);
+  // Move off this CPU now if it is no longer allowed.
+  if(p == proc && (mask & (1 << p->lastcpu)) == 0)
+    yield();
+  return 0;
+}
+
+// Return the CPU mask of the process with the given pid
+// (0 means the current process), or -1 if there is none.
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  if(pid == 0)
+    return proc->cpumask & ((1 << ncpu) - 1);
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  mask = p->cpumask & ((1 << ncpu) - 1);
+  release(&ptable.lock);
+  return mask;
+}
+
+// Copy the resource usage of the current process (who is
+// RUSAGE_SELF) or of its waited-for children (RUSAGE_CHILDREN)
+// to *ru.  Return -1 if who is neither.
+int
+getrusage(int who, struct rusage *ru)
+{
+  acquire(&ptable.lock);
+  if(who == RUSAGE_SELF)
+    *ru = proc->ru;
+  else if(who == RUSAGE_CHILDREN)
+    *ru = proc->cru;
+  else {
+    release(&ptable.lock);
+    return -1;
   }
   release(&ptable.lock);
-  return -1;
+  return 0;
 }
 
 //PAGEBREAK: 36
@@ -455,7 +1019,8 @@ procdump(void)
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s u %d s %d sys %d", p->pid, state, p->name,
+            p->ru.utime, p->ru.stime, p->ru.nsyscall);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -10,6 +10,7 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  volatile uint tlbflush;      // Set until a TLB shootdown IPI is handled
   
   // Cpu-local storage variables; see below
   struct cpu *cpu;
@@ -66,6 +67,21 @@ struct proc {
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  int thread;                  // If non-zero, clone()d: shares parent's pgdir
+  void *ustack;                // User stack passed to clone() (threads only)
+  volatile uint insyscall;     // In a system call, maybe using user memory
+  uint vmtop;                  // If above sz, pages up to here are still mapped
+  int vmresizing;              // In growproc(), resizing the shared pgdir
+  uint cpumask;                // CPUs allowed to run this process (bit i: cpus[i])
+  int lastcpu;                 // Index in cpus[] of CPU it last ran on, or -1
+  struct rusage ru;            // Resources used by this process
+  struct rusage cru;           // Resources used by its waited-for children
+  int logres;                  // Log blocks its FS operation may still add
+  struct sleeplock *shlocks[NSHLOCK]; // Sleep locks it holds shared
+  struct proc *next;           // Next on free list or pid hash chain
+  struct proc *children;       // Processes and threads this one created
+  struct proc *sibling;        // Next in parent's children list
+  struct proc *vmnext;         // Ring of processes sharing pgdir
 };
 
 // Process memory is laid out contiguously, low addresses first:
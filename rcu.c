@@ -0,0 +1,92 @@
+// Read-copy-update grace periods.
+//
+// A reader that looks at shared data without locking it does
+// so with interrupts off (pushcli), so it cannot sleep or be
+// preempted.  Each CPU passes a quiescent state, in which it
+// holds no such references, every time around the scheduler
+// loop.  A grace period ends once every CPU has passed a
+// quiescent state since it began, at which point every reader
+// that was running when it began has finished.  Writers use
+// grace periods to put off reusing memory that readers may
+// still be looking at.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "rusage.h"
+#include "proc.h"
+#include "spinlock.h"
+
+struct {
+  struct spinlock lock;
+  uint cur;            // Last grace period started
+  volatile uint done;  // Last grace period completed
+  uint want;           // Last grace period asked for
+  volatile uint need;  // CPUs yet to pass a quiescent state in cur
+} rcu;
+
+void
+rcuinit(void)
+{
+  initlock(&rcu.lock, "rcu");
+}
+
+// Called by scheduler(): this CPU holds no RCU references.
+void
+rcuquiescent(void)
+{
+  uint me;
+
+  me = 1 << (cpu - cpus);
+  if((rcu.need & me) == 0)
+    return;
+  acquire(&rcu.lock);
+  rcu.need &= ~me;
+  if(rcu.need == 0 && rcu.done != rcu.cur){
+    rcu.done = rcu.cur;
+    if(rcu.want != rcu.cur){
+      rcu.cur++;
+      rcu.need = (1 << ncpu) - 1;
+    }
+  }
+  release(&rcu.lock);
+}
+
+// Return a grace period that will not end until every
+// RCU reader running now has finished.
+uint
+rcustart(void)
+{
+  uint gp;
+
+  acquire(&rcu.lock);
+  if(rcu.done == rcu.cur){
+    // None in progress; start one.
+    gp = ++rcu.cur;
+    rcu.need = (1 << ncpu) - 1;
+  } else {
+    // The one in progress may have started before some
+    // readers did, so ask for the next one.
+    gp = rcu.want = rcu.cur + 1;
+  }
+  release(&rcu.lock);
+  return gp;
+}
+
+// Has grace period gp ended?
+int
+rcudone(uint gp)
+{
+  return (int)(rcu.done - gp) >= 0;
+}
+
+// Wait for grace period gp to end.
+// Must not hold any spinlocks.
+void
+rcuwait(uint gp)
+{
+  while(!rcudone(gp))
+    yield();
+}
@@ -0,0 +1,1218 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: rm files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 7a 08 00 00       	push   $0x87a
+  21:	6a 02                	push   $0x2
+  23:	e8 9b 04 00 00       	call   4c3 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 b7 02 00 00       	call   2e7 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(unlink(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 02 00 00       	call   337 <unlink>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 8e 08 00 00       	push   $0x88e
+  74:	6a 02                	push   $0x2
+  76:	e8 48 04 00 00       	call   4c3 <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 57 02 00 00       	call   2e7 <exit>
+
+00000090 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+    ;
+  return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e9:	eb 08                	jmp    f3 <strcmp+0xd>
+    p++, q++;
+  eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 00             	movzbl (%eax),%eax
+  f9:	84 c0                	test   %al,%al
+  fb:	74 10                	je     10d <strcmp+0x27>
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 100:	0f b6 10             	movzbl (%eax),%edx
+ 103:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 106:	0f b6 00             	movzbl (%eax),%eax
+ 109:	38 c2                	cmp    %al,%dl
+ 10b:	74 de                	je     eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 d0             	movzbl %al,%edx
+ 116:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	0f b6 c0             	movzbl %al,%eax
+ 11f:	29 c2                	sub    %eax,%edx
+ 121:	89 d0                	mov    %edx,%eax
+}
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 12b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 132:	eb 04                	jmp    138 <strlen+0x13>
+ 134:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 138:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	84 c0                	test   %al,%al
+ 145:	75 ed                	jne    134 <strlen+0xf>
+    ;
+  return n;
+ 147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 14f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 152:	50                   	push   %eax
+ 153:	ff 75 0c             	push   0xc(%ebp)
+ 156:	ff 75 08             	push   0x8(%ebp)
+ 159:	e8 32 ff ff ff       	call   90 <stosb>
+ 15e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 172:	eb 14                	jmp    188 <strchr+0x22>
+    if(*s == c)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 17d:	75 05                	jne    184 <strchr+0x1e>
+      return (char*)s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	eb 13                	jmp    197 <strchr+0x31>
+  for(; *s; s++)
+ 184:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	84 c0                	test   %al,%al
+ 190:	75 e2                	jne    174 <strchr+0xe>
+  return 0;
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 42                	jmp    1ea <gets+0x51>
+    cc = read(0, &c, 1);
+ 1a8:	83 ec 04             	sub    $0x4,%esp
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1b0:	50                   	push   %eax
+ 1b1:	6a 00                	push   $0x0
+ 1b3:	e8 47 01 00 00       	call   2ff <read>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c2:	7e 33                	jle    1f7 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	01 c2                	add    %eax,%edx
+ 1d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 16                	je     1f8 <gets+0x5f>
+ 1e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1e6:	3c 0d                	cmp    $0xd,%al
+ 1e8:	74 0e                	je     1f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1f3:	7f b3                	jg     1a8 <gets+0xf>
+ 1f5:	eb 01                	jmp    1f8 <gets+0x5f>
+      break;
+ 1f7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	01 d0                	add    %edx,%eax
+ 200:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 0c 01 00 00       	call   327 <open>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 221:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 225:	79 07                	jns    22e <stat+0x26>
+    return -1;
+ 227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 22c:	eb 25                	jmp    253 <stat+0x4b>
+  r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 03 01 00 00       	call   33f <fstat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 75 f4             	push   -0xc(%ebp)
+ 248:	e8 c2 00 00 00       	call   30f <close>
+ 24d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 25b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 262:	eb 25                	jmp    289 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 264:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 267:	89 d0                	mov    %edx,%eax
+ 269:	c1 e0 02             	shl    $0x2,%eax
+ 26c:	01 d0                	add    %edx,%eax
+ 26e:	01 c0                	add    %eax,%eax
+ 270:	89 c1                	mov    %eax,%ecx
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	8d 50 01             	lea    0x1(%eax),%edx
+ 278:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	0f be c0             	movsbl %al,%eax
+ 281:	01 c8                	add    %ecx,%eax
+ 283:	83 e8 30             	sub    $0x30,%eax
+ 286:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	7e 0a                	jle    29d <atoi+0x48>
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	3c 39                	cmp    $0x39,%al
+ 29b:	7e c7                	jle    264 <atoi+0xf>
+  return n;
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a0:	c9                   	leave
+ 2a1:	c3                   	ret
+
+000002a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2b4:	eb 17                	jmp    2cd <memmove+0x2b>
+    *dst++ = *src++;
+ 2b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2c2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2c8:	0f b6 12             	movzbl (%edx),%edx
+ 2cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2cd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2d3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2d6:	85 c0                	test   %eax,%eax
+ 2d8:	7f dc                	jg     2b6 <memmove+0x14>
+  return vdst;
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2dd:	c9                   	leave
+ 2de:	c3                   	ret
+
+000002df <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2df:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <exit>:
+SYSCALL(exit)
+ 2e7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <wait>:
+SYSCALL(wait)
+ 2ef:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <pipe>:
+SYSCALL(pipe)
+ 2f7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <read>:
+SYSCALL(read)
+ 2ff:	b8 05 00 00 00       	mov    $0x5,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <write>:
+SYSCALL(write)
+ 307:	b8 10 00 00 00       	mov    $0x10,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <close>:
+SYSCALL(close)
+ 30f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <kill>:
+SYSCALL(kill)
+ 317:	b8 06 00 00 00       	mov    $0x6,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <exec>:
+SYSCALL(exec)
+ 31f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <open>:
+SYSCALL(open)
+ 327:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <mknod>:
+SYSCALL(mknod)
+ 32f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <unlink>:
+SYSCALL(unlink)
+ 337:	b8 12 00 00 00       	mov    $0x12,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <fstat>:
+SYSCALL(fstat)
+ 33f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <link>:
+SYSCALL(link)
+ 347:	b8 13 00 00 00       	mov    $0x13,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <mkdir>:
+SYSCALL(mkdir)
+ 34f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <chdir>:
+SYSCALL(chdir)
+ 357:	b8 09 00 00 00       	mov    $0x9,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <dup>:
+SYSCALL(dup)
+ 35f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <getpid>:
+SYSCALL(getpid)
+ 367:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <sbrk>:
+SYSCALL(sbrk)
+ 36f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <sleep>:
+SYSCALL(sleep)
+ 377:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <uptime>:
+SYSCALL(uptime)
+ 37f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <clone>:
+SYSCALL(clone)
+ 387:	b8 16 00 00 00       	mov    $0x16,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <join>:
+SYSCALL(join)
+ 38f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <futex_wait>:
+SYSCALL(futex_wait)
+ 397:	b8 18 00 00 00       	mov    $0x18,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <futex_wake>:
+SYSCALL(futex_wake)
+ 39f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <setaffinity>:
+SYSCALL(setaffinity)
+ 3a7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <getaffinity>:
+SYSCALL(getaffinity)
+ 3af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <getrusage>:
+SYSCALL(getrusage)
+ 3b7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <lockstat>:
+SYSCALL(lockstat)
+ 3bf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <statfs>:
+SYSCALL(statfs)
+ 3c7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
+
+000003cf <bcachesize>:
+SYSCALL(bcachesize)
+ 3cf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <bcstat>:
+SYSCALL(bcstat)
+ 3d7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3dc:	cd 40                	int    $0x40
+ 3de:	c3                   	ret
+
+000003df <sync>:
+SYSCALL(sync)
+ 3df:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3e4:	cd 40                	int    $0x40
+ 3e6:	c3                   	ret
+
+000003e7 <fsync>:
+SYSCALL(fsync)
+ 3e7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3ef:	55                   	push   %ebp
+ 3f0:	89 e5                	mov    %esp,%ebp
+ 3f2:	83 ec 18             	sub    $0x18,%esp
+ 3f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f8:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3fb:	83 ec 04             	sub    $0x4,%esp
+ 3fe:	6a 01                	push   $0x1
+ 400:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 403:	50                   	push   %eax
+ 404:	ff 75 08             	push   0x8(%ebp)
+ 407:	e8 fb fe ff ff       	call   307 <write>
+ 40c:	83 c4 10             	add    $0x10,%esp
+}
+ 40f:	90                   	nop
+ 410:	c9                   	leave
+ 411:	c3                   	ret
+
+00000412 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 412:	55                   	push   %ebp
+ 413:	89 e5                	mov    %esp,%ebp
+ 415:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 418:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 41f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 423:	74 17                	je     43c <printint+0x2a>
+ 425:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 429:	79 11                	jns    43c <printint+0x2a>
+    neg = 1;
+ 42b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 432:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 435:	f7 d8                	neg    %eax
+ 437:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 43a:	eb 06                	jmp    442 <printint+0x30>
+  } else {
+    x = xx;
+ 43c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 442:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 449:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 44c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 44f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 454:	f7 f1                	div    %ecx
+ 456:	89 d1                	mov    %edx,%ecx
+ 458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 45b:	8d 50 01             	lea    0x1(%eax),%edx
+ 45e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 461:	0f b6 91 f8 0a 00 00 	movzbl 0xaf8(%ecx),%edx
+ 468:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 46c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 472:	ba 00 00 00 00       	mov    $0x0,%edx
+ 477:	f7 f1                	div    %ecx
+ 479:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 47c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 480:	75 c7                	jne    449 <printint+0x37>
+  if(neg)
+ 482:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 486:	74 2d                	je     4b5 <printint+0xa3>
+    buf[i++] = '-';
+ 488:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 48b:	8d 50 01             	lea    0x1(%eax),%edx
+ 48e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 491:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 496:	eb 1d                	jmp    4b5 <printint+0xa3>
+    putc(fd, buf[i]);
+ 498:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 49b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 49e:	01 d0                	add    %edx,%eax
+ 4a0:	0f b6 00             	movzbl (%eax),%eax
+ 4a3:	0f be c0             	movsbl %al,%eax
+ 4a6:	83 ec 08             	sub    $0x8,%esp
+ 4a9:	50                   	push   %eax
+ 4aa:	ff 75 08             	push   0x8(%ebp)
+ 4ad:	e8 3d ff ff ff       	call   3ef <putc>
+ 4b2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4b5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4b9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4bd:	79 d9                	jns    498 <printint+0x86>
+}
+ 4bf:	90                   	nop
+ 4c0:	90                   	nop
+ 4c1:	c9                   	leave
+ 4c2:	c3                   	ret
+
+000004c3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4c3:	55                   	push   %ebp
+ 4c4:	89 e5                	mov    %esp,%ebp
+ 4c6:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 4c9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 4d0:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 4d3:	83 c0 04             	add    $0x4,%eax
+ 4d6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 4d9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 4e0:	e9 59 01 00 00       	jmp    63e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 4e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4eb:	01 d0                	add    %edx,%eax
+ 4ed:	0f b6 00             	movzbl (%eax),%eax
+ 4f0:	0f be c0             	movsbl %al,%eax
+ 4f3:	25 ff 00 00 00       	and    $0xff,%eax
+ 4f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4ff:	75 2c                	jne    52d <printf+0x6a>
+      if(c == '%'){
+ 501:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 505:	75 0c                	jne    513 <printf+0x50>
+        state = '%';
+ 507:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 50e:	e9 27 01 00 00       	jmp    63a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 513:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 516:	0f be c0             	movsbl %al,%eax
+ 519:	83 ec 08             	sub    $0x8,%esp
+ 51c:	50                   	push   %eax
+ 51d:	ff 75 08             	push   0x8(%ebp)
+ 520:	e8 ca fe ff ff       	call   3ef <putc>
+ 525:	83 c4 10             	add    $0x10,%esp
+ 528:	e9 0d 01 00 00       	jmp    63a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 52d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 531:	0f 85 03 01 00 00    	jne    63a <printf+0x177>
+      if(c == 'd'){
+ 537:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 53b:	75 1e                	jne    55b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 53d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 540:	8b 00                	mov    (%eax),%eax
+ 542:	6a 01                	push   $0x1
+ 544:	6a 0a                	push   $0xa
+ 546:	50                   	push   %eax
+ 547:	ff 75 08             	push   0x8(%ebp)
+ 54a:	e8 c3 fe ff ff       	call   412 <printint>
+ 54f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 552:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 556:	e9 d8 00 00 00       	jmp    633 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 55b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 55f:	74 06                	je     567 <printf+0xa4>
+ 561:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 565:	75 1e                	jne    585 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 567:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 56a:	8b 00                	mov    (%eax),%eax
+ 56c:	6a 00                	push   $0x0
+ 56e:	6a 10                	push   $0x10
+ 570:	50                   	push   %eax
+ 571:	ff 75 08             	push   0x8(%ebp)
+ 574:	e8 99 fe ff ff       	call   412 <printint>
+ 579:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 57c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 580:	e9 ae 00 00 00       	jmp    633 <printf+0x170>
+      } else if(c == 's'){
+ 585:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 589:	75 43                	jne    5ce <printf+0x10b>
+        s = (char*)*ap;
+ 58b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 58e:	8b 00                	mov    (%eax),%eax
+ 590:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 593:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 597:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 59b:	75 25                	jne    5c2 <printf+0xff>
+          s = "(null)";
+ 59d:	c7 45 f4 a7 08 00 00 	movl   $0x8a7,-0xc(%ebp)
+        while(*s != 0){
+ 5a4:	eb 1c                	jmp    5c2 <printf+0xff>
+          putc(fd, *s);
+ 5a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a9:	0f b6 00             	movzbl (%eax),%eax
+ 5ac:	0f be c0             	movsbl %al,%eax
+ 5af:	83 ec 08             	sub    $0x8,%esp
+ 5b2:	50                   	push   %eax
+ 5b3:	ff 75 08             	push   0x8(%ebp)
+ 5b6:	e8 34 fe ff ff       	call   3ef <putc>
+ 5bb:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 5be:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 5c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c5:	0f b6 00             	movzbl (%eax),%eax
+ 5c8:	84 c0                	test   %al,%al
+ 5ca:	75 da                	jne    5a6 <printf+0xe3>
+ 5cc:	eb 65                	jmp    633 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 5ce:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 5d2:	75 1d                	jne    5f1 <printf+0x12e>
+        putc(fd, *ap);
+ 5d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5d7:	8b 00                	mov    (%eax),%eax
+ 5d9:	0f be c0             	movsbl %al,%eax
+ 5dc:	83 ec 08             	sub    $0x8,%esp
+ 5df:	50                   	push   %eax
+ 5e0:	ff 75 08             	push   0x8(%ebp)
+ 5e3:	e8 07 fe ff ff       	call   3ef <putc>
+ 5e8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5eb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5ef:	eb 42                	jmp    633 <printf+0x170>
+      } else if(c == '%'){
+ 5f1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5f5:	75 17                	jne    60e <printf+0x14b>
+        putc(fd, c);
+ 5f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5fa:	0f be c0             	movsbl %al,%eax
+ 5fd:	83 ec 08             	sub    $0x8,%esp
+ 600:	50                   	push   %eax
+ 601:	ff 75 08             	push   0x8(%ebp)
+ 604:	e8 e6 fd ff ff       	call   3ef <putc>
+ 609:	83 c4 10             	add    $0x10,%esp
+ 60c:	eb 25                	jmp    633 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 60e:	83 ec 08             	sub    $0x8,%esp
+ 611:	6a 25                	push   $0x25
+ 613:	ff 75 08             	push   0x8(%ebp)
+ 616:	e8 d4 fd ff ff       	call   3ef <putc>
+ 61b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 61e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 621:	0f be c0             	movsbl %al,%eax
+ 624:	83 ec 08             	sub    $0x8,%esp
+ 627:	50                   	push   %eax
+ 628:	ff 75 08             	push   0x8(%ebp)
+ 62b:	e8 bf fd ff ff       	call   3ef <putc>
+ 630:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 633:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 63a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 63e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 641:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 644:	01 d0                	add    %edx,%eax
+ 646:	0f b6 00             	movzbl (%eax),%eax
+ 649:	84 c0                	test   %al,%al
+ 64b:	0f 85 94 fe ff ff    	jne    4e5 <printf+0x22>
+    }
+  }
+}
+ 651:	90                   	nop
+ 652:	90                   	nop
+ 653:	c9                   	leave
+ 654:	c3                   	ret
+
+00000655 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 655:	55                   	push   %ebp
+ 656:	89 e5                	mov    %esp,%ebp
+ 658:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 65b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65e:	83 e8 08             	sub    $0x8,%eax
+ 661:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 664:	a1 14 0b 00 00       	mov    0xb14,%eax
+ 669:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 66c:	eb 24                	jmp    692 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 66e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 671:	8b 00                	mov    (%eax),%eax
+ 673:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 676:	72 12                	jb     68a <free+0x35>
+ 678:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 67b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 67e:	72 24                	jb     6a4 <free+0x4f>
+ 680:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 683:	8b 00                	mov    (%eax),%eax
+ 685:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 688:	72 1a                	jb     6a4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 68a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68d:	8b 00                	mov    (%eax),%eax
+ 68f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 692:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 695:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 698:	73 d4                	jae    66e <free+0x19>
+ 69a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 69d:	8b 00                	mov    (%eax),%eax
+ 69f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6a2:	73 ca                	jae    66e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6a4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6a7:	8b 40 04             	mov    0x4(%eax),%eax
+ 6aa:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6b4:	01 c2                	add    %eax,%edx
+ 6b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b9:	8b 00                	mov    (%eax),%eax
+ 6bb:	39 c2                	cmp    %eax,%edx
+ 6bd:	75 24                	jne    6e3 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 6bf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6c2:	8b 50 04             	mov    0x4(%eax),%edx
+ 6c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c8:	8b 00                	mov    (%eax),%eax
+ 6ca:	8b 40 04             	mov    0x4(%eax),%eax
+ 6cd:	01 c2                	add    %eax,%edx
+ 6cf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d2:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6d5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d8:	8b 00                	mov    (%eax),%eax
+ 6da:	8b 10                	mov    (%eax),%edx
+ 6dc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6df:	89 10                	mov    %edx,(%eax)
+ 6e1:	eb 0a                	jmp    6ed <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e6:	8b 10                	mov    (%eax),%edx
+ 6e8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6eb:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 6ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f0:	8b 40 04             	mov    0x4(%eax),%eax
+ 6f3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fd:	01 d0                	add    %edx,%eax
+ 6ff:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 702:	75 20                	jne    724 <free+0xcf>
+    p->s.size += bp->s.size;
+ 704:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 707:	8b 50 04             	mov    0x4(%eax),%edx
+ 70a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 70d:	8b 40 04             	mov    0x4(%eax),%eax
+ 710:	01 c2                	add    %eax,%edx
+ 712:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 715:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 718:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 71b:	8b 10                	mov    (%eax),%edx
+ 71d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 720:	89 10                	mov    %edx,(%eax)
+ 722:	eb 08                	jmp    72c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 724:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 727:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 72a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 72c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72f:	a3 14 0b 00 00       	mov    %eax,0xb14
+}
+ 734:	90                   	nop
+ 735:	c9                   	leave
+ 736:	c3                   	ret
+
+00000737 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 737:	55                   	push   %ebp
+ 738:	89 e5                	mov    %esp,%ebp
+ 73a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 73d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 744:	77 07                	ja     74d <morecore+0x16>
+    nu = 4096;
+ 746:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 74d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 750:	c1 e0 03             	shl    $0x3,%eax
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	50                   	push   %eax
+ 757:	e8 13 fc ff ff       	call   36f <sbrk>
+ 75c:	83 c4 10             	add    $0x10,%esp
+ 75f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 762:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 766:	75 07                	jne    76f <morecore+0x38>
+    return 0;
+ 768:	b8 00 00 00 00       	mov    $0x0,%eax
+ 76d:	eb 26                	jmp    795 <morecore+0x5e>
+  hp = (Header*)p;
+ 76f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 772:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 775:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 778:	8b 55 08             	mov    0x8(%ebp),%edx
+ 77b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 77e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 781:	83 c0 08             	add    $0x8,%eax
+ 784:	83 ec 0c             	sub    $0xc,%esp
+ 787:	50                   	push   %eax
+ 788:	e8 c8 fe ff ff       	call   655 <free>
+ 78d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 790:	a1 14 0b 00 00       	mov    0xb14,%eax
+}
+ 795:	c9                   	leave
+ 796:	c3                   	ret
+
+00000797 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 797:	55                   	push   %ebp
+ 798:	89 e5                	mov    %esp,%ebp
+ 79a:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 79d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a0:	83 c0 07             	add    $0x7,%eax
+ 7a3:	c1 e8 03             	shr    $0x3,%eax
+ 7a6:	83 c0 01             	add    $0x1,%eax
+ 7a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7ac:	a1 14 0b 00 00       	mov    0xb14,%eax
+ 7b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7b8:	75 23                	jne    7dd <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 7ba:	c7 45 f0 0c 0b 00 00 	movl   $0xb0c,-0x10(%ebp)
+ 7c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c4:	a3 14 0b 00 00       	mov    %eax,0xb14
+ 7c9:	a1 14 0b 00 00       	mov    0xb14,%eax
+ 7ce:	a3 0c 0b 00 00       	mov    %eax,0xb0c
+    base.s.size = 0;
+ 7d3:	c7 05 10 0b 00 00 00 	movl   $0x0,0xb10
+ 7da:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7e0:	8b 00                	mov    (%eax),%eax
+ 7e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 7e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e8:	8b 40 04             	mov    0x4(%eax),%eax
+ 7eb:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 7ee:	72 4d                	jb     83d <malloc+0xa6>
+      if(p->s.size == nunits)
+ 7f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f3:	8b 40 04             	mov    0x4(%eax),%eax
+ 7f6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 7f9:	75 0c                	jne    807 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7fe:	8b 10                	mov    (%eax),%edx
+ 800:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 803:	89 10                	mov    %edx,(%eax)
+ 805:	eb 26                	jmp    82d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 807:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80a:	8b 40 04             	mov    0x4(%eax),%eax
+ 80d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 810:	89 c2                	mov    %eax,%edx
+ 812:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 815:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81b:	8b 40 04             	mov    0x4(%eax),%eax
+ 81e:	c1 e0 03             	shl    $0x3,%eax
+ 821:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 824:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 827:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 82a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 82d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 830:	a3 14 0b 00 00       	mov    %eax,0xb14
+      return (void*)(p + 1);
+ 835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 838:	83 c0 08             	add    $0x8,%eax
+ 83b:	eb 3b                	jmp    878 <malloc+0xe1>
+    }
+    if(p == freep)
+ 83d:	a1 14 0b 00 00       	mov    0xb14,%eax
+ 842:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 845:	75 1e                	jne    865 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 847:	83 ec 0c             	sub    $0xc,%esp
+ 84a:	ff 75 ec             	push   -0x14(%ebp)
+ 84d:	e8 e5 fe ff ff       	call   737 <morecore>
+ 852:	83 c4 10             	add    $0x10,%esp
+ 855:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 858:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 85c:	75 07                	jne    865 <malloc+0xce>
+        return 0;
+ 85e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 863:	eb 13                	jmp    878 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 86b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86e:	8b 00                	mov    (%eax),%eax
+ 870:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 873:	e9 6d ff ff ff       	jmp    7e5 <malloc+0x4e>
+  }
+}
+ 878:	c9                   	leave
+ 879:	c3                   	ret
@@ -0,0 +1,14 @@
+#define RUSAGE_SELF      0   // The calling process
+#define RUSAGE_CHILDREN  -1  // Its children that have been waited for
+
+// Resource usage of a process, counted since it was created.
+struct rusage {
+  uint utime;     // Clock ticks spent in user space
+  uint stime;     // Clock ticks spent in the kernel
+  uint nvcsw;     // Voluntary context switches (sleeps)
+  uint nivcsw;    // Involuntary context switches (preemptions)
+  uint nsyscall;  // System calls made
+  uint inblock;   // Disk blocks read
+  uint oublock;   // Disk blocks it changed, to be written
+  uint pgfault;   // Page faults
+};
@@ -0,0 +1,168 @@
+// Sleeping locks
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "rusage.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+
+// A process waiting in acquiresleep() or acquiresleepshared(),
+// queued on its stack.
+struct sleepwaiter {
+  struct proc *proc;
+  struct sleepwaiter *next;
+  int shared;        // Waiting to hold the lock shared
+  int granted;       // Set by releasesleep() when the lock is ours
+};
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+  initlock(&lk->lk, name);
+  lk->name = name;
+  lk->locked = 0;
+  lk->nshared = 0;
+  lk->pid = 0;
+  lk->head = 0;
+  lk->tail = 0;
+  lk->acquires = 0;
+  lk->contended = 0;
+}
+
+// Return the index of lk in the current process's shared
+// locks, or -1 if it does not hold lk shared.
+static int
+findshared(struct sleeplock *lk)
+{
+  int i;
+
+  for(i = 0; i < NSHLOCK; i++)
+    if(proc->shlocks[i] == lk)
+      return i;
+  return -1;
+}
+
+// Queue up as w and wait for releasesleep() to hand us the
+// lock.  Caller holds lk->lk.
+static void
+waitsleep(struct sleeplock *lk, struct sleepwaiter *w, int shared)
+{
+  lk->contended++;
+  lockstatsleep(&lk->lk);
+  w->proc = proc;
+  w->next = 0;
+  w->shared = shared;
+  w->granted = 0;
+  if(lk->tail)
+    lk->tail->next = w;
+  else
+    lk->head = w;
+  lk->tail = w;
+  while(!w->granted)
+    sleep(w, &lk->lk);
+}
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+  struct sleepwaiter w;
+
+  acquire(&lk->lk);
+  lk->acquires++;
+  if(!lk->locked){
+    lk->locked = 1;
+    lk->pid = proc->pid;
+  } else
+    waitsleep(lk, &w, 0);
+  release(&lk->lk);
+}
+
+// Hold lk shared, along with any other readers.  A reader
+// that finds writers waiting queues behind them, so that a
+// stream of readers cannot starve a writer.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  struct sleepwaiter w;
+  int i;
+
+  acquire(&lk->lk);
+  lk->acquires++;
+  if(!lk->locked || (lk->nshared > 0 && lk->head == 0)){
+    lk->locked = 1;
+    lk->nshared++;
+  } else
+    waitsleep(lk, &w, 1);
+  release(&lk->lk);
+
+  // Record the hold, so that holdingsleepshared() and
+  // releasesleep() can check it.
+  if((i = findshared(0)) < 0)
+    panic("acquiresleepshared");
+  proc->shlocks[i] = lk;
+}
+
+// Release lk, held exclusively or shared.  When the last
+// holder leaves, hand the lock to the first waiter and, if
+// it wants it shared, to the readers queued right behind it.
+void
+releasesleep(struct sleeplock *lk)
+{
+  struct sleepwaiter *w;
+  int i;
+
+  acquire(&lk->lk);
+  if(lk->nshared > 0){
+    if((i = findshared(lk)) < 0)
+      panic("releasesleep");
+    proc->shlocks[i] = 0;
+    if(--lk->nshared > 0){
+      release(&lk->lk);
+      return;
+    }
+  }
+  lk->pid = 0;
+  if((w = lk->head) == 0)
+    lk->locked = 0;
+  else if(!w->shared){
+    // Pass the lock on; it stays locked.
+    lk->head = w->next;
+    lk->pid = w->proc->pid;
+    w->granted = 1;
+    wakeup(w);
+  } else {
+    while((w = lk->head) != 0 && w->shared){
+      lk->head = w->next;
+      lk->nshared++;
+      w->granted = 1;
+      wakeup(w);
+    }
+  }
+  if(lk->head == 0)
+    lk->tail = 0;
+  release(&lk->lk);
+}
+
+// Does the current process hold lk exclusively?
+int
+holdingsleep(struct sleeplock *lk)
+{
+  int r;
+  
+  acquire(&lk->lk);
+  r = lk->locked && lk->nshared == 0 && lk->pid == proc->pid;
+  release(&lk->lk);
+  return r;
+}
+
+// Does the current process hold lk shared?
+int
+holdingsleepshared(struct sleeplock *lk)
+{
+  return findshared(lk) >= 0;
+}
@@ -0,0 +1,21 @@
+// Long-term locks for processes.
+// A process waiting for a sleep lock sleeps instead of
+// spinning.  Waiters queue in arrival order, and release
+// hands the lock straight to the first of them, waking
+// only that one.  A sleep lock can also be held shared,
+// by any number of processes at once, for reading.
+struct sleeplock {
+  uint locked;                  // Is the lock held?
+  uint nshared;                 // Processes holding it shared, if any
+  struct spinlock lk;           // spinlock protecting this sleep lock
+  struct sleepwaiter *head;     // Waiting processes, oldest first
+  struct sleepwaiter *tail;
+
+  // For debugging:
+  char *name;        // Name of lock.
+  int pid;           // Process holding lock exclusively
+
+  // Statistics:
+  uint acquires;     // Times acquired
+  uint contended;    // Times a process had to wait
+};
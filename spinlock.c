@@ -6,17 +6,98 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+// An MCS lock's queue of waiting CPUs.  A CPU can be queued
+// on several MCS locks at once, so each CPU has one node per
+// MCS lock, chosen by the lock's mcsid.
+struct mcsnode {
+  struct mcsnode *volatile next;  // Next CPU in the queue
+  volatile uint wait;             // Spin while set
+};
+
+static struct mcsnode mcsnodes[NCPU][NMCSLOCK];
+static int nmcslock;
+
+// Lock statistics.  Each CPU counts in its own copy, so
+// counting needs no atomic instructions; lockstat() adds
+// the copies up.  The names of the classes are in lockclass[],
+// which initlock() extends, guarded by lockclassbusy.
+static char *lockclass[NLOCKSTAT];
+static uint lockclassbusy;
+static struct lockstat lockstats[NCPU][NLOCKSTAT];
+
+// Return the index of the lock class called name,
+// adding it if it is new, or -1 if there is no room.
+static int
+lockclassof(char *name)
+{
+  int i;
+
+  while(xchg(&lockclassbusy, 1) != 0)
+    pause();
+  for(i = 0; i < NLOCKSTAT && lockclass[i]; i++)
+    if(strncmp(lockclass[i], name, sizeof(lockstats[0][0].name)) == 0)
+      break;
+  if(i < NLOCKSTAT && lockclass[i] == 0)
+    lockclass[i] = name;
+  xchg(&lockclassbusy, 0);
+  return i < NLOCKSTAT ? i : -1;
+}
+
+// Add n contended acquires from call site pc to ls.  If the
+// site table is full, the least frequent site gives way to pc,
+// which inherits its count, so that the most frequent sites
+// are kept (their counts are upper bounds).
+static void
+addsite(struct lockstat *ls, uint pc, uint n)
+{
+  int i, min;
+
+  min = 0;
+  for(i = 0; i < NLOCKSITE; i++){
+    if(ls->site[i] == pc || ls->sitecount[i] == 0){
+      ls->site[i] = pc;
+      ls->sitecount[i] += n;
+      return;
+    }
+    if(ls->sitecount[i] < ls->sitecount[min])
+      min = i;
+  }
+  ls->site[min] = pc;
+  ls->sitecount[min] += n;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
+  lk->class = lockclassof(name);
   lk->name = name;
   lk->locked = 0;
+  lk->kind = LK_TICKET;
+  lk->next = 0;
+  lk->owner = 0;
+  lk->tail = 0;
   lk->cpu = 0;
 }
 
+// Make lk an MCS lock.  MCS lock ids are handed out without
+// a lock, so only boot code, running one call at a time,
+// may make MCS locks.
+void
+initmcslock(struct spinlock *lk, char *name)
+{
+  initlock(lk, name);
+  if(nmcslock < NMCSLOCK){
+    lk->kind = LK_MCS;
+    lk->mcsid = nmcslock++;
+  } else
+    lk->kind = LK_TTAS;
+}
+
 // Acquire the lock.
 // Loops (spins) until the lock is acquired.
 // Holding a lock for a long time may cause
@@ -24,45 +105,176 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  struct mcsnode *me, *prev;
+  struct lockstat *ls;
+  uint ticket, spin;
+  uint64 start;
+  int contended;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  // It also serializes, so that reads after acquire are not
-  // reordered before it. 
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  start = rdtsc();
+  contended = 0;
+
+  // The xadd, xchg and cmpxchg are atomic.
+  switch(lk->kind){
+  case LK_TICKET:
+    // Take a ticket and wait for it to be called.
+    ticket = xadd(&lk->next, 1);
+    while(*(volatile uint*)&lk->owner != ticket){
+      contended = 1;
+      pause();
+    }
+    break;
+  case LK_MCS:
+    // Join the queue, and if someone is ahead of us,
+    // wait for them to hand us the lock.
+    me = &mcsnodes[cpu - cpus][lk->mcsid];
+    me->next = 0;
+    me->wait = 1;
+    prev = (struct mcsnode*)xchg(&lk->tail, (uint)me);
+    if(prev){
+      contended = 1;
+      prev->next = me;
+      while(me->wait)
+        pause();
+    }
+    break;
+  default:
+    // Spin reading, without locked writes, until the lock looks free.
+    while(xchg(&lk->locked, 1) != 0){
+      contended = 1;
+      while(*(volatile uint*)&lk->locked)
+        pause();
+    }
+    break;
+  }
+
+  // Tell the C compiler and the processor to not move loads
+  // or stores past this point, so that the critical section's
+  // memory references happen after the lock is acquired.
+  __sync_synchronize();
 
   // Record info about lock acquisition for debugging.
+  lk->locked = 1;
   lk->cpu = cpu;
   getcallerpcs(&lk, lk->pcs);
+
+  lk->acqtime = rdtsc();
+  if(lk->class >= 0){
+    ls = &lockstats[cpu - cpus][lk->class];
+    ls->acquires++;
+    if(contended){
+      spin = lk->acqtime - start;
+      ls->contended++;
+      ls->spin += spin;
+      if(spin > ls->maxspin)
+        ls->maxspin = spin;
+      addsite(ls, lk->pcs[0], 1);
+    }
+  }
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  struct mcsnode *me;
+  struct lockstat *ls;
+  uint hold;
+
   if(!holding(lk))
     panic("release");
 
+  if(lk->class >= 0){
+    ls = &lockstats[cpu - cpus][lk->class];
+    hold = rdtsc() - lk->acqtime;
+    ls->hold += hold;
+    if(hold > ls->maxhold)
+      ls->maxhold = hold;
+  }
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
-  // The xchg serializes, so that reads before release are 
-  // not reordered after it.  The 1996 PentiumPro manual (Volume 3,
-  // 7.2) says reads can be carried out speculatively and in
-  // any order, which implies we need to serialize here.
-  // But the 2007 Intel 64 Architecture Memory Ordering White
-  // Paper says that Intel 64 and IA-32 will not move a load
-  // after a store. So lock->locked = 0 would work here.
-  // The xchg being asm volatile ensures gcc emits it after
-  // the above assignments (and after the critical section).
-  xchg(&lk->locked, 0);
+  // Tell the C compiler and the processor to not move loads
+  // or stores past this point, so that all the stores in the
+  // critical section are visible to other CPUs before the
+  // lock is released.
+  __sync_synchronize();
+
+  switch(lk->kind){
+  case LK_TICKET:
+    // Only the holder writes owner, so a plain store
+    // would do; the xchg keeps gcc from moving it.
+    lk->locked = 0;
+    xchg(&lk->owner, lk->owner + 1);
+    break;
+  case LK_MCS:
+    // Hand the lock to the next CPU in the queue.  If there is
+    // none, empty the queue, unless a CPU is just joining it.
+    lk->locked = 0;
+    me = &mcsnodes[cpu - cpus][lk->mcsid];
+    if(me->next == 0){
+      if(cmpxchg(&lk->tail, (uint)me, 0) == (uint)me)
+        break;
+      while(me->next == 0)
+        pause();
+    }
+    me->next->wait = 0;
+    break;
+  default:
+    xchg(&lk->locked, 0);
+    break;
+  }
 
   popcli();
 }
 
+// Count a process going to sleep waiting for the sleep lock
+// that lk protects.  Caller must hold lk.
+void
+lockstatsleep(struct spinlock *lk)
+{
+  if(lk->class >= 0)
+    lockstats[cpu - cpus][lk->class].sleeps++;
+}
+
+// Copy statistics for up to n lock classes, summed over
+// all CPUs, to st[], and return how many were copied.
+// If reset is set, start counting again from zero.
+// Counts made by other CPUs while this runs may be lost.
+int
+lockstat(struct lockstat *st, int n, int reset)
+{
+  struct lockstat *ls;
+  int c, i, j;
+
+  for(i = 0; i < n && i < NLOCKSTAT && lockclass[i]; i++){
+    memset(&st[i], 0, sizeof(st[i]));
+    safestrcpy(st[i].name, lockclass[i], sizeof(st[i].name));
+    for(c = 0; c < ncpu; c++){
+      ls = &lockstats[c][i];
+      st[i].acquires += ls->acquires;
+      st[i].contended += ls->contended;
+      st[i].spin += ls->spin;
+      if(ls->maxspin > st[i].maxspin)
+        st[i].maxspin = ls->maxspin;
+      st[i].hold += ls->hold;
+      st[i].sleeps += ls->sleeps;
+      if(ls->maxhold > st[i].maxhold)
+        st[i].maxhold = ls->maxhold;
+      for(j = 0; j < NLOCKSITE && ls->sitecount[j]; j++)
+        addsite(&st[i], ls->site[j], ls->sitecount[j]);
+    }
+  }
+  if(reset)
+    memset(lockstats, 0, sizeof(lockstats));
+  return i;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
@@ -1,7 +1,25 @@
 // Mutual exclusion lock.
+//
+// initlock() makes a ticket lock: CPUs get the lock in the
+// order they asked for it, and waiters spin reading a shared
+// word.  initmcslock() makes an MCS queue lock, for hot locks
+// shared by all CPUs: each waiter spins on its own queue node,
+// so a release disturbs only the next CPU in line.  There are
+// only NMCSLOCK MCS locks; later ones are test-and-test-and-set
+// locks instead.
 struct spinlock {
   uint locked;       // Is the lock held?
-  
+  int kind;          // LK_TICKET, LK_MCS or LK_TTAS
+
+  uint next;         // Ticket lock: next ticket to hand out
+  uint owner;        // Ticket lock: ticket allowed to hold the lock
+  uint tail;         // MCS lock: last queued mcsnode, or 0
+  int mcsid;         // MCS lock: index of its nodes in each CPU's set
+
+  // For lockstat:
+  int class;         // Index of its lock class, or -1
+  uint64 acqtime;    // When acquired, for hold time
+
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
@@ -9,3 +27,8 @@ struct spinlock {
                      // that locked the lock.
 };
 
+#define LK_TICKET  0
+#define LK_MCS     1
+#define LK_TTAS    2
+
+#define NMCSLOCK   8   // maximum number of MCS locks
@@ -9,3 +9,11 @@ struct stat {
   short nlink; // Number of links to file
   uint size;   // Size of file in bytes
 };
+
+struct statfs {
+  uint bsize;  // Block size in bytes
+  uint blocks; // Data blocks in file system
+  uint bfree;  // Free blocks
+  uint files;  // Inodes in file system
+  uint ffree;  // Free inodes
+};
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
@@ -66,8 +67,9 @@ argptr(int n, char **pp, int size)
 
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (Threads created by clone() share writable memory, so a sibling
+// could change the string between this check and its use; growproc()
+// at least keeps the memory mapped until the system call returns.)
 int
 argstr(int n, char **pp)
 {
@@ -98,6 +100,19 @@ extern int sys_unlink(void);
 extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
+extern int sys_getrusage(void);
+extern int sys_lockstat(void);
+extern int sys_statfs(void);
+extern int sys_bcachesize(void);
+extern int sys_bcstat(void);
+extern int sys_sync(void);
+extern int sys_fsync(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -121,6 +136,19 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_getaffinity] sys_getaffinity,
+[SYS_getrusage] sys_getrusage,
+[SYS_lockstat] sys_lockstat,
+[SYS_statfs]  sys_statfs,
+[SYS_bcachesize] sys_bcachesize,
+[SYS_bcstat]  sys_bcstat,
+[SYS_sync]    sys_sync,
+[SYS_fsync]   sys_fsync,
 };
 
 void
@@ -129,6 +157,7 @@ syscall(void)
   int num;
 
   num = proc->tf->eax;
+  proc->ru.nsyscall++;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     proc->tf->eax = syscalls[num]();
   } else {
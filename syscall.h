@@ -20,3 +20,16 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_clone  22
+#define SYS_join   23
+#define SYS_futex_wait 24
+#define SYS_futex_wake 25
+#define SYS_setaffinity 26
+#define SYS_getaffinity 27
+#define SYS_getrusage 28
+#define SYS_lockstat 29
+#define SYS_statfs 30
+#define SYS_bcachesize 31
+#define SYS_bcstat 32
+#define SYS_sync   33
+#define SYS_fsync  34
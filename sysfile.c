@@ -9,10 +9,14 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "bcstat.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -111,6 +115,75 @@ sys_fstat(void)
   return filestat(f, st);
 }
 
+// Report free space on the file system holding path.
+int
+sys_statfs(void)
+{
+  char *path;
+  struct statfs *st;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  begin_opn(iputblocks());
+  if((ip = namei(path)) == 0){
+    end_op();
+    return -1;
+  }
+  fsstat(ip->dev, st);
+  iput(ip);
+  end_op();
+  return 0;
+}
+
+// Resize the buffer cache to about n buffers, if n > 0,
+// and return the number it has.
+int
+sys_bcachesize(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return bresize(n);
+}
+
+// Write everything changed so far to disk.
+int
+sys_sync(void)
+{
+  log_sync();
+  return 0;
+}
+
+// Write the open file fd, and everything else changed so
+// far, to disk: the log commits all metadata at once.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0 || f->type != FD_INODE)
+    return -1;
+  log_sync();
+  return 0;
+}
+
+// Copy buffer cache statistics to user space and, if
+// reset, start counting again.
+int
+sys_bcstat(void)
+{
+  struct bcstat *st;
+  int reset;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0 || argint(1, &reset) < 0)
+    return -1;
+  bstat(st, reset);
+  logstat(st, reset);
+  return 0;
+}
+
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
@@ -213,6 +286,7 @@ sys_unlink(void)
   }
 
   memset(&de, 0, sizeof(de));
+  dcacheinval(dp, name);
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
   if(ip->type == T_DIR){
@@ -255,7 +329,7 @@ create(char *path, short type, short major, short minor)
     return 0;
   }
 
-  if((ip = ialloc(dp->dev, type)) == 0)
+  if((ip = ialloc(dp->dev, type, dp->inum)) == 0)
     panic("create: ialloc");
 
   ilock(ip);
@@ -291,7 +365,7 @@ sys_open(void)
   if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
     return -1;
 
-  begin_op();
+  begin_opn(omode & O_CREATE ? MAXOPBLOCKS : iputblocks());
 
   if(omode & O_CREATE){
     ip = create(path, T_FILE, 0, 0);
@@ -325,6 +399,8 @@ sys_open(void)
   f->type = FD_INODE;
   f->ip = ip;
   f->off = 0;
+  f->raoff = 0;
+  f->rawin = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
   return fd;
@@ -373,7 +449,7 @@ sys_chdir(void)
   char *path;
   struct inode *ip;
 
-  begin_op();
+  begin_opn(iputblocks());
   if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
     end_op();
     return -1;
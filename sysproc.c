@@ -5,7 +5,9 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
+#include "lockstat.h"
 
 int
 sys_fork(void)
@@ -26,6 +28,28 @@ sys_wait(void)
   return wait();
 }
 
+int
+sys_clone(void)
+{
+  int fcn, arg;
+  char *stack;
+
+  if(argint(0, &fcn) < 0 || argint(1, &arg) < 0 ||
+     argptr(2, &stack, PGSIZE) < 0)
+    return -1;
+  return clone((void(*)(void*))fcn, (void*)arg, stack);
+}
+
+int
+sys_join(void)
+{
+  void **stack;
+
+  if(argptr(0, (char**)&stack, sizeof(*stack)) < 0)
+    return -1;
+  return join(stack);
+}
+
 int
 sys_kill(void)
 {
@@ -36,6 +60,78 @@ sys_kill(void)
   return kill(pid);
 }
 
+int
+sys_futex_wait(void)
+{
+  uint *addr;
+  int val;
+
+  if(argptr(0, (char**)&addr, sizeof(*addr)) < 0 || argint(1, &val) < 0)
+    return -1;
+  if((uint)addr % sizeof(*addr) != 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+int
+sys_futex_wake(void)
+{
+  uint *addr;
+  int n;
+
+  if(argptr(0, (char**)&addr, sizeof(*addr)) < 0 || argint(1, &n) < 0)
+    return -1;
+  if((uint)addr % sizeof(*addr) != 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
+
+int
+sys_getrusage(void)
+{
+  int who;
+  struct rusage *ru;
+
+  if(argint(0, &who) < 0 || argptr(1, (void*)&ru, sizeof(*ru)) < 0)
+    return -1;
+  return getrusage(who, ru);
+}
+
+int
+sys_lockstat(void)
+{
+  int n, reset;
+  struct lockstat *st;
+
+  if(argint(1, &n) < 0 || argint(2, &reset) < 0 || n < 0)
+    return -1;
+  if(n > NLOCKSTAT)
+    n = NLOCKSTAT;  // so that n*sizeof(*st) can't overflow
+  if(argptr(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return lockstat(st, n, reset);
+}
+
 int
 sys_getpid(void)
 {
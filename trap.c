@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
@@ -40,7 +41,9 @@ trap(struct trapframe *tf)
     if(proc->killed)
       exit();
     proc->tf = tf;
+    xchg(&proc->insyscall, 1);
     syscall();
+    endsyscall();
     if(proc->killed)
       exit();
     return;
@@ -54,6 +57,13 @@ trap(struct trapframe *tf)
       wakeup(&ticks);
       release(&tickslock);
     }
+    // Charge the tick to whatever this CPU was running.
+    if(proc){
+      if((tf->cs&3) == DPL_USER)
+        proc->ru.utime++;
+      else
+        proc->ru.stime++;
+    }
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -71,6 +81,12 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_TLBFLUSH:
+    // Another CPU changed the page table we are using (see growproc).
+    lcr3(rcr3());
+    cpu->tlbflush = 0;
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -87,6 +103,8 @@ trap(struct trapframe *tf)
       panic("trap");
     }
     // In user space, assume process misbehaved.
+    if(tf->trapno == T_PGFLT)
+      proc->ru.pgfault++;
     cprintf("pid %d %s: trap %d err %d on cpu %d "
             "eip 0x%x addr 0x%x--kill proc\n",
             proc->pid, proc->name, tf->trapno, tf->err, cpu->id, tf->eip, 
@@ -102,8 +120,10 @@ trap(struct trapframe *tf)
 
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER){
+    proc->ru.nivcsw++;
     yield();
+  }
 
   // Check if the process has been killed since we yielded
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
@@ -1,4 +1,8 @@
 struct stat;
+struct statfs;
+struct bcstat;
+struct rusage;
+struct lockstat;
 struct rtcdate;
 
 // system calls
@@ -23,6 +27,19 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex_wait(uint*, uint);
+int futex_wake(uint*, int);
+int setaffinity(int, uint);
+int getaffinity(int);
+int getrusage(int, struct rusage*);
+int lockstat(struct lockstat*, int, int);
+int statfs(char*, struct statfs*);
+int bcachesize(int);
+int bcstat(struct bcstat*, int);
+int sync(void);
+int fsync(int);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -0,0 +1,11589 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <xchg>:
+  asm volatile("sti");
+}
+
+static inline uint
+xchg(volatile uint *addr, uint newval)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  uint result;
+  
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+       6:	8b 55 08             	mov    0x8(%ebp),%edx
+       9:	8b 45 0c             	mov    0xc(%ebp),%eax
+       c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+       f:	f0 87 02             	lock xchg %eax,(%edx)
+      12:	89 45 fc             	mov    %eax,-0x4(%ebp)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+      15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+      18:	c9                   	leave
+      19:	c3                   	ret
+
+0000001a <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+      1a:	55                   	push   %ebp
+      1b:	89 e5                	mov    %esp,%ebp
+      1d:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "iput test\n");
+      20:	a1 04 9a 00 00       	mov    0x9a04,%eax
+      25:	83 ec 08             	sub    $0x8,%esp
+      28:	68 8e 6c 00 00       	push   $0x6c8e
+      2d:	50                   	push   %eax
+      2e:	e8 8d 68 00 00       	call   68c0 <printf>
+      33:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("iputdir") < 0){
+      36:	83 ec 0c             	sub    $0xc,%esp
+      39:	68 99 6c 00 00       	push   $0x6c99
+      3e:	e8 09 67 00 00       	call   674c <mkdir>
+      43:	83 c4 10             	add    $0x10,%esp
+      46:	85 c0                	test   %eax,%eax
+      48:	79 1b                	jns    65 <iputtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+      4a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+      4f:	83 ec 08             	sub    $0x8,%esp
+      52:	68 a1 6c 00 00       	push   $0x6ca1
+      57:	50                   	push   %eax
+      58:	e8 63 68 00 00       	call   68c0 <printf>
+      5d:	83 c4 10             	add    $0x10,%esp
+    exit();
+      60:	e8 7f 66 00 00       	call   66e4 <exit>
+  }
+  if(chdir("iputdir") < 0){
+      65:	83 ec 0c             	sub    $0xc,%esp
+      68:	68 99 6c 00 00       	push   $0x6c99
+      6d:	e8 e2 66 00 00       	call   6754 <chdir>
+      72:	83 c4 10             	add    $0x10,%esp
+      75:	85 c0                	test   %eax,%eax
+      77:	79 1b                	jns    94 <iputtest+0x7a>
+    printf(stdout, "chdir iputdir failed\n");
+      79:	a1 04 9a 00 00       	mov    0x9a04,%eax
+      7e:	83 ec 08             	sub    $0x8,%esp
+      81:	68 af 6c 00 00       	push   $0x6caf
+      86:	50                   	push   %eax
+      87:	e8 34 68 00 00       	call   68c0 <printf>
+      8c:	83 c4 10             	add    $0x10,%esp
+    exit();
+      8f:	e8 50 66 00 00       	call   66e4 <exit>
+  }
+  if(unlink("../iputdir") < 0){
+      94:	83 ec 0c             	sub    $0xc,%esp
+      97:	68 c5 6c 00 00       	push   $0x6cc5
+      9c:	e8 93 66 00 00       	call   6734 <unlink>
+      a1:	83 c4 10             	add    $0x10,%esp
+      a4:	85 c0                	test   %eax,%eax
+      a6:	79 1b                	jns    c3 <iputtest+0xa9>
+    printf(stdout, "unlink ../iputdir failed\n");
+      a8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 d0 6c 00 00       	push   $0x6cd0
+      b5:	50                   	push   %eax
+      b6:	e8 05 68 00 00       	call   68c0 <printf>
+      bb:	83 c4 10             	add    $0x10,%esp
+    exit();
+      be:	e8 21 66 00 00       	call   66e4 <exit>
+  }
+  if(chdir("/") < 0){
+      c3:	83 ec 0c             	sub    $0xc,%esp
+      c6:	68 ea 6c 00 00       	push   $0x6cea
+      cb:	e8 84 66 00 00       	call   6754 <chdir>
+      d0:	83 c4 10             	add    $0x10,%esp
+      d3:	85 c0                	test   %eax,%eax
+      d5:	79 1b                	jns    f2 <iputtest+0xd8>
+    printf(stdout, "chdir / failed\n");
+      d7:	a1 04 9a 00 00       	mov    0x9a04,%eax
+      dc:	83 ec 08             	sub    $0x8,%esp
+      df:	68 ec 6c 00 00       	push   $0x6cec
+      e4:	50                   	push   %eax
+      e5:	e8 d6 67 00 00       	call   68c0 <printf>
+      ea:	83 c4 10             	add    $0x10,%esp
+    exit();
+      ed:	e8 f2 65 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "iput test ok\n");
+      f2:	a1 04 9a 00 00       	mov    0x9a04,%eax
+      f7:	83 ec 08             	sub    $0x8,%esp
+      fa:	68 fc 6c 00 00       	push   $0x6cfc
+      ff:	50                   	push   %eax
+     100:	e8 bb 67 00 00       	call   68c0 <printf>
+     105:	83 c4 10             	add    $0x10,%esp
+}
+     108:	90                   	nop
+     109:	c9                   	leave
+     10a:	c3                   	ret
+
+0000010b <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+     10b:	55                   	push   %ebp
+     10c:	89 e5                	mov    %esp,%ebp
+     10e:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+     111:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     116:	83 ec 08             	sub    $0x8,%esp
+     119:	68 0a 6d 00 00       	push   $0x6d0a
+     11e:	50                   	push   %eax
+     11f:	e8 9c 67 00 00       	call   68c0 <printf>
+     124:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     127:	e8 b0 65 00 00       	call   66dc <fork>
+     12c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     12f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     133:	79 1b                	jns    150 <exitiputtest+0x45>
+    printf(stdout, "fork failed\n");
+     135:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     13a:	83 ec 08             	sub    $0x8,%esp
+     13d:	68 19 6d 00 00       	push   $0x6d19
+     142:	50                   	push   %eax
+     143:	e8 78 67 00 00       	call   68c0 <printf>
+     148:	83 c4 10             	add    $0x10,%esp
+    exit();
+     14b:	e8 94 65 00 00       	call   66e4 <exit>
+  }
+  if(pid == 0){
+     150:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     154:	0f 85 92 00 00 00    	jne    1ec <exitiputtest+0xe1>
+    if(mkdir("iputdir") < 0){
+     15a:	83 ec 0c             	sub    $0xc,%esp
+     15d:	68 99 6c 00 00       	push   $0x6c99
+     162:	e8 e5 65 00 00       	call   674c <mkdir>
+     167:	83 c4 10             	add    $0x10,%esp
+     16a:	85 c0                	test   %eax,%eax
+     16c:	79 1b                	jns    189 <exitiputtest+0x7e>
+      printf(stdout, "mkdir failed\n");
+     16e:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     173:	83 ec 08             	sub    $0x8,%esp
+     176:	68 a1 6c 00 00       	push   $0x6ca1
+     17b:	50                   	push   %eax
+     17c:	e8 3f 67 00 00       	call   68c0 <printf>
+     181:	83 c4 10             	add    $0x10,%esp
+      exit();
+     184:	e8 5b 65 00 00       	call   66e4 <exit>
+    }
+    if(chdir("iputdir") < 0){
+     189:	83 ec 0c             	sub    $0xc,%esp
+     18c:	68 99 6c 00 00       	push   $0x6c99
+     191:	e8 be 65 00 00       	call   6754 <chdir>
+     196:	83 c4 10             	add    $0x10,%esp
+     199:	85 c0                	test   %eax,%eax
+     19b:	79 1b                	jns    1b8 <exitiputtest+0xad>
+      printf(stdout, "child chdir failed\n");
+     19d:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     1a2:	83 ec 08             	sub    $0x8,%esp
+     1a5:	68 26 6d 00 00       	push   $0x6d26
+     1aa:	50                   	push   %eax
+     1ab:	e8 10 67 00 00       	call   68c0 <printf>
+     1b0:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1b3:	e8 2c 65 00 00       	call   66e4 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+     1b8:	83 ec 0c             	sub    $0xc,%esp
+     1bb:	68 c5 6c 00 00       	push   $0x6cc5
+     1c0:	e8 6f 65 00 00       	call   6734 <unlink>
+     1c5:	83 c4 10             	add    $0x10,%esp
+     1c8:	85 c0                	test   %eax,%eax
+     1ca:	79 1b                	jns    1e7 <exitiputtest+0xdc>
+      printf(stdout, "unlink ../iputdir failed\n");
+     1cc:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     1d1:	83 ec 08             	sub    $0x8,%esp
+     1d4:	68 d0 6c 00 00       	push   $0x6cd0
+     1d9:	50                   	push   %eax
+     1da:	e8 e1 66 00 00       	call   68c0 <printf>
+     1df:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1e2:	e8 fd 64 00 00       	call   66e4 <exit>
+    }
+    exit();
+     1e7:	e8 f8 64 00 00       	call   66e4 <exit>
+  }
+  wait();
+     1ec:	e8 fb 64 00 00       	call   66ec <wait>
+  printf(stdout, "exitiput test ok\n");
+     1f1:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     1f6:	83 ec 08             	sub    $0x8,%esp
+     1f9:	68 3a 6d 00 00       	push   $0x6d3a
+     1fe:	50                   	push   %eax
+     1ff:	e8 bc 66 00 00       	call   68c0 <printf>
+     204:	83 c4 10             	add    $0x10,%esp
+}
+     207:	90                   	nop
+     208:	c9                   	leave
+     209:	c3                   	ret
+
+0000020a <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     20a:	55                   	push   %ebp
+     20b:	89 e5                	mov    %esp,%ebp
+     20d:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     210:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     215:	83 ec 08             	sub    $0x8,%esp
+     218:	68 4c 6d 00 00       	push   $0x6d4c
+     21d:	50                   	push   %eax
+     21e:	e8 9d 66 00 00       	call   68c0 <printf>
+     223:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("oidir") < 0){
+     226:	83 ec 0c             	sub    $0xc,%esp
+     229:	68 5b 6d 00 00       	push   $0x6d5b
+     22e:	e8 19 65 00 00       	call   674c <mkdir>
+     233:	83 c4 10             	add    $0x10,%esp
+     236:	85 c0                	test   %eax,%eax
+     238:	79 1b                	jns    255 <openiputtest+0x4b>
+    printf(stdout, "mkdir oidir failed\n");
+     23a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     23f:	83 ec 08             	sub    $0x8,%esp
+     242:	68 61 6d 00 00       	push   $0x6d61
+     247:	50                   	push   %eax
+     248:	e8 73 66 00 00       	call   68c0 <printf>
+     24d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     250:	e8 8f 64 00 00       	call   66e4 <exit>
+  }
+  pid = fork();
+     255:	e8 82 64 00 00       	call   66dc <fork>
+     25a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     25d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     261:	79 1b                	jns    27e <openiputtest+0x74>
+    printf(stdout, "fork failed\n");
+     263:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     268:	83 ec 08             	sub    $0x8,%esp
+     26b:	68 19 6d 00 00       	push   $0x6d19
+     270:	50                   	push   %eax
+     271:	e8 4a 66 00 00       	call   68c0 <printf>
+     276:	83 c4 10             	add    $0x10,%esp
+    exit();
+     279:	e8 66 64 00 00       	call   66e4 <exit>
+  }
+  if(pid == 0){
+     27e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     282:	75 3b                	jne    2bf <openiputtest+0xb5>
+    int fd = open("oidir", O_RDWR);
+     284:	83 ec 08             	sub    $0x8,%esp
+     287:	6a 02                	push   $0x2
+     289:	68 5b 6d 00 00       	push   $0x6d5b
+     28e:	e8 91 64 00 00       	call   6724 <open>
+     293:	83 c4 10             	add    $0x10,%esp
+     296:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     299:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     29d:	78 1b                	js     2ba <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     29f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     2a4:	83 ec 08             	sub    $0x8,%esp
+     2a7:	68 78 6d 00 00       	push   $0x6d78
+     2ac:	50                   	push   %eax
+     2ad:	e8 0e 66 00 00       	call   68c0 <printf>
+     2b2:	83 c4 10             	add    $0x10,%esp
+      exit();
+     2b5:	e8 2a 64 00 00       	call   66e4 <exit>
+    }
+    exit();
+     2ba:	e8 25 64 00 00       	call   66e4 <exit>
+  }
+  sleep(1);
+     2bf:	83 ec 0c             	sub    $0xc,%esp
+     2c2:	6a 01                	push   $0x1
+     2c4:	e8 ab 64 00 00       	call   6774 <sleep>
+     2c9:	83 c4 10             	add    $0x10,%esp
+  if(unlink("oidir") != 0){
+     2cc:	83 ec 0c             	sub    $0xc,%esp
+     2cf:	68 5b 6d 00 00       	push   $0x6d5b
+     2d4:	e8 5b 64 00 00       	call   6734 <unlink>
+     2d9:	83 c4 10             	add    $0x10,%esp
+     2dc:	85 c0                	test   %eax,%eax
+     2de:	74 1b                	je     2fb <openiputtest+0xf1>
+    printf(stdout, "unlink failed\n");
+     2e0:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     2e5:	83 ec 08             	sub    $0x8,%esp
+     2e8:	68 9c 6d 00 00       	push   $0x6d9c
+     2ed:	50                   	push   %eax
+     2ee:	e8 cd 65 00 00       	call   68c0 <printf>
+     2f3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2f6:	e8 e9 63 00 00       	call   66e4 <exit>
+  }
+  wait();
+     2fb:	e8 ec 63 00 00       	call   66ec <wait>
+  printf(stdout, "openiput test ok\n");
+     300:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     305:	83 ec 08             	sub    $0x8,%esp
+     308:	68 ab 6d 00 00       	push   $0x6dab
+     30d:	50                   	push   %eax
+     30e:	e8 ad 65 00 00       	call   68c0 <printf>
+     313:	83 c4 10             	add    $0x10,%esp
+}
+     316:	90                   	nop
+     317:	c9                   	leave
+     318:	c3                   	ret
+
+00000319 <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     319:	55                   	push   %ebp
+     31a:	89 e5                	mov    %esp,%ebp
+     31c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     31f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     324:	83 ec 08             	sub    $0x8,%esp
+     327:	68 bd 6d 00 00       	push   $0x6dbd
+     32c:	50                   	push   %eax
+     32d:	e8 8e 65 00 00       	call   68c0 <printf>
+     332:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+     335:	83 ec 08             	sub    $0x8,%esp
+     338:	6a 00                	push   $0x0
+     33a:	68 78 6c 00 00       	push   $0x6c78
+     33f:	e8 e0 63 00 00       	call   6724 <open>
+     344:	83 c4 10             	add    $0x10,%esp
+     347:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+     34a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     34e:	79 1b                	jns    36b <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+     350:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     355:	83 ec 08             	sub    $0x8,%esp
+     358:	68 c8 6d 00 00       	push   $0x6dc8
+     35d:	50                   	push   %eax
+     35e:	e8 5d 65 00 00       	call   68c0 <printf>
+     363:	83 c4 10             	add    $0x10,%esp
+    exit();
+     366:	e8 79 63 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+     36b:	83 ec 0c             	sub    $0xc,%esp
+     36e:	ff 75 f4             	push   -0xc(%ebp)
+     371:	e8 96 63 00 00       	call   670c <close>
+     376:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+     379:	83 ec 08             	sub    $0x8,%esp
+     37c:	6a 00                	push   $0x0
+     37e:	68 db 6d 00 00       	push   $0x6ddb
+     383:	e8 9c 63 00 00       	call   6724 <open>
+     388:	83 c4 10             	add    $0x10,%esp
+     38b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+     38e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     392:	78 1b                	js     3af <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     394:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     399:	83 ec 08             	sub    $0x8,%esp
+     39c:	68 e8 6d 00 00       	push   $0x6de8
+     3a1:	50                   	push   %eax
+     3a2:	e8 19 65 00 00       	call   68c0 <printf>
+     3a7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3aa:	e8 35 63 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "open test ok\n");
+     3af:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     3b4:	83 ec 08             	sub    $0x8,%esp
+     3b7:	68 06 6e 00 00       	push   $0x6e06
+     3bc:	50                   	push   %eax
+     3bd:	e8 fe 64 00 00       	call   68c0 <printf>
+     3c2:	83 c4 10             	add    $0x10,%esp
+}
+     3c5:	90                   	nop
+     3c6:	c9                   	leave
+     3c7:	c3                   	ret
+
+000003c8 <writetest>:
+
+void
+writetest(void)
+{
+     3c8:	55                   	push   %ebp
+     3c9:	89 e5                	mov    %esp,%ebp
+     3cb:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     3ce:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     3d3:	83 ec 08             	sub    $0x8,%esp
+     3d6:	68 14 6e 00 00       	push   $0x6e14
+     3db:	50                   	push   %eax
+     3dc:	e8 df 64 00 00       	call   68c0 <printf>
+     3e1:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+     3e4:	83 ec 08             	sub    $0x8,%esp
+     3e7:	68 02 02 00 00       	push   $0x202
+     3ec:	68 25 6e 00 00       	push   $0x6e25
+     3f1:	e8 2e 63 00 00       	call   6724 <open>
+     3f6:	83 c4 10             	add    $0x10,%esp
+     3f9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     3fc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     400:	78 22                	js     424 <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+     402:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     407:	83 ec 08             	sub    $0x8,%esp
+     40a:	68 2b 6e 00 00       	push   $0x6e2b
+     40f:	50                   	push   %eax
+     410:	e8 ab 64 00 00       	call   68c0 <printf>
+     415:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     418:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     41f:	e9 8f 00 00 00       	jmp    4b3 <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     424:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     429:	83 ec 08             	sub    $0x8,%esp
+     42c:	68 46 6e 00 00       	push   $0x6e46
+     431:	50                   	push   %eax
+     432:	e8 89 64 00 00       	call   68c0 <printf>
+     437:	83 c4 10             	add    $0x10,%esp
+    exit();
+     43a:	e8 a5 62 00 00       	call   66e4 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     43f:	83 ec 04             	sub    $0x4,%esp
+     442:	6a 0a                	push   $0xa
+     444:	68 62 6e 00 00       	push   $0x6e62
+     449:	ff 75 f0             	push   -0x10(%ebp)
+     44c:	e8 b3 62 00 00       	call   6704 <write>
+     451:	83 c4 10             	add    $0x10,%esp
+     454:	83 f8 0a             	cmp    $0xa,%eax
+     457:	74 1e                	je     477 <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     459:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     45e:	83 ec 04             	sub    $0x4,%esp
+     461:	ff 75 f4             	push   -0xc(%ebp)
+     464:	68 70 6e 00 00       	push   $0x6e70
+     469:	50                   	push   %eax
+     46a:	e8 51 64 00 00       	call   68c0 <printf>
+     46f:	83 c4 10             	add    $0x10,%esp
+      exit();
+     472:	e8 6d 62 00 00       	call   66e4 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     477:	83 ec 04             	sub    $0x4,%esp
+     47a:	6a 0a                	push   $0xa
+     47c:	68 94 6e 00 00       	push   $0x6e94
+     481:	ff 75 f0             	push   -0x10(%ebp)
+     484:	e8 7b 62 00 00       	call   6704 <write>
+     489:	83 c4 10             	add    $0x10,%esp
+     48c:	83 f8 0a             	cmp    $0xa,%eax
+     48f:	74 1e                	je     4af <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     491:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     496:	83 ec 04             	sub    $0x4,%esp
+     499:	ff 75 f4             	push   -0xc(%ebp)
+     49c:	68 a0 6e 00 00       	push   $0x6ea0
+     4a1:	50                   	push   %eax
+     4a2:	e8 19 64 00 00       	call   68c0 <printf>
+     4a7:	83 c4 10             	add    $0x10,%esp
+      exit();
+     4aa:	e8 35 62 00 00       	call   66e4 <exit>
+  for(i = 0; i < 100; i++){
+     4af:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     4b3:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     4b7:	7e 86                	jle    43f <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     4b9:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     4be:	83 ec 08             	sub    $0x8,%esp
+     4c1:	68 c4 6e 00 00       	push   $0x6ec4
+     4c6:	50                   	push   %eax
+     4c7:	e8 f4 63 00 00       	call   68c0 <printf>
+     4cc:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     4cf:	83 ec 0c             	sub    $0xc,%esp
+     4d2:	ff 75 f0             	push   -0x10(%ebp)
+     4d5:	e8 32 62 00 00       	call   670c <close>
+     4da:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     4dd:	83 ec 08             	sub    $0x8,%esp
+     4e0:	6a 00                	push   $0x0
+     4e2:	68 25 6e 00 00       	push   $0x6e25
+     4e7:	e8 38 62 00 00       	call   6724 <open>
+     4ec:	83 c4 10             	add    $0x10,%esp
+     4ef:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     4f2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4f6:	78 3c                	js     534 <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     4f8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     4fd:	83 ec 08             	sub    $0x8,%esp
+     500:	68 cf 6e 00 00       	push   $0x6ecf
+     505:	50                   	push   %eax
+     506:	e8 b5 63 00 00       	call   68c0 <printf>
+     50b:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     50e:	83 ec 04             	sub    $0x4,%esp
+     511:	68 d0 07 00 00       	push   $0x7d0
+     516:	68 20 9a 00 00       	push   $0x9a20
+     51b:	ff 75 f0             	push   -0x10(%ebp)
+     51e:	e8 d9 61 00 00       	call   66fc <read>
+     523:	83 c4 10             	add    $0x10,%esp
+     526:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     529:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     530:	75 57                	jne    589 <writetest+0x1c1>
+     532:	eb 1b                	jmp    54f <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     534:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     539:	83 ec 08             	sub    $0x8,%esp
+     53c:	68 e8 6e 00 00       	push   $0x6ee8
+     541:	50                   	push   %eax
+     542:	e8 79 63 00 00       	call   68c0 <printf>
+     547:	83 c4 10             	add    $0x10,%esp
+    exit();
+     54a:	e8 95 61 00 00       	call   66e4 <exit>
+    printf(stdout, "read succeeded ok\n");
+     54f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     554:	83 ec 08             	sub    $0x8,%esp
+     557:	68 03 6f 00 00       	push   $0x6f03
+     55c:	50                   	push   %eax
+     55d:	e8 5e 63 00 00       	call   68c0 <printf>
+     562:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     565:	83 ec 0c             	sub    $0xc,%esp
+     568:	ff 75 f0             	push   -0x10(%ebp)
+     56b:	e8 9c 61 00 00       	call   670c <close>
+     570:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     573:	83 ec 0c             	sub    $0xc,%esp
+     576:	68 25 6e 00 00       	push   $0x6e25
+     57b:	e8 b4 61 00 00       	call   6734 <unlink>
+     580:	83 c4 10             	add    $0x10,%esp
+     583:	85 c0                	test   %eax,%eax
+     585:	79 38                	jns    5bf <writetest+0x1f7>
+     587:	eb 1b                	jmp    5a4 <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     589:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     58e:	83 ec 08             	sub    $0x8,%esp
+     591:	68 16 6f 00 00       	push   $0x6f16
+     596:	50                   	push   %eax
+     597:	e8 24 63 00 00       	call   68c0 <printf>
+     59c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     59f:	e8 40 61 00 00       	call   66e4 <exit>
+    printf(stdout, "unlink small failed\n");
+     5a4:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     5a9:	83 ec 08             	sub    $0x8,%esp
+     5ac:	68 23 6f 00 00       	push   $0x6f23
+     5b1:	50                   	push   %eax
+     5b2:	e8 09 63 00 00       	call   68c0 <printf>
+     5b7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5ba:	e8 25 61 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     5bf:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     5c4:	83 ec 08             	sub    $0x8,%esp
+     5c7:	68 38 6f 00 00       	push   $0x6f38
+     5cc:	50                   	push   %eax
+     5cd:	e8 ee 62 00 00       	call   68c0 <printf>
+     5d2:	83 c4 10             	add    $0x10,%esp
+}
+     5d5:	90                   	nop
+     5d6:	c9                   	leave
+     5d7:	c3                   	ret
+
+000005d8 <writetest1>:
+
+#define NBIGBLOCKS 170  // needs a double-indirect block with 512-byte blocks
+
+void
+writetest1(void)
+{
+     5d8:	55                   	push   %ebp
+     5d9:	89 e5                	mov    %esp,%ebp
+     5db:	83 ec 18             	sub    $0x18,%esp
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     5de:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     5e3:	83 ec 08             	sub    $0x8,%esp
+     5e6:	68 4c 6f 00 00       	push   $0x6f4c
+     5eb:	50                   	push   %eax
+     5ec:	e8 cf 62 00 00       	call   68c0 <printf>
+     5f1:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_CREATE|O_RDWR);
+     5f4:	83 ec 08             	sub    $0x8,%esp
+     5f7:	68 02 02 00 00       	push   $0x202
+     5fc:	68 5c 6f 00 00       	push   $0x6f5c
+     601:	e8 1e 61 00 00       	call   6724 <open>
+     606:	83 c4 10             	add    $0x10,%esp
+     609:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     60c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     610:	79 1b                	jns    62d <writetest1+0x55>
+    printf(stdout, "error: creat big failed!\n");
+     612:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     617:	83 ec 08             	sub    $0x8,%esp
+     61a:	68 60 6f 00 00       	push   $0x6f60
+     61f:	50                   	push   %eax
+     620:	e8 9b 62 00 00       	call   68c0 <printf>
+     625:	83 c4 10             	add    $0x10,%esp
+    exit();
+     628:	e8 b7 60 00 00       	call   66e4 <exit>
+  }
+
+  // Enough blocks to need a double-indirect block.
+  for(i = 0; i < NBIGBLOCKS; i++){
+     62d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     634:	eb 4b                	jmp    681 <writetest1+0xa9>
+    ((int*)buf)[0] = i;
+     636:	ba 20 9a 00 00       	mov    $0x9a20,%edx
+     63b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     63e:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, 512) != 512){
+     640:	83 ec 04             	sub    $0x4,%esp
+     643:	68 00 02 00 00       	push   $0x200
+     648:	68 20 9a 00 00       	push   $0x9a20
+     64d:	ff 75 ec             	push   -0x14(%ebp)
+     650:	e8 af 60 00 00       	call   6704 <write>
+     655:	83 c4 10             	add    $0x10,%esp
+     658:	3d 00 02 00 00       	cmp    $0x200,%eax
+     65d:	74 1e                	je     67d <writetest1+0xa5>
+      printf(stdout, "error: write big file failed\n", i);
+     65f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     664:	83 ec 04             	sub    $0x4,%esp
+     667:	ff 75 f4             	push   -0xc(%ebp)
+     66a:	68 7a 6f 00 00       	push   $0x6f7a
+     66f:	50                   	push   %eax
+     670:	e8 4b 62 00 00       	call   68c0 <printf>
+     675:	83 c4 10             	add    $0x10,%esp
+      exit();
+     678:	e8 67 60 00 00       	call   66e4 <exit>
+  for(i = 0; i < NBIGBLOCKS; i++){
+     67d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     681:	81 7d f4 a9 00 00 00 	cmpl   $0xa9,-0xc(%ebp)
+     688:	7e ac                	jle    636 <writetest1+0x5e>
+    }
+  }
+
+  close(fd);
+     68a:	83 ec 0c             	sub    $0xc,%esp
+     68d:	ff 75 ec             	push   -0x14(%ebp)
+     690:	e8 77 60 00 00       	call   670c <close>
+     695:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_RDONLY);
+     698:	83 ec 08             	sub    $0x8,%esp
+     69b:	6a 00                	push   $0x0
+     69d:	68 5c 6f 00 00       	push   $0x6f5c
+     6a2:	e8 7d 60 00 00       	call   6724 <open>
+     6a7:	83 c4 10             	add    $0x10,%esp
+     6aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     6ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     6b1:	79 1b                	jns    6ce <writetest1+0xf6>
+    printf(stdout, "error: open big failed!\n");
+     6b3:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     6b8:	83 ec 08             	sub    $0x8,%esp
+     6bb:	68 98 6f 00 00       	push   $0x6f98
+     6c0:	50                   	push   %eax
+     6c1:	e8 fa 61 00 00       	call   68c0 <printf>
+     6c6:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6c9:	e8 16 60 00 00       	call   66e4 <exit>
+  }
+
+  n = 0;
+     6ce:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(;;){
+    i = read(fd, buf, 512);
+     6d5:	83 ec 04             	sub    $0x4,%esp
+     6d8:	68 00 02 00 00       	push   $0x200
+     6dd:	68 20 9a 00 00       	push   $0x9a20
+     6e2:	ff 75 ec             	push   -0x14(%ebp)
+     6e5:	e8 12 60 00 00       	call   66fc <read>
+     6ea:	83 c4 10             	add    $0x10,%esp
+     6ed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 0){
+     6f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6f4:	75 27                	jne    71d <writetest1+0x145>
+      if(n != NBIGBLOCKS){
+     6f6:	81 7d f0 aa 00 00 00 	cmpl   $0xaa,-0x10(%ebp)
+     6fd:	74 7d                	je     77c <writetest1+0x1a4>
+        printf(stdout, "read only %d blocks from big", n);
+     6ff:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     704:	83 ec 04             	sub    $0x4,%esp
+     707:	ff 75 f0             	push   -0x10(%ebp)
+     70a:	68 b1 6f 00 00       	push   $0x6fb1
+     70f:	50                   	push   %eax
+     710:	e8 ab 61 00 00       	call   68c0 <printf>
+     715:	83 c4 10             	add    $0x10,%esp
+        exit();
+     718:	e8 c7 5f 00 00       	call   66e4 <exit>
+      }
+      break;
+    } else if(i != 512){
+     71d:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     724:	74 1e                	je     744 <writetest1+0x16c>
+      printf(stdout, "read failed %d\n", i);
+     726:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     72b:	83 ec 04             	sub    $0x4,%esp
+     72e:	ff 75 f4             	push   -0xc(%ebp)
+     731:	68 ce 6f 00 00       	push   $0x6fce
+     736:	50                   	push   %eax
+     737:	e8 84 61 00 00       	call   68c0 <printf>
+     73c:	83 c4 10             	add    $0x10,%esp
+      exit();
+     73f:	e8 a0 5f 00 00       	call   66e4 <exit>
+    }
+    if(((int*)buf)[0] != n){
+     744:	b8 20 9a 00 00       	mov    $0x9a20,%eax
+     749:	8b 00                	mov    (%eax),%eax
+     74b:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     74e:	74 23                	je     773 <writetest1+0x19b>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+     750:	b8 20 9a 00 00       	mov    $0x9a20,%eax
+      printf(stdout, "read content of block %d is %d\n",
+     755:	8b 10                	mov    (%eax),%edx
+     757:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     75c:	52                   	push   %edx
+     75d:	ff 75 f0             	push   -0x10(%ebp)
+     760:	68 e0 6f 00 00       	push   $0x6fe0
+     765:	50                   	push   %eax
+     766:	e8 55 61 00 00       	call   68c0 <printf>
+     76b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     76e:	e8 71 5f 00 00       	call   66e4 <exit>
+    }
+    n++;
+     773:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    i = read(fd, buf, 512);
+     777:	e9 59 ff ff ff       	jmp    6d5 <writetest1+0xfd>
+      break;
+     77c:	90                   	nop
+  }
+  close(fd);
+     77d:	83 ec 0c             	sub    $0xc,%esp
+     780:	ff 75 ec             	push   -0x14(%ebp)
+     783:	e8 84 5f 00 00       	call   670c <close>
+     788:	83 c4 10             	add    $0x10,%esp
+  if(unlink("big") < 0){
+     78b:	83 ec 0c             	sub    $0xc,%esp
+     78e:	68 5c 6f 00 00       	push   $0x6f5c
+     793:	e8 9c 5f 00 00       	call   6734 <unlink>
+     798:	83 c4 10             	add    $0x10,%esp
+     79b:	85 c0                	test   %eax,%eax
+     79d:	79 1b                	jns    7ba <writetest1+0x1e2>
+    printf(stdout, "unlink big failed\n");
+     79f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     7a4:	83 ec 08             	sub    $0x8,%esp
+     7a7:	68 00 70 00 00       	push   $0x7000
+     7ac:	50                   	push   %eax
+     7ad:	e8 0e 61 00 00       	call   68c0 <printf>
+     7b2:	83 c4 10             	add    $0x10,%esp
+    exit();
+     7b5:	e8 2a 5f 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "big files ok\n");
+     7ba:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     7bf:	83 ec 08             	sub    $0x8,%esp
+     7c2:	68 13 70 00 00       	push   $0x7013
+     7c7:	50                   	push   %eax
+     7c8:	e8 f3 60 00 00       	call   68c0 <printf>
+     7cd:	83 c4 10             	add    $0x10,%esp
+}
+     7d0:	90                   	nop
+     7d1:	c9                   	leave
+     7d2:	c3                   	ret
+
+000007d3 <tindirtest>:
+
+// A file big enough to need its triple-indirect block should
+// read back, and give all its blocks back when removed.
+void
+tindirtest(void)
+{
+     7d3:	55                   	push   %ebp
+     7d4:	89 e5                	mov    %esp,%ebp
+     7d6:	83 ec 48             	sub    $0x48,%esp
+  struct statfs st0, st1;
+  int i, fd, n, nind, nblocks;
+
+  printf(stdout, "triple-indirect test\n");
+     7d9:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     7de:	83 ec 08             	sub    $0x8,%esp
+     7e1:	68 21 70 00 00       	push   $0x7021
+     7e6:	50                   	push   %eax
+     7e7:	e8 d4 60 00 00       	call   68c0 <printf>
+     7ec:	83 c4 10             	add    $0x10,%esp
+  fd = open("tindir", O_CREATE|O_RDWR);
+     7ef:	83 ec 08             	sub    $0x8,%esp
+     7f2:	68 02 02 00 00       	push   $0x202
+     7f7:	68 37 70 00 00       	push   $0x7037
+     7fc:	e8 23 5f 00 00       	call   6724 <open>
+     801:	83 c4 10             	add    $0x10,%esp
+     804:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  sync();
+     807:	e8 d0 5f 00 00       	call   67dc <sync>
+  if(fd < 0 || statfs("/", &st0) < 0){
+     80c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     810:	78 18                	js     82a <tindirtest+0x57>
+     812:	83 ec 08             	sub    $0x8,%esp
+     815:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     818:	50                   	push   %eax
+     819:	68 ea 6c 00 00       	push   $0x6cea
+     81e:	e8 a1 5f 00 00       	call   67c4 <statfs>
+     823:	83 c4 10             	add    $0x10,%esp
+     826:	85 c0                	test   %eax,%eax
+     828:	79 1b                	jns    845 <tindirtest+0x72>
+    printf(stdout, "error: creat tindir failed!\n");
+     82a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     82f:	83 ec 08             	sub    $0x8,%esp
+     832:	68 3e 70 00 00       	push   $0x703e
+     837:	50                   	push   %eax
+     838:	e8 83 60 00 00       	call   68c0 <printf>
+     83d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     840:	e8 9f 5e 00 00       	call   66e4 <exit>
+  }
+  // Fill the direct, indirect and double-indirect blocks and
+  // two indirect blocks under the triple-indirect one.
+  nind = st0.bsize / sizeof(uint);
+     845:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     848:	c1 e8 02             	shr    $0x2,%eax
+     84b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  nblocks = NDIRECT + nind + nind*nind + nind + 1;
+     84e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     851:	8d 50 0a             	lea    0xa(%eax),%edx
+     854:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     857:	0f af c0             	imul   %eax,%eax
+     85a:	01 c2                	add    %eax,%edx
+     85c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     85f:	01 d0                	add    %edx,%eax
+     861:	83 c0 01             	add    $0x1,%eax
+     864:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(nblocks + nind + 6 > st0.bfree){
+     867:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     86a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     86d:	01 d0                	add    %edx,%eax
+     86f:	83 c0 06             	add    $0x6,%eax
+     872:	89 c2                	mov    %eax,%edx
+     874:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     877:	39 d0                	cmp    %edx,%eax
+     879:	73 39                	jae    8b4 <tindirtest+0xe1>
+    printf(stdout, "triple-indirect test skipped: file system too small\n");
+     87b:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     880:	83 ec 08             	sub    $0x8,%esp
+     883:	68 5c 70 00 00       	push   $0x705c
+     888:	50                   	push   %eax
+     889:	e8 32 60 00 00       	call   68c0 <printf>
+     88e:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     891:	83 ec 0c             	sub    $0xc,%esp
+     894:	ff 75 f0             	push   -0x10(%ebp)
+     897:	e8 70 5e 00 00       	call   670c <close>
+     89c:	83 c4 10             	add    $0x10,%esp
+    unlink("tindir");
+     89f:	83 ec 0c             	sub    $0xc,%esp
+     8a2:	68 37 70 00 00       	push   $0x7037
+     8a7:	e8 88 5e 00 00       	call   6734 <unlink>
+     8ac:	83 c4 10             	add    $0x10,%esp
+     8af:	e9 c3 01 00 00       	jmp    a77 <tindirtest+0x2a4>
+    return;
+  }
+
+  for(i = 0; i < nblocks; i++){
+     8b4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     8bb:	eb 4c                	jmp    909 <tindirtest+0x136>
+    ((int*)buf)[0] = i;
+     8bd:	ba 20 9a 00 00       	mov    $0x9a20,%edx
+     8c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8c5:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, st0.bsize) != st0.bsize){
+     8c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     8ca:	83 ec 04             	sub    $0x4,%esp
+     8cd:	50                   	push   %eax
+     8ce:	68 20 9a 00 00       	push   $0x9a20
+     8d3:	ff 75 f0             	push   -0x10(%ebp)
+     8d6:	e8 29 5e 00 00       	call   6704 <write>
+     8db:	83 c4 10             	add    $0x10,%esp
+     8de:	89 c2                	mov    %eax,%edx
+     8e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     8e3:	39 c2                	cmp    %eax,%edx
+     8e5:	74 1e                	je     905 <tindirtest+0x132>
+      printf(stdout, "error: write tindir block %d failed\n", i);
+     8e7:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     8ec:	83 ec 04             	sub    $0x4,%esp
+     8ef:	ff 75 f4             	push   -0xc(%ebp)
+     8f2:	68 94 70 00 00       	push   $0x7094
+     8f7:	50                   	push   %eax
+     8f8:	e8 c3 5f 00 00       	call   68c0 <printf>
+     8fd:	83 c4 10             	add    $0x10,%esp
+      exit();
+     900:	e8 df 5d 00 00       	call   66e4 <exit>
+  for(i = 0; i < nblocks; i++){
+     905:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     909:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     90c:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+     90f:	7c ac                	jl     8bd <tindirtest+0xea>
+    }
+  }
+  close(fd);
+     911:	83 ec 0c             	sub    $0xc,%esp
+     914:	ff 75 f0             	push   -0x10(%ebp)
+     917:	e8 f0 5d 00 00       	call   670c <close>
+     91c:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("tindir", O_RDONLY);
+     91f:	83 ec 08             	sub    $0x8,%esp
+     922:	6a 00                	push   $0x0
+     924:	68 37 70 00 00       	push   $0x7037
+     929:	e8 f6 5d 00 00       	call   6724 <open>
+     92e:	83 c4 10             	add    $0x10,%esp
+     931:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+     934:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     938:	79 1b                	jns    955 <tindirtest+0x182>
+    printf(stdout, "error: open tindir failed!\n");
+     93a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     93f:	83 ec 08             	sub    $0x8,%esp
+     942:	68 b9 70 00 00       	push   $0x70b9
+     947:	50                   	push   %eax
+     948:	e8 73 5f 00 00       	call   68c0 <printf>
+     94d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     950:	e8 8f 5d 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; (n = read(fd, buf, st0.bsize)) == st0.bsize; i++){
+     955:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     95c:	eb 33                	jmp    991 <tindirtest+0x1be>
+    if(((int*)buf)[0] != i){
+     95e:	b8 20 9a 00 00       	mov    $0x9a20,%eax
+     963:	8b 00                	mov    (%eax),%eax
+     965:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     968:	74 23                	je     98d <tindirtest+0x1ba>
+      printf(stdout, "read content of block %d is %d\n", i, ((int*)buf)[0]);
+     96a:	b8 20 9a 00 00       	mov    $0x9a20,%eax
+     96f:	8b 10                	mov    (%eax),%edx
+     971:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     976:	52                   	push   %edx
+     977:	ff 75 f4             	push   -0xc(%ebp)
+     97a:	68 e0 6f 00 00       	push   $0x6fe0
+     97f:	50                   	push   %eax
+     980:	e8 3b 5f 00 00       	call   68c0 <printf>
+     985:	83 c4 10             	add    $0x10,%esp
+      exit();
+     988:	e8 57 5d 00 00       	call   66e4 <exit>
+  for(i = 0; (n = read(fd, buf, st0.bsize)) == st0.bsize; i++){
+     98d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     991:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     994:	83 ec 04             	sub    $0x4,%esp
+     997:	50                   	push   %eax
+     998:	68 20 9a 00 00       	push   $0x9a20
+     99d:	ff 75 f0             	push   -0x10(%ebp)
+     9a0:	e8 57 5d 00 00       	call   66fc <read>
+     9a5:	83 c4 10             	add    $0x10,%esp
+     9a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     9ab:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     9ae:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     9b1:	39 c2                	cmp    %eax,%edx
+     9b3:	74 a9                	je     95e <tindirtest+0x18b>
+    }
+  }
+  close(fd);
+     9b5:	83 ec 0c             	sub    $0xc,%esp
+     9b8:	ff 75 f0             	push   -0x10(%ebp)
+     9bb:	e8 4c 5d 00 00       	call   670c <close>
+     9c0:	83 c4 10             	add    $0x10,%esp
+  if(n != 0 || i != nblocks){
+     9c3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     9c7:	75 08                	jne    9d1 <tindirtest+0x1fe>
+     9c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9cc:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+     9cf:	74 1e                	je     9ef <tindirtest+0x21c>
+    printf(stdout, "read only %d blocks from tindir\n", i);
+     9d1:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     9d6:	83 ec 04             	sub    $0x4,%esp
+     9d9:	ff 75 f4             	push   -0xc(%ebp)
+     9dc:	68 d8 70 00 00       	push   $0x70d8
+     9e1:	50                   	push   %eax
+     9e2:	e8 d9 5e 00 00       	call   68c0 <printf>
+     9e7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9ea:	e8 f5 5c 00 00       	call   66e4 <exit>
+  }
+
+  if(unlink("tindir") < 0){
+     9ef:	83 ec 0c             	sub    $0xc,%esp
+     9f2:	68 37 70 00 00       	push   $0x7037
+     9f7:	e8 38 5d 00 00       	call   6734 <unlink>
+     9fc:	83 c4 10             	add    $0x10,%esp
+     9ff:	85 c0                	test   %eax,%eax
+     a01:	79 1b                	jns    a1e <tindirtest+0x24b>
+    printf(stdout, "unlink tindir failed\n");
+     a03:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     a08:	83 ec 08             	sub    $0x8,%esp
+     a0b:	68 f9 70 00 00       	push   $0x70f9
+     a10:	50                   	push   %eax
+     a11:	e8 aa 5e 00 00       	call   68c0 <printf>
+     a16:	83 c4 10             	add    $0x10,%esp
+    exit();
+     a19:	e8 c6 5c 00 00       	call   66e4 <exit>
+  }
+  sync();
+     a1e:	e8 b9 5d 00 00       	call   67dc <sync>
+  statfs("/", &st1);
+     a23:	83 ec 08             	sub    $0x8,%esp
+     a26:	8d 45 bc             	lea    -0x44(%ebp),%eax
+     a29:	50                   	push   %eax
+     a2a:	68 ea 6c 00 00       	push   $0x6cea
+     a2f:	e8 90 5d 00 00       	call   67c4 <statfs>
+     a34:	83 c4 10             	add    $0x10,%esp
+  if(st1.bfree < st0.bfree){
+     a37:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     a3a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     a3d:	39 c2                	cmp    %eax,%edx
+     a3f:	73 20                	jae    a61 <tindirtest+0x28e>
+    printf(stdout, "tindir blocks not all freed: %d of %d\n",
+     a41:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+     a44:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     a47:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     a4c:	51                   	push   %ecx
+     a4d:	52                   	push   %edx
+     a4e:	68 10 71 00 00       	push   $0x7110
+     a53:	50                   	push   %eax
+     a54:	e8 67 5e 00 00       	call   68c0 <printf>
+     a59:	83 c4 10             	add    $0x10,%esp
+           st1.bfree, st0.bfree);
+    exit();
+     a5c:	e8 83 5c 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "triple-indirect ok\n");
+     a61:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     a66:	83 ec 08             	sub    $0x8,%esp
+     a69:	68 37 71 00 00       	push   $0x7137
+     a6e:	50                   	push   %eax
+     a6f:	e8 4c 5e 00 00       	call   68c0 <printf>
+     a74:	83 c4 10             	add    $0x10,%esp
+}
+     a77:	c9                   	leave
+     a78:	c3                   	ret
+
+00000a79 <fragwritetest>:
+#define FRAGRUN 40  // blocks between the free ones
+#define FRAGBIG (128*1024)
+
+void
+fragwritetest(void)
+{
+     a79:	55                   	push   %ebp
+     a7a:	89 e5                	mov    %esp,%ebp
+     a7c:	53                   	push   %ebx
+     a7d:	83 ec 34             	sub    $0x34,%esp
+  struct statfs st;
+  char *p;
+  int i, fda, fdb, fd, nbmap;
+
+  printf(stdout, "fragmented write test\n");
+     a80:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     a85:	83 ec 08             	sub    $0x8,%esp
+     a88:	68 4b 71 00 00       	push   $0x714b
+     a8d:	50                   	push   %eax
+     a8e:	e8 2d 5e 00 00       	call   68c0 <printf>
+     a93:	83 c4 10             	add    $0x10,%esp
+  if(statfs("/", &st) < 0){
+     a96:	83 ec 08             	sub    $0x8,%esp
+     a99:	8d 45 cc             	lea    -0x34(%ebp),%eax
+     a9c:	50                   	push   %eax
+     a9d:	68 ea 6c 00 00       	push   $0x6cea
+     aa2:	e8 1d 5d 00 00       	call   67c4 <statfs>
+     aa7:	83 c4 10             	add    $0x10,%esp
+     aaa:	85 c0                	test   %eax,%eax
+     aac:	79 1b                	jns    ac9 <fragwritetest+0x50>
+    printf(stdout, "statfs failed\n");
+     aae:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     ab3:	83 ec 08             	sub    $0x8,%esp
+     ab6:	68 62 71 00 00       	push   $0x7162
+     abb:	50                   	push   %eax
+     abc:	e8 ff 5d 00 00       	call   68c0 <printf>
+     ac1:	83 c4 10             	add    $0x10,%esp
+    exit();
+     ac4:	e8 1b 5c 00 00       	call   66e4 <exit>
+  }
+  nbmap = st.blocks / (st.bsize*8);
+     ac9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     acc:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     acf:	8d 1c d5 00 00 00 00 	lea    0x0(,%edx,8),%ebx
+     ad6:	ba 00 00 00 00       	mov    $0x0,%edx
+     adb:	f7 f3                	div    %ebx
+     add:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(st.bsize != 512 || nbmap < 3 || st.bfree < nbmap*st.bsize*8/2){
+     ae0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     ae3:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ae8:	75 1b                	jne    b05 <fragwritetest+0x8c>
+     aea:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+     aee:	7e 15                	jle    b05 <fragwritetest+0x8c>
+     af0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     af3:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     af6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     af9:	0f af c2             	imul   %edx,%eax
+     afc:	c1 e0 03             	shl    $0x3,%eax
+     aff:	d1 e8                	shr    %eax
+     b01:	39 c1                	cmp    %eax,%ecx
+     b03:	73 1b                	jae    b20 <fragwritetest+0xa7>
+    printf(stdout, "fragmented write test skipped: needs a large 512-byte-block file system\n");
+     b05:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     b0a:	83 ec 08             	sub    $0x8,%esp
+     b0d:	68 74 71 00 00       	push   $0x7174
+     b12:	50                   	push   %eax
+     b13:	e8 a8 5d 00 00       	call   68c0 <printf>
+     b18:	83 c4 10             	add    $0x10,%esp
+     b1b:	e9 33 03 00 00       	jmp    e53 <fragwritetest+0x3da>
+    return;
+  }
+  p = malloc(FRAGBIG);
+     b20:	83 ec 0c             	sub    $0xc,%esp
+     b23:	68 00 00 02 00       	push   $0x20000
+     b28:	e8 67 60 00 00       	call   6b94 <malloc>
+     b2d:	83 c4 10             	add    $0x10,%esp
+     b30:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  fda = open("fraga", O_CREATE|O_RDWR);
+     b33:	83 ec 08             	sub    $0x8,%esp
+     b36:	68 02 02 00 00       	push   $0x202
+     b3b:	68 bd 71 00 00       	push   $0x71bd
+     b40:	e8 df 5b 00 00       	call   6724 <open>
+     b45:	83 c4 10             	add    $0x10,%esp
+     b48:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  fdb = open("fragb", O_CREATE|O_RDWR);
+     b4b:	83 ec 08             	sub    $0x8,%esp
+     b4e:	68 02 02 00 00       	push   $0x202
+     b53:	68 c3 71 00 00       	push   $0x71c3
+     b58:	e8 c7 5b 00 00       	call   6724 <open>
+     b5d:	83 c4 10             	add    $0x10,%esp
+     b60:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(p == 0 || fda < 0 || fdb < 0){
+     b63:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b67:	74 0c                	je     b75 <fragwritetest+0xfc>
+     b69:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     b6d:	78 06                	js     b75 <fragwritetest+0xfc>
+     b6f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     b73:	79 1b                	jns    b90 <fragwritetest+0x117>
+    printf(stdout, "fragwrite: setup failed\n");
+     b75:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     b7a:	83 ec 08             	sub    $0x8,%esp
+     b7d:	68 c9 71 00 00       	push   $0x71c9
+     b82:	50                   	push   %eax
+     b83:	e8 38 5d 00 00       	call   68c0 <printf>
+     b88:	83 c4 10             	add    $0x10,%esp
+    exit();
+     b8b:	e8 54 5b 00 00       	call   66e4 <exit>
+  }
+  memset(p, 'f', FRAGBIG);
+     b90:	83 ec 04             	sub    $0x4,%esp
+     b93:	68 00 00 02 00       	push   $0x20000
+     b98:	6a 66                	push   $0x66
+     b9a:	ff 75 ec             	push   -0x14(%ebp)
+     b9d:	e8 a7 59 00 00       	call   6549 <memset>
+     ba2:	83 c4 10             	add    $0x10,%esp
+  // fraga and fragb allocate after their last blocks, so they
+  // take turns: one block of fraga, then FRAGRUN of fragb.
+  while(statfs("/", &st) == 0 && st.bfree > 4*FRAGRUN){
+     ba5:	eb 55                	jmp    bfc <fragwritetest+0x183>
+    if(write(fda, p, 512) != 512 ||
+     ba7:	83 ec 04             	sub    $0x4,%esp
+     baa:	68 00 02 00 00       	push   $0x200
+     baf:	ff 75 ec             	push   -0x14(%ebp)
+     bb2:	ff 75 e8             	push   -0x18(%ebp)
+     bb5:	e8 4a 5b 00 00       	call   6704 <write>
+     bba:	83 c4 10             	add    $0x10,%esp
+     bbd:	3d 00 02 00 00       	cmp    $0x200,%eax
+     bc2:	75 1d                	jne    be1 <fragwritetest+0x168>
+       write(fdb, p, FRAGRUN*512) != FRAGRUN*512){
+     bc4:	83 ec 04             	sub    $0x4,%esp
+     bc7:	68 00 50 00 00       	push   $0x5000
+     bcc:	ff 75 ec             	push   -0x14(%ebp)
+     bcf:	ff 75 e4             	push   -0x1c(%ebp)
+     bd2:	e8 2d 5b 00 00       	call   6704 <write>
+     bd7:	83 c4 10             	add    $0x10,%esp
+    if(write(fda, p, 512) != 512 ||
+     bda:	3d 00 50 00 00       	cmp    $0x5000,%eax
+     bdf:	74 1b                	je     bfc <fragwritetest+0x183>
+      printf(stdout, "fragwrite: fill failed\n");
+     be1:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     be6:	83 ec 08             	sub    $0x8,%esp
+     be9:	68 e2 71 00 00       	push   $0x71e2
+     bee:	50                   	push   %eax
+     bef:	e8 cc 5c 00 00       	call   68c0 <printf>
+     bf4:	83 c4 10             	add    $0x10,%esp
+      exit();
+     bf7:	e8 e8 5a 00 00       	call   66e4 <exit>
+  while(statfs("/", &st) == 0 && st.bfree > 4*FRAGRUN){
+     bfc:	83 ec 08             	sub    $0x8,%esp
+     bff:	8d 45 cc             	lea    -0x34(%ebp),%eax
+     c02:	50                   	push   %eax
+     c03:	68 ea 6c 00 00       	push   $0x6cea
+     c08:	e8 b7 5b 00 00       	call   67c4 <statfs>
+     c0d:	83 c4 10             	add    $0x10,%esp
+     c10:	85 c0                	test   %eax,%eax
+     c12:	75 0a                	jne    c1e <fragwritetest+0x1a5>
+     c14:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     c17:	3d a0 00 00 00       	cmp    $0xa0,%eax
+     c1c:	77 89                	ja     ba7 <fragwritetest+0x12e>
+    }
+  }
+  close(fda);
+     c1e:	83 ec 0c             	sub    $0xc,%esp
+     c21:	ff 75 e8             	push   -0x18(%ebp)
+     c24:	e8 e3 5a 00 00       	call   670c <close>
+     c29:	83 c4 10             	add    $0x10,%esp
+  close(fdb);
+     c2c:	83 ec 0c             	sub    $0xc,%esp
+     c2f:	ff 75 e4             	push   -0x1c(%ebp)
+     c32:	e8 d5 5a 00 00       	call   670c <close>
+     c37:	83 c4 10             	add    $0x10,%esp
+  unlink("fraga");
+     c3a:	83 ec 0c             	sub    $0xc,%esp
+     c3d:	68 bd 71 00 00       	push   $0x71bd
+     c42:	e8 ed 5a 00 00       	call   6734 <unlink>
+     c47:	83 c4 10             	add    $0x10,%esp
+  sync();
+     c4a:	e8 8d 5b 00 00       	call   67dc <sync>
+  statfs("/", &st);
+     c4f:	83 ec 08             	sub    $0x8,%esp
+     c52:	8d 45 cc             	lea    -0x34(%ebp),%eax
+     c55:	50                   	push   %eax
+     c56:	68 ea 6c 00 00       	push   $0x6cea
+     c5b:	e8 64 5b 00 00       	call   67c4 <statfs>
+     c60:	83 c4 10             	add    $0x10,%esp
+  if(st.bfree < FRAGBIG/512 + 4*FRAGRUN){
+     c63:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     c66:	3d 9f 01 00 00       	cmp    $0x19f,%eax
+     c6b:	77 1f                	ja     c8c <fragwritetest+0x213>
+    printf(stdout, "fragwrite: only %d blocks free\n", st.bfree);
+     c6d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     c70:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     c75:	83 ec 04             	sub    $0x4,%esp
+     c78:	52                   	push   %edx
+     c79:	68 fc 71 00 00       	push   $0x71fc
+     c7e:	50                   	push   %eax
+     c7f:	e8 3c 5c 00 00       	call   68c0 <printf>
+     c84:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c87:	e8 58 5a 00 00       	call   66e4 <exit>
+  }
+
+  fd = open("fragc", O_CREATE|O_RDWR);
+     c8c:	83 ec 08             	sub    $0x8,%esp
+     c8f:	68 02 02 00 00       	push   $0x202
+     c94:	68 1c 72 00 00       	push   $0x721c
+     c99:	e8 86 5a 00 00       	call   6724 <open>
+     c9e:	83 c4 10             	add    $0x10,%esp
+     ca1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < FRAGBIG; i++)
+     ca4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     cab:	eb 31                	jmp    cde <fragwritetest+0x265>
+    p[i] = i % 251;
+     cad:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     cb0:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+     cb5:	89 c8                	mov    %ecx,%eax
+     cb7:	f7 ea                	imul   %edx
+     cb9:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+     cbc:	c1 f8 07             	sar    $0x7,%eax
+     cbf:	89 ca                	mov    %ecx,%edx
+     cc1:	c1 fa 1f             	sar    $0x1f,%edx
+     cc4:	29 d0                	sub    %edx,%eax
+     cc6:	69 d0 fb 00 00 00    	imul   $0xfb,%eax,%edx
+     ccc:	89 c8                	mov    %ecx,%eax
+     cce:	29 d0                	sub    %edx,%eax
+     cd0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     cd3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     cd6:	01 ca                	add    %ecx,%edx
+     cd8:	88 02                	mov    %al,(%edx)
+  for(i = 0; i < FRAGBIG; i++)
+     cda:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     cde:	81 7d f4 ff ff 01 00 	cmpl   $0x1ffff,-0xc(%ebp)
+     ce5:	7e c6                	jle    cad <fragwritetest+0x234>
+  if(fd < 0 || write(fd, p, FRAGBIG) != FRAGBIG){
+     ce7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     ceb:	78 1d                	js     d0a <fragwritetest+0x291>
+     ced:	83 ec 04             	sub    $0x4,%esp
+     cf0:	68 00 00 02 00       	push   $0x20000
+     cf5:	ff 75 ec             	push   -0x14(%ebp)
+     cf8:	ff 75 e0             	push   -0x20(%ebp)
+     cfb:	e8 04 5a 00 00       	call   6704 <write>
+     d00:	83 c4 10             	add    $0x10,%esp
+     d03:	3d 00 00 02 00       	cmp    $0x20000,%eax
+     d08:	74 1b                	je     d25 <fragwritetest+0x2ac>
+    printf(stdout, "fragwrite: large write failed\n");
+     d0a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     d0f:	83 ec 08             	sub    $0x8,%esp
+     d12:	68 24 72 00 00       	push   $0x7224
+     d17:	50                   	push   %eax
+     d18:	e8 a3 5b 00 00       	call   68c0 <printf>
+     d1d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d20:	e8 bf 59 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+     d25:	83 ec 0c             	sub    $0xc,%esp
+     d28:	ff 75 e0             	push   -0x20(%ebp)
+     d2b:	e8 dc 59 00 00       	call   670c <close>
+     d30:	83 c4 10             	add    $0x10,%esp
+  memset(p, 0, FRAGBIG);
+     d33:	83 ec 04             	sub    $0x4,%esp
+     d36:	68 00 00 02 00       	push   $0x20000
+     d3b:	6a 00                	push   $0x0
+     d3d:	ff 75 ec             	push   -0x14(%ebp)
+     d40:	e8 04 58 00 00       	call   6549 <memset>
+     d45:	83 c4 10             	add    $0x10,%esp
+  fd = open("fragc", O_RDONLY);
+     d48:	83 ec 08             	sub    $0x8,%esp
+     d4b:	6a 00                	push   $0x0
+     d4d:	68 1c 72 00 00       	push   $0x721c
+     d52:	e8 cd 59 00 00       	call   6724 <open>
+     d57:	83 c4 10             	add    $0x10,%esp
+     d5a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(fd < 0 || read(fd, p, FRAGBIG) != FRAGBIG){
+     d5d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     d61:	78 1d                	js     d80 <fragwritetest+0x307>
+     d63:	83 ec 04             	sub    $0x4,%esp
+     d66:	68 00 00 02 00       	push   $0x20000
+     d6b:	ff 75 ec             	push   -0x14(%ebp)
+     d6e:	ff 75 e0             	push   -0x20(%ebp)
+     d71:	e8 86 59 00 00       	call   66fc <read>
+     d76:	83 c4 10             	add    $0x10,%esp
+     d79:	3d 00 00 02 00       	cmp    $0x20000,%eax
+     d7e:	74 1b                	je     d9b <fragwritetest+0x322>
+    printf(stdout, "fragwrite: read failed\n");
+     d80:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     d85:	83 ec 08             	sub    $0x8,%esp
+     d88:	68 43 72 00 00       	push   $0x7243
+     d8d:	50                   	push   %eax
+     d8e:	e8 2d 5b 00 00       	call   68c0 <printf>
+     d93:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d96:	e8 49 59 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+     d9b:	83 ec 0c             	sub    $0xc,%esp
+     d9e:	ff 75 e0             	push   -0x20(%ebp)
+     da1:	e8 66 59 00 00       	call   670c <close>
+     da6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < FRAGBIG; i++){
+     da9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     db0:	eb 54                	jmp    e06 <fragwritetest+0x38d>
+    if(p[i] != (char)(i % 251)){
+     db2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     db5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     db8:	01 d0                	add    %edx,%eax
+     dba:	0f b6 18             	movzbl (%eax),%ebx
+     dbd:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     dc0:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+     dc5:	89 c8                	mov    %ecx,%eax
+     dc7:	f7 ea                	imul   %edx
+     dc9:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+     dcc:	c1 f8 07             	sar    $0x7,%eax
+     dcf:	89 ca                	mov    %ecx,%edx
+     dd1:	c1 fa 1f             	sar    $0x1f,%edx
+     dd4:	29 d0                	sub    %edx,%eax
+     dd6:	69 d0 fb 00 00 00    	imul   $0xfb,%eax,%edx
+     ddc:	89 c8                	mov    %ecx,%eax
+     dde:	29 d0                	sub    %edx,%eax
+     de0:	38 c3                	cmp    %al,%bl
+     de2:	74 1e                	je     e02 <fragwritetest+0x389>
+      printf(stdout, "fragwrite: wrong data at %d\n", i);
+     de4:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     de9:	83 ec 04             	sub    $0x4,%esp
+     dec:	ff 75 f4             	push   -0xc(%ebp)
+     def:	68 5b 72 00 00       	push   $0x725b
+     df4:	50                   	push   %eax
+     df5:	e8 c6 5a 00 00       	call   68c0 <printf>
+     dfa:	83 c4 10             	add    $0x10,%esp
+      exit();
+     dfd:	e8 e2 58 00 00       	call   66e4 <exit>
+  for(i = 0; i < FRAGBIG; i++){
+     e02:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     e06:	81 7d f4 ff ff 01 00 	cmpl   $0x1ffff,-0xc(%ebp)
+     e0d:	7e a3                	jle    db2 <fragwritetest+0x339>
+    }
+  }
+  free(p);
+     e0f:	83 ec 0c             	sub    $0xc,%esp
+     e12:	ff 75 ec             	push   -0x14(%ebp)
+     e15:	e8 38 5c 00 00       	call   6a52 <free>
+     e1a:	83 c4 10             	add    $0x10,%esp
+  unlink("fragb");
+     e1d:	83 ec 0c             	sub    $0xc,%esp
+     e20:	68 c3 71 00 00       	push   $0x71c3
+     e25:	e8 0a 59 00 00       	call   6734 <unlink>
+     e2a:	83 c4 10             	add    $0x10,%esp
+  unlink("fragc");
+     e2d:	83 ec 0c             	sub    $0xc,%esp
+     e30:	68 1c 72 00 00       	push   $0x721c
+     e35:	e8 fa 58 00 00       	call   6734 <unlink>
+     e3a:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "fragmented write ok\n");
+     e3d:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     e42:	83 ec 08             	sub    $0x8,%esp
+     e45:	68 78 72 00 00       	push   $0x7278
+     e4a:	50                   	push   %eax
+     e4b:	e8 70 5a 00 00       	call   68c0 <printf>
+     e50:	83 c4 10             	add    $0x10,%esp
+}
+     e53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e56:	c9                   	leave
+     e57:	c3                   	ret
+
+00000e58 <statfstest>:
+
+// statfs() should see blocks and an inode go and come back.
+void
+statfstest(void)
+{
+     e58:	55                   	push   %ebp
+     e59:	89 e5                	mov    %esp,%ebp
+     e5b:	83 ec 58             	sub    $0x58,%esp
+  struct statfs st0, st1, st2;
+  int fd, i;
+
+  printf(stdout, "statfs test\n");
+     e5e:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     e63:	83 ec 08             	sub    $0x8,%esp
+     e66:	68 8d 72 00 00       	push   $0x728d
+     e6b:	50                   	push   %eax
+     e6c:	e8 4f 5a 00 00       	call   68c0 <printf>
+     e71:	83 c4 10             	add    $0x10,%esp
+  if(statfs("/", &st0) < 0 || st0.bsize < 512 || st0.bfree > st0.blocks){
+     e74:	83 ec 08             	sub    $0x8,%esp
+     e77:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     e7a:	50                   	push   %eax
+     e7b:	68 ea 6c 00 00       	push   $0x6cea
+     e80:	e8 3f 59 00 00       	call   67c4 <statfs>
+     e85:	83 c4 10             	add    $0x10,%esp
+     e88:	85 c0                	test   %eax,%eax
+     e8a:	78 14                	js     ea0 <statfstest+0x48>
+     e8c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     e8f:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+     e94:	76 0a                	jbe    ea0 <statfstest+0x48>
+     e96:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e99:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     e9c:	39 c2                	cmp    %eax,%edx
+     e9e:	73 1b                	jae    ebb <statfstest+0x63>
+    printf(stdout, "statfs failed\n");
+     ea0:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     ea5:	83 ec 08             	sub    $0x8,%esp
+     ea8:	68 62 71 00 00       	push   $0x7162
+     ead:	50                   	push   %eax
+     eae:	e8 0d 5a 00 00       	call   68c0 <printf>
+     eb3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     eb6:	e8 29 58 00 00       	call   66e4 <exit>
+  }
+  fd = open("statfs", O_CREATE|O_RDWR);
+     ebb:	83 ec 08             	sub    $0x8,%esp
+     ebe:	68 02 02 00 00       	push   $0x202
+     ec3:	68 9a 72 00 00       	push   $0x729a
+     ec8:	e8 57 58 00 00       	call   6724 <open>
+     ecd:	83 c4 10             	add    $0x10,%esp
+     ed0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 10; i++)
+     ed3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     eda:	eb 1b                	jmp    ef7 <statfstest+0x9f>
+    write(fd, buf, st0.bsize);
+     edc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     edf:	83 ec 04             	sub    $0x4,%esp
+     ee2:	50                   	push   %eax
+     ee3:	68 20 9a 00 00       	push   $0x9a20
+     ee8:	ff 75 f0             	push   -0x10(%ebp)
+     eeb:	e8 14 58 00 00       	call   6704 <write>
+     ef0:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 10; i++)
+     ef3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     ef7:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     efb:	7e df                	jle    edc <statfstest+0x84>
+  close(fd);
+     efd:	83 ec 0c             	sub    $0xc,%esp
+     f00:	ff 75 f0             	push   -0x10(%ebp)
+     f03:	e8 04 58 00 00       	call   670c <close>
+     f08:	83 c4 10             	add    $0x10,%esp
+  statfs("/", &st1);
+     f0b:	83 ec 08             	sub    $0x8,%esp
+     f0e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     f11:	50                   	push   %eax
+     f12:	68 ea 6c 00 00       	push   $0x6cea
+     f17:	e8 a8 58 00 00       	call   67c4 <statfs>
+     f1c:	83 c4 10             	add    $0x10,%esp
+  unlink("statfs");
+     f1f:	83 ec 0c             	sub    $0xc,%esp
+     f22:	68 9a 72 00 00       	push   $0x729a
+     f27:	e8 08 58 00 00       	call   6734 <unlink>
+     f2c:	83 c4 10             	add    $0x10,%esp
+  sync();  // freed blocks are only free once the unlink commits
+     f2f:	e8 a8 58 00 00       	call   67dc <sync>
+  statfs("/", &st2);
+     f34:	83 ec 08             	sub    $0x8,%esp
+     f37:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+     f3a:	50                   	push   %eax
+     f3b:	68 ea 6c 00 00       	push   $0x6cea
+     f40:	e8 7f 58 00 00       	call   67c4 <statfs>
+     f45:	83 c4 10             	add    $0x10,%esp
+  if(st1.bfree > st0.bfree - 10 || st1.ffree != st0.ffree - 1 ||
+     f48:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f4b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     f4e:	83 ea 0a             	sub    $0xa,%edx
+     f51:	39 c2                	cmp    %eax,%edx
+     f53:	72 24                	jb     f79 <statfstest+0x121>
+     f55:	8b 55 d8             	mov    -0x28(%ebp),%edx
+     f58:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f5b:	83 e8 01             	sub    $0x1,%eax
+     f5e:	39 c2                	cmp    %eax,%edx
+     f60:	75 17                	jne    f79 <statfstest+0x121>
+     st2.bfree < st1.bfree + 10 || st2.ffree != st0.ffree){
+     f62:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     f65:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f68:	83 c0 0a             	add    $0xa,%eax
+  if(st1.bfree > st0.bfree - 10 || st1.ffree != st0.ffree - 1 ||
+     f6b:	39 c2                	cmp    %eax,%edx
+     f6d:	72 0a                	jb     f79 <statfstest+0x121>
+     st2.bfree < st1.bfree + 10 || st2.ffree != st0.ffree){
+     f6f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     f72:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f75:	39 c2                	cmp    %eax,%edx
+     f77:	74 1b                	je     f94 <statfstest+0x13c>
+    printf(stdout, "statfs counts wrong\n");
+     f79:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     f7e:	83 ec 08             	sub    $0x8,%esp
+     f81:	68 a1 72 00 00       	push   $0x72a1
+     f86:	50                   	push   %eax
+     f87:	e8 34 59 00 00       	call   68c0 <printf>
+     f8c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     f8f:	e8 50 57 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "statfs ok\n");
+     f94:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     f99:	83 ec 08             	sub    $0x8,%esp
+     f9c:	68 b6 72 00 00       	push   $0x72b6
+     fa1:	50                   	push   %eax
+     fa2:	e8 19 59 00 00       	call   68c0 <printf>
+     fa7:	83 c4 10             	add    $0x10,%esp
+}
+     faa:	90                   	nop
+     fab:	c9                   	leave
+     fac:	c3                   	ret
+
+00000fad <bcachetest>:
+
+// Files should read back the same through a buffer cache
+// shrunk as far as it goes, and the cache should grow back.
+void
+bcachetest(void)
+{
+     fad:	55                   	push   %ebp
+     fae:	89 e5                	mov    %esp,%ebp
+     fb0:	83 ec 28             	sub    $0x28,%esp
+  int n0, n1, fd, i, j;
+
+  printf(stdout, "bcache test\n");
+     fb3:	a1 04 9a 00 00       	mov    0x9a04,%eax
+     fb8:	83 ec 08             	sub    $0x8,%esp
+     fbb:	68 c1 72 00 00       	push   $0x72c1
+     fc0:	50                   	push   %eax
+     fc1:	e8 fa 58 00 00       	call   68c0 <printf>
+     fc6:	83 c4 10             	add    $0x10,%esp
+  n0 = bcachesize(0);
+     fc9:	83 ec 0c             	sub    $0xc,%esp
+     fcc:	6a 00                	push   $0x0
+     fce:	e8 f9 57 00 00       	call   67cc <bcachesize>
+     fd3:	83 c4 10             	add    $0x10,%esp
+     fd6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n1 = bcachesize(1);
+     fd9:	83 ec 0c             	sub    $0xc,%esp
+     fdc:	6a 01                	push   $0x1
+     fde:	e8 e9 57 00 00       	call   67cc <bcachesize>
+     fe3:	83 c4 10             	add    $0x10,%esp
+     fe6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(n0 <= 0 || n1 <= 0 || n1 > n0){
+     fe9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fed:	7e 0e                	jle    ffd <bcachetest+0x50>
+     fef:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     ff3:	7e 08                	jle    ffd <bcachetest+0x50>
+     ff5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ff8:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     ffb:	7e 1e                	jle    101b <bcachetest+0x6e>
+    printf(stdout, "bcachesize failed %d %d\n", n0, n1);
+     ffd:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1002:	ff 75 e8             	push   -0x18(%ebp)
+    1005:	ff 75 ec             	push   -0x14(%ebp)
+    1008:	68 ce 72 00 00       	push   $0x72ce
+    100d:	50                   	push   %eax
+    100e:	e8 ad 58 00 00       	call   68c0 <printf>
+    1013:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1016:	e8 c9 56 00 00       	call   66e4 <exit>
+  }
+  fd = open("bcache", O_CREATE|O_RDWR);
+    101b:	83 ec 08             	sub    $0x8,%esp
+    101e:	68 02 02 00 00       	push   $0x202
+    1023:	68 e7 72 00 00       	push   $0x72e7
+    1028:	e8 f7 56 00 00       	call   6724 <open>
+    102d:	83 c4 10             	add    $0x10,%esp
+    1030:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < 2*n1; i++){
+    1033:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    103a:	eb 56                	jmp    1092 <bcachetest+0xe5>
+    memset(buf, i, 512);
+    103c:	83 ec 04             	sub    $0x4,%esp
+    103f:	68 00 02 00 00       	push   $0x200
+    1044:	ff 75 f4             	push   -0xc(%ebp)
+    1047:	68 20 9a 00 00       	push   $0x9a20
+    104c:	e8 f8 54 00 00       	call   6549 <memset>
+    1051:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 512) != 512){
+    1054:	83 ec 04             	sub    $0x4,%esp
+    1057:	68 00 02 00 00       	push   $0x200
+    105c:	68 20 9a 00 00       	push   $0x9a20
+    1061:	ff 75 e4             	push   -0x1c(%ebp)
+    1064:	e8 9b 56 00 00       	call   6704 <write>
+    1069:	83 c4 10             	add    $0x10,%esp
+    106c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1071:	74 1b                	je     108e <bcachetest+0xe1>
+      printf(stdout, "bcache write failed\n");
+    1073:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1078:	83 ec 08             	sub    $0x8,%esp
+    107b:	68 ee 72 00 00       	push   $0x72ee
+    1080:	50                   	push   %eax
+    1081:	e8 3a 58 00 00       	call   68c0 <printf>
+    1086:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1089:	e8 56 56 00 00       	call   66e4 <exit>
+  for(i = 0; i < 2*n1; i++){
+    108e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1092:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1095:	01 c0                	add    %eax,%eax
+    1097:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    109a:	7c a0                	jl     103c <bcachetest+0x8f>
+    }
+  }
+  close(fd);
+    109c:	83 ec 0c             	sub    $0xc,%esp
+    109f:	ff 75 e4             	push   -0x1c(%ebp)
+    10a2:	e8 65 56 00 00       	call   670c <close>
+    10a7:	83 c4 10             	add    $0x10,%esp
+  fd = open("bcache", O_RDONLY);
+    10aa:	83 ec 08             	sub    $0x8,%esp
+    10ad:	6a 00                	push   $0x0
+    10af:	68 e7 72 00 00       	push   $0x72e7
+    10b4:	e8 6b 56 00 00       	call   6724 <open>
+    10b9:	83 c4 10             	add    $0x10,%esp
+    10bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < 2*n1; i++){
+    10bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10c6:	e9 81 00 00 00       	jmp    114c <bcachetest+0x19f>
+    if(read(fd, buf, 512) != 512){
+    10cb:	83 ec 04             	sub    $0x4,%esp
+    10ce:	68 00 02 00 00       	push   $0x200
+    10d3:	68 20 9a 00 00       	push   $0x9a20
+    10d8:	ff 75 e4             	push   -0x1c(%ebp)
+    10db:	e8 1c 56 00 00       	call   66fc <read>
+    10e0:	83 c4 10             	add    $0x10,%esp
+    10e3:	3d 00 02 00 00       	cmp    $0x200,%eax
+    10e8:	74 1b                	je     1105 <bcachetest+0x158>
+      printf(stdout, "bcache read failed\n");
+    10ea:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    10ef:	83 ec 08             	sub    $0x8,%esp
+    10f2:	68 03 73 00 00       	push   $0x7303
+    10f7:	50                   	push   %eax
+    10f8:	e8 c3 57 00 00       	call   68c0 <printf>
+    10fd:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1100:	e8 df 55 00 00       	call   66e4 <exit>
+    }
+    for(j = 0; j < 512; j++)
+    1105:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    110c:	eb 31                	jmp    113f <bcachetest+0x192>
+      if(buf[j] != (char)i){
+    110e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1111:	05 20 9a 00 00       	add    $0x9a20,%eax
+    1116:	0f b6 00             	movzbl (%eax),%eax
+    1119:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    111c:	38 d0                	cmp    %dl,%al
+    111e:	74 1b                	je     113b <bcachetest+0x18e>
+        printf(stdout, "bcache wrong data\n");
+    1120:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1125:	83 ec 08             	sub    $0x8,%esp
+    1128:	68 17 73 00 00       	push   $0x7317
+    112d:	50                   	push   %eax
+    112e:	e8 8d 57 00 00       	call   68c0 <printf>
+    1133:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1136:	e8 a9 55 00 00       	call   66e4 <exit>
+    for(j = 0; j < 512; j++)
+    113b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    113f:	81 7d f0 ff 01 00 00 	cmpl   $0x1ff,-0x10(%ebp)
+    1146:	7e c6                	jle    110e <bcachetest+0x161>
+  for(i = 0; i < 2*n1; i++){
+    1148:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    114c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    114f:	01 c0                	add    %eax,%eax
+    1151:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1154:	0f 8c 71 ff ff ff    	jl     10cb <bcachetest+0x11e>
+      }
+  }
+  close(fd);
+    115a:	83 ec 0c             	sub    $0xc,%esp
+    115d:	ff 75 e4             	push   -0x1c(%ebp)
+    1160:	e8 a7 55 00 00       	call   670c <close>
+    1165:	83 c4 10             	add    $0x10,%esp
+  unlink("bcache");
+    1168:	83 ec 0c             	sub    $0xc,%esp
+    116b:	68 e7 72 00 00       	push   $0x72e7
+    1170:	e8 bf 55 00 00       	call   6734 <unlink>
+    1175:	83 c4 10             	add    $0x10,%esp
+  if(bcachesize(n0) < n0){
+    1178:	83 ec 0c             	sub    $0xc,%esp
+    117b:	ff 75 ec             	push   -0x14(%ebp)
+    117e:	e8 49 56 00 00       	call   67cc <bcachesize>
+    1183:	83 c4 10             	add    $0x10,%esp
+    1186:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1189:	7e 1b                	jle    11a6 <bcachetest+0x1f9>
+    printf(stdout, "bcache did not grow back\n");
+    118b:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1190:	83 ec 08             	sub    $0x8,%esp
+    1193:	68 2a 73 00 00       	push   $0x732a
+    1198:	50                   	push   %eax
+    1199:	e8 22 57 00 00       	call   68c0 <printf>
+    119e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    11a1:	e8 3e 55 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "bcache ok\n");
+    11a6:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    11ab:	83 ec 08             	sub    $0x8,%esp
+    11ae:	68 44 73 00 00       	push   $0x7344
+    11b3:	50                   	push   %eax
+    11b4:	e8 07 57 00 00       	call   68c0 <printf>
+    11b9:	83 c4 10             	add    $0x10,%esp
+}
+    11bc:	90                   	nop
+    11bd:	c9                   	leave
+    11be:	c3                   	ret
+
+000011bf <bcstattest>:
+// of a file larger than the cache evicts from in; a block
+// read again after that goes on am, and later reads of it
+// hit there; and a reset clears the counters.
+void
+bcstattest(void)
+{
+    11bf:	55                   	push   %ebp
+    11c0:	89 e5                	mov    %esp,%ebp
+    11c2:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  struct bcstat st0, st1;
+  int n0, n1, fd, i;
+
+  printf(stdout, "bcstat test\n");
+    11c8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    11cd:	83 ec 08             	sub    $0x8,%esp
+    11d0:	68 4f 73 00 00       	push   $0x734f
+    11d5:	50                   	push   %eax
+    11d6:	e8 e5 56 00 00       	call   68c0 <printf>
+    11db:	83 c4 10             	add    $0x10,%esp
+  n0 = bcachesize(0);
+    11de:	83 ec 0c             	sub    $0xc,%esp
+    11e1:	6a 00                	push   $0x0
+    11e3:	e8 e4 55 00 00       	call   67cc <bcachesize>
+    11e8:	83 c4 10             	add    $0x10,%esp
+    11eb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n1 = bcachesize(1);
+    11ee:	83 ec 0c             	sub    $0xc,%esp
+    11f1:	6a 01                	push   $0x1
+    11f3:	e8 d4 55 00 00       	call   67cc <bcachesize>
+    11f8:	83 c4 10             	add    $0x10,%esp
+    11fb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  fd = open("bcstat", O_CREATE|O_RDWR);
+    11fe:	83 ec 08             	sub    $0x8,%esp
+    1201:	68 02 02 00 00       	push   $0x202
+    1206:	68 5c 73 00 00       	push   $0x735c
+    120b:	e8 14 55 00 00       	call   6724 <open>
+    1210:	83 c4 10             	add    $0x10,%esp
+    1213:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1216:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    121a:	79 1b                	jns    1237 <bcstattest+0x78>
+    printf(stdout, "create bcstat failed\n");
+    121c:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1221:	83 ec 08             	sub    $0x8,%esp
+    1224:	68 63 73 00 00       	push   $0x7363
+    1229:	50                   	push   %eax
+    122a:	e8 91 56 00 00       	call   68c0 <printf>
+    122f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1232:	e8 ad 54 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; i < 2*n1; i++){
+    1237:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    123e:	eb 3e                	jmp    127e <bcstattest+0xbf>
+    if(write(fd, buf, 512) != 512){
+    1240:	83 ec 04             	sub    $0x4,%esp
+    1243:	68 00 02 00 00       	push   $0x200
+    1248:	68 20 9a 00 00       	push   $0x9a20
+    124d:	ff 75 e8             	push   -0x18(%ebp)
+    1250:	e8 af 54 00 00       	call   6704 <write>
+    1255:	83 c4 10             	add    $0x10,%esp
+    1258:	3d 00 02 00 00       	cmp    $0x200,%eax
+    125d:	74 1b                	je     127a <bcstattest+0xbb>
+      printf(stdout, "bcstat write failed\n");
+    125f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1264:	83 ec 08             	sub    $0x8,%esp
+    1267:	68 79 73 00 00       	push   $0x7379
+    126c:	50                   	push   %eax
+    126d:	e8 4e 56 00 00       	call   68c0 <printf>
+    1272:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1275:	e8 6a 54 00 00       	call   66e4 <exit>
+  for(i = 0; i < 2*n1; i++){
+    127a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    127e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1281:	01 c0                	add    %eax,%eax
+    1283:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1286:	7c b8                	jl     1240 <bcstattest+0x81>
+    }
+  }
+  fsync(fd);
+    1288:	83 ec 0c             	sub    $0xc,%esp
+    128b:	ff 75 e8             	push   -0x18(%ebp)
+    128e:	e8 51 55 00 00       	call   67e4 <fsync>
+    1293:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    1296:	83 ec 0c             	sub    $0xc,%esp
+    1299:	ff 75 e8             	push   -0x18(%ebp)
+    129c:	e8 6b 54 00 00       	call   670c <close>
+    12a1:	83 c4 10             	add    $0x10,%esp
+
+  bcstat(&st0, 1);
+    12a4:	83 ec 08             	sub    $0x8,%esp
+    12a7:	6a 01                	push   $0x1
+    12a9:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    12ac:	50                   	push   %eax
+    12ad:	e8 22 55 00 00       	call   67d4 <bcstat>
+    12b2:	83 c4 10             	add    $0x10,%esp
+  fd = open("bcstat", O_RDONLY);
+    12b5:	83 ec 08             	sub    $0x8,%esp
+    12b8:	6a 00                	push   $0x0
+    12ba:	68 5c 73 00 00       	push   $0x735c
+    12bf:	e8 60 54 00 00       	call   6724 <open>
+    12c4:	83 c4 10             	add    $0x10,%esp
+    12c7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; i < 2*n1; i++)
+    12ca:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12d1:	eb 1c                	jmp    12ef <bcstattest+0x130>
+    read(fd, buf, 512);
+    12d3:	83 ec 04             	sub    $0x4,%esp
+    12d6:	68 00 02 00 00       	push   $0x200
+    12db:	68 20 9a 00 00       	push   $0x9a20
+    12e0:	ff 75 e8             	push   -0x18(%ebp)
+    12e3:	e8 14 54 00 00       	call   66fc <read>
+    12e8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2*n1; i++)
+    12eb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    12ef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12f2:	01 c0                	add    %eax,%eax
+    12f4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    12f7:	7c da                	jl     12d3 <bcstattest+0x114>
+  close(fd);
+    12f9:	83 ec 0c             	sub    $0xc,%esp
+    12fc:	ff 75 e8             	push   -0x18(%ebp)
+    12ff:	e8 08 54 00 00       	call   670c <close>
+    1304:	83 c4 10             	add    $0x10,%esp
+  bcstat(&st0, 0);
+    1307:	83 ec 08             	sub    $0x8,%esp
+    130a:	6a 00                	push   $0x0
+    130c:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    130f:	50                   	push   %eax
+    1310:	e8 bf 54 00 00       	call   67d4 <bcstat>
+    1315:	83 c4 10             	add    $0x10,%esp
+  if(st0.evicts[BQ_IN] == 0){
+    1318:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    131b:	85 c0                	test   %eax,%eax
+    131d:	75 1b                	jne    133a <bcstattest+0x17b>
+    printf(stdout, "bcstat: scan evicted nothing from in\n");
+    131f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1324:	83 ec 08             	sub    $0x8,%esp
+    1327:	68 90 73 00 00       	push   $0x7390
+    132c:	50                   	push   %eax
+    132d:	e8 8e 55 00 00       	call   68c0 <printf>
+    1332:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1335:	e8 aa 53 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; i < 2; i++){
+    133a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1341:	eb 56                	jmp    1399 <bcstattest+0x1da>
+    fd = open("bcstat", O_RDONLY);
+    1343:	83 ec 08             	sub    $0x8,%esp
+    1346:	6a 00                	push   $0x0
+    1348:	68 5c 73 00 00       	push   $0x735c
+    134d:	e8 d2 53 00 00       	call   6724 <open>
+    1352:	83 c4 10             	add    $0x10,%esp
+    1355:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    read(fd, buf, 512);
+    1358:	83 ec 04             	sub    $0x4,%esp
+    135b:	68 00 02 00 00       	push   $0x200
+    1360:	68 20 9a 00 00       	push   $0x9a20
+    1365:	ff 75 e8             	push   -0x18(%ebp)
+    1368:	e8 8f 53 00 00       	call   66fc <read>
+    136d:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	ff 75 e8             	push   -0x18(%ebp)
+    1376:	e8 91 53 00 00       	call   670c <close>
+    137b:	83 c4 10             	add    $0x10,%esp
+    if(i == 0)
+    137e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1382:	75 11                	jne    1395 <bcstattest+0x1d6>
+      bcstat(&st0, 0);
+    1384:	83 ec 08             	sub    $0x8,%esp
+    1387:	6a 00                	push   $0x0
+    1389:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    138c:	50                   	push   %eax
+    138d:	e8 42 54 00 00       	call   67d4 <bcstat>
+    1392:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    1395:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1399:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    139d:	7e a4                	jle    1343 <bcstattest+0x184>
+  }
+  bcstat(&st1, 0);
+    139f:	83 ec 08             	sub    $0x8,%esp
+    13a2:	6a 00                	push   $0x0
+    13a4:	8d 45 80             	lea    -0x80(%ebp),%eax
+    13a7:	50                   	push   %eax
+    13a8:	e8 27 54 00 00       	call   67d4 <bcstat>
+    13ad:	83 c4 10             	add    $0x10,%esp
+  if(st0.ghosthits == 0 || st0.misses[BQ_AM] == 0 ||
+    13b0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    13b3:	85 c0                	test   %eax,%eax
+    13b5:	74 11                	je     13c8 <bcstattest+0x209>
+    13b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    13ba:	85 c0                	test   %eax,%eax
+    13bc:	74 0a                	je     13c8 <bcstattest+0x209>
+     st1.hits[BQ_AM] <= st0.hits[BQ_AM]){
+    13be:	8b 45 90             	mov    -0x70(%ebp),%eax
+    13c1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  if(st0.ghosthits == 0 || st0.misses[BQ_AM] == 0 ||
+    13c4:	39 c2                	cmp    %eax,%edx
+    13c6:	72 1b                	jb     13e3 <bcstattest+0x224>
+    printf(stdout, "bcstat: re-read did not go through am\n");
+    13c8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    13cd:	83 ec 08             	sub    $0x8,%esp
+    13d0:	68 b8 73 00 00       	push   $0x73b8
+    13d5:	50                   	push   %eax
+    13d6:	e8 e5 54 00 00       	call   68c0 <printf>
+    13db:	83 c4 10             	add    $0x10,%esp
+    exit();
+    13de:	e8 01 53 00 00       	call   66e4 <exit>
+  }
+
+  bcstat(&st0, 1);
+    13e3:	83 ec 08             	sub    $0x8,%esp
+    13e6:	6a 01                	push   $0x1
+    13e8:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    13eb:	50                   	push   %eax
+    13ec:	e8 e3 53 00 00       	call   67d4 <bcstat>
+    13f1:	83 c4 10             	add    $0x10,%esp
+  bcstat(&st0, 0);
+    13f4:	83 ec 08             	sub    $0x8,%esp
+    13f7:	6a 00                	push   $0x0
+    13f9:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    13fc:	50                   	push   %eax
+    13fd:	e8 d2 53 00 00       	call   67d4 <bcstat>
+    1402:	83 c4 10             	add    $0x10,%esp
+  if(st0.evicts[BQ_IN] != 0 || st0.ghosthits != 0 ||
+    1405:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1408:	85 c0                	test   %eax,%eax
+    140a:	75 0e                	jne    141a <bcstattest+0x25b>
+    140c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    140f:	85 c0                	test   %eax,%eax
+    1411:	75 07                	jne    141a <bcstattest+0x25b>
+     st0.misses[BQ_AM] != 0){
+    1413:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  if(st0.evicts[BQ_IN] != 0 || st0.ghosthits != 0 ||
+    1416:	85 c0                	test   %eax,%eax
+    1418:	74 1b                	je     1435 <bcstattest+0x276>
+    printf(stdout, "bcstat: reset did not clear counters\n");
+    141a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    141f:	83 ec 08             	sub    $0x8,%esp
+    1422:	68 e0 73 00 00       	push   $0x73e0
+    1427:	50                   	push   %eax
+    1428:	e8 93 54 00 00       	call   68c0 <printf>
+    142d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1430:	e8 af 52 00 00       	call   66e4 <exit>
+  }
+  unlink("bcstat");
+    1435:	83 ec 0c             	sub    $0xc,%esp
+    1438:	68 5c 73 00 00       	push   $0x735c
+    143d:	e8 f2 52 00 00       	call   6734 <unlink>
+    1442:	83 c4 10             	add    $0x10,%esp
+  bcachesize(n0);
+    1445:	83 ec 0c             	sub    $0xc,%esp
+    1448:	ff 75 f0             	push   -0x10(%ebp)
+    144b:	e8 7c 53 00 00       	call   67cc <bcachesize>
+    1450:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "bcstat ok\n");
+    1453:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1458:	83 ec 08             	sub    $0x8,%esp
+    145b:	68 06 74 00 00       	push   $0x7406
+    1460:	50                   	push   %eax
+    1461:	e8 5a 54 00 00       	call   68c0 <printf>
+    1466:	83 c4 10             	add    $0x10,%esp
+}
+    1469:	90                   	nop
+    146a:	c9                   	leave
+    146b:	c3                   	ret
+
+0000146c <logopstest>:
+// the log should let more than two file system calls into a
+// transaction at once: writers of one file wait for its lock
+// inside their operations.
+void
+logopstest(void)
+{
+    146c:	55                   	push   %ebp
+    146d:	89 e5                	mov    %esp,%ebp
+    146f:	83 ec 58             	sub    $0x58,%esp
+  struct bcstat st;
+  int fd, i, k, pid;
+
+  printf(stdout, "log ops test\n");
+    1472:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1477:	83 ec 08             	sub    $0x8,%esp
+    147a:	68 11 74 00 00       	push   $0x7411
+    147f:	50                   	push   %eax
+    1480:	e8 3b 54 00 00       	call   68c0 <printf>
+    1485:	83 c4 10             	add    $0x10,%esp
+  if(bcstat(&st, 1) < 0 || st.logsize < 3*MAXOPBLOCKS){
+    1488:	83 ec 08             	sub    $0x8,%esp
+    148b:	6a 01                	push   $0x1
+    148d:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    1490:	50                   	push   %eax
+    1491:	e8 3e 53 00 00       	call   67d4 <bcstat>
+    1496:	83 c4 10             	add    $0x10,%esp
+    1499:	85 c0                	test   %eax,%eax
+    149b:	78 08                	js     14a5 <logopstest+0x39>
+    149d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    14a0:	83 f8 1d             	cmp    $0x1d,%eax
+    14a3:	77 1f                	ja     14c4 <logopstest+0x58>
+    printf(stdout, "log too small for 3 ops: %d\n", st.logsize);
+    14a5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    14a8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    14ad:	83 ec 04             	sub    $0x4,%esp
+    14b0:	52                   	push   %edx
+    14b1:	68 1f 74 00 00       	push   $0x741f
+    14b6:	50                   	push   %eax
+    14b7:	e8 04 54 00 00       	call   68c0 <printf>
+    14bc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    14bf:	e8 20 52 00 00       	call   66e4 <exit>
+  }
+  close(open("logops", O_CREATE|O_RDWR));
+    14c4:	83 ec 08             	sub    $0x8,%esp
+    14c7:	68 02 02 00 00       	push   $0x202
+    14cc:	68 3c 74 00 00       	push   $0x743c
+    14d1:	e8 4e 52 00 00       	call   6724 <open>
+    14d6:	83 c4 10             	add    $0x10,%esp
+    14d9:	83 ec 0c             	sub    $0xc,%esp
+    14dc:	50                   	push   %eax
+    14dd:	e8 2a 52 00 00       	call   670c <close>
+    14e2:	83 c4 10             	add    $0x10,%esp
+  for(k = 0; k < 6; k++){
+    14e5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    14ec:	e9 a9 00 00 00       	jmp    159a <logopstest+0x12e>
+    pid = fork();
+    14f1:	e8 e6 51 00 00       	call   66dc <fork>
+    14f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pid < 0){
+    14f9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    14fd:	79 1b                	jns    151a <logopstest+0xae>
+      printf(stdout, "fork failed\n");
+    14ff:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1504:	83 ec 08             	sub    $0x8,%esp
+    1507:	68 19 6d 00 00       	push   $0x6d19
+    150c:	50                   	push   %eax
+    150d:	e8 ae 53 00 00       	call   68c0 <printf>
+    1512:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1515:	e8 ca 51 00 00       	call   66e4 <exit>
+    }
+    if(pid > 0)
+    151a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    151e:	7f 75                	jg     1595 <logopstest+0x129>
+      continue;
+    fd = open("logops", O_RDWR);
+    1520:	83 ec 08             	sub    $0x8,%esp
+    1523:	6a 02                	push   $0x2
+    1525:	68 3c 74 00 00       	push   $0x743c
+    152a:	e8 f5 51 00 00       	call   6724 <open>
+    152f:	83 c4 10             	add    $0x10,%esp
+    1532:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; i < 20; i++){
+    1535:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    153c:	eb 3e                	jmp    157c <logopstest+0x110>
+      if(write(fd, buf, 4096) != 4096){
+    153e:	83 ec 04             	sub    $0x4,%esp
+    1541:	68 00 10 00 00       	push   $0x1000
+    1546:	68 20 9a 00 00       	push   $0x9a20
+    154b:	ff 75 e8             	push   -0x18(%ebp)
+    154e:	e8 b1 51 00 00       	call   6704 <write>
+    1553:	83 c4 10             	add    $0x10,%esp
+    1556:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    155b:	74 1b                	je     1578 <logopstest+0x10c>
+        printf(stdout, "logops write failed\n");
+    155d:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1562:	83 ec 08             	sub    $0x8,%esp
+    1565:	68 43 74 00 00       	push   $0x7443
+    156a:	50                   	push   %eax
+    156b:	e8 50 53 00 00       	call   68c0 <printf>
+    1570:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1573:	e8 6c 51 00 00       	call   66e4 <exit>
+    for(i = 0; i < 20; i++){
+    1578:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    157c:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1580:	7e bc                	jle    153e <logopstest+0xd2>
+      }
+    }
+    close(fd);
+    1582:	83 ec 0c             	sub    $0xc,%esp
+    1585:	ff 75 e8             	push   -0x18(%ebp)
+    1588:	e8 7f 51 00 00       	call   670c <close>
+    158d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1590:	e8 4f 51 00 00       	call   66e4 <exit>
+      continue;
+    1595:	90                   	nop
+  for(k = 0; k < 6; k++){
+    1596:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    159a:	83 7d f0 05          	cmpl   $0x5,-0x10(%ebp)
+    159e:	0f 8e 4d ff ff ff    	jle    14f1 <logopstest+0x85>
+  }
+  for(k = 0; k < 6; k++)
+    15a4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    15ab:	eb 09                	jmp    15b6 <logopstest+0x14a>
+    wait();
+    15ad:	e8 3a 51 00 00       	call   66ec <wait>
+  for(k = 0; k < 6; k++)
+    15b2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    15b6:	83 7d f0 05          	cmpl   $0x5,-0x10(%ebp)
+    15ba:	7e f1                	jle    15ad <logopstest+0x141>
+  unlink("logops");
+    15bc:	83 ec 0c             	sub    $0xc,%esp
+    15bf:	68 3c 74 00 00       	push   $0x743c
+    15c4:	e8 6b 51 00 00       	call   6734 <unlink>
+    15c9:	83 c4 10             	add    $0x10,%esp
+  bcstat(&st, 0);
+    15cc:	83 ec 08             	sub    $0x8,%esp
+    15cf:	6a 00                	push   $0x0
+    15d1:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    15d4:	50                   	push   %eax
+    15d5:	e8 fa 51 00 00       	call   67d4 <bcstat>
+    15da:	83 c4 10             	add    $0x10,%esp
+  if(st.maxops <= 2){
+    15dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    15e0:	83 f8 02             	cmp    $0x2,%eax
+    15e3:	77 1f                	ja     1604 <logopstest+0x198>
+    printf(stdout, "only %d ops in a transaction at once\n", st.maxops);
+    15e5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    15e8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    15ed:	83 ec 04             	sub    $0x4,%esp
+    15f0:	52                   	push   %edx
+    15f1:	68 58 74 00 00       	push   $0x7458
+    15f6:	50                   	push   %eax
+    15f7:	e8 c4 52 00 00       	call   68c0 <printf>
+    15fc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    15ff:	e8 e0 50 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "log ops ok\n");
+    1604:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1609:	83 ec 08             	sub    $0x8,%esp
+    160c:	68 7e 74 00 00       	push   $0x747e
+    1611:	50                   	push   %eax
+    1612:	e8 a9 52 00 00       	call   68c0 <printf>
+    1617:	83 c4 10             	add    $0x10,%esp
+}
+    161a:	90                   	nop
+    161b:	c9                   	leave
+    161c:	c3                   	ret
+
+0000161d <readaheadtest>:
+// three processes read the same file sequentially at once
+// through a small cache, so that their read-ahead races with
+// each other's reads; a buffer left locked would hang them.
+void
+readaheadtest(void)
+{
+    161d:	55                   	push   %ebp
+    161e:	89 e5                	mov    %esp,%ebp
+    1620:	83 ec 28             	sub    $0x28,%esp
+  int n0, n1, fd, i, j, k, pid;
+
+  printf(stdout, "readahead test\n");
+    1623:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1628:	83 ec 08             	sub    $0x8,%esp
+    162b:	68 8a 74 00 00       	push   $0x748a
+    1630:	50                   	push   %eax
+    1631:	e8 8a 52 00 00       	call   68c0 <printf>
+    1636:	83 c4 10             	add    $0x10,%esp
+  n0 = bcachesize(0);
+    1639:	83 ec 0c             	sub    $0xc,%esp
+    163c:	6a 00                	push   $0x0
+    163e:	e8 89 51 00 00       	call   67cc <bcachesize>
+    1643:	83 c4 10             	add    $0x10,%esp
+    1646:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  n1 = bcachesize(1);
+    1649:	83 ec 0c             	sub    $0xc,%esp
+    164c:	6a 01                	push   $0x1
+    164e:	e8 79 51 00 00       	call   67cc <bcachesize>
+    1653:	83 c4 10             	add    $0x10,%esp
+    1656:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  fd = open("readahead", O_CREATE|O_RDWR);
+    1659:	83 ec 08             	sub    $0x8,%esp
+    165c:	68 02 02 00 00       	push   $0x202
+    1661:	68 9a 74 00 00       	push   $0x749a
+    1666:	e8 b9 50 00 00       	call   6724 <open>
+    166b:	83 c4 10             	add    $0x10,%esp
+    166e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(fd < 0){
+    1671:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1675:	79 1b                	jns    1692 <readaheadtest+0x75>
+    printf(stdout, "create readahead failed\n");
+    1677:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    167c:	83 ec 08             	sub    $0x8,%esp
+    167f:	68 a4 74 00 00       	push   $0x74a4
+    1684:	50                   	push   %eax
+    1685:	e8 36 52 00 00       	call   68c0 <printf>
+    168a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    168d:	e8 52 50 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; i < 4*n1; i++){
+    1692:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1699:	eb 56                	jmp    16f1 <readaheadtest+0xd4>
+    memset(buf, i, 512);
+    169b:	83 ec 04             	sub    $0x4,%esp
+    169e:	68 00 02 00 00       	push   $0x200
+    16a3:	ff 75 f4             	push   -0xc(%ebp)
+    16a6:	68 20 9a 00 00       	push   $0x9a20
+    16ab:	e8 99 4e 00 00       	call   6549 <memset>
+    16b0:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 512) != 512){
+    16b3:	83 ec 04             	sub    $0x4,%esp
+    16b6:	68 00 02 00 00       	push   $0x200
+    16bb:	68 20 9a 00 00       	push   $0x9a20
+    16c0:	ff 75 e0             	push   -0x20(%ebp)
+    16c3:	e8 3c 50 00 00       	call   6704 <write>
+    16c8:	83 c4 10             	add    $0x10,%esp
+    16cb:	3d 00 02 00 00       	cmp    $0x200,%eax
+    16d0:	74 1b                	je     16ed <readaheadtest+0xd0>
+      printf(stdout, "readahead write failed\n");
+    16d2:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    16d7:	83 ec 08             	sub    $0x8,%esp
+    16da:	68 bd 74 00 00       	push   $0x74bd
+    16df:	50                   	push   %eax
+    16e0:	e8 db 51 00 00       	call   68c0 <printf>
+    16e5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    16e8:	e8 f7 4f 00 00       	call   66e4 <exit>
+  for(i = 0; i < 4*n1; i++){
+    16ed:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    16f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    16f4:	c1 e0 02             	shl    $0x2,%eax
+    16f7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    16fa:	7c 9f                	jl     169b <readaheadtest+0x7e>
+    }
+  }
+  close(fd);
+    16fc:	83 ec 0c             	sub    $0xc,%esp
+    16ff:	ff 75 e0             	push   -0x20(%ebp)
+    1702:	e8 05 50 00 00       	call   670c <close>
+    1707:	83 c4 10             	add    $0x10,%esp
+  for(k = 0; k < 3; k++){
+    170a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1711:	e9 1b 01 00 00       	jmp    1831 <readaheadtest+0x214>
+    pid = k < 2 ? fork() : 0;
+    1716:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    171a:	7f 07                	jg     1723 <readaheadtest+0x106>
+    171c:	e8 bb 4f 00 00       	call   66dc <fork>
+    1721:	eb 05                	jmp    1728 <readaheadtest+0x10b>
+    1723:	b8 00 00 00 00       	mov    $0x0,%eax
+    1728:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    if(pid < 0){
+    172b:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    172f:	79 1b                	jns    174c <readaheadtest+0x12f>
+      printf(stdout, "fork failed\n");
+    1731:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1736:	83 ec 08             	sub    $0x8,%esp
+    1739:	68 19 6d 00 00       	push   $0x6d19
+    173e:	50                   	push   %eax
+    173f:	e8 7c 51 00 00       	call   68c0 <printf>
+    1744:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1747:	e8 98 4f 00 00       	call   66e4 <exit>
+    }
+    if(pid > 0)
+    174c:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    1750:	0f 8f d6 00 00 00    	jg     182c <readaheadtest+0x20f>
+      continue;
+    fd = open("readahead", O_RDONLY);
+    1756:	83 ec 08             	sub    $0x8,%esp
+    1759:	6a 00                	push   $0x0
+    175b:	68 9a 74 00 00       	push   $0x749a
+    1760:	e8 bf 4f 00 00       	call   6724 <open>
+    1765:	83 c4 10             	add    $0x10,%esp
+    1768:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(i = 0; i < 4*n1; i++){
+    176b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1772:	e9 81 00 00 00       	jmp    17f8 <readaheadtest+0x1db>
+      if(read(fd, buf, 512) != 512){
+    1777:	83 ec 04             	sub    $0x4,%esp
+    177a:	68 00 02 00 00       	push   $0x200
+    177f:	68 20 9a 00 00       	push   $0x9a20
+    1784:	ff 75 e0             	push   -0x20(%ebp)
+    1787:	e8 70 4f 00 00       	call   66fc <read>
+    178c:	83 c4 10             	add    $0x10,%esp
+    178f:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1794:	74 1b                	je     17b1 <readaheadtest+0x194>
+        printf(stdout, "readahead read failed\n");
+    1796:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    179b:	83 ec 08             	sub    $0x8,%esp
+    179e:	68 d5 74 00 00       	push   $0x74d5
+    17a3:	50                   	push   %eax
+    17a4:	e8 17 51 00 00       	call   68c0 <printf>
+    17a9:	83 c4 10             	add    $0x10,%esp
+        exit();
+    17ac:	e8 33 4f 00 00       	call   66e4 <exit>
+      }
+      for(j = 0; j < 512; j++){
+    17b1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    17b8:	eb 31                	jmp    17eb <readaheadtest+0x1ce>
+        if(buf[j] != (char)i){
+    17ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    17bd:	05 20 9a 00 00       	add    $0x9a20,%eax
+    17c2:	0f b6 00             	movzbl (%eax),%eax
+    17c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    17c8:	38 d0                	cmp    %dl,%al
+    17ca:	74 1b                	je     17e7 <readaheadtest+0x1ca>
+          printf(stdout, "readahead wrong data\n");
+    17cc:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    17d1:	83 ec 08             	sub    $0x8,%esp
+    17d4:	68 ec 74 00 00       	push   $0x74ec
+    17d9:	50                   	push   %eax
+    17da:	e8 e1 50 00 00       	call   68c0 <printf>
+    17df:	83 c4 10             	add    $0x10,%esp
+          exit();
+    17e2:	e8 fd 4e 00 00       	call   66e4 <exit>
+      for(j = 0; j < 512; j++){
+    17e7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    17eb:	81 7d f0 ff 01 00 00 	cmpl   $0x1ff,-0x10(%ebp)
+    17f2:	7e c6                	jle    17ba <readaheadtest+0x19d>
+    for(i = 0; i < 4*n1; i++){
+    17f4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    17f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    17fb:	c1 e0 02             	shl    $0x2,%eax
+    17fe:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1801:	0f 8c 70 ff ff ff    	jl     1777 <readaheadtest+0x15a>
+        }
+      }
+    }
+    close(fd);
+    1807:	83 ec 0c             	sub    $0xc,%esp
+    180a:	ff 75 e0             	push   -0x20(%ebp)
+    180d:	e8 fa 4e 00 00       	call   670c <close>
+    1812:	83 c4 10             	add    $0x10,%esp
+    if(k < 2)
+    1815:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    1819:	7f 05                	jg     1820 <readaheadtest+0x203>
+      exit();
+    181b:	e8 c4 4e 00 00       	call   66e4 <exit>
+    wait();
+    1820:	e8 c7 4e 00 00       	call   66ec <wait>
+    wait();
+    1825:	e8 c2 4e 00 00       	call   66ec <wait>
+    182a:	eb 01                	jmp    182d <readaheadtest+0x210>
+      continue;
+    182c:	90                   	nop
+  for(k = 0; k < 3; k++){
+    182d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    1831:	83 7d ec 02          	cmpl   $0x2,-0x14(%ebp)
+    1835:	0f 8e db fe ff ff    	jle    1716 <readaheadtest+0xf9>
+  }
+  unlink("readahead");
+    183b:	83 ec 0c             	sub    $0xc,%esp
+    183e:	68 9a 74 00 00       	push   $0x749a
+    1843:	e8 ec 4e 00 00       	call   6734 <unlink>
+    1848:	83 c4 10             	add    $0x10,%esp
+  bcachesize(n0);
+    184b:	83 ec 0c             	sub    $0xc,%esp
+    184e:	ff 75 e8             	push   -0x18(%ebp)
+    1851:	e8 76 4f 00 00       	call   67cc <bcachesize>
+    1856:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "readahead ok\n");
+    1859:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    185e:	83 ec 08             	sub    $0x8,%esp
+    1861:	68 02 75 00 00       	push   $0x7502
+    1866:	50                   	push   %eax
+    1867:	e8 54 50 00 00       	call   68c0 <printf>
+    186c:	83 c4 10             	add    $0x10,%esp
+}
+    186f:	90                   	nop
+    1870:	c9                   	leave
+    1871:	c3                   	ret
+
+00001872 <synctest>:
+
+// fsync() should refuse pipes, and sync() should commit: the
+// blocks of an unlinked file are only free once it has.
+void
+synctest(void)
+{
+    1872:	55                   	push   %ebp
+    1873:	89 e5                	mov    %esp,%ebp
+    1875:	83 ec 48             	sub    $0x48,%esp
+  struct statfs st0, st1;
+  int fd, i, p[2];
+
+  printf(stdout, "sync test\n");
+    1878:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    187d:	83 ec 08             	sub    $0x8,%esp
+    1880:	68 10 75 00 00       	push   $0x7510
+    1885:	50                   	push   %eax
+    1886:	e8 35 50 00 00       	call   68c0 <printf>
+    188b:	83 c4 10             	add    $0x10,%esp
+  if(statfs("/", &st0) < 0){
+    188e:	83 ec 08             	sub    $0x8,%esp
+    1891:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1894:	50                   	push   %eax
+    1895:	68 ea 6c 00 00       	push   $0x6cea
+    189a:	e8 25 4f 00 00       	call   67c4 <statfs>
+    189f:	83 c4 10             	add    $0x10,%esp
+    18a2:	85 c0                	test   %eax,%eax
+    18a4:	79 1b                	jns    18c1 <synctest+0x4f>
+    printf(stdout, "statfs failed\n");
+    18a6:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    18ab:	83 ec 08             	sub    $0x8,%esp
+    18ae:	68 62 71 00 00       	push   $0x7162
+    18b3:	50                   	push   %eax
+    18b4:	e8 07 50 00 00       	call   68c0 <printf>
+    18b9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    18bc:	e8 23 4e 00 00       	call   66e4 <exit>
+  }
+  fd = open("sync", O_CREATE|O_RDWR);
+    18c1:	83 ec 08             	sub    $0x8,%esp
+    18c4:	68 02 02 00 00       	push   $0x202
+    18c9:	68 1b 75 00 00       	push   $0x751b
+    18ce:	e8 51 4e 00 00       	call   6724 <open>
+    18d3:	83 c4 10             	add    $0x10,%esp
+    18d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  memset(buf, 's', st0.bsize);
+    18d9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    18dc:	83 ec 04             	sub    $0x4,%esp
+    18df:	50                   	push   %eax
+    18e0:	6a 73                	push   $0x73
+    18e2:	68 20 9a 00 00       	push   $0x9a20
+    18e7:	e8 5d 4c 00 00       	call   6549 <memset>
+    18ec:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 10 && fd >= 0; i++){
+    18ef:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    18f6:	eb 3f                	jmp    1937 <synctest+0xc5>
+    if(write(fd, buf, st0.bsize) != st0.bsize){
+    18f8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    18fb:	83 ec 04             	sub    $0x4,%esp
+    18fe:	50                   	push   %eax
+    18ff:	68 20 9a 00 00       	push   $0x9a20
+    1904:	ff 75 f0             	push   -0x10(%ebp)
+    1907:	e8 f8 4d 00 00       	call   6704 <write>
+    190c:	83 c4 10             	add    $0x10,%esp
+    190f:	89 c2                	mov    %eax,%edx
+    1911:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1914:	39 c2                	cmp    %eax,%edx
+    1916:	74 1b                	je     1933 <synctest+0xc1>
+      printf(stdout, "sync write failed\n");
+    1918:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    191d:	83 ec 08             	sub    $0x8,%esp
+    1920:	68 20 75 00 00       	push   $0x7520
+    1925:	50                   	push   %eax
+    1926:	e8 95 4f 00 00       	call   68c0 <printf>
+    192b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    192e:	e8 b1 4d 00 00       	call   66e4 <exit>
+  for(i = 0; i < 10 && fd >= 0; i++){
+    1933:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1937:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    193b:	7f 06                	jg     1943 <synctest+0xd1>
+    193d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1941:	79 b5                	jns    18f8 <synctest+0x86>
+    }
+  }
+  if(fd < 0 || fsync(fd) < 0){
+    1943:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1947:	78 12                	js     195b <synctest+0xe9>
+    1949:	83 ec 0c             	sub    $0xc,%esp
+    194c:	ff 75 f0             	push   -0x10(%ebp)
+    194f:	e8 90 4e 00 00       	call   67e4 <fsync>
+    1954:	83 c4 10             	add    $0x10,%esp
+    1957:	85 c0                	test   %eax,%eax
+    1959:	79 1b                	jns    1976 <synctest+0x104>
+    printf(stdout, "fsync failed\n");
+    195b:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1960:	83 ec 08             	sub    $0x8,%esp
+    1963:	68 33 75 00 00       	push   $0x7533
+    1968:	50                   	push   %eax
+    1969:	e8 52 4f 00 00       	call   68c0 <printf>
+    196e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1971:	e8 6e 4d 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    1976:	83 ec 0c             	sub    $0xc,%esp
+    1979:	ff 75 f0             	push   -0x10(%ebp)
+    197c:	e8 8b 4d 00 00       	call   670c <close>
+    1981:	83 c4 10             	add    $0x10,%esp
+  if(pipe(p) < 0 || fsync(p[0]) >= 0){
+    1984:	83 ec 0c             	sub    $0xc,%esp
+    1987:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    198a:	50                   	push   %eax
+    198b:	e8 64 4d 00 00       	call   66f4 <pipe>
+    1990:	83 c4 10             	add    $0x10,%esp
+    1993:	85 c0                	test   %eax,%eax
+    1995:	78 13                	js     19aa <synctest+0x138>
+    1997:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    199a:	83 ec 0c             	sub    $0xc,%esp
+    199d:	50                   	push   %eax
+    199e:	e8 41 4e 00 00       	call   67e4 <fsync>
+    19a3:	83 c4 10             	add    $0x10,%esp
+    19a6:	85 c0                	test   %eax,%eax
+    19a8:	78 1b                	js     19c5 <synctest+0x153>
+    printf(stdout, "fsync of a pipe succeeded\n");
+    19aa:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    19af:	83 ec 08             	sub    $0x8,%esp
+    19b2:	68 41 75 00 00       	push   $0x7541
+    19b7:	50                   	push   %eax
+    19b8:	e8 03 4f 00 00       	call   68c0 <printf>
+    19bd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    19c0:	e8 1f 4d 00 00       	call   66e4 <exit>
+  }
+  close(p[0]);
+    19c5:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    19c8:	83 ec 0c             	sub    $0xc,%esp
+    19cb:	50                   	push   %eax
+    19cc:	e8 3b 4d 00 00       	call   670c <close>
+    19d1:	83 c4 10             	add    $0x10,%esp
+  close(p[1]);
+    19d4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    19d7:	83 ec 0c             	sub    $0xc,%esp
+    19da:	50                   	push   %eax
+    19db:	e8 2c 4d 00 00       	call   670c <close>
+    19e0:	83 c4 10             	add    $0x10,%esp
+  statfs("/", &st0);
+    19e3:	83 ec 08             	sub    $0x8,%esp
+    19e6:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    19e9:	50                   	push   %eax
+    19ea:	68 ea 6c 00 00       	push   $0x6cea
+    19ef:	e8 d0 4d 00 00       	call   67c4 <statfs>
+    19f4:	83 c4 10             	add    $0x10,%esp
+  unlink("sync");
+    19f7:	83 ec 0c             	sub    $0xc,%esp
+    19fa:	68 1b 75 00 00       	push   $0x751b
+    19ff:	e8 30 4d 00 00       	call   6734 <unlink>
+    1a04:	83 c4 10             	add    $0x10,%esp
+  if(sync() < 0){
+    1a07:	e8 d0 4d 00 00       	call   67dc <sync>
+    1a0c:	85 c0                	test   %eax,%eax
+    1a0e:	79 1b                	jns    1a2b <synctest+0x1b9>
+    printf(stdout, "sync failed\n");
+    1a10:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1a15:	83 ec 08             	sub    $0x8,%esp
+    1a18:	68 5c 75 00 00       	push   $0x755c
+    1a1d:	50                   	push   %eax
+    1a1e:	e8 9d 4e 00 00       	call   68c0 <printf>
+    1a23:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a26:	e8 b9 4c 00 00       	call   66e4 <exit>
+  }
+  statfs("/", &st1);
+    1a2b:	83 ec 08             	sub    $0x8,%esp
+    1a2e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1a31:	50                   	push   %eax
+    1a32:	68 ea 6c 00 00       	push   $0x6cea
+    1a37:	e8 88 4d 00 00       	call   67c4 <statfs>
+    1a3c:	83 c4 10             	add    $0x10,%esp
+  if(st1.bfree < st0.bfree + 10){
+    1a3f:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    1a42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a45:	83 c0 0a             	add    $0xa,%eax
+    1a48:	39 c2                	cmp    %eax,%edx
+    1a4a:	73 1b                	jae    1a67 <synctest+0x1f5>
+    printf(stdout, "sync did not commit the unlink\n");
+    1a4c:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1a51:	83 ec 08             	sub    $0x8,%esp
+    1a54:	68 6c 75 00 00       	push   $0x756c
+    1a59:	50                   	push   %eax
+    1a5a:	e8 61 4e 00 00       	call   68c0 <printf>
+    1a5f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a62:	e8 7d 4c 00 00       	call   66e4 <exit>
+  }
+  fd = open("sync", O_RDONLY);
+    1a67:	83 ec 08             	sub    $0x8,%esp
+    1a6a:	6a 00                	push   $0x0
+    1a6c:	68 1b 75 00 00       	push   $0x751b
+    1a71:	e8 ae 4c 00 00       	call   6724 <open>
+    1a76:	83 c4 10             	add    $0x10,%esp
+    1a79:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+    1a7c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1a80:	78 1b                	js     1a9d <synctest+0x22b>
+    printf(stdout, "sync: unlinked file still there\n");
+    1a82:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1a87:	83 ec 08             	sub    $0x8,%esp
+    1a8a:	68 8c 75 00 00       	push   $0x758c
+    1a8f:	50                   	push   %eax
+    1a90:	e8 2b 4e 00 00       	call   68c0 <printf>
+    1a95:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a98:	e8 47 4c 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "sync ok\n");
+    1a9d:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1aa2:	83 ec 08             	sub    $0x8,%esp
+    1aa5:	68 ad 75 00 00       	push   $0x75ad
+    1aaa:	50                   	push   %eax
+    1aab:	e8 10 4e 00 00       	call   68c0 <printf>
+    1ab0:	83 c4 10             	add    $0x10,%esp
+}
+    1ab3:	90                   	nop
+    1ab4:	c9                   	leave
+    1ab5:	c3                   	ret
+
+00001ab6 <installtest>:
+// home a batch at a time and releases each as soon as its
+// write is done (bwaitany()), so the reader must never see
+// a block half old and half new.
+void
+installtest(void)
+{
+    1ab6:	55                   	push   %ebp
+    1ab7:	89 e5                	mov    %esp,%ebp
+    1ab9:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct statfs st;
+  struct bcstat bs0, bs1;
+  int fd, i, j, k, pid;
+
+  printf(stdout, "install test\n");
+    1abf:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1ac4:	83 ec 08             	sub    $0x8,%esp
+    1ac7:	68 b6 75 00 00       	push   $0x75b6
+    1acc:	50                   	push   %eax
+    1acd:	e8 ee 4d 00 00       	call   68c0 <printf>
+    1ad2:	83 c4 10             	add    $0x10,%esp
+  if(statfs("/", &st) < 0 || st.bsize > sizeof(buf)){
+    1ad5:	83 ec 08             	sub    $0x8,%esp
+    1ad8:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    1adb:	50                   	push   %eax
+    1adc:	68 ea 6c 00 00       	push   $0x6cea
+    1ae1:	e8 de 4c 00 00       	call   67c4 <statfs>
+    1ae6:	83 c4 10             	add    $0x10,%esp
+    1ae9:	85 c0                	test   %eax,%eax
+    1aeb:	78 0a                	js     1af7 <installtest+0x41>
+    1aed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1af0:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1af5:	76 1b                	jbe    1b12 <installtest+0x5c>
+    printf(stdout, "statfs failed\n");
+    1af7:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1afc:	83 ec 08             	sub    $0x8,%esp
+    1aff:	68 62 71 00 00       	push   $0x7162
+    1b04:	50                   	push   %eax
+    1b05:	e8 b6 4d 00 00       	call   68c0 <printf>
+    1b0a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b0d:	e8 d2 4b 00 00       	call   66e4 <exit>
+  }
+  fd = open("install", O_CREATE|O_RDWR);
+    1b12:	83 ec 08             	sub    $0x8,%esp
+    1b15:	68 02 02 00 00       	push   $0x202
+    1b1a:	68 c4 75 00 00       	push   $0x75c4
+    1b1f:	e8 00 4c 00 00       	call   6724 <open>
+    1b24:	83 c4 10             	add    $0x10,%esp
+    1b27:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  memset(buf, 'a', st.bsize);
+    1b2a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1b2d:	83 ec 04             	sub    $0x4,%esp
+    1b30:	50                   	push   %eax
+    1b31:	6a 61                	push   $0x61
+    1b33:	68 20 9a 00 00       	push   $0x9a20
+    1b38:	e8 0c 4a 00 00       	call   6549 <memset>
+    1b3d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 10 && fd >= 0; i++)
+    1b40:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1b47:	eb 1b                	jmp    1b64 <installtest+0xae>
+    write(fd, buf, st.bsize);
+    1b49:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1b4c:	83 ec 04             	sub    $0x4,%esp
+    1b4f:	50                   	push   %eax
+    1b50:	68 20 9a 00 00       	push   $0x9a20
+    1b55:	ff 75 e8             	push   -0x18(%ebp)
+    1b58:	e8 a7 4b 00 00       	call   6704 <write>
+    1b5d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 10 && fd >= 0; i++)
+    1b60:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1b64:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    1b68:	7f 06                	jg     1b70 <installtest+0xba>
+    1b6a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1b6e:	79 d9                	jns    1b49 <installtest+0x93>
+  if(fd < 0 || fsync(fd) < 0){
+    1b70:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1b74:	78 12                	js     1b88 <installtest+0xd2>
+    1b76:	83 ec 0c             	sub    $0xc,%esp
+    1b79:	ff 75 e8             	push   -0x18(%ebp)
+    1b7c:	e8 63 4c 00 00       	call   67e4 <fsync>
+    1b81:	83 c4 10             	add    $0x10,%esp
+    1b84:	85 c0                	test   %eax,%eax
+    1b86:	79 1b                	jns    1ba3 <installtest+0xed>
+    printf(stdout, "create install failed\n");
+    1b88:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1b8d:	83 ec 08             	sub    $0x8,%esp
+    1b90:	68 cc 75 00 00       	push   $0x75cc
+    1b95:	50                   	push   %eax
+    1b96:	e8 25 4d 00 00       	call   68c0 <printf>
+    1b9b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b9e:	e8 41 4b 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    1ba3:	83 ec 0c             	sub    $0xc,%esp
+    1ba6:	ff 75 e8             	push   -0x18(%ebp)
+    1ba9:	e8 5e 4b 00 00       	call   670c <close>
+    1bae:	83 c4 10             	add    $0x10,%esp
+  bcstat(&bs0, 0);
+    1bb1:	83 ec 08             	sub    $0x8,%esp
+    1bb4:	6a 00                	push   $0x0
+    1bb6:	8d 45 9c             	lea    -0x64(%ebp),%eax
+    1bb9:	50                   	push   %eax
+    1bba:	e8 15 4c 00 00       	call   67d4 <bcstat>
+    1bbf:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1bc2:	e8 15 4b 00 00       	call   66dc <fork>
+    1bc7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1bca:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1bce:	79 1b                	jns    1beb <installtest+0x135>
+    printf(stdout, "fork failed\n");
+    1bd0:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1bd5:	83 ec 08             	sub    $0x8,%esp
+    1bd8:	68 19 6d 00 00       	push   $0x6d19
+    1bdd:	50                   	push   %eax
+    1bde:	e8 dd 4c 00 00       	call   68c0 <printf>
+    1be3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1be6:	e8 f9 4a 00 00       	call   66e4 <exit>
+  }
+  for(k = 0; k < 20; k++){
+    1beb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1bf2:	e9 73 01 00 00       	jmp    1d6a <installtest+0x2b4>
+    fd = open("install", O_RDWR);
+    1bf7:	83 ec 08             	sub    $0x8,%esp
+    1bfa:	6a 02                	push   $0x2
+    1bfc:	68 c4 75 00 00       	push   $0x75c4
+    1c01:	e8 1e 4b 00 00       	call   6724 <open>
+    1c06:	83 c4 10             	add    $0x10,%esp
+    1c09:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    1c0c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1c10:	79 1b                	jns    1c2d <installtest+0x177>
+      printf(stdout, "open install failed\n");
+    1c12:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1c17:	83 ec 08             	sub    $0x8,%esp
+    1c1a:	68 e3 75 00 00       	push   $0x75e3
+    1c1f:	50                   	push   %eax
+    1c20:	e8 9b 4c 00 00       	call   68c0 <printf>
+    1c25:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1c28:	e8 b7 4a 00 00       	call   66e4 <exit>
+    }
+    for(i = 0; i < 10; i++){
+    1c2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1c34:	e9 e2 00 00 00       	jmp    1d1b <installtest+0x265>
+      if(pid > 0)
+    1c39:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1c3d:	7e 1b                	jle    1c5a <installtest+0x1a4>
+        memset(buf, 'a' + k, st.bsize);
+    1c3f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1c42:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1c45:	83 c2 61             	add    $0x61,%edx
+    1c48:	83 ec 04             	sub    $0x4,%esp
+    1c4b:	50                   	push   %eax
+    1c4c:	52                   	push   %edx
+    1c4d:	68 20 9a 00 00       	push   $0x9a20
+    1c52:	e8 f2 48 00 00       	call   6549 <memset>
+    1c57:	83 c4 10             	add    $0x10,%esp
+      if((pid > 0 ? write(fd, buf, st.bsize) : read(fd, buf, st.bsize)) != st.bsize){
+    1c5a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1c5e:	7e 1b                	jle    1c7b <installtest+0x1c5>
+    1c60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1c63:	83 ec 04             	sub    $0x4,%esp
+    1c66:	50                   	push   %eax
+    1c67:	68 20 9a 00 00       	push   $0x9a20
+    1c6c:	ff 75 e8             	push   -0x18(%ebp)
+    1c6f:	e8 90 4a 00 00       	call   6704 <write>
+    1c74:	83 c4 10             	add    $0x10,%esp
+    1c77:	89 c2                	mov    %eax,%edx
+    1c79:	eb 19                	jmp    1c94 <installtest+0x1de>
+    1c7b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1c7e:	83 ec 04             	sub    $0x4,%esp
+    1c81:	50                   	push   %eax
+    1c82:	68 20 9a 00 00       	push   $0x9a20
+    1c87:	ff 75 e8             	push   -0x18(%ebp)
+    1c8a:	e8 6d 4a 00 00       	call   66fc <read>
+    1c8f:	83 c4 10             	add    $0x10,%esp
+    1c92:	89 c2                	mov    %eax,%edx
+    1c94:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1c97:	39 c2                	cmp    %eax,%edx
+    1c99:	74 1b                	je     1cb6 <installtest+0x200>
+        printf(stdout, "install read/write failed\n");
+    1c9b:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1ca0:	83 ec 08             	sub    $0x8,%esp
+    1ca3:	68 f8 75 00 00       	push   $0x75f8
+    1ca8:	50                   	push   %eax
+    1ca9:	e8 12 4c 00 00       	call   68c0 <printf>
+    1cae:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1cb1:	e8 2e 4a 00 00       	call   66e4 <exit>
+      }
+      for(j = 1; j < st.bsize; j++){
+    1cb6:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    1cbd:	eb 4e                	jmp    1d0d <installtest+0x257>
+        if(buf[j] != buf[0] || buf[0] < 'a' || buf[0] >= 'a' + 20){
+    1cbf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1cc2:	05 20 9a 00 00       	add    $0x9a20,%eax
+    1cc7:	0f b6 10             	movzbl (%eax),%edx
+    1cca:	0f b6 05 20 9a 00 00 	movzbl 0x9a20,%eax
+    1cd1:	38 c2                	cmp    %al,%dl
+    1cd3:	75 16                	jne    1ceb <installtest+0x235>
+    1cd5:	0f b6 05 20 9a 00 00 	movzbl 0x9a20,%eax
+    1cdc:	3c 60                	cmp    $0x60,%al
+    1cde:	7e 0b                	jle    1ceb <installtest+0x235>
+    1ce0:	0f b6 05 20 9a 00 00 	movzbl 0x9a20,%eax
+    1ce7:	3c 74                	cmp    $0x74,%al
+    1ce9:	7e 1e                	jle    1d09 <installtest+0x253>
+          printf(stdout, "install: block %d torn\n", i);
+    1ceb:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1cf0:	83 ec 04             	sub    $0x4,%esp
+    1cf3:	ff 75 f4             	push   -0xc(%ebp)
+    1cf6:	68 13 76 00 00       	push   $0x7613
+    1cfb:	50                   	push   %eax
+    1cfc:	e8 bf 4b 00 00       	call   68c0 <printf>
+    1d01:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1d04:	e8 db 49 00 00       	call   66e4 <exit>
+      for(j = 1; j < st.bsize; j++){
+    1d09:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1d0d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1d10:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1d13:	39 c2                	cmp    %eax,%edx
+    1d15:	72 a8                	jb     1cbf <installtest+0x209>
+    for(i = 0; i < 10; i++){
+    1d17:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1d1b:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    1d1f:	0f 8e 14 ff ff ff    	jle    1c39 <installtest+0x183>
+        }
+      }
+    }
+    if(pid > 0 && fsync(fd) < 0){
+    1d25:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1d29:	7e 2d                	jle    1d58 <installtest+0x2a2>
+    1d2b:	83 ec 0c             	sub    $0xc,%esp
+    1d2e:	ff 75 e8             	push   -0x18(%ebp)
+    1d31:	e8 ae 4a 00 00       	call   67e4 <fsync>
+    1d36:	83 c4 10             	add    $0x10,%esp
+    1d39:	85 c0                	test   %eax,%eax
+    1d3b:	79 1b                	jns    1d58 <installtest+0x2a2>
+      printf(stdout, "install fsync failed\n");
+    1d3d:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1d42:	83 ec 08             	sub    $0x8,%esp
+    1d45:	68 2b 76 00 00       	push   $0x762b
+    1d4a:	50                   	push   %eax
+    1d4b:	e8 70 4b 00 00       	call   68c0 <printf>
+    1d50:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1d53:	e8 8c 49 00 00       	call   66e4 <exit>
+    }
+    close(fd);
+    1d58:	83 ec 0c             	sub    $0xc,%esp
+    1d5b:	ff 75 e8             	push   -0x18(%ebp)
+    1d5e:	e8 a9 49 00 00       	call   670c <close>
+    1d63:	83 c4 10             	add    $0x10,%esp
+  for(k = 0; k < 20; k++){
+    1d66:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    1d6a:	83 7d ec 13          	cmpl   $0x13,-0x14(%ebp)
+    1d6e:	0f 8e 83 fe ff ff    	jle    1bf7 <installtest+0x141>
+  }
+  if(pid == 0)
+    1d74:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1d78:	75 05                	jne    1d7f <installtest+0x2c9>
+    exit();
+    1d7a:	e8 65 49 00 00       	call   66e4 <exit>
+  wait();
+    1d7f:	e8 68 49 00 00       	call   66ec <wait>
+  bcstat(&bs1, 0);
+    1d84:	83 ec 08             	sub    $0x8,%esp
+    1d87:	6a 00                	push   $0x0
+    1d89:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+    1d8f:	50                   	push   %eax
+    1d90:	e8 3f 4a 00 00       	call   67d4 <bcstat>
+    1d95:	83 c4 10             	add    $0x10,%esp
+  if(bs1.commits < bs0.commits + 20){
+    1d98:	8b 55 94             	mov    -0x6c(%ebp),%edx
+    1d9b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    1d9e:	83 c0 14             	add    $0x14,%eax
+    1da1:	39 c2                	cmp    %eax,%edx
+    1da3:	73 24                	jae    1dc9 <installtest+0x313>
+    printf(stdout, "install: only %d commits\n", bs1.commits - bs0.commits);
+    1da5:	8b 55 94             	mov    -0x6c(%ebp),%edx
+    1da8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    1dab:	29 c2                	sub    %eax,%edx
+    1dad:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1db2:	83 ec 04             	sub    $0x4,%esp
+    1db5:	52                   	push   %edx
+    1db6:	68 41 76 00 00       	push   $0x7641
+    1dbb:	50                   	push   %eax
+    1dbc:	e8 ff 4a 00 00       	call   68c0 <printf>
+    1dc1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1dc4:	e8 1b 49 00 00       	call   66e4 <exit>
+  }
+  unlink("install");
+    1dc9:	83 ec 0c             	sub    $0xc,%esp
+    1dcc:	68 c4 75 00 00       	push   $0x75c4
+    1dd1:	e8 5e 49 00 00       	call   6734 <unlink>
+    1dd6:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "install ok\n");
+    1dd9:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1dde:	83 ec 08             	sub    $0x8,%esp
+    1de1:	68 5b 76 00 00       	push   $0x765b
+    1de6:	50                   	push   %eax
+    1de7:	e8 d4 4a 00 00       	call   68c0 <printf>
+    1dec:	83 c4 10             	add    $0x10,%esp
+}
+    1def:	90                   	nop
+    1df0:	c9                   	leave
+    1df1:	c3                   	ret
+
+00001df2 <createtest>:
+
+void
+createtest(void)
+{
+    1df2:	55                   	push   %ebp
+    1df3:	89 e5                	mov    %esp,%ebp
+    1df5:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+    1df8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1dfd:	83 ec 08             	sub    $0x8,%esp
+    1e00:	68 68 76 00 00       	push   $0x7668
+    1e05:	50                   	push   %eax
+    1e06:	e8 b5 4a 00 00       	call   68c0 <printf>
+    1e0b:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+    1e0e:	c6 05 20 ba 00 00 61 	movb   $0x61,0xba20
+  name[2] = '\0';
+    1e15:	c6 05 22 ba 00 00 00 	movb   $0x0,0xba22
+  for(i = 0; i < 52; i++){
+    1e1c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1e23:	eb 35                	jmp    1e5a <createtest+0x68>
+    name[1] = '0' + i;
+    1e25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e28:	83 c0 30             	add    $0x30,%eax
+    1e2b:	a2 21 ba 00 00       	mov    %al,0xba21
+    fd = open(name, O_CREATE|O_RDWR);
+    1e30:	83 ec 08             	sub    $0x8,%esp
+    1e33:	68 02 02 00 00       	push   $0x202
+    1e38:	68 20 ba 00 00       	push   $0xba20
+    1e3d:	e8 e2 48 00 00       	call   6724 <open>
+    1e42:	83 c4 10             	add    $0x10,%esp
+    1e45:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+    1e48:	83 ec 0c             	sub    $0xc,%esp
+    1e4b:	ff 75 f0             	push   -0x10(%ebp)
+    1e4e:	e8 b9 48 00 00       	call   670c <close>
+    1e53:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+    1e56:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1e5a:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+    1e5e:	7e c5                	jle    1e25 <createtest+0x33>
+  }
+  name[0] = 'a';
+    1e60:	c6 05 20 ba 00 00 61 	movb   $0x61,0xba20
+  name[2] = '\0';
+    1e67:	c6 05 22 ba 00 00 00 	movb   $0x0,0xba22
+  for(i = 0; i < 52; i++){
+    1e6e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1e75:	eb 1f                	jmp    1e96 <createtest+0xa4>
+    name[1] = '0' + i;
+    1e77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e7a:	83 c0 30             	add    $0x30,%eax
+    1e7d:	a2 21 ba 00 00       	mov    %al,0xba21
+    unlink(name);
+    1e82:	83 ec 0c             	sub    $0xc,%esp
+    1e85:	68 20 ba 00 00       	push   $0xba20
+    1e8a:	e8 a5 48 00 00       	call   6734 <unlink>
+    1e8f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+    1e92:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1e96:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+    1e9a:	7e db                	jle    1e77 <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+    1e9c:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1ea1:	83 ec 08             	sub    $0x8,%esp
+    1ea4:	68 90 76 00 00       	push   $0x7690
+    1ea9:	50                   	push   %eax
+    1eaa:	e8 11 4a 00 00       	call   68c0 <printf>
+    1eaf:	83 c4 10             	add    $0x10,%esp
+}
+    1eb2:	90                   	nop
+    1eb3:	c9                   	leave
+    1eb4:	c3                   	ret
+
+00001eb5 <dcachetest>:
+// must replace a cached miss, and an unlink must hide the
+// name from later lookups, even while another process keeps
+// looking the name up.
+void
+dcachetest(void)
+{
+    1eb5:	55                   	push   %ebp
+    1eb6:	89 e5                	mov    %esp,%ebp
+    1eb8:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, pid;
+
+  printf(stdout, "dcache test\n");
+    1ebb:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1ec0:	83 ec 08             	sub    $0x8,%esp
+    1ec3:	68 b6 76 00 00       	push   $0x76b6
+    1ec8:	50                   	push   %eax
+    1ec9:	e8 f2 49 00 00       	call   68c0 <printf>
+    1ece:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dcdir") < 0){
+    1ed1:	83 ec 0c             	sub    $0xc,%esp
+    1ed4:	68 c3 76 00 00       	push   $0x76c3
+    1ed9:	e8 6e 48 00 00       	call   674c <mkdir>
+    1ede:	83 c4 10             	add    $0x10,%esp
+    1ee1:	85 c0                	test   %eax,%eax
+    1ee3:	79 1b                	jns    1f00 <dcachetest+0x4b>
+    printf(stdout, "mkdir dcdir failed\n");
+    1ee5:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1eea:	83 ec 08             	sub    $0x8,%esp
+    1eed:	68 c9 76 00 00       	push   $0x76c9
+    1ef2:	50                   	push   %eax
+    1ef3:	e8 c8 49 00 00       	call   68c0 <printf>
+    1ef8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1efb:	e8 e4 47 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; i < 2; i++){
+    1f00:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1f07:	eb 35                	jmp    1f3e <dcachetest+0x89>
+    if(open("dcdir/f", O_RDONLY) >= 0){
+    1f09:	83 ec 08             	sub    $0x8,%esp
+    1f0c:	6a 00                	push   $0x0
+    1f0e:	68 dd 76 00 00       	push   $0x76dd
+    1f13:	e8 0c 48 00 00       	call   6724 <open>
+    1f18:	83 c4 10             	add    $0x10,%esp
+    1f1b:	85 c0                	test   %eax,%eax
+    1f1d:	78 1b                	js     1f3a <dcachetest+0x85>
+      printf(stdout, "dcache: open of missing file succeeded\n");
+    1f1f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1f24:	83 ec 08             	sub    $0x8,%esp
+    1f27:	68 e8 76 00 00       	push   $0x76e8
+    1f2c:	50                   	push   %eax
+    1f2d:	e8 8e 49 00 00       	call   68c0 <printf>
+    1f32:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1f35:	e8 aa 47 00 00       	call   66e4 <exit>
+  for(i = 0; i < 2; i++){
+    1f3a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1f3e:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    1f42:	7e c5                	jle    1f09 <dcachetest+0x54>
+    }
+  }
+  fd = open("dcdir/f", O_CREATE|O_RDWR);
+    1f44:	83 ec 08             	sub    $0x8,%esp
+    1f47:	68 02 02 00 00       	push   $0x202
+    1f4c:	68 dd 76 00 00       	push   $0x76dd
+    1f51:	e8 ce 47 00 00       	call   6724 <open>
+    1f56:	83 c4 10             	add    $0x10,%esp
+    1f59:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    1f5c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1f60:	79 1b                	jns    1f7d <dcachetest+0xc8>
+    printf(stdout, "dcache: create after failed open failed\n");
+    1f62:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1f67:	83 ec 08             	sub    $0x8,%esp
+    1f6a:	68 10 77 00 00       	push   $0x7710
+    1f6f:	50                   	push   %eax
+    1f70:	e8 4b 49 00 00       	call   68c0 <printf>
+    1f75:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1f78:	e8 67 47 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    1f7d:	83 ec 0c             	sub    $0xc,%esp
+    1f80:	ff 75 f0             	push   -0x10(%ebp)
+    1f83:	e8 84 47 00 00       	call   670c <close>
+    1f88:	83 c4 10             	add    $0x10,%esp
+  fd = open("dcdir/f", O_RDONLY);
+    1f8b:	83 ec 08             	sub    $0x8,%esp
+    1f8e:	6a 00                	push   $0x0
+    1f90:	68 dd 76 00 00       	push   $0x76dd
+    1f95:	e8 8a 47 00 00       	call   6724 <open>
+    1f9a:	83 c4 10             	add    $0x10,%esp
+    1f9d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    1fa0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1fa4:	79 1b                	jns    1fc1 <dcachetest+0x10c>
+    printf(stdout, "dcache: open after create failed\n");
+    1fa6:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1fab:	83 ec 08             	sub    $0x8,%esp
+    1fae:	68 3c 77 00 00       	push   $0x773c
+    1fb3:	50                   	push   %eax
+    1fb4:	e8 07 49 00 00       	call   68c0 <printf>
+    1fb9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1fbc:	e8 23 47 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    1fc1:	83 ec 0c             	sub    $0xc,%esp
+    1fc4:	ff 75 f0             	push   -0x10(%ebp)
+    1fc7:	e8 40 47 00 00       	call   670c <close>
+    1fcc:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+    1fcf:	e8 08 47 00 00       	call   66dc <fork>
+    1fd4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    1fd7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1fdb:	79 1b                	jns    1ff8 <dcachetest+0x143>
+    printf(stdout, "fork failed\n");
+    1fdd:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    1fe2:	83 ec 08             	sub    $0x8,%esp
+    1fe5:	68 19 6d 00 00       	push   $0x6d19
+    1fea:	50                   	push   %eax
+    1feb:	e8 d0 48 00 00       	call   68c0 <printf>
+    1ff0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1ff3:	e8 ec 46 00 00       	call   66e4 <exit>
+  }
+  if(pid == 0){
+    1ff8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1ffc:	75 2b                	jne    2029 <dcachetest+0x174>
+    for(;;){
+      fd = open("dcdir/f", O_RDONLY);
+    1ffe:	83 ec 08             	sub    $0x8,%esp
+    2001:	6a 00                	push   $0x0
+    2003:	68 dd 76 00 00       	push   $0x76dd
+    2008:	e8 17 47 00 00       	call   6724 <open>
+    200d:	83 c4 10             	add    $0x10,%esp
+    2010:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      if(fd >= 0)
+    2013:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2017:	78 e5                	js     1ffe <dcachetest+0x149>
+        close(fd);
+    2019:	83 ec 0c             	sub    $0xc,%esp
+    201c:	ff 75 f0             	push   -0x10(%ebp)
+    201f:	e8 e8 46 00 00       	call   670c <close>
+    2024:	83 c4 10             	add    $0x10,%esp
+      fd = open("dcdir/f", O_RDONLY);
+    2027:	eb d5                	jmp    1ffe <dcachetest+0x149>
+    }
+  }
+  for(i = 0; i < 100; i++){
+    2029:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2030:	e9 b0 00 00 00       	jmp    20e5 <dcachetest+0x230>
+    if(unlink("dcdir/f") < 0){
+    2035:	83 ec 0c             	sub    $0xc,%esp
+    2038:	68 dd 76 00 00       	push   $0x76dd
+    203d:	e8 f2 46 00 00       	call   6734 <unlink>
+    2042:	83 c4 10             	add    $0x10,%esp
+    2045:	85 c0                	test   %eax,%eax
+    2047:	79 1b                	jns    2064 <dcachetest+0x1af>
+      printf(stdout, "dcache: unlink failed\n");
+    2049:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    204e:	83 ec 08             	sub    $0x8,%esp
+    2051:	68 5e 77 00 00       	push   $0x775e
+    2056:	50                   	push   %eax
+    2057:	e8 64 48 00 00       	call   68c0 <printf>
+    205c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    205f:	e8 80 46 00 00       	call   66e4 <exit>
+    }
+    fd = open("dcdir/f", O_RDONLY);
+    2064:	83 ec 08             	sub    $0x8,%esp
+    2067:	6a 00                	push   $0x0
+    2069:	68 dd 76 00 00       	push   $0x76dd
+    206e:	e8 b1 46 00 00       	call   6724 <open>
+    2073:	83 c4 10             	add    $0x10,%esp
+    2076:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+    2079:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    207d:	78 1b                	js     209a <dcachetest+0x1e5>
+      printf(stdout, "dcache: open after unlink succeeded\n");
+    207f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2084:	83 ec 08             	sub    $0x8,%esp
+    2087:	68 78 77 00 00       	push   $0x7778
+    208c:	50                   	push   %eax
+    208d:	e8 2e 48 00 00       	call   68c0 <printf>
+    2092:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2095:	e8 4a 46 00 00       	call   66e4 <exit>
+    }
+    fd = open("dcdir/f", O_CREATE|O_RDWR);
+    209a:	83 ec 08             	sub    $0x8,%esp
+    209d:	68 02 02 00 00       	push   $0x202
+    20a2:	68 dd 76 00 00       	push   $0x76dd
+    20a7:	e8 78 46 00 00       	call   6724 <open>
+    20ac:	83 c4 10             	add    $0x10,%esp
+    20af:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd < 0){
+    20b2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    20b6:	79 1b                	jns    20d3 <dcachetest+0x21e>
+      printf(stdout, "dcache: create after unlink failed\n");
+    20b8:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    20bd:	83 ec 08             	sub    $0x8,%esp
+    20c0:	68 a0 77 00 00       	push   $0x77a0
+    20c5:	50                   	push   %eax
+    20c6:	e8 f5 47 00 00       	call   68c0 <printf>
+    20cb:	83 c4 10             	add    $0x10,%esp
+      exit();
+    20ce:	e8 11 46 00 00       	call   66e4 <exit>
+    }
+    close(fd);
+    20d3:	83 ec 0c             	sub    $0xc,%esp
+    20d6:	ff 75 f0             	push   -0x10(%ebp)
+    20d9:	e8 2e 46 00 00       	call   670c <close>
+    20de:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    20e1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    20e5:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    20e9:	0f 8e 46 ff ff ff    	jle    2035 <dcachetest+0x180>
+  }
+  kill(pid);
+    20ef:	83 ec 0c             	sub    $0xc,%esp
+    20f2:	ff 75 ec             	push   -0x14(%ebp)
+    20f5:	e8 1a 46 00 00       	call   6714 <kill>
+    20fa:	83 c4 10             	add    $0x10,%esp
+  wait();
+    20fd:	e8 ea 45 00 00       	call   66ec <wait>
+  if(unlink("dcdir/f") < 0 || unlink("dcdir") < 0){
+    2102:	83 ec 0c             	sub    $0xc,%esp
+    2105:	68 dd 76 00 00       	push   $0x76dd
+    210a:	e8 25 46 00 00       	call   6734 <unlink>
+    210f:	83 c4 10             	add    $0x10,%esp
+    2112:	85 c0                	test   %eax,%eax
+    2114:	78 14                	js     212a <dcachetest+0x275>
+    2116:	83 ec 0c             	sub    $0xc,%esp
+    2119:	68 c3 76 00 00       	push   $0x76c3
+    211e:	e8 11 46 00 00       	call   6734 <unlink>
+    2123:	83 c4 10             	add    $0x10,%esp
+    2126:	85 c0                	test   %eax,%eax
+    2128:	79 1b                	jns    2145 <dcachetest+0x290>
+    printf(stdout, "dcache: cleanup failed\n");
+    212a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    212f:	83 ec 08             	sub    $0x8,%esp
+    2132:	68 c4 77 00 00       	push   $0x77c4
+    2137:	50                   	push   %eax
+    2138:	e8 83 47 00 00       	call   68c0 <printf>
+    213d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2140:	e8 9f 45 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "dcache ok\n");
+    2145:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    214a:	83 ec 08             	sub    $0x8,%esp
+    214d:	68 dc 77 00 00       	push   $0x77dc
+    2152:	50                   	push   %eax
+    2153:	e8 68 47 00 00       	call   68c0 <printf>
+    2158:	83 c4 10             	add    $0x10,%esp
+}
+    215b:	90                   	nop
+    215c:	c9                   	leave
+    215d:	c3                   	ret
+
+0000215e <dirtest>:
+
+void dirtest(void)
+{
+    215e:	55                   	push   %ebp
+    215f:	89 e5                	mov    %esp,%ebp
+    2161:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+    2164:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2169:	83 ec 08             	sub    $0x8,%esp
+    216c:	68 e7 77 00 00       	push   $0x77e7
+    2171:	50                   	push   %eax
+    2172:	e8 49 47 00 00       	call   68c0 <printf>
+    2177:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+    217a:	83 ec 0c             	sub    $0xc,%esp
+    217d:	68 f3 77 00 00       	push   $0x77f3
+    2182:	e8 c5 45 00 00       	call   674c <mkdir>
+    2187:	83 c4 10             	add    $0x10,%esp
+    218a:	85 c0                	test   %eax,%eax
+    218c:	79 1b                	jns    21a9 <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+    218e:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2193:	83 ec 08             	sub    $0x8,%esp
+    2196:	68 a1 6c 00 00       	push   $0x6ca1
+    219b:	50                   	push   %eax
+    219c:	e8 1f 47 00 00       	call   68c0 <printf>
+    21a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21a4:	e8 3b 45 00 00       	call   66e4 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+    21a9:	83 ec 0c             	sub    $0xc,%esp
+    21ac:	68 f3 77 00 00       	push   $0x77f3
+    21b1:	e8 9e 45 00 00       	call   6754 <chdir>
+    21b6:	83 c4 10             	add    $0x10,%esp
+    21b9:	85 c0                	test   %eax,%eax
+    21bb:	79 1b                	jns    21d8 <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+    21bd:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    21c2:	83 ec 08             	sub    $0x8,%esp
+    21c5:	68 f8 77 00 00       	push   $0x77f8
+    21ca:	50                   	push   %eax
+    21cb:	e8 f0 46 00 00       	call   68c0 <printf>
+    21d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21d3:	e8 0c 45 00 00       	call   66e4 <exit>
+  }
+
+  if(chdir("..") < 0){
+    21d8:	83 ec 0c             	sub    $0xc,%esp
+    21db:	68 0b 78 00 00       	push   $0x780b
+    21e0:	e8 6f 45 00 00       	call   6754 <chdir>
+    21e5:	83 c4 10             	add    $0x10,%esp
+    21e8:	85 c0                	test   %eax,%eax
+    21ea:	79 1b                	jns    2207 <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+    21ec:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    21f1:	83 ec 08             	sub    $0x8,%esp
+    21f4:	68 0e 78 00 00       	push   $0x780e
+    21f9:	50                   	push   %eax
+    21fa:	e8 c1 46 00 00       	call   68c0 <printf>
+    21ff:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2202:	e8 dd 44 00 00       	call   66e4 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+    2207:	83 ec 0c             	sub    $0xc,%esp
+    220a:	68 f3 77 00 00       	push   $0x77f3
+    220f:	e8 20 45 00 00       	call   6734 <unlink>
+    2214:	83 c4 10             	add    $0x10,%esp
+    2217:	85 c0                	test   %eax,%eax
+    2219:	79 1b                	jns    2236 <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+    221b:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2220:	83 ec 08             	sub    $0x8,%esp
+    2223:	68 1f 78 00 00       	push   $0x781f
+    2228:	50                   	push   %eax
+    2229:	e8 92 46 00 00       	call   68c0 <printf>
+    222e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2231:	e8 ae 44 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "mkdir test ok\n");
+    2236:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    223b:	83 ec 08             	sub    $0x8,%esp
+    223e:	68 33 78 00 00       	push   $0x7833
+    2243:	50                   	push   %eax
+    2244:	e8 77 46 00 00       	call   68c0 <printf>
+    2249:	83 c4 10             	add    $0x10,%esp
+}
+    224c:	90                   	nop
+    224d:	c9                   	leave
+    224e:	c3                   	ret
+
+0000224f <exectest>:
+
+void
+exectest(void)
+{
+    224f:	55                   	push   %ebp
+    2250:	89 e5                	mov    %esp,%ebp
+    2252:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+    2255:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    225a:	83 ec 08             	sub    $0x8,%esp
+    225d:	68 42 78 00 00       	push   $0x7842
+    2262:	50                   	push   %eax
+    2263:	e8 58 46 00 00       	call   68c0 <printf>
+    2268:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+    226b:	83 ec 08             	sub    $0x8,%esp
+    226e:	68 f0 99 00 00       	push   $0x99f0
+    2273:	68 78 6c 00 00       	push   $0x6c78
+    2278:	e8 9f 44 00 00       	call   671c <exec>
+    227d:	83 c4 10             	add    $0x10,%esp
+    2280:	85 c0                	test   %eax,%eax
+    2282:	79 1b                	jns    229f <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+    2284:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2289:	83 ec 08             	sub    $0x8,%esp
+    228c:	68 4d 78 00 00       	push   $0x784d
+    2291:	50                   	push   %eax
+    2292:	e8 29 46 00 00       	call   68c0 <printf>
+    2297:	83 c4 10             	add    $0x10,%esp
+    exit();
+    229a:	e8 45 44 00 00       	call   66e4 <exit>
+  }
+}
+    229f:	90                   	nop
+    22a0:	c9                   	leave
+    22a1:	c3                   	ret
+
+000022a2 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+    22a2:	55                   	push   %ebp
+    22a3:	89 e5                	mov    %esp,%ebp
+    22a5:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+    22a8:	83 ec 0c             	sub    $0xc,%esp
+    22ab:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    22ae:	50                   	push   %eax
+    22af:	e8 40 44 00 00       	call   66f4 <pipe>
+    22b4:	83 c4 10             	add    $0x10,%esp
+    22b7:	85 c0                	test   %eax,%eax
+    22b9:	74 17                	je     22d2 <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+    22bb:	83 ec 08             	sub    $0x8,%esp
+    22be:	68 5f 78 00 00       	push   $0x785f
+    22c3:	6a 01                	push   $0x1
+    22c5:	e8 f6 45 00 00       	call   68c0 <printf>
+    22ca:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22cd:	e8 12 44 00 00       	call   66e4 <exit>
+  }
+  pid = fork();
+    22d2:	e8 05 44 00 00       	call   66dc <fork>
+    22d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+    22da:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+    22e1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    22e5:	0f 85 89 00 00 00    	jne    2374 <pipe1+0xd2>
+    close(fds[0]);
+    22eb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    22ee:	83 ec 0c             	sub    $0xc,%esp
+    22f1:	50                   	push   %eax
+    22f2:	e8 15 44 00 00       	call   670c <close>
+    22f7:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+    22fa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    2301:	eb 66                	jmp    2369 <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+    2303:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    230a:	eb 19                	jmp    2325 <pipe1+0x83>
+        buf[i] = seq++;
+    230c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    230f:	8d 50 01             	lea    0x1(%eax),%edx
+    2312:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    2315:	89 c2                	mov    %eax,%edx
+    2317:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    231a:	05 20 9a 00 00       	add    $0x9a20,%eax
+    231f:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+    2321:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2325:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+    232c:	7e de                	jle    230c <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+    232e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    2331:	83 ec 04             	sub    $0x4,%esp
+    2334:	68 09 04 00 00       	push   $0x409
+    2339:	68 20 9a 00 00       	push   $0x9a20
+    233e:	50                   	push   %eax
+    233f:	e8 c0 43 00 00       	call   6704 <write>
+    2344:	83 c4 10             	add    $0x10,%esp
+    2347:	3d 09 04 00 00       	cmp    $0x409,%eax
+    234c:	74 17                	je     2365 <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+    234e:	83 ec 08             	sub    $0x8,%esp
+    2351:	68 6e 78 00 00       	push   $0x786e
+    2356:	6a 01                	push   $0x1
+    2358:	e8 63 45 00 00       	call   68c0 <printf>
+    235d:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2360:	e8 7f 43 00 00       	call   66e4 <exit>
+    for(n = 0; n < 5; n++){
+    2365:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    2369:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+    236d:	7e 94                	jle    2303 <pipe1+0x61>
+      }
+    }
+    exit();
+    236f:	e8 70 43 00 00       	call   66e4 <exit>
+  } else if(pid > 0){
+    2374:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    2378:	0f 8e f4 00 00 00    	jle    2472 <pipe1+0x1d0>
+    close(fds[1]);
+    237e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    2381:	83 ec 0c             	sub    $0xc,%esp
+    2384:	50                   	push   %eax
+    2385:	e8 82 43 00 00       	call   670c <close>
+    238a:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+    238d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+    2394:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+    239b:	eb 66                	jmp    2403 <pipe1+0x161>
+      for(i = 0; i < n; i++){
+    239d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    23a4:	eb 3b                	jmp    23e1 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+    23a6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    23a9:	05 20 9a 00 00       	add    $0x9a20,%eax
+    23ae:	0f b6 00             	movzbl (%eax),%eax
+    23b1:	0f be c8             	movsbl %al,%ecx
+    23b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    23b7:	8d 50 01             	lea    0x1(%eax),%edx
+    23ba:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    23bd:	31 c8                	xor    %ecx,%eax
+    23bf:	0f b6 c0             	movzbl %al,%eax
+    23c2:	85 c0                	test   %eax,%eax
+    23c4:	74 17                	je     23dd <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+    23c6:	83 ec 08             	sub    $0x8,%esp
+    23c9:	68 7c 78 00 00       	push   $0x787c
+    23ce:	6a 01                	push   $0x1
+    23d0:	e8 eb 44 00 00       	call   68c0 <printf>
+    23d5:	83 c4 10             	add    $0x10,%esp
+    23d8:	e9 ac 00 00 00       	jmp    2489 <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+    23dd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    23e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    23e4:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    23e7:	7c bd                	jl     23a6 <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+    23e9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    23ec:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+    23ef:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+    23f2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    23f5:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    23fa:	76 07                	jbe    2403 <pipe1+0x161>
+        cc = sizeof(buf);
+    23fc:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+    2403:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    2406:	83 ec 04             	sub    $0x4,%esp
+    2409:	ff 75 e8             	push   -0x18(%ebp)
+    240c:	68 20 9a 00 00       	push   $0x9a20
+    2411:	50                   	push   %eax
+    2412:	e8 e5 42 00 00       	call   66fc <read>
+    2417:	83 c4 10             	add    $0x10,%esp
+    241a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    241d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2421:	0f 8f 76 ff ff ff    	jg     239d <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+    2427:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+    242e:	74 1a                	je     244a <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+    2430:	83 ec 04             	sub    $0x4,%esp
+    2433:	ff 75 e4             	push   -0x1c(%ebp)
+    2436:	68 8a 78 00 00       	push   $0x788a
+    243b:	6a 01                	push   $0x1
+    243d:	e8 7e 44 00 00       	call   68c0 <printf>
+    2442:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2445:	e8 9a 42 00 00       	call   66e4 <exit>
+    }
+    close(fds[0]);
+    244a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    244d:	83 ec 0c             	sub    $0xc,%esp
+    2450:	50                   	push   %eax
+    2451:	e8 b6 42 00 00       	call   670c <close>
+    2456:	83 c4 10             	add    $0x10,%esp
+    wait();
+    2459:	e8 8e 42 00 00       	call   66ec <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+    245e:	83 ec 08             	sub    $0x8,%esp
+    2461:	68 b0 78 00 00       	push   $0x78b0
+    2466:	6a 01                	push   $0x1
+    2468:	e8 53 44 00 00       	call   68c0 <printf>
+    246d:	83 c4 10             	add    $0x10,%esp
+    2470:	eb 17                	jmp    2489 <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+    2472:	83 ec 08             	sub    $0x8,%esp
+    2475:	68 a1 78 00 00       	push   $0x78a1
+    247a:	6a 01                	push   $0x1
+    247c:	e8 3f 44 00 00       	call   68c0 <printf>
+    2481:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2484:	e8 5b 42 00 00       	call   66e4 <exit>
+}
+    2489:	c9                   	leave
+    248a:	c3                   	ret
+
+0000248b <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+    248b:	55                   	push   %ebp
+    248c:	89 e5                	mov    %esp,%ebp
+    248e:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+    2491:	83 ec 08             	sub    $0x8,%esp
+    2494:	68 ba 78 00 00       	push   $0x78ba
+    2499:	6a 01                	push   $0x1
+    249b:	e8 20 44 00 00       	call   68c0 <printf>
+    24a0:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+    24a3:	e8 34 42 00 00       	call   66dc <fork>
+    24a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+    24ab:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    24af:	75 03                	jne    24b4 <preempt+0x29>
+    for(;;)
+    24b1:	90                   	nop
+    24b2:	eb fd                	jmp    24b1 <preempt+0x26>
+      ;
+
+  pid2 = fork();
+    24b4:	e8 23 42 00 00       	call   66dc <fork>
+    24b9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+    24bc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    24c0:	75 03                	jne    24c5 <preempt+0x3a>
+    for(;;)
+    24c2:	90                   	nop
+    24c3:	eb fd                	jmp    24c2 <preempt+0x37>
+      ;
+
+  pipe(pfds);
+    24c5:	83 ec 0c             	sub    $0xc,%esp
+    24c8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    24cb:	50                   	push   %eax
+    24cc:	e8 23 42 00 00       	call   66f4 <pipe>
+    24d1:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    24d4:	e8 03 42 00 00       	call   66dc <fork>
+    24d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+    24dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    24e0:	75 4e                	jne    2530 <preempt+0xa5>
+    close(pfds[0]);
+    24e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    24e5:	83 ec 0c             	sub    $0xc,%esp
+    24e8:	50                   	push   %eax
+    24e9:	e8 1e 42 00 00       	call   670c <close>
+    24ee:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+    24f1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    24f4:	83 ec 04             	sub    $0x4,%esp
+    24f7:	6a 01                	push   $0x1
+    24f9:	68 c4 78 00 00       	push   $0x78c4
+    24fe:	50                   	push   %eax
+    24ff:	e8 00 42 00 00       	call   6704 <write>
+    2504:	83 c4 10             	add    $0x10,%esp
+    2507:	83 f8 01             	cmp    $0x1,%eax
+    250a:	74 12                	je     251e <preempt+0x93>
+      printf(1, "preempt write error");
+    250c:	83 ec 08             	sub    $0x8,%esp
+    250f:	68 c6 78 00 00       	push   $0x78c6
+    2514:	6a 01                	push   $0x1
+    2516:	e8 a5 43 00 00       	call   68c0 <printf>
+    251b:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+    251e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2521:	83 ec 0c             	sub    $0xc,%esp
+    2524:	50                   	push   %eax
+    2525:	e8 e2 41 00 00       	call   670c <close>
+    252a:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    252d:	90                   	nop
+    252e:	eb fd                	jmp    252d <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+    2530:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2533:	83 ec 0c             	sub    $0xc,%esp
+    2536:	50                   	push   %eax
+    2537:	e8 d0 41 00 00       	call   670c <close>
+    253c:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    253f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2542:	83 ec 04             	sub    $0x4,%esp
+    2545:	68 00 20 00 00       	push   $0x2000
+    254a:	68 20 9a 00 00       	push   $0x9a20
+    254f:	50                   	push   %eax
+    2550:	e8 a7 41 00 00       	call   66fc <read>
+    2555:	83 c4 10             	add    $0x10,%esp
+    2558:	83 f8 01             	cmp    $0x1,%eax
+    255b:	74 14                	je     2571 <preempt+0xe6>
+    printf(1, "preempt read error");
+    255d:	83 ec 08             	sub    $0x8,%esp
+    2560:	68 da 78 00 00       	push   $0x78da
+    2565:	6a 01                	push   $0x1
+    2567:	e8 54 43 00 00       	call   68c0 <printf>
+    256c:	83 c4 10             	add    $0x10,%esp
+    256f:	eb 7e                	jmp    25ef <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+    2571:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2574:	83 ec 0c             	sub    $0xc,%esp
+    2577:	50                   	push   %eax
+    2578:	e8 8f 41 00 00       	call   670c <close>
+    257d:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+    2580:	83 ec 08             	sub    $0x8,%esp
+    2583:	68 ed 78 00 00       	push   $0x78ed
+    2588:	6a 01                	push   $0x1
+    258a:	e8 31 43 00 00       	call   68c0 <printf>
+    258f:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+    2592:	83 ec 0c             	sub    $0xc,%esp
+    2595:	ff 75 f4             	push   -0xc(%ebp)
+    2598:	e8 77 41 00 00       	call   6714 <kill>
+    259d:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+    25a0:	83 ec 0c             	sub    $0xc,%esp
+    25a3:	ff 75 f0             	push   -0x10(%ebp)
+    25a6:	e8 69 41 00 00       	call   6714 <kill>
+    25ab:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+    25ae:	83 ec 0c             	sub    $0xc,%esp
+    25b1:	ff 75 ec             	push   -0x14(%ebp)
+    25b4:	e8 5b 41 00 00       	call   6714 <kill>
+    25b9:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+    25bc:	83 ec 08             	sub    $0x8,%esp
+    25bf:	68 f6 78 00 00       	push   $0x78f6
+    25c4:	6a 01                	push   $0x1
+    25c6:	e8 f5 42 00 00       	call   68c0 <printf>
+    25cb:	83 c4 10             	add    $0x10,%esp
+  wait();
+    25ce:	e8 19 41 00 00       	call   66ec <wait>
+  wait();
+    25d3:	e8 14 41 00 00       	call   66ec <wait>
+  wait();
+    25d8:	e8 0f 41 00 00       	call   66ec <wait>
+  printf(1, "preempt ok\n");
+    25dd:	83 ec 08             	sub    $0x8,%esp
+    25e0:	68 ff 78 00 00       	push   $0x78ff
+    25e5:	6a 01                	push   $0x1
+    25e7:	e8 d4 42 00 00       	call   68c0 <printf>
+    25ec:	83 c4 10             	add    $0x10,%esp
+}
+    25ef:	c9                   	leave
+    25f0:	c3                   	ret
+
+000025f1 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+    25f1:	55                   	push   %ebp
+    25f2:	89 e5                	mov    %esp,%ebp
+    25f4:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    25f7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    25fe:	eb 4f                	jmp    264f <exitwait+0x5e>
+    pid = fork();
+    2600:	e8 d7 40 00 00       	call   66dc <fork>
+    2605:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+    2608:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    260c:	79 14                	jns    2622 <exitwait+0x31>
+      printf(1, "fork failed\n");
+    260e:	83 ec 08             	sub    $0x8,%esp
+    2611:	68 19 6d 00 00       	push   $0x6d19
+    2616:	6a 01                	push   $0x1
+    2618:	e8 a3 42 00 00       	call   68c0 <printf>
+    261d:	83 c4 10             	add    $0x10,%esp
+      return;
+    2620:	eb 45                	jmp    2667 <exitwait+0x76>
+    }
+    if(pid){
+    2622:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2626:	74 1e                	je     2646 <exitwait+0x55>
+      if(wait() != pid){
+    2628:	e8 bf 40 00 00       	call   66ec <wait>
+    262d:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    2630:	74 19                	je     264b <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+    2632:	83 ec 08             	sub    $0x8,%esp
+    2635:	68 0b 79 00 00       	push   $0x790b
+    263a:	6a 01                	push   $0x1
+    263c:	e8 7f 42 00 00       	call   68c0 <printf>
+    2641:	83 c4 10             	add    $0x10,%esp
+        return;
+    2644:	eb 21                	jmp    2667 <exitwait+0x76>
+      }
+    } else {
+      exit();
+    2646:	e8 99 40 00 00       	call   66e4 <exit>
+  for(i = 0; i < 100; i++){
+    264b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    264f:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    2653:	7e ab                	jle    2600 <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+    2655:	83 ec 08             	sub    $0x8,%esp
+    2658:	68 1b 79 00 00       	push   $0x791b
+    265d:	6a 01                	push   $0x1
+    265f:	e8 5c 42 00 00       	call   68c0 <printf>
+    2664:	83 c4 10             	add    $0x10,%esp
+}
+    2667:	c9                   	leave
+    2668:	c3                   	ret
+
+00002669 <clonechild>:
+// threads created by clone() share memory with their creator
+int clonevar;
+
+void
+clonechild(void *arg)
+{
+    2669:	55                   	push   %ebp
+    266a:	89 e5                	mov    %esp,%ebp
+    266c:	83 ec 08             	sub    $0x8,%esp
+  clonevar = (int)arg;
+    266f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2672:	a3 24 ba 00 00       	mov    %eax,0xba24
+  sbrk(4096);
+    2677:	83 ec 0c             	sub    $0xc,%esp
+    267a:	68 00 10 00 00       	push   $0x1000
+    267f:	e8 e8 40 00 00       	call   676c <sbrk>
+    2684:	83 c4 10             	add    $0x10,%esp
+  exit();
+    2687:	e8 58 40 00 00       	call   66e4 <exit>
+
+0000268c <cloneshrink>:
+}
+
+// shrinks memory while its creator is blocked in join()
+void
+cloneshrink(void *arg)
+{
+    268c:	55                   	push   %ebp
+    268d:	89 e5                	mov    %esp,%ebp
+    268f:	83 ec 08             	sub    $0x8,%esp
+  sbrk(-4096);
+    2692:	83 ec 0c             	sub    $0xc,%esp
+    2695:	68 00 f0 ff ff       	push   $0xfffff000
+    269a:	e8 cd 40 00 00       	call   676c <sbrk>
+    269f:	83 c4 10             	add    $0x10,%esp
+  exit();
+    26a2:	e8 3d 40 00 00       	call   66e4 <exit>
+
+000026a7 <clonetest>:
+}
+
+void
+clonetest(void)
+{
+    26a7:	55                   	push   %ebp
+    26a8:	89 e5                	mov    %esp,%ebp
+    26aa:	83 ec 28             	sub    $0x28,%esp
+  char *p, *stack, *oldbrk;
+  void *ustack;
+  int pid;
+
+  printf(1, "clone test\n");
+    26ad:	83 ec 08             	sub    $0x8,%esp
+    26b0:	68 28 79 00 00       	push   $0x7928
+    26b5:	6a 01                	push   $0x1
+    26b7:	e8 04 42 00 00       	call   68c0 <printf>
+    26bc:	83 c4 10             	add    $0x10,%esp
+  p = sbrk(0);
+    26bf:	83 ec 0c             	sub    $0xc,%esp
+    26c2:	6a 00                	push   $0x0
+    26c4:	e8 a3 40 00 00       	call   676c <sbrk>
+    26c9:	83 c4 10             	add    $0x10,%esp
+    26cc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((uint)p % 4096)
+    26cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    26d2:	25 ff 0f 00 00       	and    $0xfff,%eax
+    26d7:	85 c0                	test   %eax,%eax
+    26d9:	74 1d                	je     26f8 <clonetest+0x51>
+    sbrk(4096 - (uint)p % 4096);
+    26db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    26de:	25 ff 0f 00 00       	and    $0xfff,%eax
+    26e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+    26e8:	29 c2                	sub    %eax,%edx
+    26ea:	89 d0                	mov    %edx,%eax
+    26ec:	83 ec 0c             	sub    $0xc,%esp
+    26ef:	50                   	push   %eax
+    26f0:	e8 77 40 00 00       	call   676c <sbrk>
+    26f5:	83 c4 10             	add    $0x10,%esp
+  stack = sbrk(4096);
+    26f8:	83 ec 0c             	sub    $0xc,%esp
+    26fb:	68 00 10 00 00       	push   $0x1000
+    2700:	e8 67 40 00 00       	call   676c <sbrk>
+    2705:	83 c4 10             	add    $0x10,%esp
+    2708:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  oldbrk = sbrk(0);
+    270b:	83 ec 0c             	sub    $0xc,%esp
+    270e:	6a 00                	push   $0x0
+    2710:	e8 57 40 00 00       	call   676c <sbrk>
+    2715:	83 c4 10             	add    $0x10,%esp
+    2718:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  clonevar = 0;
+    271b:	c7 05 24 ba 00 00 00 	movl   $0x0,0xba24
+    2722:	00 00 00 
+  pid = clone(clonechild, (void*)42, stack);
+    2725:	83 ec 04             	sub    $0x4,%esp
+    2728:	ff 75 f0             	push   -0x10(%ebp)
+    272b:	6a 2a                	push   $0x2a
+    272d:	68 69 26 00 00       	push   $0x2669
+    2732:	e8 4d 40 00 00       	call   6784 <clone>
+    2737:	83 c4 10             	add    $0x10,%esp
+    273a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    273d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2741:	79 17                	jns    275a <clonetest+0xb3>
+    printf(1, "clone failed\n");
+    2743:	83 ec 08             	sub    $0x8,%esp
+    2746:	68 34 79 00 00       	push   $0x7934
+    274b:	6a 01                	push   $0x1
+    274d:	e8 6e 41 00 00       	call   68c0 <printf>
+    2752:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2755:	e8 8a 3f 00 00       	call   66e4 <exit>
+  }
+  if(join(&ustack) != pid || ustack != stack){
+    275a:	83 ec 0c             	sub    $0xc,%esp
+    275d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    2760:	50                   	push   %eax
+    2761:	e8 26 40 00 00       	call   678c <join>
+    2766:	83 c4 10             	add    $0x10,%esp
+    2769:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+    276c:	75 08                	jne    2776 <clonetest+0xcf>
+    276e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2771:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    2774:	74 17                	je     278d <clonetest+0xe6>
+    printf(1, "join wrong pid or stack\n");
+    2776:	83 ec 08             	sub    $0x8,%esp
+    2779:	68 42 79 00 00       	push   $0x7942
+    277e:	6a 01                	push   $0x1
+    2780:	e8 3b 41 00 00       	call   68c0 <printf>
+    2785:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2788:	e8 57 3f 00 00       	call   66e4 <exit>
+  }
+  if(clonevar != 42){
+    278d:	a1 24 ba 00 00       	mov    0xba24,%eax
+    2792:	83 f8 2a             	cmp    $0x2a,%eax
+    2795:	74 17                	je     27ae <clonetest+0x107>
+    printf(1, "clone child did not share memory\n");
+    2797:	83 ec 08             	sub    $0x8,%esp
+    279a:	68 5c 79 00 00       	push   $0x795c
+    279f:	6a 01                	push   $0x1
+    27a1:	e8 1a 41 00 00       	call   68c0 <printf>
+    27a6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    27a9:	e8 36 3f 00 00       	call   66e4 <exit>
+  }
+  if(sbrk(0) != oldbrk + 4096){
+    27ae:	83 ec 0c             	sub    $0xc,%esp
+    27b1:	6a 00                	push   $0x0
+    27b3:	e8 b4 3f 00 00       	call   676c <sbrk>
+    27b8:	83 c4 10             	add    $0x10,%esp
+    27bb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    27be:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    27c4:	39 d0                	cmp    %edx,%eax
+    27c6:	74 17                	je     27df <clonetest+0x138>
+    printf(1, "clone child sbrk not shared\n");
+    27c8:	83 ec 08             	sub    $0x8,%esp
+    27cb:	68 7e 79 00 00       	push   $0x797e
+    27d0:	6a 01                	push   $0x1
+    27d2:	e8 e9 40 00 00       	call   68c0 <printf>
+    27d7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    27da:	e8 05 3f 00 00       	call   66e4 <exit>
+  }
+  oldbrk[0] = 1;
+    27df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    27e2:	c6 00 01             	movb   $0x1,(%eax)
+  if(clone(cloneshrink, 0, stack) < 0 || join(&ustack) < 0){
+    27e5:	83 ec 04             	sub    $0x4,%esp
+    27e8:	ff 75 f0             	push   -0x10(%ebp)
+    27eb:	6a 00                	push   $0x0
+    27ed:	68 8c 26 00 00       	push   $0x268c
+    27f2:	e8 8d 3f 00 00       	call   6784 <clone>
+    27f7:	83 c4 10             	add    $0x10,%esp
+    27fa:	85 c0                	test   %eax,%eax
+    27fc:	78 13                	js     2811 <clonetest+0x16a>
+    27fe:	83 ec 0c             	sub    $0xc,%esp
+    2801:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    2804:	50                   	push   %eax
+    2805:	e8 82 3f 00 00       	call   678c <join>
+    280a:	83 c4 10             	add    $0x10,%esp
+    280d:	85 c0                	test   %eax,%eax
+    280f:	79 17                	jns    2828 <clonetest+0x181>
+    printf(1, "clone shrink failed\n");
+    2811:	83 ec 08             	sub    $0x8,%esp
+    2814:	68 9b 79 00 00       	push   $0x799b
+    2819:	6a 01                	push   $0x1
+    281b:	e8 a0 40 00 00       	call   68c0 <printf>
+    2820:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2823:	e8 bc 3e 00 00       	call   66e4 <exit>
+  }
+  if(sbrk(0) != oldbrk){
+    2828:	83 ec 0c             	sub    $0xc,%esp
+    282b:	6a 00                	push   $0x0
+    282d:	e8 3a 3f 00 00       	call   676c <sbrk>
+    2832:	83 c4 10             	add    $0x10,%esp
+    2835:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    2838:	74 17                	je     2851 <clonetest+0x1aa>
+    printf(1, "clone child sbrk(-4096) not shared\n");
+    283a:	83 ec 08             	sub    $0x8,%esp
+    283d:	68 b0 79 00 00       	push   $0x79b0
+    2842:	6a 01                	push   $0x1
+    2844:	e8 77 40 00 00       	call   68c0 <printf>
+    2849:	83 c4 10             	add    $0x10,%esp
+    exit();
+    284c:	e8 93 3e 00 00       	call   66e4 <exit>
+  }
+  if(sbrk(4096) != oldbrk || oldbrk[0] != 0){
+    2851:	83 ec 0c             	sub    $0xc,%esp
+    2854:	68 00 10 00 00       	push   $0x1000
+    2859:	e8 0e 3f 00 00       	call   676c <sbrk>
+    285e:	83 c4 10             	add    $0x10,%esp
+    2861:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    2864:	75 0a                	jne    2870 <clonetest+0x1c9>
+    2866:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2869:	0f b6 00             	movzbl (%eax),%eax
+    286c:	84 c0                	test   %al,%al
+    286e:	74 17                	je     2887 <clonetest+0x1e0>
+    printf(1, "regrown memory not zeroed\n");
+    2870:	83 ec 08             	sub    $0x8,%esp
+    2873:	68 d4 79 00 00       	push   $0x79d4
+    2878:	6a 01                	push   $0x1
+    287a:	e8 41 40 00 00       	call   68c0 <printf>
+    287f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2882:	e8 5d 3e 00 00       	call   66e4 <exit>
+  }
+  sbrk(-4096);
+    2887:	83 ec 0c             	sub    $0xc,%esp
+    288a:	68 00 f0 ff ff       	push   $0xfffff000
+    288f:	e8 d8 3e 00 00       	call   676c <sbrk>
+    2894:	83 c4 10             	add    $0x10,%esp
+  if(join(&ustack) != -1 || wait() != -1){
+    2897:	83 ec 0c             	sub    $0xc,%esp
+    289a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    289d:	50                   	push   %eax
+    289e:	e8 e9 3e 00 00       	call   678c <join>
+    28a3:	83 c4 10             	add    $0x10,%esp
+    28a6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    28a9:	75 0a                	jne    28b5 <clonetest+0x20e>
+    28ab:	e8 3c 3e 00 00       	call   66ec <wait>
+    28b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    28b3:	74 17                	je     28cc <clonetest+0x225>
+    printf(1, "join got too many\n");
+    28b5:	83 ec 08             	sub    $0x8,%esp
+    28b8:	68 ef 79 00 00       	push   $0x79ef
+    28bd:	6a 01                	push   $0x1
+    28bf:	e8 fc 3f 00 00       	call   68c0 <printf>
+    28c4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    28c7:	e8 18 3e 00 00       	call   66e4 <exit>
+  }
+  printf(1, "clone test ok\n");
+    28cc:	83 ec 08             	sub    $0x8,%esp
+    28cf:	68 02 7a 00 00       	push   $0x7a02
+    28d4:	6a 01                	push   $0x1
+    28d6:	e8 e5 3f 00 00       	call   68c0 <printf>
+    28db:	83 c4 10             	add    $0x10,%esp
+}
+    28de:	90                   	nop
+    28df:	c9                   	leave
+    28e0:	c3                   	ret
+
+000028e1 <futexlock>:
+uint futexmu;
+int futexcount;
+
+void
+futexlock(uint *m)
+{
+    28e1:	55                   	push   %ebp
+    28e2:	89 e5                	mov    %esp,%ebp
+    28e4:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(m, 1) == 0)
+    28e7:	6a 01                	push   $0x1
+    28e9:	ff 75 08             	push   0x8(%ebp)
+    28ec:	e8 0f d7 ff ff       	call   0 <xchg>
+    28f1:	83 c4 08             	add    $0x8,%esp
+    28f4:	85 c0                	test   %eax,%eax
+    28f6:	74 28                	je     2920 <futexlock+0x3f>
+    return;
+  while(xchg(m, 2) != 0)
+    28f8:	eb 10                	jmp    290a <futexlock+0x29>
+    futex_wait(m, 2);
+    28fa:	83 ec 08             	sub    $0x8,%esp
+    28fd:	6a 02                	push   $0x2
+    28ff:	ff 75 08             	push   0x8(%ebp)
+    2902:	e8 8d 3e 00 00       	call   6794 <futex_wait>
+    2907:	83 c4 10             	add    $0x10,%esp
+  while(xchg(m, 2) != 0)
+    290a:	83 ec 08             	sub    $0x8,%esp
+    290d:	6a 02                	push   $0x2
+    290f:	ff 75 08             	push   0x8(%ebp)
+    2912:	e8 e9 d6 ff ff       	call   0 <xchg>
+    2917:	83 c4 10             	add    $0x10,%esp
+    291a:	85 c0                	test   %eax,%eax
+    291c:	75 dc                	jne    28fa <futexlock+0x19>
+    291e:	eb 01                	jmp    2921 <futexlock+0x40>
+    return;
+    2920:	90                   	nop
+}
+    2921:	c9                   	leave
+    2922:	c3                   	ret
+
+00002923 <futexunlock>:
+
+void
+futexunlock(uint *m)
+{
+    2923:	55                   	push   %ebp
+    2924:	89 e5                	mov    %esp,%ebp
+    2926:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(m, 0) == 2)
+    2929:	6a 00                	push   $0x0
+    292b:	ff 75 08             	push   0x8(%ebp)
+    292e:	e8 cd d6 ff ff       	call   0 <xchg>
+    2933:	83 c4 08             	add    $0x8,%esp
+    2936:	83 f8 02             	cmp    $0x2,%eax
+    2939:	75 10                	jne    294b <futexunlock+0x28>
+    futex_wake(m, 1);
+    293b:	83 ec 08             	sub    $0x8,%esp
+    293e:	6a 01                	push   $0x1
+    2940:	ff 75 08             	push   0x8(%ebp)
+    2943:	e8 54 3e 00 00       	call   679c <futex_wake>
+    2948:	83 c4 10             	add    $0x10,%esp
+}
+    294b:	90                   	nop
+    294c:	c9                   	leave
+    294d:	c3                   	ret
+
+0000294e <futexchild>:
+
+void
+futexchild(void *arg)
+{
+    294e:	55                   	push   %ebp
+    294f:	89 e5                	mov    %esp,%ebp
+    2951:	83 ec 18             	sub    $0x18,%esp
+  int i, n;
+
+  for(i = 0; i < 500; i++){
+    2954:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    295b:	eb 67                	jmp    29c4 <futexchild+0x76>
+    futexlock(&futexmu);
+    295d:	83 ec 0c             	sub    $0xc,%esp
+    2960:	68 28 ba 00 00       	push   $0xba28
+    2965:	e8 77 ff ff ff       	call   28e1 <futexlock>
+    296a:	83 c4 10             	add    $0x10,%esp
+    n = futexcount;
+    296d:	a1 2c ba 00 00       	mov    0xba2c,%eax
+    2972:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(i % 50 == 0)
+    2975:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    2978:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    297d:	89 c8                	mov    %ecx,%eax
+    297f:	f7 ea                	imul   %edx
+    2981:	89 d0                	mov    %edx,%eax
+    2983:	c1 f8 04             	sar    $0x4,%eax
+    2986:	89 ca                	mov    %ecx,%edx
+    2988:	c1 fa 1f             	sar    $0x1f,%edx
+    298b:	29 d0                	sub    %edx,%eax
+    298d:	6b d0 32             	imul   $0x32,%eax,%edx
+    2990:	89 c8                	mov    %ecx,%eax
+    2992:	29 d0                	sub    %edx,%eax
+    2994:	85 c0                	test   %eax,%eax
+    2996:	75 0d                	jne    29a5 <futexchild+0x57>
+      sleep(1);
+    2998:	83 ec 0c             	sub    $0xc,%esp
+    299b:	6a 01                	push   $0x1
+    299d:	e8 d2 3d 00 00       	call   6774 <sleep>
+    29a2:	83 c4 10             	add    $0x10,%esp
+    futexcount = n + 1;
+    29a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    29a8:	83 c0 01             	add    $0x1,%eax
+    29ab:	a3 2c ba 00 00       	mov    %eax,0xba2c
+    futexunlock(&futexmu);
+    29b0:	83 ec 0c             	sub    $0xc,%esp
+    29b3:	68 28 ba 00 00       	push   $0xba28
+    29b8:	e8 66 ff ff ff       	call   2923 <futexunlock>
+    29bd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    29c0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    29c4:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    29cb:	7e 90                	jle    295d <futexchild+0xf>
+  }
+  exit();
+    29cd:	e8 12 3d 00 00       	call   66e4 <exit>
+
+000029d2 <futextest>:
+}
+
+void
+futextest(void)
+{
+    29d2:	55                   	push   %ebp
+    29d3:	89 e5                	mov    %esp,%ebp
+    29d5:	83 ec 18             	sub    $0x18,%esp
+  char *p, *stacks;
+  void *ustack;
+  int i;
+
+  printf(1, "futex test\n");
+    29d8:	83 ec 08             	sub    $0x8,%esp
+    29db:	68 11 7a 00 00       	push   $0x7a11
+    29e0:	6a 01                	push   $0x1
+    29e2:	e8 d9 3e 00 00       	call   68c0 <printf>
+    29e7:	83 c4 10             	add    $0x10,%esp
+  p = sbrk(0);
+    29ea:	83 ec 0c             	sub    $0xc,%esp
+    29ed:	6a 00                	push   $0x0
+    29ef:	e8 78 3d 00 00       	call   676c <sbrk>
+    29f4:	83 c4 10             	add    $0x10,%esp
+    29f7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((uint)p % 4096)
+    29fa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    29fd:	25 ff 0f 00 00       	and    $0xfff,%eax
+    2a02:	85 c0                	test   %eax,%eax
+    2a04:	74 1d                	je     2a23 <futextest+0x51>
+    sbrk(4096 - (uint)p % 4096);
+    2a06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2a09:	25 ff 0f 00 00       	and    $0xfff,%eax
+    2a0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+    2a13:	29 c2                	sub    %eax,%edx
+    2a15:	89 d0                	mov    %edx,%eax
+    2a17:	83 ec 0c             	sub    $0xc,%esp
+    2a1a:	50                   	push   %eax
+    2a1b:	e8 4c 3d 00 00       	call   676c <sbrk>
+    2a20:	83 c4 10             	add    $0x10,%esp
+  stacks = sbrk(4*4096);
+    2a23:	83 ec 0c             	sub    $0xc,%esp
+    2a26:	68 00 40 00 00       	push   $0x4000
+    2a2b:	e8 3c 3d 00 00       	call   676c <sbrk>
+    2a30:	83 c4 10             	add    $0x10,%esp
+    2a33:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  futexmu = 0;
+    2a36:	c7 05 28 ba 00 00 00 	movl   $0x0,0xba28
+    2a3d:	00 00 00 
+  futexcount = 0;
+    2a40:	c7 05 2c ba 00 00 00 	movl   $0x0,0xba2c
+    2a47:	00 00 00 
+  for(i = 0; i < 4; i++){
+    2a4a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2a51:	eb 3f                	jmp    2a92 <futextest+0xc0>
+    if(clone(futexchild, 0, stacks + i*4096) < 0){
+    2a53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a56:	c1 e0 0c             	shl    $0xc,%eax
+    2a59:	89 c2                	mov    %eax,%edx
+    2a5b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2a5e:	01 d0                	add    %edx,%eax
+    2a60:	83 ec 04             	sub    $0x4,%esp
+    2a63:	50                   	push   %eax
+    2a64:	6a 00                	push   $0x0
+    2a66:	68 4e 29 00 00       	push   $0x294e
+    2a6b:	e8 14 3d 00 00       	call   6784 <clone>
+    2a70:	83 c4 10             	add    $0x10,%esp
+    2a73:	85 c0                	test   %eax,%eax
+    2a75:	79 17                	jns    2a8e <futextest+0xbc>
+      printf(1, "futex clone failed\n");
+    2a77:	83 ec 08             	sub    $0x8,%esp
+    2a7a:	68 1d 7a 00 00       	push   $0x7a1d
+    2a7f:	6a 01                	push   $0x1
+    2a81:	e8 3a 3e 00 00       	call   68c0 <printf>
+    2a86:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2a89:	e8 56 3c 00 00       	call   66e4 <exit>
+  for(i = 0; i < 4; i++){
+    2a8e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2a92:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+    2a96:	7e bb                	jle    2a53 <futextest+0x81>
+    }
+  }
+  for(i = 0; i < 4; i++){
+    2a98:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2a9f:	eb 2e                	jmp    2acf <futextest+0xfd>
+    if(join(&ustack) < 0){
+    2aa1:	83 ec 0c             	sub    $0xc,%esp
+    2aa4:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    2aa7:	50                   	push   %eax
+    2aa8:	e8 df 3c 00 00       	call   678c <join>
+    2aad:	83 c4 10             	add    $0x10,%esp
+    2ab0:	85 c0                	test   %eax,%eax
+    2ab2:	79 17                	jns    2acb <futextest+0xf9>
+      printf(1, "futex join failed\n");
+    2ab4:	83 ec 08             	sub    $0x8,%esp
+    2ab7:	68 31 7a 00 00       	push   $0x7a31
+    2abc:	6a 01                	push   $0x1
+    2abe:	e8 fd 3d 00 00       	call   68c0 <printf>
+    2ac3:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2ac6:	e8 19 3c 00 00       	call   66e4 <exit>
+  for(i = 0; i < 4; i++){
+    2acb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2acf:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+    2ad3:	7e cc                	jle    2aa1 <futextest+0xcf>
+    }
+  }
+  if(futexcount != 4*500){
+    2ad5:	a1 2c ba 00 00       	mov    0xba2c,%eax
+    2ada:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    2adf:	74 1f                	je     2b00 <futextest+0x12e>
+    printf(1, "futex count %d, expected %d\n", futexcount, 4*500);
+    2ae1:	a1 2c ba 00 00       	mov    0xba2c,%eax
+    2ae6:	68 d0 07 00 00       	push   $0x7d0
+    2aeb:	50                   	push   %eax
+    2aec:	68 44 7a 00 00       	push   $0x7a44
+    2af1:	6a 01                	push   $0x1
+    2af3:	e8 c8 3d 00 00       	call   68c0 <printf>
+    2af8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2afb:	e8 e4 3b 00 00       	call   66e4 <exit>
+  }
+  futexmu = 5;
+    2b00:	c7 05 28 ba 00 00 05 	movl   $0x5,0xba28
+    2b07:	00 00 00 
+  if(futex_wait(&futexmu, 6) != -1){
+    2b0a:	83 ec 08             	sub    $0x8,%esp
+    2b0d:	6a 06                	push   $0x6
+    2b0f:	68 28 ba 00 00       	push   $0xba28
+    2b14:	e8 7b 3c 00 00       	call   6794 <futex_wait>
+    2b19:	83 c4 10             	add    $0x10,%esp
+    2b1c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b1f:	74 17                	je     2b38 <futextest+0x166>
+    printf(1, "futex_wait did not check value\n");
+    2b21:	83 ec 08             	sub    $0x8,%esp
+    2b24:	68 64 7a 00 00       	push   $0x7a64
+    2b29:	6a 01                	push   $0x1
+    2b2b:	e8 90 3d 00 00       	call   68c0 <printf>
+    2b30:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b33:	e8 ac 3b 00 00       	call   66e4 <exit>
+  }
+  printf(1, "futex test ok\n");
+    2b38:	83 ec 08             	sub    $0x8,%esp
+    2b3b:	68 84 7a 00 00       	push   $0x7a84
+    2b40:	6a 01                	push   $0x1
+    2b42:	e8 79 3d 00 00       	call   68c0 <printf>
+    2b47:	83 c4 10             	add    $0x10,%esp
+}
+    2b4a:	90                   	nop
+    2b4b:	c9                   	leave
+    2b4c:	c3                   	ret
+
+00002b4d <affinitytest>:
+
+// pin to one CPU and back; a child inherits the mask.
+void
+affinitytest(void)
+{
+    2b4d:	55                   	push   %ebp
+    2b4e:	89 e5                	mov    %esp,%ebp
+    2b50:	83 ec 18             	sub    $0x18,%esp
+  int all, pid;
+
+  printf(1, "affinity test\n");
+    2b53:	83 ec 08             	sub    $0x8,%esp
+    2b56:	68 93 7a 00 00       	push   $0x7a93
+    2b5b:	6a 01                	push   $0x1
+    2b5d:	e8 5e 3d 00 00       	call   68c0 <printf>
+    2b62:	83 c4 10             	add    $0x10,%esp
+  all = getaffinity(0);
+    2b65:	83 ec 0c             	sub    $0xc,%esp
+    2b68:	6a 00                	push   $0x0
+    2b6a:	e8 3d 3c 00 00       	call   67ac <getaffinity>
+    2b6f:	83 c4 10             	add    $0x10,%esp
+    2b72:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(all == 0 || all == -1){
+    2b75:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2b79:	74 06                	je     2b81 <affinitytest+0x34>
+    2b7b:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    2b7f:	75 17                	jne    2b98 <affinitytest+0x4b>
+    printf(1, "getaffinity failed\n");
+    2b81:	83 ec 08             	sub    $0x8,%esp
+    2b84:	68 a2 7a 00 00       	push   $0x7aa2
+    2b89:	6a 01                	push   $0x1
+    2b8b:	e8 30 3d 00 00       	call   68c0 <printf>
+    2b90:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b93:	e8 4c 3b 00 00       	call   66e4 <exit>
+  }
+  if(setaffinity(0, 0) != -1){
+    2b98:	83 ec 08             	sub    $0x8,%esp
+    2b9b:	6a 00                	push   $0x0
+    2b9d:	6a 00                	push   $0x0
+    2b9f:	e8 00 3c 00 00       	call   67a4 <setaffinity>
+    2ba4:	83 c4 10             	add    $0x10,%esp
+    2ba7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2baa:	74 17                	je     2bc3 <affinitytest+0x76>
+    printf(1, "setaffinity accepted empty mask\n");
+    2bac:	83 ec 08             	sub    $0x8,%esp
+    2baf:	68 b8 7a 00 00       	push   $0x7ab8
+    2bb4:	6a 01                	push   $0x1
+    2bb6:	e8 05 3d 00 00       	call   68c0 <printf>
+    2bbb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2bbe:	e8 21 3b 00 00       	call   66e4 <exit>
+  }
+  if(setaffinity(0, 1) < 0 || getaffinity(getpid()) != 1){
+    2bc3:	83 ec 08             	sub    $0x8,%esp
+    2bc6:	6a 01                	push   $0x1
+    2bc8:	6a 00                	push   $0x0
+    2bca:	e8 d5 3b 00 00       	call   67a4 <setaffinity>
+    2bcf:	83 c4 10             	add    $0x10,%esp
+    2bd2:	85 c0                	test   %eax,%eax
+    2bd4:	78 16                	js     2bec <affinitytest+0x9f>
+    2bd6:	e8 89 3b 00 00       	call   6764 <getpid>
+    2bdb:	83 ec 0c             	sub    $0xc,%esp
+    2bde:	50                   	push   %eax
+    2bdf:	e8 c8 3b 00 00       	call   67ac <getaffinity>
+    2be4:	83 c4 10             	add    $0x10,%esp
+    2be7:	83 f8 01             	cmp    $0x1,%eax
+    2bea:	74 17                	je     2c03 <affinitytest+0xb6>
+    printf(1, "setaffinity failed\n");
+    2bec:	83 ec 08             	sub    $0x8,%esp
+    2bef:	68 d9 7a 00 00       	push   $0x7ad9
+    2bf4:	6a 01                	push   $0x1
+    2bf6:	e8 c5 3c 00 00       	call   68c0 <printf>
+    2bfb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2bfe:	e8 e1 3a 00 00       	call   66e4 <exit>
+  }
+  pid = fork();
+    2c03:	e8 d4 3a 00 00       	call   66dc <fork>
+    2c08:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    2c0b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2c0f:	75 29                	jne    2c3a <affinitytest+0xed>
+    if(getaffinity(0) != 1)
+    2c11:	83 ec 0c             	sub    $0xc,%esp
+    2c14:	6a 00                	push   $0x0
+    2c16:	e8 91 3b 00 00       	call   67ac <getaffinity>
+    2c1b:	83 c4 10             	add    $0x10,%esp
+    2c1e:	83 f8 01             	cmp    $0x1,%eax
+    2c21:	74 12                	je     2c35 <affinitytest+0xe8>
+      printf(1, "affinity not inherited\n");
+    2c23:	83 ec 08             	sub    $0x8,%esp
+    2c26:	68 ed 7a 00 00       	push   $0x7aed
+    2c2b:	6a 01                	push   $0x1
+    2c2d:	e8 8e 3c 00 00       	call   68c0 <printf>
+    2c32:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c35:	e8 aa 3a 00 00       	call   66e4 <exit>
+  }
+  wait();
+    2c3a:	e8 ad 3a 00 00       	call   66ec <wait>
+  if(setaffinity(0, all) < 0){
+    2c3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2c42:	83 ec 08             	sub    $0x8,%esp
+    2c45:	50                   	push   %eax
+    2c46:	6a 00                	push   $0x0
+    2c48:	e8 57 3b 00 00       	call   67a4 <setaffinity>
+    2c4d:	83 c4 10             	add    $0x10,%esp
+    2c50:	85 c0                	test   %eax,%eax
+    2c52:	79 17                	jns    2c6b <affinitytest+0x11e>
+    printf(1, "setaffinity restore failed\n");
+    2c54:	83 ec 08             	sub    $0x8,%esp
+    2c57:	68 05 7b 00 00       	push   $0x7b05
+    2c5c:	6a 01                	push   $0x1
+    2c5e:	e8 5d 3c 00 00       	call   68c0 <printf>
+    2c63:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c66:	e8 79 3a 00 00       	call   66e4 <exit>
+  }
+  printf(1, "affinity test ok\n");
+    2c6b:	83 ec 08             	sub    $0x8,%esp
+    2c6e:	68 21 7b 00 00       	push   $0x7b21
+    2c73:	6a 01                	push   $0x1
+    2c75:	e8 46 3c 00 00       	call   68c0 <printf>
+    2c7a:	83 c4 10             	add    $0x10,%esp
+}
+    2c7d:	90                   	nop
+    2c7e:	c9                   	leave
+    2c7f:	c3                   	ret
+
+00002c80 <rusagetest>:
+
+// a waited-for child's system calls show up in RUSAGE_CHILDREN.
+void
+rusagetest(void)
+{
+    2c80:	55                   	push   %ebp
+    2c81:	89 e5                	mov    %esp,%ebp
+    2c83:	83 ec 38             	sub    $0x38,%esp
+  struct rusage ru;
+  int fd;
+
+  printf(1, "rusage test\n");
+    2c86:	83 ec 08             	sub    $0x8,%esp
+    2c89:	68 33 7b 00 00       	push   $0x7b33
+    2c8e:	6a 01                	push   $0x1
+    2c90:	e8 2b 3c 00 00       	call   68c0 <printf>
+    2c95:	83 c4 10             	add    $0x10,%esp
+  if(fork() == 0){
+    2c98:	e8 3f 3a 00 00       	call   66dc <fork>
+    2c9d:	85 c0                	test   %eax,%eax
+    2c9f:	75 50                	jne    2cf1 <rusagetest+0x71>
+    // The flusher writes the block, but the child is charged.
+    fd = open("rusage", O_CREATE|O_RDWR);
+    2ca1:	83 ec 08             	sub    $0x8,%esp
+    2ca4:	68 02 02 00 00       	push   $0x202
+    2ca9:	68 40 7b 00 00       	push   $0x7b40
+    2cae:	e8 71 3a 00 00       	call   6724 <open>
+    2cb3:	83 c4 10             	add    $0x10,%esp
+    2cb6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    write(fd, "x", 1);
+    2cb9:	83 ec 04             	sub    $0x4,%esp
+    2cbc:	6a 01                	push   $0x1
+    2cbe:	68 c4 78 00 00       	push   $0x78c4
+    2cc3:	ff 75 f4             	push   -0xc(%ebp)
+    2cc6:	e8 39 3a 00 00       	call   6704 <write>
+    2ccb:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    2cce:	83 ec 0c             	sub    $0xc,%esp
+    2cd1:	ff 75 f4             	push   -0xc(%ebp)
+    2cd4:	e8 33 3a 00 00       	call   670c <close>
+    2cd9:	83 c4 10             	add    $0x10,%esp
+    unlink("rusage");
+    2cdc:	83 ec 0c             	sub    $0xc,%esp
+    2cdf:	68 40 7b 00 00       	push   $0x7b40
+    2ce4:	e8 4b 3a 00 00       	call   6734 <unlink>
+    2ce9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cec:	e8 f3 39 00 00       	call   66e4 <exit>
+  }
+  wait();
+    2cf1:	e8 f6 39 00 00       	call   66ec <wait>
+  if(getrusage(RUSAGE_CHILDREN, &ru) < 0 || ru.nsyscall < 2 ||
+    2cf6:	83 ec 08             	sub    $0x8,%esp
+    2cf9:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    2cfc:	50                   	push   %eax
+    2cfd:	6a ff                	push   $0xffffffff
+    2cff:	e8 b0 3a 00 00       	call   67b4 <getrusage>
+    2d04:	83 c4 10             	add    $0x10,%esp
+    2d07:	85 c0                	test   %eax,%eax
+    2d09:	78 0f                	js     2d1a <rusagetest+0x9a>
+    2d0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2d0e:	83 f8 01             	cmp    $0x1,%eax
+    2d11:	76 07                	jbe    2d1a <rusagetest+0x9a>
+     ru.oublock < 1){
+    2d13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  if(getrusage(RUSAGE_CHILDREN, &ru) < 0 || ru.nsyscall < 2 ||
+    2d16:	85 c0                	test   %eax,%eax
+    2d18:	75 17                	jne    2d31 <rusagetest+0xb1>
+    printf(1, "getrusage failed\n");
+    2d1a:	83 ec 08             	sub    $0x8,%esp
+    2d1d:	68 47 7b 00 00       	push   $0x7b47
+    2d22:	6a 01                	push   $0x1
+    2d24:	e8 97 3b 00 00       	call   68c0 <printf>
+    2d29:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d2c:	e8 b3 39 00 00       	call   66e4 <exit>
+  }
+  printf(1, "rusage test ok\n");
+    2d31:	83 ec 08             	sub    $0x8,%esp
+    2d34:	68 59 7b 00 00       	push   $0x7b59
+    2d39:	6a 01                	push   $0x1
+    2d3b:	e8 80 3b 00 00       	call   68c0 <printf>
+    2d40:	83 c4 10             	add    $0x10,%esp
+}
+    2d43:	90                   	nop
+    2d44:	c9                   	leave
+    2d45:	c3                   	ret
+
+00002d46 <lockstatsum>:
+struct lockstat lst[NLOCKSTAT];
+
+// Sum the counters of all lock classes after lockstat().
+static void
+lockstatsum(int reset, uint *acquires, uint *waits)
+{
+    2d46:	55                   	push   %ebp
+    2d47:	89 e5                	mov    %esp,%ebp
+    2d49:	83 ec 18             	sub    $0x18,%esp
+  int i, n;
+
+  n = lockstat(lst, NLOCKSTAT, reset);
+    2d4c:	83 ec 04             	sub    $0x4,%esp
+    2d4f:	ff 75 08             	push   0x8(%ebp)
+    2d52:	6a 20                	push   $0x20
+    2d54:	68 40 ba 00 00       	push   $0xba40
+    2d59:	e8 5e 3a 00 00       	call   67bc <lockstat>
+    2d5e:	83 c4 10             	add    $0x10,%esp
+    2d61:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(n <= 0 || n > NLOCKSTAT){
+    2d64:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2d68:	7e 06                	jle    2d70 <lockstatsum+0x2a>
+    2d6a:	83 7d f0 20          	cmpl   $0x20,-0x10(%ebp)
+    2d6e:	7e 1e                	jle    2d8e <lockstatsum+0x48>
+    printf(stdout, "lockstat failed: %d\n", n);
+    2d70:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2d75:	83 ec 04             	sub    $0x4,%esp
+    2d78:	ff 75 f0             	push   -0x10(%ebp)
+    2d7b:	68 69 7b 00 00       	push   $0x7b69
+    2d80:	50                   	push   %eax
+    2d81:	e8 3a 3b 00 00       	call   68c0 <printf>
+    2d86:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d89:	e8 56 39 00 00       	call   66e4 <exit>
+  }
+  *acquires = *waits = 0;
+    2d8e:	8b 45 10             	mov    0x10(%ebp),%eax
+    2d91:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    2d97:	8b 45 10             	mov    0x10(%ebp),%eax
+    2d9a:	8b 10                	mov    (%eax),%edx
+    2d9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2d9f:	89 10                	mov    %edx,(%eax)
+  for(i = 0; i < n; i++){
+    2da1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2da8:	eb 47                	jmp    2df1 <lockstatsum+0xab>
+    *acquires += lst[i].acquires;
+    2daa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2dad:	8b 10                	mov    (%eax),%edx
+    2daf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2db2:	6b c0 54             	imul   $0x54,%eax,%eax
+    2db5:	05 50 ba 00 00       	add    $0xba50,%eax
+    2dba:	8b 00                	mov    (%eax),%eax
+    2dbc:	01 c2                	add    %eax,%edx
+    2dbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2dc1:	89 10                	mov    %edx,(%eax)
+    *waits += lst[i].contended + lst[i].sleeps;
+    2dc3:	8b 45 10             	mov    0x10(%ebp),%eax
+    2dc6:	8b 00                	mov    (%eax),%eax
+    2dc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2dcb:	6b d2 54             	imul   $0x54,%edx,%edx
+    2dce:	81 c2 54 ba 00 00    	add    $0xba54,%edx
+    2dd4:	8b 0a                	mov    (%edx),%ecx
+    2dd6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2dd9:	6b d2 54             	imul   $0x54,%edx,%edx
+    2ddc:	81 c2 70 ba 00 00    	add    $0xba70,%edx
+    2de2:	8b 12                	mov    (%edx),%edx
+    2de4:	01 ca                	add    %ecx,%edx
+    2de6:	01 c2                	add    %eax,%edx
+    2de8:	8b 45 10             	mov    0x10(%ebp),%eax
+    2deb:	89 10                	mov    %edx,(%eax)
+  for(i = 0; i < n; i++){
+    2ded:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2df1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2df4:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    2df7:	7c b1                	jl     2daa <lockstatsum+0x64>
+  }
+}
+    2df9:	90                   	nop
+    2dfa:	90                   	nop
+    2dfb:	c9                   	leave
+    2dfc:	c3                   	ret
+
+00002dfd <lockstattest>:
+// four processes append to one file at once, so that they
+// wait for each other's locks; lockstat() should count that,
+// and count from zero again after a reset.
+void
+lockstattest(void)
+{
+    2dfd:	55                   	push   %ebp
+    2dfe:	89 e5                	mov    %esp,%ebp
+    2e00:	83 ec 28             	sub    $0x28,%esp
+  uint a0, w0, a1, w1;
+  int fd, i, k, pid;
+
+  printf(stdout, "lockstat test\n");
+    2e03:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2e08:	83 ec 08             	sub    $0x8,%esp
+    2e0b:	68 7e 7b 00 00       	push   $0x7b7e
+    2e10:	50                   	push   %eax
+    2e11:	e8 aa 3a 00 00       	call   68c0 <printf>
+    2e16:	83 c4 10             	add    $0x10,%esp
+  lockstatsum(1, &a0, &w0);
+    2e19:	83 ec 04             	sub    $0x4,%esp
+    2e1c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2e1f:	50                   	push   %eax
+    2e20:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    2e23:	50                   	push   %eax
+    2e24:	6a 01                	push   $0x1
+    2e26:	e8 1b ff ff ff       	call   2d46 <lockstatsum>
+    2e2b:	83 c4 10             	add    $0x10,%esp
+  close(open("lockstat", O_CREATE|O_RDWR));
+    2e2e:	83 ec 08             	sub    $0x8,%esp
+    2e31:	68 02 02 00 00       	push   $0x202
+    2e36:	68 8d 7b 00 00       	push   $0x7b8d
+    2e3b:	e8 e4 38 00 00       	call   6724 <open>
+    2e40:	83 c4 10             	add    $0x10,%esp
+    2e43:	83 ec 0c             	sub    $0xc,%esp
+    2e46:	50                   	push   %eax
+    2e47:	e8 c0 38 00 00       	call   670c <close>
+    2e4c:	83 c4 10             	add    $0x10,%esp
+  for(k = 0; k < 4; k++){
+    2e4f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2e56:	e9 a9 00 00 00       	jmp    2f04 <lockstattest+0x107>
+    pid = fork();
+    2e5b:	e8 7c 38 00 00       	call   66dc <fork>
+    2e60:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pid < 0){
+    2e63:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2e67:	79 1b                	jns    2e84 <lockstattest+0x87>
+      printf(stdout, "fork failed\n");
+    2e69:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2e6e:	83 ec 08             	sub    $0x8,%esp
+    2e71:	68 19 6d 00 00       	push   $0x6d19
+    2e76:	50                   	push   %eax
+    2e77:	e8 44 3a 00 00       	call   68c0 <printf>
+    2e7c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2e7f:	e8 60 38 00 00       	call   66e4 <exit>
+    }
+    if(pid > 0)
+    2e84:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2e88:	7f 75                	jg     2eff <lockstattest+0x102>
+      continue;
+    fd = open("lockstat", O_RDWR);
+    2e8a:	83 ec 08             	sub    $0x8,%esp
+    2e8d:	6a 02                	push   $0x2
+    2e8f:	68 8d 7b 00 00       	push   $0x7b8d
+    2e94:	e8 8b 38 00 00       	call   6724 <open>
+    2e99:	83 c4 10             	add    $0x10,%esp
+    2e9c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; i < 100; i++){
+    2e9f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2ea6:	eb 3e                	jmp    2ee6 <lockstattest+0xe9>
+      if(write(fd, buf, 512) != 512){
+    2ea8:	83 ec 04             	sub    $0x4,%esp
+    2eab:	68 00 02 00 00       	push   $0x200
+    2eb0:	68 20 9a 00 00       	push   $0x9a20
+    2eb5:	ff 75 e8             	push   -0x18(%ebp)
+    2eb8:	e8 47 38 00 00       	call   6704 <write>
+    2ebd:	83 c4 10             	add    $0x10,%esp
+    2ec0:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2ec5:	74 1b                	je     2ee2 <lockstattest+0xe5>
+        printf(stdout, "lockstat write failed\n");
+    2ec7:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2ecc:	83 ec 08             	sub    $0x8,%esp
+    2ecf:	68 96 7b 00 00       	push   $0x7b96
+    2ed4:	50                   	push   %eax
+    2ed5:	e8 e6 39 00 00       	call   68c0 <printf>
+    2eda:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2edd:	e8 02 38 00 00       	call   66e4 <exit>
+    for(i = 0; i < 100; i++){
+    2ee2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2ee6:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    2eea:	7e bc                	jle    2ea8 <lockstattest+0xab>
+      }
+    }
+    close(fd);
+    2eec:	83 ec 0c             	sub    $0xc,%esp
+    2eef:	ff 75 e8             	push   -0x18(%ebp)
+    2ef2:	e8 15 38 00 00       	call   670c <close>
+    2ef7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2efa:	e8 e5 37 00 00       	call   66e4 <exit>
+      continue;
+    2eff:	90                   	nop
+  for(k = 0; k < 4; k++){
+    2f00:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2f04:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    2f08:	0f 8e 4d ff ff ff    	jle    2e5b <lockstattest+0x5e>
+  }
+  for(k = 0; k < 4; k++)
+    2f0e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2f15:	eb 09                	jmp    2f20 <lockstattest+0x123>
+    wait();
+    2f17:	e8 d0 37 00 00       	call   66ec <wait>
+  for(k = 0; k < 4; k++)
+    2f1c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2f20:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    2f24:	7e f1                	jle    2f17 <lockstattest+0x11a>
+  unlink("lockstat");
+    2f26:	83 ec 0c             	sub    $0xc,%esp
+    2f29:	68 8d 7b 00 00       	push   $0x7b8d
+    2f2e:	e8 01 38 00 00       	call   6734 <unlink>
+    2f33:	83 c4 10             	add    $0x10,%esp
+  lockstatsum(1, &a0, &w0);
+    2f36:	83 ec 04             	sub    $0x4,%esp
+    2f39:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2f3c:	50                   	push   %eax
+    2f3d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    2f40:	50                   	push   %eax
+    2f41:	6a 01                	push   $0x1
+    2f43:	e8 fe fd ff ff       	call   2d46 <lockstatsum>
+    2f48:	83 c4 10             	add    $0x10,%esp
+  if(a0 == 0 || w0 == 0){
+    2f4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2f4e:	85 c0                	test   %eax,%eax
+    2f50:	74 07                	je     2f59 <lockstattest+0x15c>
+    2f52:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    2f55:	85 c0                	test   %eax,%eax
+    2f57:	75 20                	jne    2f79 <lockstattest+0x17c>
+    printf(stdout, "lockstat: %d acquires, %d waits\n", a0, w0);
+    2f59:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    2f5c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    2f5f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2f64:	51                   	push   %ecx
+    2f65:	52                   	push   %edx
+    2f66:	68 b0 7b 00 00       	push   $0x7bb0
+    2f6b:	50                   	push   %eax
+    2f6c:	e8 4f 39 00 00       	call   68c0 <printf>
+    2f71:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f74:	e8 6b 37 00 00       	call   66e4 <exit>
+  }
+  lockstatsum(0, &a1, &w1);
+    2f79:	83 ec 04             	sub    $0x4,%esp
+    2f7c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2f7f:	50                   	push   %eax
+    2f80:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    2f83:	50                   	push   %eax
+    2f84:	6a 00                	push   $0x0
+    2f86:	e8 bb fd ff ff       	call   2d46 <lockstatsum>
+    2f8b:	83 c4 10             	add    $0x10,%esp
+  if(a1 >= a0 || w1 >= w0){
+    2f8e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    2f91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2f94:	39 c2                	cmp    %eax,%edx
+    2f96:	73 0a                	jae    2fa2 <lockstattest+0x1a5>
+    2f98:	8b 55 d8             	mov    -0x28(%ebp),%edx
+    2f9b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    2f9e:	39 c2                	cmp    %eax,%edx
+    2fa0:	72 1b                	jb     2fbd <lockstattest+0x1c0>
+    printf(stdout, "lockstat: reset did not clear counters\n");
+    2fa2:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2fa7:	83 ec 08             	sub    $0x8,%esp
+    2faa:	68 d4 7b 00 00       	push   $0x7bd4
+    2faf:	50                   	push   %eax
+    2fb0:	e8 0b 39 00 00       	call   68c0 <printf>
+    2fb5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2fb8:	e8 27 37 00 00       	call   66e4 <exit>
+  }
+  printf(stdout, "lockstat ok\n");
+    2fbd:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    2fc2:	83 ec 08             	sub    $0x8,%esp
+    2fc5:	68 fc 7b 00 00       	push   $0x7bfc
+    2fca:	50                   	push   %eax
+    2fcb:	e8 f0 38 00 00       	call   68c0 <printf>
+    2fd0:	83 c4 10             	add    $0x10,%esp
+}
+    2fd3:	90                   	nop
+    2fd4:	c9                   	leave
+    2fd5:	c3                   	ret
+
+00002fd6 <mem>:
+void
+mem(void)
+{
+    2fd6:	55                   	push   %ebp
+    2fd7:	89 e5                	mov    %esp,%ebp
+    2fd9:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    2fdc:	83 ec 08             	sub    $0x8,%esp
+    2fdf:	68 09 7c 00 00       	push   $0x7c09
+    2fe4:	6a 01                	push   $0x1
+    2fe6:	e8 d5 38 00 00       	call   68c0 <printf>
+    2feb:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    2fee:	e8 71 37 00 00       	call   6764 <getpid>
+    2ff3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+    2ff6:	e8 e1 36 00 00       	call   66dc <fork>
+    2ffb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    2ffe:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3002:	0f 85 b7 00 00 00    	jne    30bf <mem+0xe9>
+    m1 = 0;
+    3008:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    300f:	eb 0e                	jmp    301f <mem+0x49>
+      *(char**)m2 = m1;
+    3011:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3014:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3017:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+    3019:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    301c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    301f:	83 ec 0c             	sub    $0xc,%esp
+    3022:	68 11 27 00 00       	push   $0x2711
+    3027:	e8 68 3b 00 00       	call   6b94 <malloc>
+    302c:	83 c4 10             	add    $0x10,%esp
+    302f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    3032:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3036:	75 d9                	jne    3011 <mem+0x3b>
+    }
+    while(m1){
+    3038:	eb 1c                	jmp    3056 <mem+0x80>
+      m2 = *(char**)m1;
+    303a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    303d:	8b 00                	mov    (%eax),%eax
+    303f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+    3042:	83 ec 0c             	sub    $0xc,%esp
+    3045:	ff 75 f4             	push   -0xc(%ebp)
+    3048:	e8 05 3a 00 00       	call   6a52 <free>
+    304d:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    3050:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3053:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+    3056:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    305a:	75 de                	jne    303a <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+    305c:	83 ec 0c             	sub    $0xc,%esp
+    305f:	68 00 50 00 00       	push   $0x5000
+    3064:	e8 2b 3b 00 00       	call   6b94 <malloc>
+    3069:	83 c4 10             	add    $0x10,%esp
+    306c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+    306f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3073:	75 25                	jne    309a <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+    3075:	83 ec 08             	sub    $0x8,%esp
+    3078:	68 13 7c 00 00       	push   $0x7c13
+    307d:	6a 01                	push   $0x1
+    307f:	e8 3c 38 00 00       	call   68c0 <printf>
+    3084:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    3087:	83 ec 0c             	sub    $0xc,%esp
+    308a:	ff 75 f0             	push   -0x10(%ebp)
+    308d:	e8 82 36 00 00       	call   6714 <kill>
+    3092:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3095:	e8 4a 36 00 00       	call   66e4 <exit>
+    }
+    free(m1);
+    309a:	83 ec 0c             	sub    $0xc,%esp
+    309d:	ff 75 f4             	push   -0xc(%ebp)
+    30a0:	e8 ad 39 00 00       	call   6a52 <free>
+    30a5:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+    30a8:	83 ec 08             	sub    $0x8,%esp
+    30ab:	68 2d 7c 00 00       	push   $0x7c2d
+    30b0:	6a 01                	push   $0x1
+    30b2:	e8 09 38 00 00       	call   68c0 <printf>
+    30b7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30ba:	e8 25 36 00 00       	call   66e4 <exit>
+  } else {
+    wait();
+    30bf:	e8 28 36 00 00       	call   66ec <wait>
+  }
+}
+    30c4:	90                   	nop
+    30c5:	c9                   	leave
+    30c6:	c3                   	ret
+
+000030c7 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    30c7:	55                   	push   %ebp
+    30c8:	89 e5                	mov    %esp,%ebp
+    30ca:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    30cd:	83 ec 08             	sub    $0x8,%esp
+    30d0:	68 35 7c 00 00       	push   $0x7c35
+    30d5:	6a 01                	push   $0x1
+    30d7:	e8 e4 37 00 00       	call   68c0 <printf>
+    30dc:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+    30df:	83 ec 0c             	sub    $0xc,%esp
+    30e2:	68 44 7c 00 00       	push   $0x7c44
+    30e7:	e8 48 36 00 00       	call   6734 <unlink>
+    30ec:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    30ef:	83 ec 08             	sub    $0x8,%esp
+    30f2:	68 02 02 00 00       	push   $0x202
+    30f7:	68 44 7c 00 00       	push   $0x7c44
+    30fc:	e8 23 36 00 00       	call   6724 <open>
+    3101:	83 c4 10             	add    $0x10,%esp
+    3104:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    3107:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    310b:	79 17                	jns    3124 <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    310d:	83 ec 08             	sub    $0x8,%esp
+    3110:	68 50 7c 00 00       	push   $0x7c50
+    3115:	6a 01                	push   $0x1
+    3117:	e8 a4 37 00 00       	call   68c0 <printf>
+    311c:	83 c4 10             	add    $0x10,%esp
+    return;
+    311f:	e9 84 01 00 00       	jmp    32a8 <sharedfd+0x1e1>
+  }
+  pid = fork();
+    3124:	e8 b3 35 00 00       	call   66dc <fork>
+    3129:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    312c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    3130:	75 07                	jne    3139 <sharedfd+0x72>
+    3132:	b8 63 00 00 00       	mov    $0x63,%eax
+    3137:	eb 05                	jmp    313e <sharedfd+0x77>
+    3139:	b8 70 00 00 00       	mov    $0x70,%eax
+    313e:	83 ec 04             	sub    $0x4,%esp
+    3141:	6a 0a                	push   $0xa
+    3143:	50                   	push   %eax
+    3144:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    3147:	50                   	push   %eax
+    3148:	e8 fc 33 00 00       	call   6549 <memset>
+    314d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+    3150:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3157:	eb 31                	jmp    318a <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    3159:	83 ec 04             	sub    $0x4,%esp
+    315c:	6a 0a                	push   $0xa
+    315e:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    3161:	50                   	push   %eax
+    3162:	ff 75 e8             	push   -0x18(%ebp)
+    3165:	e8 9a 35 00 00       	call   6704 <write>
+    316a:	83 c4 10             	add    $0x10,%esp
+    316d:	83 f8 0a             	cmp    $0xa,%eax
+    3170:	74 14                	je     3186 <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+    3172:	83 ec 08             	sub    $0x8,%esp
+    3175:	68 7c 7c 00 00       	push   $0x7c7c
+    317a:	6a 01                	push   $0x1
+    317c:	e8 3f 37 00 00       	call   68c0 <printf>
+    3181:	83 c4 10             	add    $0x10,%esp
+      break;
+    3184:	eb 0d                	jmp    3193 <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+    3186:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    318a:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    3191:	7e c6                	jle    3159 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+    3193:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    3197:	75 05                	jne    319e <sharedfd+0xd7>
+    exit();
+    3199:	e8 46 35 00 00       	call   66e4 <exit>
+  else
+    wait();
+    319e:	e8 49 35 00 00       	call   66ec <wait>
+  close(fd);
+    31a3:	83 ec 0c             	sub    $0xc,%esp
+    31a6:	ff 75 e8             	push   -0x18(%ebp)
+    31a9:	e8 5e 35 00 00       	call   670c <close>
+    31ae:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+    31b1:	83 ec 08             	sub    $0x8,%esp
+    31b4:	6a 00                	push   $0x0
+    31b6:	68 44 7c 00 00       	push   $0x7c44
+    31bb:	e8 64 35 00 00       	call   6724 <open>
+    31c0:	83 c4 10             	add    $0x10,%esp
+    31c3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    31c6:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    31ca:	79 17                	jns    31e3 <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    31cc:	83 ec 08             	sub    $0x8,%esp
+    31cf:	68 9c 7c 00 00       	push   $0x7c9c
+    31d4:	6a 01                	push   $0x1
+    31d6:	e8 e5 36 00 00       	call   68c0 <printf>
+    31db:	83 c4 10             	add    $0x10,%esp
+    return;
+    31de:	e9 c5 00 00 00       	jmp    32a8 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+    31e3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    31ea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    31ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    31f0:	eb 3b                	jmp    322d <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+    31f2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    31f9:	eb 2a                	jmp    3225 <sharedfd+0x15e>
+      if(buf[i] == 'c')
+    31fb:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    31fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3201:	01 d0                	add    %edx,%eax
+    3203:	0f b6 00             	movzbl (%eax),%eax
+    3206:	3c 63                	cmp    $0x63,%al
+    3208:	75 04                	jne    320e <sharedfd+0x147>
+        nc++;
+    320a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+    320e:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    3211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3214:	01 d0                	add    %edx,%eax
+    3216:	0f b6 00             	movzbl (%eax),%eax
+    3219:	3c 70                	cmp    $0x70,%al
+    321b:	75 04                	jne    3221 <sharedfd+0x15a>
+        np++;
+    321d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+    3221:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3225:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3228:	83 f8 09             	cmp    $0x9,%eax
+    322b:	76 ce                	jbe    31fb <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    322d:	83 ec 04             	sub    $0x4,%esp
+    3230:	6a 0a                	push   $0xa
+    3232:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    3235:	50                   	push   %eax
+    3236:	ff 75 e8             	push   -0x18(%ebp)
+    3239:	e8 be 34 00 00       	call   66fc <read>
+    323e:	83 c4 10             	add    $0x10,%esp
+    3241:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    3244:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    3248:	7f a8                	jg     31f2 <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+    324a:	83 ec 0c             	sub    $0xc,%esp
+    324d:	ff 75 e8             	push   -0x18(%ebp)
+    3250:	e8 b7 34 00 00       	call   670c <close>
+    3255:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    3258:	83 ec 0c             	sub    $0xc,%esp
+    325b:	68 44 7c 00 00       	push   $0x7c44
+    3260:	e8 cf 34 00 00       	call   6734 <unlink>
+    3265:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    3268:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    326f:	75 1d                	jne    328e <sharedfd+0x1c7>
+    3271:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    3278:	75 14                	jne    328e <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    327a:	83 ec 08             	sub    $0x8,%esp
+    327d:	68 c7 7c 00 00       	push   $0x7cc7
+    3282:	6a 01                	push   $0x1
+    3284:	e8 37 36 00 00       	call   68c0 <printf>
+    3289:	83 c4 10             	add    $0x10,%esp
+    328c:	eb 1a                	jmp    32a8 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    328e:	ff 75 ec             	push   -0x14(%ebp)
+    3291:	ff 75 f0             	push   -0x10(%ebp)
+    3294:	68 d4 7c 00 00       	push   $0x7cd4
+    3299:	6a 01                	push   $0x1
+    329b:	e8 20 36 00 00       	call   68c0 <printf>
+    32a0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32a3:	e8 3c 34 00 00       	call   66e4 <exit>
+  }
+}
+    32a8:	c9                   	leave
+    32a9:	c3                   	ret
+
+000032aa <sharedread>:
+// three processes read a file while a fourth rewrites it, so
+// that readers share its blocks and the writer waits for them;
+// each 512-byte piece read must come from a single write.
+void
+sharedread(void)
+{
+    32aa:	55                   	push   %ebp
+    32ab:	89 e5                	mov    %esp,%ebp
+    32ad:	81 ec 28 02 00 00    	sub    $0x228,%esp
+  int fd, pid, i, j, k, n;
+  char buf[512];
+
+  printf(1, "sharedread test\n");
+    32b3:	83 ec 08             	sub    $0x8,%esp
+    32b6:	68 e9 7c 00 00       	push   $0x7ce9
+    32bb:	6a 01                	push   $0x1
+    32bd:	e8 fe 35 00 00       	call   68c0 <printf>
+    32c2:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedread");
+    32c5:	83 ec 0c             	sub    $0xc,%esp
+    32c8:	68 fa 7c 00 00       	push   $0x7cfa
+    32cd:	e8 62 34 00 00       	call   6734 <unlink>
+    32d2:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedread", O_CREATE|O_RDWR);
+    32d5:	83 ec 08             	sub    $0x8,%esp
+    32d8:	68 02 02 00 00       	push   $0x202
+    32dd:	68 fa 7c 00 00       	push   $0x7cfa
+    32e2:	e8 3d 34 00 00       	call   6724 <open>
+    32e7:	83 c4 10             	add    $0x10,%esp
+    32ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(fd < 0){
+    32ed:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    32f1:	79 17                	jns    330a <sharedread+0x60>
+    printf(1, "create sharedread failed\n");
+    32f3:	83 ec 08             	sub    $0x8,%esp
+    32f6:	68 05 7d 00 00       	push   $0x7d05
+    32fb:	6a 01                	push   $0x1
+    32fd:	e8 be 35 00 00       	call   68c0 <printf>
+    3302:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3305:	e8 da 33 00 00       	call   66e4 <exit>
+  }
+  memset(buf, 'a', sizeof(buf));
+    330a:	83 ec 04             	sub    $0x4,%esp
+    330d:	68 00 02 00 00       	push   $0x200
+    3312:	6a 61                	push   $0x61
+    3314:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+    331a:	50                   	push   %eax
+    331b:	e8 29 32 00 00       	call   6549 <memset>
+    3320:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 8; i++){
+    3323:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    332a:	eb 3c                	jmp    3368 <sharedread+0xbe>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    332c:	83 ec 04             	sub    $0x4,%esp
+    332f:	68 00 02 00 00       	push   $0x200
+    3334:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+    333a:	50                   	push   %eax
+    333b:	ff 75 e4             	push   -0x1c(%ebp)
+    333e:	e8 c1 33 00 00       	call   6704 <write>
+    3343:	83 c4 10             	add    $0x10,%esp
+    3346:	3d 00 02 00 00       	cmp    $0x200,%eax
+    334b:	74 17                	je     3364 <sharedread+0xba>
+      printf(1, "write sharedread failed\n");
+    334d:	83 ec 08             	sub    $0x8,%esp
+    3350:	68 1f 7d 00 00       	push   $0x7d1f
+    3355:	6a 01                	push   $0x1
+    3357:	e8 64 35 00 00       	call   68c0 <printf>
+    335c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    335f:	e8 80 33 00 00       	call   66e4 <exit>
+  for(i = 0; i < 8; i++){
+    3364:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3368:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+    336c:	7e be                	jle    332c <sharedread+0x82>
+    }
+  }
+  close(fd);
+    336e:	83 ec 0c             	sub    $0xc,%esp
+    3371:	ff 75 e4             	push   -0x1c(%ebp)
+    3374:	e8 93 33 00 00       	call   670c <close>
+    3379:	83 c4 10             	add    $0x10,%esp
+
+  for(k = 0; k < 4; k++){
+    337c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    3383:	e9 a7 01 00 00       	jmp    352f <sharedread+0x285>
+    pid = fork();
+    3388:	e8 4f 33 00 00       	call   66dc <fork>
+    338d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(pid < 0){
+    3390:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    3394:	79 17                	jns    33ad <sharedread+0x103>
+      printf(1, "fork failed\n");
+    3396:	83 ec 08             	sub    $0x8,%esp
+    3399:	68 19 6d 00 00       	push   $0x6d19
+    339e:	6a 01                	push   $0x1
+    33a0:	e8 1b 35 00 00       	call   68c0 <printf>
+    33a5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    33a8:	e8 37 33 00 00       	call   66e4 <exit>
+    }
+    if(pid > 0)
+    33ad:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    33b1:	0f 8f 73 01 00 00    	jg     352a <sharedread+0x280>
+      continue;
+    for(j = 0; j < 20; j++){
+    33b7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    33be:	e9 58 01 00 00       	jmp    351b <sharedread+0x271>
+      fd = open("sharedread", k == 0 ? O_RDWR : O_RDONLY);
+    33c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    33c7:	75 07                	jne    33d0 <sharedread+0x126>
+    33c9:	b8 02 00 00 00       	mov    $0x2,%eax
+    33ce:	eb 05                	jmp    33d5 <sharedread+0x12b>
+    33d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    33d5:	83 ec 08             	sub    $0x8,%esp
+    33d8:	50                   	push   %eax
+    33d9:	68 fa 7c 00 00       	push   $0x7cfa
+    33de:	e8 41 33 00 00       	call   6724 <open>
+    33e3:	83 c4 10             	add    $0x10,%esp
+    33e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(fd < 0){
+    33e9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    33ed:	79 17                	jns    3406 <sharedread+0x15c>
+        printf(1, "open sharedread failed\n");
+    33ef:	83 ec 08             	sub    $0x8,%esp
+    33f2:	68 38 7d 00 00       	push   $0x7d38
+    33f7:	6a 01                	push   $0x1
+    33f9:	e8 c2 34 00 00       	call   68c0 <printf>
+    33fe:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3401:	e8 de 32 00 00       	call   66e4 <exit>
+      }
+      for(i = 0; i < 8; i++){
+    3406:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    340d:	e9 ed 00 00 00       	jmp    34ff <sharedread+0x255>
+        if(k == 0){
+    3412:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3416:	75 5f                	jne    3477 <sharedread+0x1cd>
+          memset(buf, 'a' + (i + j) % 26, sizeof(buf));
+    3418:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    341b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    341e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+    3421:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    3426:	89 c8                	mov    %ecx,%eax
+    3428:	f7 ea                	imul   %edx
+    342a:	89 d0                	mov    %edx,%eax
+    342c:	c1 f8 03             	sar    $0x3,%eax
+    342f:	89 ca                	mov    %ecx,%edx
+    3431:	c1 fa 1f             	sar    $0x1f,%edx
+    3434:	29 d0                	sub    %edx,%eax
+    3436:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    3439:	89 c8                	mov    %ecx,%eax
+    343b:	29 d0                	sub    %edx,%eax
+    343d:	83 c0 61             	add    $0x61,%eax
+    3440:	83 ec 04             	sub    $0x4,%esp
+    3443:	68 00 02 00 00       	push   $0x200
+    3448:	50                   	push   %eax
+    3449:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+    344f:	50                   	push   %eax
+    3450:	e8 f4 30 00 00       	call   6549 <memset>
+    3455:	83 c4 10             	add    $0x10,%esp
+          n = write(fd, buf, sizeof(buf));
+    3458:	83 ec 04             	sub    $0x4,%esp
+    345b:	68 00 02 00 00       	push   $0x200
+    3460:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+    3466:	50                   	push   %eax
+    3467:	ff 75 e4             	push   -0x1c(%ebp)
+    346a:	e8 95 32 00 00       	call   6704 <write>
+    346f:	83 c4 10             	add    $0x10,%esp
+    3472:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    3475:	eb 1d                	jmp    3494 <sharedread+0x1ea>
+        } else
+          n = read(fd, buf, sizeof(buf));
+    3477:	83 ec 04             	sub    $0x4,%esp
+    347a:	68 00 02 00 00       	push   $0x200
+    347f:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+    3485:	50                   	push   %eax
+    3486:	ff 75 e4             	push   -0x1c(%ebp)
+    3489:	e8 6e 32 00 00       	call   66fc <read>
+    348e:	83 c4 10             	add    $0x10,%esp
+    3491:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if(n != sizeof(buf)){
+    3494:	81 7d e8 00 02 00 00 	cmpl   $0x200,-0x18(%ebp)
+    349b:	74 17                	je     34b4 <sharedread+0x20a>
+          printf(1, "sharedread i/o failed\n");
+    349d:	83 ec 08             	sub    $0x8,%esp
+    34a0:	68 50 7d 00 00       	push   $0x7d50
+    34a5:	6a 01                	push   $0x1
+    34a7:	e8 14 34 00 00       	call   68c0 <printf>
+    34ac:	83 c4 10             	add    $0x10,%esp
+          exit();
+    34af:	e8 30 32 00 00       	call   66e4 <exit>
+        }
+        for(n = 1; n < sizeof(buf); n++){
+    34b4:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    34bb:	eb 34                	jmp    34f1 <sharedread+0x247>
+          if(buf[n] != buf[0]){
+    34bd:	8d 95 e0 fd ff ff    	lea    -0x220(%ebp),%edx
+    34c3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    34c6:	01 d0                	add    %edx,%eax
+    34c8:	0f b6 10             	movzbl (%eax),%edx
+    34cb:	0f b6 85 e0 fd ff ff 	movzbl -0x220(%ebp),%eax
+    34d2:	38 c2                	cmp    %al,%dl
+    34d4:	74 17                	je     34ed <sharedread+0x243>
+            printf(1, "sharedread saw a torn write\n");
+    34d6:	83 ec 08             	sub    $0x8,%esp
+    34d9:	68 67 7d 00 00       	push   $0x7d67
+    34de:	6a 01                	push   $0x1
+    34e0:	e8 db 33 00 00       	call   68c0 <printf>
+    34e5:	83 c4 10             	add    $0x10,%esp
+            exit();
+    34e8:	e8 f7 31 00 00       	call   66e4 <exit>
+        for(n = 1; n < sizeof(buf); n++){
+    34ed:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    34f1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    34f4:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    34f9:	76 c2                	jbe    34bd <sharedread+0x213>
+      for(i = 0; i < 8; i++){
+    34fb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    34ff:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+    3503:	0f 8e 09 ff ff ff    	jle    3412 <sharedread+0x168>
+          }
+        }
+      }
+      close(fd);
+    3509:	83 ec 0c             	sub    $0xc,%esp
+    350c:	ff 75 e4             	push   -0x1c(%ebp)
+    350f:	e8 f8 31 00 00       	call   670c <close>
+    3514:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < 20; j++){
+    3517:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    351b:	83 7d f0 13          	cmpl   $0x13,-0x10(%ebp)
+    351f:	0f 8e 9e fe ff ff    	jle    33c3 <sharedread+0x119>
+    }
+    exit();
+    3525:	e8 ba 31 00 00       	call   66e4 <exit>
+      continue;
+    352a:	90                   	nop
+  for(k = 0; k < 4; k++){
+    352b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    352f:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+    3533:	0f 8e 4f fe ff ff    	jle    3388 <sharedread+0xde>
+  }
+  for(k = 0; k < 4; k++)
+    3539:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    3540:	eb 09                	jmp    354b <sharedread+0x2a1>
+    wait();
+    3542:	e8 a5 31 00 00       	call   66ec <wait>
+  for(k = 0; k < 4; k++)
+    3547:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    354b:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+    354f:	7e f1                	jle    3542 <sharedread+0x298>
+  unlink("sharedread");
+    3551:	83 ec 0c             	sub    $0xc,%esp
+    3554:	68 fa 7c 00 00       	push   $0x7cfa
+    3559:	e8 d6 31 00 00       	call   6734 <unlink>
+    355e:	83 c4 10             	add    $0x10,%esp
+  printf(1, "sharedread ok\n");
+    3561:	83 ec 08             	sub    $0x8,%esp
+    3564:	68 84 7d 00 00       	push   $0x7d84
+    3569:	6a 01                	push   $0x1
+    356b:	e8 50 33 00 00       	call   68c0 <printf>
+    3570:	83 c4 10             	add    $0x10,%esp
+}
+    3573:	90                   	nop
+    3574:	c9                   	leave
+    3575:	c3                   	ret
+
+00003576 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    3576:	55                   	push   %ebp
+    3577:	89 e5                	mov    %esp,%ebp
+    3579:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    357c:	c7 45 c8 93 7d 00 00 	movl   $0x7d93,-0x38(%ebp)
+    3583:	c7 45 cc 96 7d 00 00 	movl   $0x7d96,-0x34(%ebp)
+    358a:	c7 45 d0 99 7d 00 00 	movl   $0x7d99,-0x30(%ebp)
+    3591:	c7 45 d4 9c 7d 00 00 	movl   $0x7d9c,-0x2c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    3598:	83 ec 08             	sub    $0x8,%esp
+    359b:	68 9f 7d 00 00       	push   $0x7d9f
+    35a0:	6a 01                	push   $0x1
+    35a2:	e8 19 33 00 00       	call   68c0 <printf>
+    35a7:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    35aa:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    35b1:	e9 f0 00 00 00       	jmp    36a6 <fourfiles+0x130>
+    fname = names[pi];
+    35b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    35b9:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    35bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    unlink(fname);
+    35c0:	83 ec 0c             	sub    $0xc,%esp
+    35c3:	ff 75 e4             	push   -0x1c(%ebp)
+    35c6:	e8 69 31 00 00       	call   6734 <unlink>
+    35cb:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+    35ce:	e8 09 31 00 00       	call   66dc <fork>
+    35d3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(pid < 0){
+    35d6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    35da:	79 17                	jns    35f3 <fourfiles+0x7d>
+      printf(1, "fork failed\n");
+    35dc:	83 ec 08             	sub    $0x8,%esp
+    35df:	68 19 6d 00 00       	push   $0x6d19
+    35e4:	6a 01                	push   $0x1
+    35e6:	e8 d5 32 00 00       	call   68c0 <printf>
+    35eb:	83 c4 10             	add    $0x10,%esp
+      exit();
+    35ee:	e8 f1 30 00 00       	call   66e4 <exit>
+    }
+
+    if(pid == 0){
+    35f3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    35f7:	0f 85 a5 00 00 00    	jne    36a2 <fourfiles+0x12c>
+      fd = open(fname, O_CREATE | O_RDWR);
+    35fd:	83 ec 08             	sub    $0x8,%esp
+    3600:	68 02 02 00 00       	push   $0x202
+    3605:	ff 75 e4             	push   -0x1c(%ebp)
+    3608:	e8 17 31 00 00       	call   6724 <open>
+    360d:	83 c4 10             	add    $0x10,%esp
+    3610:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(fd < 0){
+    3613:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    3617:	79 17                	jns    3630 <fourfiles+0xba>
+        printf(1, "create failed\n");
+    3619:	83 ec 08             	sub    $0x8,%esp
+    361c:	68 af 7d 00 00       	push   $0x7daf
+    3621:	6a 01                	push   $0x1
+    3623:	e8 98 32 00 00       	call   68c0 <printf>
+    3628:	83 c4 10             	add    $0x10,%esp
+        exit();
+    362b:	e8 b4 30 00 00       	call   66e4 <exit>
+      }
+      
+      memset(buf, '0'+pi, 512);
+    3630:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3633:	83 c0 30             	add    $0x30,%eax
+    3636:	83 ec 04             	sub    $0x4,%esp
+    3639:	68 00 02 00 00       	push   $0x200
+    363e:	50                   	push   %eax
+    363f:	68 20 9a 00 00       	push   $0x9a20
+    3644:	e8 00 2f 00 00       	call   6549 <memset>
+    3649:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 12; i++){
+    364c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3653:	eb 42                	jmp    3697 <fourfiles+0x121>
+        if((n = write(fd, buf, 500)) != 500){
+    3655:	83 ec 04             	sub    $0x4,%esp
+    3658:	68 f4 01 00 00       	push   $0x1f4
+    365d:	68 20 9a 00 00       	push   $0x9a20
+    3662:	ff 75 e0             	push   -0x20(%ebp)
+    3665:	e8 9a 30 00 00       	call   6704 <write>
+    366a:	83 c4 10             	add    $0x10,%esp
+    366d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    3670:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    3677:	74 1a                	je     3693 <fourfiles+0x11d>
+          printf(1, "write failed %d\n", n);
+    3679:	83 ec 04             	sub    $0x4,%esp
+    367c:	ff 75 dc             	push   -0x24(%ebp)
+    367f:	68 be 7d 00 00       	push   $0x7dbe
+    3684:	6a 01                	push   $0x1
+    3686:	e8 35 32 00 00       	call   68c0 <printf>
+    368b:	83 c4 10             	add    $0x10,%esp
+          exit();
+    368e:	e8 51 30 00 00       	call   66e4 <exit>
+      for(i = 0; i < 12; i++){
+    3693:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3697:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    369b:	7e b8                	jle    3655 <fourfiles+0xdf>
+        }
+      }
+      exit();
+    369d:	e8 42 30 00 00       	call   66e4 <exit>
+  for(pi = 0; pi < 4; pi++){
+    36a2:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    36a6:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    36aa:	0f 8e 06 ff ff ff    	jle    35b6 <fourfiles+0x40>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    36b0:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    36b7:	eb 09                	jmp    36c2 <fourfiles+0x14c>
+    wait();
+    36b9:	e8 2e 30 00 00       	call   66ec <wait>
+  for(pi = 0; pi < 4; pi++){
+    36be:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    36c2:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    36c6:	7e f1                	jle    36b9 <fourfiles+0x143>
+  }
+
+  for(i = 0; i < 2; i++){
+    36c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    36cf:	e9 d4 00 00 00       	jmp    37a8 <fourfiles+0x232>
+    fname = names[i];
+    36d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    36d7:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    36db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    fd = open(fname, 0);
+    36de:	83 ec 08             	sub    $0x8,%esp
+    36e1:	6a 00                	push   $0x0
+    36e3:	ff 75 e4             	push   -0x1c(%ebp)
+    36e6:	e8 39 30 00 00       	call   6724 <open>
+    36eb:	83 c4 10             	add    $0x10,%esp
+    36ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    36f1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    36f8:	eb 4a                	jmp    3744 <fourfiles+0x1ce>
+      for(j = 0; j < n; j++){
+    36fa:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3701:	eb 33                	jmp    3736 <fourfiles+0x1c0>
+        if(buf[j] != '0'+i){
+    3703:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3706:	05 20 9a 00 00       	add    $0x9a20,%eax
+    370b:	0f b6 00             	movzbl (%eax),%eax
+    370e:	0f be d0             	movsbl %al,%edx
+    3711:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3714:	83 c0 30             	add    $0x30,%eax
+    3717:	39 c2                	cmp    %eax,%edx
+    3719:	74 17                	je     3732 <fourfiles+0x1bc>
+          printf(1, "wrong char\n");
+    371b:	83 ec 08             	sub    $0x8,%esp
+    371e:	68 cf 7d 00 00       	push   $0x7dcf
+    3723:	6a 01                	push   $0x1
+    3725:	e8 96 31 00 00       	call   68c0 <printf>
+    372a:	83 c4 10             	add    $0x10,%esp
+          exit();
+    372d:	e8 b2 2f 00 00       	call   66e4 <exit>
+      for(j = 0; j < n; j++){
+    3732:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3736:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3739:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    373c:	7c c5                	jl     3703 <fourfiles+0x18d>
+        }
+      }
+      total += n;
+    373e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    3741:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    3744:	83 ec 04             	sub    $0x4,%esp
+    3747:	68 00 20 00 00       	push   $0x2000
+    374c:	68 20 9a 00 00       	push   $0x9a20
+    3751:	ff 75 e0             	push   -0x20(%ebp)
+    3754:	e8 a3 2f 00 00       	call   66fc <read>
+    3759:	83 c4 10             	add    $0x10,%esp
+    375c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    375f:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    3763:	7f 95                	jg     36fa <fourfiles+0x184>
+    }
+    close(fd);
+    3765:	83 ec 0c             	sub    $0xc,%esp
+    3768:	ff 75 e0             	push   -0x20(%ebp)
+    376b:	e8 9c 2f 00 00       	call   670c <close>
+    3770:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    3773:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    377a:	74 1a                	je     3796 <fourfiles+0x220>
+      printf(1, "wrong length %d\n", total);
+    377c:	83 ec 04             	sub    $0x4,%esp
+    377f:	ff 75 ec             	push   -0x14(%ebp)
+    3782:	68 db 7d 00 00       	push   $0x7ddb
+    3787:	6a 01                	push   $0x1
+    3789:	e8 32 31 00 00       	call   68c0 <printf>
+    378e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3791:	e8 4e 2f 00 00       	call   66e4 <exit>
+    }
+    unlink(fname);
+    3796:	83 ec 0c             	sub    $0xc,%esp
+    3799:	ff 75 e4             	push   -0x1c(%ebp)
+    379c:	e8 93 2f 00 00       	call   6734 <unlink>
+    37a1:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    37a4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    37a8:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    37ac:	0f 8e 22 ff ff ff    	jle    36d4 <fourfiles+0x15e>
+  }
+
+  printf(1, "fourfiles ok\n");
+    37b2:	83 ec 08             	sub    $0x8,%esp
+    37b5:	68 ec 7d 00 00       	push   $0x7dec
+    37ba:	6a 01                	push   $0x1
+    37bc:	e8 ff 30 00 00       	call   68c0 <printf>
+    37c1:	83 c4 10             	add    $0x10,%esp
+}
+    37c4:	90                   	nop
+    37c5:	c9                   	leave
+    37c6:	c3                   	ret
+
+000037c7 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    37c7:	55                   	push   %ebp
+    37c8:	89 e5                	mov    %esp,%ebp
+    37ca:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    37cd:	83 ec 08             	sub    $0x8,%esp
+    37d0:	68 fa 7d 00 00       	push   $0x7dfa
+    37d5:	6a 01                	push   $0x1
+    37d7:	e8 e4 30 00 00       	call   68c0 <printf>
+    37dc:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    37df:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    37e6:	e9 f6 00 00 00       	jmp    38e1 <createdelete+0x11a>
+    pid = fork();
+    37eb:	e8 ec 2e 00 00       	call   66dc <fork>
+    37f0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    37f3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    37f7:	79 17                	jns    3810 <createdelete+0x49>
+      printf(1, "fork failed\n");
+    37f9:	83 ec 08             	sub    $0x8,%esp
+    37fc:	68 19 6d 00 00       	push   $0x6d19
+    3801:	6a 01                	push   $0x1
+    3803:	e8 b8 30 00 00       	call   68c0 <printf>
+    3808:	83 c4 10             	add    $0x10,%esp
+      exit();
+    380b:	e8 d4 2e 00 00       	call   66e4 <exit>
+    }
+
+    if(pid == 0){
+    3810:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3814:	0f 85 c3 00 00 00    	jne    38dd <createdelete+0x116>
+      name[0] = 'p' + pi;
+    381a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    381d:	83 c0 70             	add    $0x70,%eax
+    3820:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    3823:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+      for(i = 0; i < N; i++){
+    3827:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    382e:	e9 9b 00 00 00       	jmp    38ce <createdelete+0x107>
+        name[1] = '0' + i;
+    3833:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3836:	83 c0 30             	add    $0x30,%eax
+    3839:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    383c:	83 ec 08             	sub    $0x8,%esp
+    383f:	68 02 02 00 00       	push   $0x202
+    3844:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3847:	50                   	push   %eax
+    3848:	e8 d7 2e 00 00       	call   6724 <open>
+    384d:	83 c4 10             	add    $0x10,%esp
+    3850:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    3853:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3857:	79 17                	jns    3870 <createdelete+0xa9>
+          printf(1, "create failed\n");
+    3859:	83 ec 08             	sub    $0x8,%esp
+    385c:	68 af 7d 00 00       	push   $0x7daf
+    3861:	6a 01                	push   $0x1
+    3863:	e8 58 30 00 00       	call   68c0 <printf>
+    3868:	83 c4 10             	add    $0x10,%esp
+          exit();
+    386b:	e8 74 2e 00 00       	call   66e4 <exit>
+        }
+        close(fd);
+    3870:	83 ec 0c             	sub    $0xc,%esp
+    3873:	ff 75 ec             	push   -0x14(%ebp)
+    3876:	e8 91 2e 00 00       	call   670c <close>
+    387b:	83 c4 10             	add    $0x10,%esp
+        if(i > 0 && (i % 2 ) == 0){
+    387e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3882:	7e 46                	jle    38ca <createdelete+0x103>
+    3884:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3887:	83 e0 01             	and    $0x1,%eax
+    388a:	85 c0                	test   %eax,%eax
+    388c:	75 3c                	jne    38ca <createdelete+0x103>
+          name[1] = '0' + (i / 2);
+    388e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3891:	89 c2                	mov    %eax,%edx
+    3893:	c1 ea 1f             	shr    $0x1f,%edx
+    3896:	01 d0                	add    %edx,%eax
+    3898:	d1 f8                	sar    %eax
+    389a:	83 c0 30             	add    $0x30,%eax
+    389d:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    38a0:	83 ec 0c             	sub    $0xc,%esp
+    38a3:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    38a6:	50                   	push   %eax
+    38a7:	e8 88 2e 00 00       	call   6734 <unlink>
+    38ac:	83 c4 10             	add    $0x10,%esp
+    38af:	85 c0                	test   %eax,%eax
+    38b1:	79 17                	jns    38ca <createdelete+0x103>
+            printf(1, "unlink failed\n");
+    38b3:	83 ec 08             	sub    $0x8,%esp
+    38b6:	68 9c 6d 00 00       	push   $0x6d9c
+    38bb:	6a 01                	push   $0x1
+    38bd:	e8 fe 2f 00 00       	call   68c0 <printf>
+    38c2:	83 c4 10             	add    $0x10,%esp
+            exit();
+    38c5:	e8 1a 2e 00 00       	call   66e4 <exit>
+      for(i = 0; i < N; i++){
+    38ca:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    38ce:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    38d2:	0f 8e 5b ff ff ff    	jle    3833 <createdelete+0x6c>
+          }
+        }
+      }
+      exit();
+    38d8:	e8 07 2e 00 00       	call   66e4 <exit>
+  for(pi = 0; pi < 4; pi++){
+    38dd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    38e1:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    38e5:	0f 8e 00 ff ff ff    	jle    37eb <createdelete+0x24>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    38eb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    38f2:	eb 09                	jmp    38fd <createdelete+0x136>
+    wait();
+    38f4:	e8 f3 2d 00 00       	call   66ec <wait>
+  for(pi = 0; pi < 4; pi++){
+    38f9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    38fd:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    3901:	7e f1                	jle    38f4 <createdelete+0x12d>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    3903:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    3907:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    390b:	88 45 c9             	mov    %al,-0x37(%ebp)
+    390e:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    3912:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    3915:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    391c:	e9 b2 00 00 00       	jmp    39d3 <createdelete+0x20c>
+    for(pi = 0; pi < 4; pi++){
+    3921:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3928:	e9 98 00 00 00       	jmp    39c5 <createdelete+0x1fe>
+      name[0] = 'p' + pi;
+    392d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3930:	83 c0 70             	add    $0x70,%eax
+    3933:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    3936:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3939:	83 c0 30             	add    $0x30,%eax
+    393c:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    393f:	83 ec 08             	sub    $0x8,%esp
+    3942:	6a 00                	push   $0x0
+    3944:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3947:	50                   	push   %eax
+    3948:	e8 d7 2d 00 00       	call   6724 <open>
+    394d:	83 c4 10             	add    $0x10,%esp
+    3950:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    3953:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3957:	74 06                	je     395f <createdelete+0x198>
+    3959:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    395d:	7e 21                	jle    3980 <createdelete+0x1b9>
+    395f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3963:	79 1b                	jns    3980 <createdelete+0x1b9>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    3965:	83 ec 04             	sub    $0x4,%esp
+    3968:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    396b:	50                   	push   %eax
+    396c:	68 10 7e 00 00       	push   $0x7e10
+    3971:	6a 01                	push   $0x1
+    3973:	e8 48 2f 00 00       	call   68c0 <printf>
+    3978:	83 c4 10             	add    $0x10,%esp
+        exit();
+    397b:	e8 64 2d 00 00       	call   66e4 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    3980:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3984:	7e 27                	jle    39ad <createdelete+0x1e6>
+    3986:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    398a:	7f 21                	jg     39ad <createdelete+0x1e6>
+    398c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3990:	78 1b                	js     39ad <createdelete+0x1e6>
+        printf(1, "oops createdelete %s did exist\n", name);
+    3992:	83 ec 04             	sub    $0x4,%esp
+    3995:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3998:	50                   	push   %eax
+    3999:	68 34 7e 00 00       	push   $0x7e34
+    399e:	6a 01                	push   $0x1
+    39a0:	e8 1b 2f 00 00       	call   68c0 <printf>
+    39a5:	83 c4 10             	add    $0x10,%esp
+        exit();
+    39a8:	e8 37 2d 00 00       	call   66e4 <exit>
+      }
+      if(fd >= 0)
+    39ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    39b1:	78 0e                	js     39c1 <createdelete+0x1fa>
+        close(fd);
+    39b3:	83 ec 0c             	sub    $0xc,%esp
+    39b6:	ff 75 ec             	push   -0x14(%ebp)
+    39b9:	e8 4e 2d 00 00       	call   670c <close>
+    39be:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    39c1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    39c5:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    39c9:	0f 8e 5e ff ff ff    	jle    392d <createdelete+0x166>
+  for(i = 0; i < N; i++){
+    39cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    39d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    39d7:	0f 8e 44 ff ff ff    	jle    3921 <createdelete+0x15a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    39dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    39e4:	eb 38                	jmp    3a1e <createdelete+0x257>
+    for(pi = 0; pi < 4; pi++){
+    39e6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    39ed:	eb 25                	jmp    3a14 <createdelete+0x24d>
+      name[0] = 'p' + i;
+    39ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    39f2:	83 c0 70             	add    $0x70,%eax
+    39f5:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    39f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    39fb:	83 c0 30             	add    $0x30,%eax
+    39fe:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    3a01:	83 ec 0c             	sub    $0xc,%esp
+    3a04:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3a07:	50                   	push   %eax
+    3a08:	e8 27 2d 00 00       	call   6734 <unlink>
+    3a0d:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    3a10:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3a14:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    3a18:	7e d5                	jle    39ef <createdelete+0x228>
+  for(i = 0; i < N; i++){
+    3a1a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3a1e:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    3a22:	7e c2                	jle    39e6 <createdelete+0x21f>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    3a24:	83 ec 08             	sub    $0x8,%esp
+    3a27:	68 54 7e 00 00       	push   $0x7e54
+    3a2c:	6a 01                	push   $0x1
+    3a2e:	e8 8d 2e 00 00       	call   68c0 <printf>
+    3a33:	83 c4 10             	add    $0x10,%esp
+}
+    3a36:	90                   	nop
+    3a37:	c9                   	leave
+    3a38:	c3                   	ret
+
+00003a39 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    3a39:	55                   	push   %ebp
+    3a3a:	89 e5                	mov    %esp,%ebp
+    3a3c:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    3a3f:	83 ec 08             	sub    $0x8,%esp
+    3a42:	68 65 7e 00 00       	push   $0x7e65
+    3a47:	6a 01                	push   $0x1
+    3a49:	e8 72 2e 00 00       	call   68c0 <printf>
+    3a4e:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    3a51:	83 ec 08             	sub    $0x8,%esp
+    3a54:	68 02 02 00 00       	push   $0x202
+    3a59:	68 76 7e 00 00       	push   $0x7e76
+    3a5e:	e8 c1 2c 00 00       	call   6724 <open>
+    3a63:	83 c4 10             	add    $0x10,%esp
+    3a66:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3a69:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3a6d:	79 17                	jns    3a86 <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    3a6f:	83 ec 08             	sub    $0x8,%esp
+    3a72:	68 81 7e 00 00       	push   $0x7e81
+    3a77:	6a 01                	push   $0x1
+    3a79:	e8 42 2e 00 00       	call   68c0 <printf>
+    3a7e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a81:	e8 5e 2c 00 00       	call   66e4 <exit>
+  }
+  write(fd, "hello", 5);
+    3a86:	83 ec 04             	sub    $0x4,%esp
+    3a89:	6a 05                	push   $0x5
+    3a8b:	68 9b 7e 00 00       	push   $0x7e9b
+    3a90:	ff 75 f4             	push   -0xc(%ebp)
+    3a93:	e8 6c 2c 00 00       	call   6704 <write>
+    3a98:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    3a9b:	83 ec 0c             	sub    $0xc,%esp
+    3a9e:	ff 75 f4             	push   -0xc(%ebp)
+    3aa1:	e8 66 2c 00 00       	call   670c <close>
+    3aa6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    3aa9:	83 ec 08             	sub    $0x8,%esp
+    3aac:	6a 02                	push   $0x2
+    3aae:	68 76 7e 00 00       	push   $0x7e76
+    3ab3:	e8 6c 2c 00 00       	call   6724 <open>
+    3ab8:	83 c4 10             	add    $0x10,%esp
+    3abb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3abe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3ac2:	79 17                	jns    3adb <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    3ac4:	83 ec 08             	sub    $0x8,%esp
+    3ac7:	68 a1 7e 00 00       	push   $0x7ea1
+    3acc:	6a 01                	push   $0x1
+    3ace:	e8 ed 2d 00 00       	call   68c0 <printf>
+    3ad3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3ad6:	e8 09 2c 00 00       	call   66e4 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    3adb:	83 ec 0c             	sub    $0xc,%esp
+    3ade:	68 76 7e 00 00       	push   $0x7e76
+    3ae3:	e8 4c 2c 00 00       	call   6734 <unlink>
+    3ae8:	83 c4 10             	add    $0x10,%esp
+    3aeb:	85 c0                	test   %eax,%eax
+    3aed:	74 17                	je     3b06 <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    3aef:	83 ec 08             	sub    $0x8,%esp
+    3af2:	68 b9 7e 00 00       	push   $0x7eb9
+    3af7:	6a 01                	push   $0x1
+    3af9:	e8 c2 2d 00 00       	call   68c0 <printf>
+    3afe:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b01:	e8 de 2b 00 00       	call   66e4 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    3b06:	83 ec 08             	sub    $0x8,%esp
+    3b09:	68 02 02 00 00       	push   $0x202
+    3b0e:	68 76 7e 00 00       	push   $0x7e76
+    3b13:	e8 0c 2c 00 00       	call   6724 <open>
+    3b18:	83 c4 10             	add    $0x10,%esp
+    3b1b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    3b1e:	83 ec 04             	sub    $0x4,%esp
+    3b21:	6a 03                	push   $0x3
+    3b23:	68 d3 7e 00 00       	push   $0x7ed3
+    3b28:	ff 75 f0             	push   -0x10(%ebp)
+    3b2b:	e8 d4 2b 00 00       	call   6704 <write>
+    3b30:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    3b33:	83 ec 0c             	sub    $0xc,%esp
+    3b36:	ff 75 f0             	push   -0x10(%ebp)
+    3b39:	e8 ce 2b 00 00       	call   670c <close>
+    3b3e:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    3b41:	83 ec 04             	sub    $0x4,%esp
+    3b44:	68 00 20 00 00       	push   $0x2000
+    3b49:	68 20 9a 00 00       	push   $0x9a20
+    3b4e:	ff 75 f4             	push   -0xc(%ebp)
+    3b51:	e8 a6 2b 00 00       	call   66fc <read>
+    3b56:	83 c4 10             	add    $0x10,%esp
+    3b59:	83 f8 05             	cmp    $0x5,%eax
+    3b5c:	74 17                	je     3b75 <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    3b5e:	83 ec 08             	sub    $0x8,%esp
+    3b61:	68 d7 7e 00 00       	push   $0x7ed7
+    3b66:	6a 01                	push   $0x1
+    3b68:	e8 53 2d 00 00       	call   68c0 <printf>
+    3b6d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b70:	e8 6f 2b 00 00       	call   66e4 <exit>
+  }
+  if(buf[0] != 'h'){
+    3b75:	0f b6 05 20 9a 00 00 	movzbl 0x9a20,%eax
+    3b7c:	3c 68                	cmp    $0x68,%al
+    3b7e:	74 17                	je     3b97 <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    3b80:	83 ec 08             	sub    $0x8,%esp
+    3b83:	68 ee 7e 00 00       	push   $0x7eee
+    3b88:	6a 01                	push   $0x1
+    3b8a:	e8 31 2d 00 00       	call   68c0 <printf>
+    3b8f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b92:	e8 4d 2b 00 00       	call   66e4 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    3b97:	83 ec 04             	sub    $0x4,%esp
+    3b9a:	6a 0a                	push   $0xa
+    3b9c:	68 20 9a 00 00       	push   $0x9a20
+    3ba1:	ff 75 f4             	push   -0xc(%ebp)
+    3ba4:	e8 5b 2b 00 00       	call   6704 <write>
+    3ba9:	83 c4 10             	add    $0x10,%esp
+    3bac:	83 f8 0a             	cmp    $0xa,%eax
+    3baf:	74 17                	je     3bc8 <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    3bb1:	83 ec 08             	sub    $0x8,%esp
+    3bb4:	68 05 7f 00 00       	push   $0x7f05
+    3bb9:	6a 01                	push   $0x1
+    3bbb:	e8 00 2d 00 00       	call   68c0 <printf>
+    3bc0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3bc3:	e8 1c 2b 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    3bc8:	83 ec 0c             	sub    $0xc,%esp
+    3bcb:	ff 75 f4             	push   -0xc(%ebp)
+    3bce:	e8 39 2b 00 00       	call   670c <close>
+    3bd3:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    3bd6:	83 ec 0c             	sub    $0xc,%esp
+    3bd9:	68 76 7e 00 00       	push   $0x7e76
+    3bde:	e8 51 2b 00 00       	call   6734 <unlink>
+    3be3:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    3be6:	83 ec 08             	sub    $0x8,%esp
+    3be9:	68 1e 7f 00 00       	push   $0x7f1e
+    3bee:	6a 01                	push   $0x1
+    3bf0:	e8 cb 2c 00 00       	call   68c0 <printf>
+    3bf5:	83 c4 10             	add    $0x10,%esp
+}
+    3bf8:	90                   	nop
+    3bf9:	c9                   	leave
+    3bfa:	c3                   	ret
+
+00003bfb <linktest>:
+
+void
+linktest(void)
+{
+    3bfb:	55                   	push   %ebp
+    3bfc:	89 e5                	mov    %esp,%ebp
+    3bfe:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    3c01:	83 ec 08             	sub    $0x8,%esp
+    3c04:	68 2d 7f 00 00       	push   $0x7f2d
+    3c09:	6a 01                	push   $0x1
+    3c0b:	e8 b0 2c 00 00       	call   68c0 <printf>
+    3c10:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    3c13:	83 ec 0c             	sub    $0xc,%esp
+    3c16:	68 37 7f 00 00       	push   $0x7f37
+    3c1b:	e8 14 2b 00 00       	call   6734 <unlink>
+    3c20:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    3c23:	83 ec 0c             	sub    $0xc,%esp
+    3c26:	68 3b 7f 00 00       	push   $0x7f3b
+    3c2b:	e8 04 2b 00 00       	call   6734 <unlink>
+    3c30:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    3c33:	83 ec 08             	sub    $0x8,%esp
+    3c36:	68 02 02 00 00       	push   $0x202
+    3c3b:	68 37 7f 00 00       	push   $0x7f37
+    3c40:	e8 df 2a 00 00       	call   6724 <open>
+    3c45:	83 c4 10             	add    $0x10,%esp
+    3c48:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3c4b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3c4f:	79 17                	jns    3c68 <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    3c51:	83 ec 08             	sub    $0x8,%esp
+    3c54:	68 3f 7f 00 00       	push   $0x7f3f
+    3c59:	6a 01                	push   $0x1
+    3c5b:	e8 60 2c 00 00       	call   68c0 <printf>
+    3c60:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3c63:	e8 7c 2a 00 00       	call   66e4 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    3c68:	83 ec 04             	sub    $0x4,%esp
+    3c6b:	6a 05                	push   $0x5
+    3c6d:	68 9b 7e 00 00       	push   $0x7e9b
+    3c72:	ff 75 f4             	push   -0xc(%ebp)
+    3c75:	e8 8a 2a 00 00       	call   6704 <write>
+    3c7a:	83 c4 10             	add    $0x10,%esp
+    3c7d:	83 f8 05             	cmp    $0x5,%eax
+    3c80:	74 17                	je     3c99 <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    3c82:	83 ec 08             	sub    $0x8,%esp
+    3c85:	68 52 7f 00 00       	push   $0x7f52
+    3c8a:	6a 01                	push   $0x1
+    3c8c:	e8 2f 2c 00 00       	call   68c0 <printf>
+    3c91:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3c94:	e8 4b 2a 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    3c99:	83 ec 0c             	sub    $0xc,%esp
+    3c9c:	ff 75 f4             	push   -0xc(%ebp)
+    3c9f:	e8 68 2a 00 00       	call   670c <close>
+    3ca4:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    3ca7:	83 ec 08             	sub    $0x8,%esp
+    3caa:	68 3b 7f 00 00       	push   $0x7f3b
+    3caf:	68 37 7f 00 00       	push   $0x7f37
+    3cb4:	e8 8b 2a 00 00       	call   6744 <link>
+    3cb9:	83 c4 10             	add    $0x10,%esp
+    3cbc:	85 c0                	test   %eax,%eax
+    3cbe:	79 17                	jns    3cd7 <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    3cc0:	83 ec 08             	sub    $0x8,%esp
+    3cc3:	68 64 7f 00 00       	push   $0x7f64
+    3cc8:	6a 01                	push   $0x1
+    3cca:	e8 f1 2b 00 00       	call   68c0 <printf>
+    3ccf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3cd2:	e8 0d 2a 00 00       	call   66e4 <exit>
+  }
+  unlink("lf1");
+    3cd7:	83 ec 0c             	sub    $0xc,%esp
+    3cda:	68 37 7f 00 00       	push   $0x7f37
+    3cdf:	e8 50 2a 00 00       	call   6734 <unlink>
+    3ce4:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    3ce7:	83 ec 08             	sub    $0x8,%esp
+    3cea:	6a 00                	push   $0x0
+    3cec:	68 37 7f 00 00       	push   $0x7f37
+    3cf1:	e8 2e 2a 00 00       	call   6724 <open>
+    3cf6:	83 c4 10             	add    $0x10,%esp
+    3cf9:	85 c0                	test   %eax,%eax
+    3cfb:	78 17                	js     3d14 <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    3cfd:	83 ec 08             	sub    $0x8,%esp
+    3d00:	68 7c 7f 00 00       	push   $0x7f7c
+    3d05:	6a 01                	push   $0x1
+    3d07:	e8 b4 2b 00 00       	call   68c0 <printf>
+    3d0c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d0f:	e8 d0 29 00 00       	call   66e4 <exit>
+  }
+
+  fd = open("lf2", 0);
+    3d14:	83 ec 08             	sub    $0x8,%esp
+    3d17:	6a 00                	push   $0x0
+    3d19:	68 3b 7f 00 00       	push   $0x7f3b
+    3d1e:	e8 01 2a 00 00       	call   6724 <open>
+    3d23:	83 c4 10             	add    $0x10,%esp
+    3d26:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3d29:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3d2d:	79 17                	jns    3d46 <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    3d2f:	83 ec 08             	sub    $0x8,%esp
+    3d32:	68 a1 7f 00 00       	push   $0x7fa1
+    3d37:	6a 01                	push   $0x1
+    3d39:	e8 82 2b 00 00       	call   68c0 <printf>
+    3d3e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d41:	e8 9e 29 00 00       	call   66e4 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    3d46:	83 ec 04             	sub    $0x4,%esp
+    3d49:	68 00 20 00 00       	push   $0x2000
+    3d4e:	68 20 9a 00 00       	push   $0x9a20
+    3d53:	ff 75 f4             	push   -0xc(%ebp)
+    3d56:	e8 a1 29 00 00       	call   66fc <read>
+    3d5b:	83 c4 10             	add    $0x10,%esp
+    3d5e:	83 f8 05             	cmp    $0x5,%eax
+    3d61:	74 17                	je     3d7a <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    3d63:	83 ec 08             	sub    $0x8,%esp
+    3d66:	68 b2 7f 00 00       	push   $0x7fb2
+    3d6b:	6a 01                	push   $0x1
+    3d6d:	e8 4e 2b 00 00       	call   68c0 <printf>
+    3d72:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d75:	e8 6a 29 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    3d7a:	83 ec 0c             	sub    $0xc,%esp
+    3d7d:	ff 75 f4             	push   -0xc(%ebp)
+    3d80:	e8 87 29 00 00       	call   670c <close>
+    3d85:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    3d88:	83 ec 08             	sub    $0x8,%esp
+    3d8b:	68 3b 7f 00 00       	push   $0x7f3b
+    3d90:	68 3b 7f 00 00       	push   $0x7f3b
+    3d95:	e8 aa 29 00 00       	call   6744 <link>
+    3d9a:	83 c4 10             	add    $0x10,%esp
+    3d9d:	85 c0                	test   %eax,%eax
+    3d9f:	78 17                	js     3db8 <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    3da1:	83 ec 08             	sub    $0x8,%esp
+    3da4:	68 c3 7f 00 00       	push   $0x7fc3
+    3da9:	6a 01                	push   $0x1
+    3dab:	e8 10 2b 00 00       	call   68c0 <printf>
+    3db0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3db3:	e8 2c 29 00 00       	call   66e4 <exit>
+  }
+
+  unlink("lf2");
+    3db8:	83 ec 0c             	sub    $0xc,%esp
+    3dbb:	68 3b 7f 00 00       	push   $0x7f3b
+    3dc0:	e8 6f 29 00 00       	call   6734 <unlink>
+    3dc5:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    3dc8:	83 ec 08             	sub    $0x8,%esp
+    3dcb:	68 37 7f 00 00       	push   $0x7f37
+    3dd0:	68 3b 7f 00 00       	push   $0x7f3b
+    3dd5:	e8 6a 29 00 00       	call   6744 <link>
+    3dda:	83 c4 10             	add    $0x10,%esp
+    3ddd:	85 c0                	test   %eax,%eax
+    3ddf:	78 17                	js     3df8 <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    3de1:	83 ec 08             	sub    $0x8,%esp
+    3de4:	68 e4 7f 00 00       	push   $0x7fe4
+    3de9:	6a 01                	push   $0x1
+    3deb:	e8 d0 2a 00 00       	call   68c0 <printf>
+    3df0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3df3:	e8 ec 28 00 00       	call   66e4 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    3df8:	83 ec 08             	sub    $0x8,%esp
+    3dfb:	68 37 7f 00 00       	push   $0x7f37
+    3e00:	68 07 80 00 00       	push   $0x8007
+    3e05:	e8 3a 29 00 00       	call   6744 <link>
+    3e0a:	83 c4 10             	add    $0x10,%esp
+    3e0d:	85 c0                	test   %eax,%eax
+    3e0f:	78 17                	js     3e28 <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    3e11:	83 ec 08             	sub    $0x8,%esp
+    3e14:	68 09 80 00 00       	push   $0x8009
+    3e19:	6a 01                	push   $0x1
+    3e1b:	e8 a0 2a 00 00       	call   68c0 <printf>
+    3e20:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3e23:	e8 bc 28 00 00       	call   66e4 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    3e28:	83 ec 08             	sub    $0x8,%esp
+    3e2b:	68 25 80 00 00       	push   $0x8025
+    3e30:	6a 01                	push   $0x1
+    3e32:	e8 89 2a 00 00       	call   68c0 <printf>
+    3e37:	83 c4 10             	add    $0x10,%esp
+}
+    3e3a:	90                   	nop
+    3e3b:	c9                   	leave
+    3e3c:	c3                   	ret
+
+00003e3d <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    3e3d:	55                   	push   %ebp
+    3e3e:	89 e5                	mov    %esp,%ebp
+    3e40:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    3e43:	83 ec 08             	sub    $0x8,%esp
+    3e46:	68 32 80 00 00       	push   $0x8032
+    3e4b:	6a 01                	push   $0x1
+    3e4d:	e8 6e 2a 00 00       	call   68c0 <printf>
+    3e52:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    3e55:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    3e59:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    3e5d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3e64:	e9 fc 00 00 00       	jmp    3f65 <concreate+0x128>
+    file[1] = '0' + i;
+    3e69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e6c:	83 c0 30             	add    $0x30,%eax
+    3e6f:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    3e72:	83 ec 0c             	sub    $0xc,%esp
+    3e75:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3e78:	50                   	push   %eax
+    3e79:	e8 b6 28 00 00       	call   6734 <unlink>
+    3e7e:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    3e81:	e8 56 28 00 00       	call   66dc <fork>
+    3e86:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    3e89:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3e8d:	74 3b                	je     3eca <concreate+0x8d>
+    3e8f:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3e92:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    3e97:	89 c8                	mov    %ecx,%eax
+    3e99:	f7 ea                	imul   %edx
+    3e9b:	89 c8                	mov    %ecx,%eax
+    3e9d:	c1 f8 1f             	sar    $0x1f,%eax
+    3ea0:	29 c2                	sub    %eax,%edx
+    3ea2:	89 d0                	mov    %edx,%eax
+    3ea4:	01 c0                	add    %eax,%eax
+    3ea6:	01 d0                	add    %edx,%eax
+    3ea8:	29 c1                	sub    %eax,%ecx
+    3eaa:	89 ca                	mov    %ecx,%edx
+    3eac:	83 fa 01             	cmp    $0x1,%edx
+    3eaf:	75 19                	jne    3eca <concreate+0x8d>
+      link("C0", file);
+    3eb1:	83 ec 08             	sub    $0x8,%esp
+    3eb4:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3eb7:	50                   	push   %eax
+    3eb8:	68 42 80 00 00       	push   $0x8042
+    3ebd:	e8 82 28 00 00       	call   6744 <link>
+    3ec2:	83 c4 10             	add    $0x10,%esp
+    3ec5:	e9 87 00 00 00       	jmp    3f51 <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    3eca:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3ece:	75 3b                	jne    3f0b <concreate+0xce>
+    3ed0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3ed3:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3ed8:	89 c8                	mov    %ecx,%eax
+    3eda:	f7 ea                	imul   %edx
+    3edc:	d1 fa                	sar    %edx
+    3ede:	89 c8                	mov    %ecx,%eax
+    3ee0:	c1 f8 1f             	sar    $0x1f,%eax
+    3ee3:	29 c2                	sub    %eax,%edx
+    3ee5:	89 d0                	mov    %edx,%eax
+    3ee7:	c1 e0 02             	shl    $0x2,%eax
+    3eea:	01 d0                	add    %edx,%eax
+    3eec:	29 c1                	sub    %eax,%ecx
+    3eee:	89 ca                	mov    %ecx,%edx
+    3ef0:	83 fa 01             	cmp    $0x1,%edx
+    3ef3:	75 16                	jne    3f0b <concreate+0xce>
+      link("C0", file);
+    3ef5:	83 ec 08             	sub    $0x8,%esp
+    3ef8:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3efb:	50                   	push   %eax
+    3efc:	68 42 80 00 00       	push   $0x8042
+    3f01:	e8 3e 28 00 00       	call   6744 <link>
+    3f06:	83 c4 10             	add    $0x10,%esp
+    3f09:	eb 46                	jmp    3f51 <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    3f0b:	83 ec 08             	sub    $0x8,%esp
+    3f0e:	68 02 02 00 00       	push   $0x202
+    3f13:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3f16:	50                   	push   %eax
+    3f17:	e8 08 28 00 00       	call   6724 <open>
+    3f1c:	83 c4 10             	add    $0x10,%esp
+    3f1f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    3f22:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3f26:	79 1b                	jns    3f43 <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    3f28:	83 ec 04             	sub    $0x4,%esp
+    3f2b:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3f2e:	50                   	push   %eax
+    3f2f:	68 45 80 00 00       	push   $0x8045
+    3f34:	6a 01                	push   $0x1
+    3f36:	e8 85 29 00 00       	call   68c0 <printf>
+    3f3b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3f3e:	e8 a1 27 00 00       	call   66e4 <exit>
+      }
+      close(fd);
+    3f43:	83 ec 0c             	sub    $0xc,%esp
+    3f46:	ff 75 ec             	push   -0x14(%ebp)
+    3f49:	e8 be 27 00 00       	call   670c <close>
+    3f4e:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    3f51:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3f55:	75 05                	jne    3f5c <concreate+0x11f>
+      exit();
+    3f57:	e8 88 27 00 00       	call   66e4 <exit>
+    else
+      wait();
+    3f5c:	e8 8b 27 00 00       	call   66ec <wait>
+  for(i = 0; i < 40; i++){
+    3f61:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3f65:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    3f69:	0f 8e fa fe ff ff    	jle    3e69 <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    3f6f:	83 ec 04             	sub    $0x4,%esp
+    3f72:	6a 28                	push   $0x28
+    3f74:	6a 00                	push   $0x0
+    3f76:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    3f79:	50                   	push   %eax
+    3f7a:	e8 ca 25 00 00       	call   6549 <memset>
+    3f7f:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    3f82:	83 ec 08             	sub    $0x8,%esp
+    3f85:	6a 00                	push   $0x0
+    3f87:	68 07 80 00 00       	push   $0x8007
+    3f8c:	e8 93 27 00 00       	call   6724 <open>
+    3f91:	83 c4 10             	add    $0x10,%esp
+    3f94:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    3f97:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    3f9e:	e9 99 00 00 00       	jmp    403c <concreate+0x1ff>
+    if(de.inum == 0)
+    3fa3:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    3fa7:	66 85 c0             	test   %ax,%ax
+    3faa:	0f 84 8b 00 00 00    	je     403b <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    3fb0:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    3fb4:	3c 43                	cmp    $0x43,%al
+    3fb6:	0f 85 80 00 00 00    	jne    403c <concreate+0x1ff>
+    3fbc:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    3fc0:	84 c0                	test   %al,%al
+    3fc2:	75 78                	jne    403c <concreate+0x1ff>
+      i = de.name[1] - '0';
+    3fc4:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    3fc8:	0f be c0             	movsbl %al,%eax
+    3fcb:	83 e8 30             	sub    $0x30,%eax
+    3fce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    3fd1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3fd5:	78 08                	js     3fdf <concreate+0x1a2>
+    3fd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3fda:	83 f8 27             	cmp    $0x27,%eax
+    3fdd:	76 1e                	jbe    3ffd <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    3fdf:	83 ec 04             	sub    $0x4,%esp
+    3fe2:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    3fe5:	83 c0 02             	add    $0x2,%eax
+    3fe8:	50                   	push   %eax
+    3fe9:	68 61 80 00 00       	push   $0x8061
+    3fee:	6a 01                	push   $0x1
+    3ff0:	e8 cb 28 00 00       	call   68c0 <printf>
+    3ff5:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3ff8:	e8 e7 26 00 00       	call   66e4 <exit>
+      }
+      if(fa[i]){
+    3ffd:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    4000:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4003:	01 d0                	add    %edx,%eax
+    4005:	0f b6 00             	movzbl (%eax),%eax
+    4008:	84 c0                	test   %al,%al
+    400a:	74 1e                	je     402a <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    400c:	83 ec 04             	sub    $0x4,%esp
+    400f:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    4012:	83 c0 02             	add    $0x2,%eax
+    4015:	50                   	push   %eax
+    4016:	68 7a 80 00 00       	push   $0x807a
+    401b:	6a 01                	push   $0x1
+    401d:	e8 9e 28 00 00       	call   68c0 <printf>
+    4022:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4025:	e8 ba 26 00 00       	call   66e4 <exit>
+      }
+      fa[i] = 1;
+    402a:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    402d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4030:	01 d0                	add    %edx,%eax
+    4032:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    4035:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4039:	eb 01                	jmp    403c <concreate+0x1ff>
+      continue;
+    403b:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    403c:	83 ec 04             	sub    $0x4,%esp
+    403f:	6a 10                	push   $0x10
+    4041:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    4044:	50                   	push   %eax
+    4045:	ff 75 ec             	push   -0x14(%ebp)
+    4048:	e8 af 26 00 00       	call   66fc <read>
+    404d:	83 c4 10             	add    $0x10,%esp
+    4050:	85 c0                	test   %eax,%eax
+    4052:	0f 8f 4b ff ff ff    	jg     3fa3 <concreate+0x166>
+    }
+  }
+  close(fd);
+    4058:	83 ec 0c             	sub    $0xc,%esp
+    405b:	ff 75 ec             	push   -0x14(%ebp)
+    405e:	e8 a9 26 00 00       	call   670c <close>
+    4063:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    4066:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    406a:	74 17                	je     4083 <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    406c:	83 ec 08             	sub    $0x8,%esp
+    406f:	68 98 80 00 00       	push   $0x8098
+    4074:	6a 01                	push   $0x1
+    4076:	e8 45 28 00 00       	call   68c0 <printf>
+    407b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    407e:	e8 61 26 00 00       	call   66e4 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    4083:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    408a:	e9 43 01 00 00       	jmp    41d2 <concreate+0x395>
+    file[1] = '0' + i;
+    408f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4092:	83 c0 30             	add    $0x30,%eax
+    4095:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    4098:	e8 3f 26 00 00       	call   66dc <fork>
+    409d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    40a0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    40a4:	79 17                	jns    40bd <concreate+0x280>
+      printf(1, "fork failed\n");
+    40a6:	83 ec 08             	sub    $0x8,%esp
+    40a9:	68 19 6d 00 00       	push   $0x6d19
+    40ae:	6a 01                	push   $0x1
+    40b0:	e8 0b 28 00 00       	call   68c0 <printf>
+    40b5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    40b8:	e8 27 26 00 00       	call   66e4 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    40bd:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    40c0:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    40c5:	89 c8                	mov    %ecx,%eax
+    40c7:	f7 ea                	imul   %edx
+    40c9:	89 c8                	mov    %ecx,%eax
+    40cb:	c1 f8 1f             	sar    $0x1f,%eax
+    40ce:	29 c2                	sub    %eax,%edx
+    40d0:	89 d0                	mov    %edx,%eax
+    40d2:	01 c0                	add    %eax,%eax
+    40d4:	01 d0                	add    %edx,%eax
+    40d6:	29 c1                	sub    %eax,%ecx
+    40d8:	89 ca                	mov    %ecx,%edx
+    40da:	85 d2                	test   %edx,%edx
+    40dc:	75 06                	jne    40e4 <concreate+0x2a7>
+    40de:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    40e2:	74 28                	je     410c <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    40e4:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    40e7:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    40ec:	89 c8                	mov    %ecx,%eax
+    40ee:	f7 ea                	imul   %edx
+    40f0:	89 c8                	mov    %ecx,%eax
+    40f2:	c1 f8 1f             	sar    $0x1f,%eax
+    40f5:	29 c2                	sub    %eax,%edx
+    40f7:	89 d0                	mov    %edx,%eax
+    40f9:	01 c0                	add    %eax,%eax
+    40fb:	01 d0                	add    %edx,%eax
+    40fd:	29 c1                	sub    %eax,%ecx
+    40ff:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    4101:	83 fa 01             	cmp    $0x1,%edx
+    4104:	75 7c                	jne    4182 <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    4106:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    410a:	74 76                	je     4182 <concreate+0x345>
+      close(open(file, 0));
+    410c:	83 ec 08             	sub    $0x8,%esp
+    410f:	6a 00                	push   $0x0
+    4111:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    4114:	50                   	push   %eax
+    4115:	e8 0a 26 00 00       	call   6724 <open>
+    411a:	83 c4 10             	add    $0x10,%esp
+    411d:	83 ec 0c             	sub    $0xc,%esp
+    4120:	50                   	push   %eax
+    4121:	e8 e6 25 00 00       	call   670c <close>
+    4126:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    4129:	83 ec 08             	sub    $0x8,%esp
+    412c:	6a 00                	push   $0x0
+    412e:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    4131:	50                   	push   %eax
+    4132:	e8 ed 25 00 00       	call   6724 <open>
+    4137:	83 c4 10             	add    $0x10,%esp
+    413a:	83 ec 0c             	sub    $0xc,%esp
+    413d:	50                   	push   %eax
+    413e:	e8 c9 25 00 00       	call   670c <close>
+    4143:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    4146:	83 ec 08             	sub    $0x8,%esp
+    4149:	6a 00                	push   $0x0
+    414b:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    414e:	50                   	push   %eax
+    414f:	e8 d0 25 00 00       	call   6724 <open>
+    4154:	83 c4 10             	add    $0x10,%esp
+    4157:	83 ec 0c             	sub    $0xc,%esp
+    415a:	50                   	push   %eax
+    415b:	e8 ac 25 00 00       	call   670c <close>
+    4160:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    4163:	83 ec 08             	sub    $0x8,%esp
+    4166:	6a 00                	push   $0x0
+    4168:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    416b:	50                   	push   %eax
+    416c:	e8 b3 25 00 00       	call   6724 <open>
+    4171:	83 c4 10             	add    $0x10,%esp
+    4174:	83 ec 0c             	sub    $0xc,%esp
+    4177:	50                   	push   %eax
+    4178:	e8 8f 25 00 00       	call   670c <close>
+    417d:	83 c4 10             	add    $0x10,%esp
+    4180:	eb 3c                	jmp    41be <concreate+0x381>
+    } else {
+      unlink(file);
+    4182:	83 ec 0c             	sub    $0xc,%esp
+    4185:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    4188:	50                   	push   %eax
+    4189:	e8 a6 25 00 00       	call   6734 <unlink>
+    418e:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    4191:	83 ec 0c             	sub    $0xc,%esp
+    4194:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    4197:	50                   	push   %eax
+    4198:	e8 97 25 00 00       	call   6734 <unlink>
+    419d:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    41a0:	83 ec 0c             	sub    $0xc,%esp
+    41a3:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    41a6:	50                   	push   %eax
+    41a7:	e8 88 25 00 00       	call   6734 <unlink>
+    41ac:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    41af:	83 ec 0c             	sub    $0xc,%esp
+    41b2:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    41b5:	50                   	push   %eax
+    41b6:	e8 79 25 00 00       	call   6734 <unlink>
+    41bb:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    41be:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    41c2:	75 05                	jne    41c9 <concreate+0x38c>
+      exit();
+    41c4:	e8 1b 25 00 00       	call   66e4 <exit>
+    else
+      wait();
+    41c9:	e8 1e 25 00 00       	call   66ec <wait>
+  for(i = 0; i < 40; i++){
+    41ce:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    41d2:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    41d6:	0f 8e b3 fe ff ff    	jle    408f <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    41dc:	83 ec 08             	sub    $0x8,%esp
+    41df:	68 c9 80 00 00       	push   $0x80c9
+    41e4:	6a 01                	push   $0x1
+    41e6:	e8 d5 26 00 00       	call   68c0 <printf>
+    41eb:	83 c4 10             	add    $0x10,%esp
+}
+    41ee:	90                   	nop
+    41ef:	c9                   	leave
+    41f0:	c3                   	ret
+
+000041f1 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    41f1:	55                   	push   %ebp
+    41f2:	89 e5                	mov    %esp,%ebp
+    41f4:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    41f7:	83 ec 08             	sub    $0x8,%esp
+    41fa:	68 d7 80 00 00       	push   $0x80d7
+    41ff:	6a 01                	push   $0x1
+    4201:	e8 ba 26 00 00       	call   68c0 <printf>
+    4206:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    4209:	83 ec 0c             	sub    $0xc,%esp
+    420c:	68 c4 78 00 00       	push   $0x78c4
+    4211:	e8 1e 25 00 00       	call   6734 <unlink>
+    4216:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    4219:	e8 be 24 00 00       	call   66dc <fork>
+    421e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    4221:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4225:	79 17                	jns    423e <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    4227:	83 ec 08             	sub    $0x8,%esp
+    422a:	68 19 6d 00 00       	push   $0x6d19
+    422f:	6a 01                	push   $0x1
+    4231:	e8 8a 26 00 00       	call   68c0 <printf>
+    4236:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4239:	e8 a6 24 00 00       	call   66e4 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    423e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4242:	74 07                	je     424b <linkunlink+0x5a>
+    4244:	b8 01 00 00 00       	mov    $0x1,%eax
+    4249:	eb 05                	jmp    4250 <linkunlink+0x5f>
+    424b:	b8 61 00 00 00       	mov    $0x61,%eax
+    4250:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    4253:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    425a:	e9 98 00 00 00       	jmp    42f7 <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    425f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4262:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    4268:	05 39 30 00 00       	add    $0x3039,%eax
+    426d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    4270:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    4273:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    4278:	89 c8                	mov    %ecx,%eax
+    427a:	f7 e2                	mul    %edx
+    427c:	d1 ea                	shr    %edx
+    427e:	89 d0                	mov    %edx,%eax
+    4280:	01 c0                	add    %eax,%eax
+    4282:	01 d0                	add    %edx,%eax
+    4284:	29 c1                	sub    %eax,%ecx
+    4286:	89 ca                	mov    %ecx,%edx
+    4288:	85 d2                	test   %edx,%edx
+    428a:	75 23                	jne    42af <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    428c:	83 ec 08             	sub    $0x8,%esp
+    428f:	68 02 02 00 00       	push   $0x202
+    4294:	68 c4 78 00 00       	push   $0x78c4
+    4299:	e8 86 24 00 00       	call   6724 <open>
+    429e:	83 c4 10             	add    $0x10,%esp
+    42a1:	83 ec 0c             	sub    $0xc,%esp
+    42a4:	50                   	push   %eax
+    42a5:	e8 62 24 00 00       	call   670c <close>
+    42aa:	83 c4 10             	add    $0x10,%esp
+    42ad:	eb 44                	jmp    42f3 <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    42af:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    42b2:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    42b7:	89 c8                	mov    %ecx,%eax
+    42b9:	f7 e2                	mul    %edx
+    42bb:	d1 ea                	shr    %edx
+    42bd:	89 d0                	mov    %edx,%eax
+    42bf:	01 c0                	add    %eax,%eax
+    42c1:	01 d0                	add    %edx,%eax
+    42c3:	29 c1                	sub    %eax,%ecx
+    42c5:	89 ca                	mov    %ecx,%edx
+    42c7:	83 fa 01             	cmp    $0x1,%edx
+    42ca:	75 17                	jne    42e3 <linkunlink+0xf2>
+      link("cat", "x");
+    42cc:	83 ec 08             	sub    $0x8,%esp
+    42cf:	68 c4 78 00 00       	push   $0x78c4
+    42d4:	68 e8 80 00 00       	push   $0x80e8
+    42d9:	e8 66 24 00 00       	call   6744 <link>
+    42de:	83 c4 10             	add    $0x10,%esp
+    42e1:	eb 10                	jmp    42f3 <linkunlink+0x102>
+    } else {
+      unlink("x");
+    42e3:	83 ec 0c             	sub    $0xc,%esp
+    42e6:	68 c4 78 00 00       	push   $0x78c4
+    42eb:	e8 44 24 00 00       	call   6734 <unlink>
+    42f0:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    42f3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    42f7:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    42fb:	0f 8e 5e ff ff ff    	jle    425f <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    4301:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4305:	74 07                	je     430e <linkunlink+0x11d>
+    wait();
+    4307:	e8 e0 23 00 00       	call   66ec <wait>
+    430c:	eb 05                	jmp    4313 <linkunlink+0x122>
+  else 
+    exit();
+    430e:	e8 d1 23 00 00       	call   66e4 <exit>
+
+  printf(1, "linkunlink ok\n");
+    4313:	83 ec 08             	sub    $0x8,%esp
+    4316:	68 ec 80 00 00       	push   $0x80ec
+    431b:	6a 01                	push   $0x1
+    431d:	e8 9e 25 00 00       	call   68c0 <printf>
+    4322:	83 c4 10             	add    $0x10,%esp
+}
+    4325:	90                   	nop
+    4326:	c9                   	leave
+    4327:	c3                   	ret
+
+00004328 <dxdottest>:
+// directory that uses indirect blocks
+// "." and ".." must still be found once a directory has
+// grown big enough to be hash-indexed.
+void
+dxdottest(void)
+{
+    4328:	55                   	push   %ebp
+    4329:	89 e5                	mov    %esp,%ebp
+    432b:	83 ec 68             	sub    $0x68,%esp
+  struct stat st0, st1, st2;
+  char path[16];
+  int i, fd;
+
+  printf(1, "indexed dot test\n");
+    432e:	83 ec 08             	sub    $0x8,%esp
+    4331:	68 fb 80 00 00       	push   $0x80fb
+    4336:	6a 01                	push   $0x1
+    4338:	e8 83 25 00 00       	call   68c0 <printf>
+    433d:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dxdot") < 0){
+    4340:	83 ec 0c             	sub    $0xc,%esp
+    4343:	68 0d 81 00 00       	push   $0x810d
+    4348:	e8 ff 23 00 00       	call   674c <mkdir>
+    434d:	83 c4 10             	add    $0x10,%esp
+    4350:	85 c0                	test   %eax,%eax
+    4352:	79 17                	jns    436b <dxdottest+0x43>
+    printf(1, "mkdir dxdot failed\n");
+    4354:	83 ec 08             	sub    $0x8,%esp
+    4357:	68 13 81 00 00       	push   $0x8113
+    435c:	6a 01                	push   $0x1
+    435e:	e8 5d 25 00 00       	call   68c0 <printf>
+    4363:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4366:	e8 79 23 00 00       	call   66e4 <exit>
+  }
+  strcpy(path, "dxdot/f00");
+    436b:	83 ec 08             	sub    $0x8,%esp
+    436e:	68 27 81 00 00       	push   $0x8127
+    4373:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4376:	50                   	push   %eax
+    4377:	e8 37 21 00 00       	call   64b3 <strcpy>
+    437c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    437f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4386:	e9 8f 00 00 00       	jmp    441a <dxdottest+0xf2>
+    path[7] = '0' + i / 10;
+    438b:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    438e:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4393:	89 c8                	mov    %ecx,%eax
+    4395:	f7 ea                	imul   %edx
+    4397:	c1 fa 02             	sar    $0x2,%edx
+    439a:	89 c8                	mov    %ecx,%eax
+    439c:	c1 f8 1f             	sar    $0x1f,%eax
+    439f:	29 c2                	sub    %eax,%edx
+    43a1:	89 d0                	mov    %edx,%eax
+    43a3:	83 c0 30             	add    $0x30,%eax
+    43a6:	88 45 ab             	mov    %al,-0x55(%ebp)
+    path[8] = '0' + i % 10;
+    43a9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    43ac:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    43b1:	89 c8                	mov    %ecx,%eax
+    43b3:	f7 ea                	imul   %edx
+    43b5:	c1 fa 02             	sar    $0x2,%edx
+    43b8:	89 c8                	mov    %ecx,%eax
+    43ba:	c1 f8 1f             	sar    $0x1f,%eax
+    43bd:	29 c2                	sub    %eax,%edx
+    43bf:	89 d0                	mov    %edx,%eax
+    43c1:	c1 e0 02             	shl    $0x2,%eax
+    43c4:	01 d0                	add    %edx,%eax
+    43c6:	01 c0                	add    %eax,%eax
+    43c8:	29 c1                	sub    %eax,%ecx
+    43ca:	89 ca                	mov    %ecx,%edx
+    43cc:	89 d0                	mov    %edx,%eax
+    43ce:	83 c0 30             	add    $0x30,%eax
+    43d1:	88 45 ac             	mov    %al,-0x54(%ebp)
+    if((fd = open(path, O_CREATE)) < 0){
+    43d4:	83 ec 08             	sub    $0x8,%esp
+    43d7:	68 00 02 00 00       	push   $0x200
+    43dc:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    43df:	50                   	push   %eax
+    43e0:	e8 3f 23 00 00       	call   6724 <open>
+    43e5:	83 c4 10             	add    $0x10,%esp
+    43e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    43eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    43ef:	79 17                	jns    4408 <dxdottest+0xe0>
+      printf(1, "create in dxdot failed\n");
+    43f1:	83 ec 08             	sub    $0x8,%esp
+    43f4:	68 31 81 00 00       	push   $0x8131
+    43f9:	6a 01                	push   $0x1
+    43fb:	e8 c0 24 00 00       	call   68c0 <printf>
+    4400:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4403:	e8 dc 22 00 00       	call   66e4 <exit>
+    }
+    close(fd);
+    4408:	83 ec 0c             	sub    $0xc,%esp
+    440b:	ff 75 f0             	push   -0x10(%ebp)
+    440e:	e8 f9 22 00 00       	call   670c <close>
+    4413:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    4416:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    441a:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    441e:	0f 8e 67 ff ff ff    	jle    438b <dxdottest+0x63>
+  }
+  if(stat("dxdot", &st0) < 0 || stat("dxdot/.", &st1) < 0 ||
+    4424:	83 ec 08             	sub    $0x8,%esp
+    4427:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    442a:	50                   	push   %eax
+    442b:	68 0d 81 00 00       	push   $0x810d
+    4430:	e8 d0 21 00 00       	call   6605 <stat>
+    4435:	83 c4 10             	add    $0x10,%esp
+    4438:	85 c0                	test   %eax,%eax
+    443a:	78 22                	js     445e <dxdottest+0x136>
+    443c:	83 ec 08             	sub    $0x8,%esp
+    443f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    4442:	50                   	push   %eax
+    4443:	68 49 81 00 00       	push   $0x8149
+    4448:	e8 b8 21 00 00       	call   6605 <stat>
+    444d:	83 c4 10             	add    $0x10,%esp
+    4450:	85 c0                	test   %eax,%eax
+    4452:	78 0a                	js     445e <dxdottest+0x136>
+     st1.ino != st0.ino){
+    4454:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    4457:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  if(stat("dxdot", &st0) < 0 || stat("dxdot/.", &st1) < 0 ||
+    445a:	39 c2                	cmp    %eax,%edx
+    445c:	74 17                	je     4475 <dxdottest+0x14d>
+    printf(1, "dxdot/. not found\n");
+    445e:	83 ec 08             	sub    $0x8,%esp
+    4461:	68 51 81 00 00       	push   $0x8151
+    4466:	6a 01                	push   $0x1
+    4468:	e8 53 24 00 00       	call   68c0 <printf>
+    446d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4470:	e8 6f 22 00 00       	call   66e4 <exit>
+  }
+  if(stat(".", &st0) < 0 || stat("dxdot/..", &st2) < 0 ||
+    4475:	83 ec 08             	sub    $0x8,%esp
+    4478:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    447b:	50                   	push   %eax
+    447c:	68 07 80 00 00       	push   $0x8007
+    4481:	e8 7f 21 00 00       	call   6605 <stat>
+    4486:	83 c4 10             	add    $0x10,%esp
+    4489:	85 c0                	test   %eax,%eax
+    448b:	78 22                	js     44af <dxdottest+0x187>
+    448d:	83 ec 08             	sub    $0x8,%esp
+    4490:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    4493:	50                   	push   %eax
+    4494:	68 64 81 00 00       	push   $0x8164
+    4499:	e8 67 21 00 00       	call   6605 <stat>
+    449e:	83 c4 10             	add    $0x10,%esp
+    44a1:	85 c0                	test   %eax,%eax
+    44a3:	78 0a                	js     44af <dxdottest+0x187>
+     st2.ino != st0.ino){
+    44a5:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    44a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  if(stat(".", &st0) < 0 || stat("dxdot/..", &st2) < 0 ||
+    44ab:	39 c2                	cmp    %eax,%edx
+    44ad:	74 17                	je     44c6 <dxdottest+0x19e>
+    printf(1, "dxdot/.. not found\n");
+    44af:	83 ec 08             	sub    $0x8,%esp
+    44b2:	68 6d 81 00 00       	push   $0x816d
+    44b7:	6a 01                	push   $0x1
+    44b9:	e8 02 24 00 00       	call   68c0 <printf>
+    44be:	83 c4 10             	add    $0x10,%esp
+    exit();
+    44c1:	e8 1e 22 00 00       	call   66e4 <exit>
+  }
+  if(chdir("dxdot") < 0 || chdir("..") < 0){
+    44c6:	83 ec 0c             	sub    $0xc,%esp
+    44c9:	68 0d 81 00 00       	push   $0x810d
+    44ce:	e8 81 22 00 00       	call   6754 <chdir>
+    44d3:	83 c4 10             	add    $0x10,%esp
+    44d6:	85 c0                	test   %eax,%eax
+    44d8:	78 14                	js     44ee <dxdottest+0x1c6>
+    44da:	83 ec 0c             	sub    $0xc,%esp
+    44dd:	68 0b 78 00 00       	push   $0x780b
+    44e2:	e8 6d 22 00 00       	call   6754 <chdir>
+    44e7:	83 c4 10             	add    $0x10,%esp
+    44ea:	85 c0                	test   %eax,%eax
+    44ec:	79 17                	jns    4505 <dxdottest+0x1dd>
+    printf(1, "chdir dxdot/.. failed\n");
+    44ee:	83 ec 08             	sub    $0x8,%esp
+    44f1:	68 81 81 00 00       	push   $0x8181
+    44f6:	6a 01                	push   $0x1
+    44f8:	e8 c3 23 00 00       	call   68c0 <printf>
+    44fd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4500:	e8 df 21 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; i < 100; i++){
+    4505:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    450c:	eb 77                	jmp    4585 <dxdottest+0x25d>
+    path[7] = '0' + i / 10;
+    450e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4511:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4516:	89 c8                	mov    %ecx,%eax
+    4518:	f7 ea                	imul   %edx
+    451a:	c1 fa 02             	sar    $0x2,%edx
+    451d:	89 c8                	mov    %ecx,%eax
+    451f:	c1 f8 1f             	sar    $0x1f,%eax
+    4522:	29 c2                	sub    %eax,%edx
+    4524:	89 d0                	mov    %edx,%eax
+    4526:	83 c0 30             	add    $0x30,%eax
+    4529:	88 45 ab             	mov    %al,-0x55(%ebp)
+    path[8] = '0' + i % 10;
+    452c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    452f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4534:	89 c8                	mov    %ecx,%eax
+    4536:	f7 ea                	imul   %edx
+    4538:	c1 fa 02             	sar    $0x2,%edx
+    453b:	89 c8                	mov    %ecx,%eax
+    453d:	c1 f8 1f             	sar    $0x1f,%eax
+    4540:	29 c2                	sub    %eax,%edx
+    4542:	89 d0                	mov    %edx,%eax
+    4544:	c1 e0 02             	shl    $0x2,%eax
+    4547:	01 d0                	add    %edx,%eax
+    4549:	01 c0                	add    %eax,%eax
+    454b:	29 c1                	sub    %eax,%ecx
+    454d:	89 ca                	mov    %ecx,%edx
+    454f:	89 d0                	mov    %edx,%eax
+    4551:	83 c0 30             	add    $0x30,%eax
+    4554:	88 45 ac             	mov    %al,-0x54(%ebp)
+    if(unlink(path) < 0){
+    4557:	83 ec 0c             	sub    $0xc,%esp
+    455a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    455d:	50                   	push   %eax
+    455e:	e8 d1 21 00 00       	call   6734 <unlink>
+    4563:	83 c4 10             	add    $0x10,%esp
+    4566:	85 c0                	test   %eax,%eax
+    4568:	79 17                	jns    4581 <dxdottest+0x259>
+      printf(1, "unlink in dxdot failed\n");
+    456a:	83 ec 08             	sub    $0x8,%esp
+    456d:	68 98 81 00 00       	push   $0x8198
+    4572:	6a 01                	push   $0x1
+    4574:	e8 47 23 00 00       	call   68c0 <printf>
+    4579:	83 c4 10             	add    $0x10,%esp
+      exit();
+    457c:	e8 63 21 00 00       	call   66e4 <exit>
+  for(i = 0; i < 100; i++){
+    4581:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4585:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    4589:	7e 83                	jle    450e <dxdottest+0x1e6>
+    }
+  }
+  if(unlink("dxdot") < 0){
+    458b:	83 ec 0c             	sub    $0xc,%esp
+    458e:	68 0d 81 00 00       	push   $0x810d
+    4593:	e8 9c 21 00 00       	call   6734 <unlink>
+    4598:	83 c4 10             	add    $0x10,%esp
+    459b:	85 c0                	test   %eax,%eax
+    459d:	79 17                	jns    45b6 <dxdottest+0x28e>
+    printf(1, "unlink dxdot failed\n");
+    459f:	83 ec 08             	sub    $0x8,%esp
+    45a2:	68 b0 81 00 00       	push   $0x81b0
+    45a7:	6a 01                	push   $0x1
+    45a9:	e8 12 23 00 00       	call   68c0 <printf>
+    45ae:	83 c4 10             	add    $0x10,%esp
+    exit();
+    45b1:	e8 2e 21 00 00       	call   66e4 <exit>
+  }
+  printf(1, "indexed dot ok\n");
+    45b6:	83 ec 08             	sub    $0x8,%esp
+    45b9:	68 c5 81 00 00       	push   $0x81c5
+    45be:	6a 01                	push   $0x1
+    45c0:	e8 fb 22 00 00       	call   68c0 <printf>
+    45c5:	83 c4 10             	add    $0x10,%esp
+}
+    45c8:	90                   	nop
+    45c9:	c9                   	leave
+    45ca:	c3                   	ret
+
+000045cb <bigdir>:
+
+void
+bigdir(void)
+{
+    45cb:	55                   	push   %ebp
+    45cc:	89 e5                	mov    %esp,%ebp
+    45ce:	83 ec 28             	sub    $0x28,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    45d1:	83 ec 08             	sub    $0x8,%esp
+    45d4:	68 d5 81 00 00       	push   $0x81d5
+    45d9:	6a 01                	push   $0x1
+    45db:	e8 e0 22 00 00       	call   68c0 <printf>
+    45e0:	83 c4 10             	add    $0x10,%esp
+  unlink("bd");
+    45e3:	83 ec 0c             	sub    $0xc,%esp
+    45e6:	68 e2 81 00 00       	push   $0x81e2
+    45eb:	e8 44 21 00 00       	call   6734 <unlink>
+    45f0:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bd", O_CREATE);
+    45f3:	83 ec 08             	sub    $0x8,%esp
+    45f6:	68 00 02 00 00       	push   $0x200
+    45fb:	68 e2 81 00 00       	push   $0x81e2
+    4600:	e8 1f 21 00 00       	call   6724 <open>
+    4605:	83 c4 10             	add    $0x10,%esp
+    4608:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    460b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    460f:	79 17                	jns    4628 <bigdir+0x5d>
+    printf(1, "bigdir create failed\n");
+    4611:	83 ec 08             	sub    $0x8,%esp
+    4614:	68 e5 81 00 00       	push   $0x81e5
+    4619:	6a 01                	push   $0x1
+    461b:	e8 a0 22 00 00       	call   68c0 <printf>
+    4620:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4623:	e8 bc 20 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    4628:	83 ec 0c             	sub    $0xc,%esp
+    462b:	ff 75 f0             	push   -0x10(%ebp)
+    462e:	e8 d9 20 00 00       	call   670c <close>
+    4633:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    4636:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    463d:	eb 69                	jmp    46a8 <bigdir+0xdd>
+    name[0] = 'x';
+    463f:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    4643:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4646:	8d 50 3f             	lea    0x3f(%eax),%edx
+    4649:	85 c0                	test   %eax,%eax
+    464b:	0f 48 c2             	cmovs  %edx,%eax
+    464e:	c1 f8 06             	sar    $0x6,%eax
+    4651:	83 c0 30             	add    $0x30,%eax
+    4654:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    4657:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    465a:	89 d0                	mov    %edx,%eax
+    465c:	c1 f8 1f             	sar    $0x1f,%eax
+    465f:	c1 e8 1a             	shr    $0x1a,%eax
+    4662:	01 c2                	add    %eax,%edx
+    4664:	83 e2 3f             	and    $0x3f,%edx
+    4667:	29 c2                	sub    %eax,%edx
+    4669:	89 d0                	mov    %edx,%eax
+    466b:	83 c0 30             	add    $0x30,%eax
+    466e:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    4671:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(link("bd", name) != 0){
+    4675:	83 ec 08             	sub    $0x8,%esp
+    4678:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    467b:	50                   	push   %eax
+    467c:	68 e2 81 00 00       	push   $0x81e2
+    4681:	e8 be 20 00 00       	call   6744 <link>
+    4686:	83 c4 10             	add    $0x10,%esp
+    4689:	85 c0                	test   %eax,%eax
+    468b:	74 17                	je     46a4 <bigdir+0xd9>
+      printf(1, "bigdir link failed\n");
+    468d:	83 ec 08             	sub    $0x8,%esp
+    4690:	68 fb 81 00 00       	push   $0x81fb
+    4695:	6a 01                	push   $0x1
+    4697:	e8 24 22 00 00       	call   68c0 <printf>
+    469c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    469f:	e8 40 20 00 00       	call   66e4 <exit>
+  for(i = 0; i < 500; i++){
+    46a4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    46a8:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    46af:	7e 8e                	jle    463f <bigdir+0x74>
+    }
+  }
+
+  unlink("bd");
+    46b1:	83 ec 0c             	sub    $0xc,%esp
+    46b4:	68 e2 81 00 00       	push   $0x81e2
+    46b9:	e8 76 20 00 00       	call   6734 <unlink>
+    46be:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    46c1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    46c8:	eb 64                	jmp    472e <bigdir+0x163>
+    name[0] = 'x';
+    46ca:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    46ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    46d1:	8d 50 3f             	lea    0x3f(%eax),%edx
+    46d4:	85 c0                	test   %eax,%eax
+    46d6:	0f 48 c2             	cmovs  %edx,%eax
+    46d9:	c1 f8 06             	sar    $0x6,%eax
+    46dc:	83 c0 30             	add    $0x30,%eax
+    46df:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    46e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    46e5:	89 d0                	mov    %edx,%eax
+    46e7:	c1 f8 1f             	sar    $0x1f,%eax
+    46ea:	c1 e8 1a             	shr    $0x1a,%eax
+    46ed:	01 c2                	add    %eax,%edx
+    46ef:	83 e2 3f             	and    $0x3f,%edx
+    46f2:	29 c2                	sub    %eax,%edx
+    46f4:	89 d0                	mov    %edx,%eax
+    46f6:	83 c0 30             	add    $0x30,%eax
+    46f9:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    46fc:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(unlink(name) != 0){
+    4700:	83 ec 0c             	sub    $0xc,%esp
+    4703:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    4706:	50                   	push   %eax
+    4707:	e8 28 20 00 00       	call   6734 <unlink>
+    470c:	83 c4 10             	add    $0x10,%esp
+    470f:	85 c0                	test   %eax,%eax
+    4711:	74 17                	je     472a <bigdir+0x15f>
+      printf(1, "bigdir unlink failed");
+    4713:	83 ec 08             	sub    $0x8,%esp
+    4716:	68 0f 82 00 00       	push   $0x820f
+    471b:	6a 01                	push   $0x1
+    471d:	e8 9e 21 00 00       	call   68c0 <printf>
+    4722:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4725:	e8 ba 1f 00 00       	call   66e4 <exit>
+  for(i = 0; i < 500; i++){
+    472a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    472e:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    4735:	7e 93                	jle    46ca <bigdir+0xff>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    4737:	83 ec 08             	sub    $0x8,%esp
+    473a:	68 24 82 00 00       	push   $0x8224
+    473f:	6a 01                	push   $0x1
+    4741:	e8 7a 21 00 00       	call   68c0 <printf>
+    4746:	83 c4 10             	add    $0x10,%esp
+}
+    4749:	90                   	nop
+    474a:	c9                   	leave
+    474b:	c3                   	ret
+
+0000474c <subdir>:
+
+void
+subdir(void)
+{
+    474c:	55                   	push   %ebp
+    474d:	89 e5                	mov    %esp,%ebp
+    474f:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    4752:	83 ec 08             	sub    $0x8,%esp
+    4755:	68 2f 82 00 00       	push   $0x822f
+    475a:	6a 01                	push   $0x1
+    475c:	e8 5f 21 00 00       	call   68c0 <printf>
+    4761:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    4764:	83 ec 0c             	sub    $0xc,%esp
+    4767:	68 3c 82 00 00       	push   $0x823c
+    476c:	e8 c3 1f 00 00       	call   6734 <unlink>
+    4771:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    4774:	83 ec 0c             	sub    $0xc,%esp
+    4777:	68 3f 82 00 00       	push   $0x823f
+    477c:	e8 cb 1f 00 00       	call   674c <mkdir>
+    4781:	83 c4 10             	add    $0x10,%esp
+    4784:	85 c0                	test   %eax,%eax
+    4786:	74 17                	je     479f <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    4788:	83 ec 08             	sub    $0x8,%esp
+    478b:	68 42 82 00 00       	push   $0x8242
+    4790:	6a 01                	push   $0x1
+    4792:	e8 29 21 00 00       	call   68c0 <printf>
+    4797:	83 c4 10             	add    $0x10,%esp
+    exit();
+    479a:	e8 45 1f 00 00       	call   66e4 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    479f:	83 ec 08             	sub    $0x8,%esp
+    47a2:	68 02 02 00 00       	push   $0x202
+    47a7:	68 5a 82 00 00       	push   $0x825a
+    47ac:	e8 73 1f 00 00       	call   6724 <open>
+    47b1:	83 c4 10             	add    $0x10,%esp
+    47b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    47b7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    47bb:	79 17                	jns    47d4 <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    47bd:	83 ec 08             	sub    $0x8,%esp
+    47c0:	68 60 82 00 00       	push   $0x8260
+    47c5:	6a 01                	push   $0x1
+    47c7:	e8 f4 20 00 00       	call   68c0 <printf>
+    47cc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    47cf:	e8 10 1f 00 00       	call   66e4 <exit>
+  }
+  write(fd, "ff", 2);
+    47d4:	83 ec 04             	sub    $0x4,%esp
+    47d7:	6a 02                	push   $0x2
+    47d9:	68 3c 82 00 00       	push   $0x823c
+    47de:	ff 75 f4             	push   -0xc(%ebp)
+    47e1:	e8 1e 1f 00 00       	call   6704 <write>
+    47e6:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    47e9:	83 ec 0c             	sub    $0xc,%esp
+    47ec:	ff 75 f4             	push   -0xc(%ebp)
+    47ef:	e8 18 1f 00 00       	call   670c <close>
+    47f4:	83 c4 10             	add    $0x10,%esp
+  
+  if(unlink("dd") >= 0){
+    47f7:	83 ec 0c             	sub    $0xc,%esp
+    47fa:	68 3f 82 00 00       	push   $0x823f
+    47ff:	e8 30 1f 00 00       	call   6734 <unlink>
+    4804:	83 c4 10             	add    $0x10,%esp
+    4807:	85 c0                	test   %eax,%eax
+    4809:	78 17                	js     4822 <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    480b:	83 ec 08             	sub    $0x8,%esp
+    480e:	68 78 82 00 00       	push   $0x8278
+    4813:	6a 01                	push   $0x1
+    4815:	e8 a6 20 00 00       	call   68c0 <printf>
+    481a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    481d:	e8 c2 1e 00 00       	call   66e4 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    4822:	83 ec 0c             	sub    $0xc,%esp
+    4825:	68 9e 82 00 00       	push   $0x829e
+    482a:	e8 1d 1f 00 00       	call   674c <mkdir>
+    482f:	83 c4 10             	add    $0x10,%esp
+    4832:	85 c0                	test   %eax,%eax
+    4834:	74 17                	je     484d <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    4836:	83 ec 08             	sub    $0x8,%esp
+    4839:	68 a5 82 00 00       	push   $0x82a5
+    483e:	6a 01                	push   $0x1
+    4840:	e8 7b 20 00 00       	call   68c0 <printf>
+    4845:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4848:	e8 97 1e 00 00       	call   66e4 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    484d:	83 ec 08             	sub    $0x8,%esp
+    4850:	68 02 02 00 00       	push   $0x202
+    4855:	68 c0 82 00 00       	push   $0x82c0
+    485a:	e8 c5 1e 00 00       	call   6724 <open>
+    485f:	83 c4 10             	add    $0x10,%esp
+    4862:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    4865:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4869:	79 17                	jns    4882 <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    486b:	83 ec 08             	sub    $0x8,%esp
+    486e:	68 c9 82 00 00       	push   $0x82c9
+    4873:	6a 01                	push   $0x1
+    4875:	e8 46 20 00 00       	call   68c0 <printf>
+    487a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    487d:	e8 62 1e 00 00       	call   66e4 <exit>
+  }
+  write(fd, "FF", 2);
+    4882:	83 ec 04             	sub    $0x4,%esp
+    4885:	6a 02                	push   $0x2
+    4887:	68 e1 82 00 00       	push   $0x82e1
+    488c:	ff 75 f4             	push   -0xc(%ebp)
+    488f:	e8 70 1e 00 00       	call   6704 <write>
+    4894:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    4897:	83 ec 0c             	sub    $0xc,%esp
+    489a:	ff 75 f4             	push   -0xc(%ebp)
+    489d:	e8 6a 1e 00 00       	call   670c <close>
+    48a2:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    48a5:	83 ec 08             	sub    $0x8,%esp
+    48a8:	6a 00                	push   $0x0
+    48aa:	68 e4 82 00 00       	push   $0x82e4
+    48af:	e8 70 1e 00 00       	call   6724 <open>
+    48b4:	83 c4 10             	add    $0x10,%esp
+    48b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    48ba:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    48be:	79 17                	jns    48d7 <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    48c0:	83 ec 08             	sub    $0x8,%esp
+    48c3:	68 f0 82 00 00       	push   $0x82f0
+    48c8:	6a 01                	push   $0x1
+    48ca:	e8 f1 1f 00 00       	call   68c0 <printf>
+    48cf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    48d2:	e8 0d 1e 00 00       	call   66e4 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    48d7:	83 ec 04             	sub    $0x4,%esp
+    48da:	68 00 20 00 00       	push   $0x2000
+    48df:	68 20 9a 00 00       	push   $0x9a20
+    48e4:	ff 75 f4             	push   -0xc(%ebp)
+    48e7:	e8 10 1e 00 00       	call   66fc <read>
+    48ec:	83 c4 10             	add    $0x10,%esp
+    48ef:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    48f2:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    48f6:	75 0b                	jne    4903 <subdir+0x1b7>
+    48f8:	0f b6 05 20 9a 00 00 	movzbl 0x9a20,%eax
+    48ff:	3c 66                	cmp    $0x66,%al
+    4901:	74 17                	je     491a <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    4903:	83 ec 08             	sub    $0x8,%esp
+    4906:	68 09 83 00 00       	push   $0x8309
+    490b:	6a 01                	push   $0x1
+    490d:	e8 ae 1f 00 00       	call   68c0 <printf>
+    4912:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4915:	e8 ca 1d 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    491a:	83 ec 0c             	sub    $0xc,%esp
+    491d:	ff 75 f4             	push   -0xc(%ebp)
+    4920:	e8 e7 1d 00 00       	call   670c <close>
+    4925:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    4928:	83 ec 08             	sub    $0x8,%esp
+    492b:	68 24 83 00 00       	push   $0x8324
+    4930:	68 c0 82 00 00       	push   $0x82c0
+    4935:	e8 0a 1e 00 00       	call   6744 <link>
+    493a:	83 c4 10             	add    $0x10,%esp
+    493d:	85 c0                	test   %eax,%eax
+    493f:	74 17                	je     4958 <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    4941:	83 ec 08             	sub    $0x8,%esp
+    4944:	68 30 83 00 00       	push   $0x8330
+    4949:	6a 01                	push   $0x1
+    494b:	e8 70 1f 00 00       	call   68c0 <printf>
+    4950:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4953:	e8 8c 1d 00 00       	call   66e4 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    4958:	83 ec 0c             	sub    $0xc,%esp
+    495b:	68 c0 82 00 00       	push   $0x82c0
+    4960:	e8 cf 1d 00 00       	call   6734 <unlink>
+    4965:	83 c4 10             	add    $0x10,%esp
+    4968:	85 c0                	test   %eax,%eax
+    496a:	74 17                	je     4983 <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    496c:	83 ec 08             	sub    $0x8,%esp
+    496f:	68 51 83 00 00       	push   $0x8351
+    4974:	6a 01                	push   $0x1
+    4976:	e8 45 1f 00 00       	call   68c0 <printf>
+    497b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    497e:	e8 61 1d 00 00       	call   66e4 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    4983:	83 ec 08             	sub    $0x8,%esp
+    4986:	6a 00                	push   $0x0
+    4988:	68 c0 82 00 00       	push   $0x82c0
+    498d:	e8 92 1d 00 00       	call   6724 <open>
+    4992:	83 c4 10             	add    $0x10,%esp
+    4995:	85 c0                	test   %eax,%eax
+    4997:	78 17                	js     49b0 <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    4999:	83 ec 08             	sub    $0x8,%esp
+    499c:	68 6c 83 00 00       	push   $0x836c
+    49a1:	6a 01                	push   $0x1
+    49a3:	e8 18 1f 00 00       	call   68c0 <printf>
+    49a8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    49ab:	e8 34 1d 00 00       	call   66e4 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    49b0:	83 ec 0c             	sub    $0xc,%esp
+    49b3:	68 3f 82 00 00       	push   $0x823f
+    49b8:	e8 97 1d 00 00       	call   6754 <chdir>
+    49bd:	83 c4 10             	add    $0x10,%esp
+    49c0:	85 c0                	test   %eax,%eax
+    49c2:	74 17                	je     49db <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    49c4:	83 ec 08             	sub    $0x8,%esp
+    49c7:	68 90 83 00 00       	push   $0x8390
+    49cc:	6a 01                	push   $0x1
+    49ce:	e8 ed 1e 00 00       	call   68c0 <printf>
+    49d3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    49d6:	e8 09 1d 00 00       	call   66e4 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    49db:	83 ec 0c             	sub    $0xc,%esp
+    49de:	68 a1 83 00 00       	push   $0x83a1
+    49e3:	e8 6c 1d 00 00       	call   6754 <chdir>
+    49e8:	83 c4 10             	add    $0x10,%esp
+    49eb:	85 c0                	test   %eax,%eax
+    49ed:	74 17                	je     4a06 <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    49ef:	83 ec 08             	sub    $0x8,%esp
+    49f2:	68 ad 83 00 00       	push   $0x83ad
+    49f7:	6a 01                	push   $0x1
+    49f9:	e8 c2 1e 00 00       	call   68c0 <printf>
+    49fe:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a01:	e8 de 1c 00 00       	call   66e4 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    4a06:	83 ec 0c             	sub    $0xc,%esp
+    4a09:	68 c7 83 00 00       	push   $0x83c7
+    4a0e:	e8 41 1d 00 00       	call   6754 <chdir>
+    4a13:	83 c4 10             	add    $0x10,%esp
+    4a16:	85 c0                	test   %eax,%eax
+    4a18:	74 17                	je     4a31 <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    4a1a:	83 ec 08             	sub    $0x8,%esp
+    4a1d:	68 ad 83 00 00       	push   $0x83ad
+    4a22:	6a 01                	push   $0x1
+    4a24:	e8 97 1e 00 00       	call   68c0 <printf>
+    4a29:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a2c:	e8 b3 1c 00 00       	call   66e4 <exit>
+  }
+  if(chdir("./..") != 0){
+    4a31:	83 ec 0c             	sub    $0xc,%esp
+    4a34:	68 d6 83 00 00       	push   $0x83d6
+    4a39:	e8 16 1d 00 00       	call   6754 <chdir>
+    4a3e:	83 c4 10             	add    $0x10,%esp
+    4a41:	85 c0                	test   %eax,%eax
+    4a43:	74 17                	je     4a5c <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    4a45:	83 ec 08             	sub    $0x8,%esp
+    4a48:	68 db 83 00 00       	push   $0x83db
+    4a4d:	6a 01                	push   $0x1
+    4a4f:	e8 6c 1e 00 00       	call   68c0 <printf>
+    4a54:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a57:	e8 88 1c 00 00       	call   66e4 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    4a5c:	83 ec 08             	sub    $0x8,%esp
+    4a5f:	6a 00                	push   $0x0
+    4a61:	68 24 83 00 00       	push   $0x8324
+    4a66:	e8 b9 1c 00 00       	call   6724 <open>
+    4a6b:	83 c4 10             	add    $0x10,%esp
+    4a6e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    4a71:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4a75:	79 17                	jns    4a8e <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    4a77:	83 ec 08             	sub    $0x8,%esp
+    4a7a:	68 ee 83 00 00       	push   $0x83ee
+    4a7f:	6a 01                	push   $0x1
+    4a81:	e8 3a 1e 00 00       	call   68c0 <printf>
+    4a86:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a89:	e8 56 1c 00 00       	call   66e4 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    4a8e:	83 ec 04             	sub    $0x4,%esp
+    4a91:	68 00 20 00 00       	push   $0x2000
+    4a96:	68 20 9a 00 00       	push   $0x9a20
+    4a9b:	ff 75 f4             	push   -0xc(%ebp)
+    4a9e:	e8 59 1c 00 00       	call   66fc <read>
+    4aa3:	83 c4 10             	add    $0x10,%esp
+    4aa6:	83 f8 02             	cmp    $0x2,%eax
+    4aa9:	74 17                	je     4ac2 <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    4aab:	83 ec 08             	sub    $0x8,%esp
+    4aae:	68 06 84 00 00       	push   $0x8406
+    4ab3:	6a 01                	push   $0x1
+    4ab5:	e8 06 1e 00 00       	call   68c0 <printf>
+    4aba:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4abd:	e8 22 1c 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    4ac2:	83 ec 0c             	sub    $0xc,%esp
+    4ac5:	ff 75 f4             	push   -0xc(%ebp)
+    4ac8:	e8 3f 1c 00 00       	call   670c <close>
+    4acd:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    4ad0:	83 ec 08             	sub    $0x8,%esp
+    4ad3:	6a 00                	push   $0x0
+    4ad5:	68 c0 82 00 00       	push   $0x82c0
+    4ada:	e8 45 1c 00 00       	call   6724 <open>
+    4adf:	83 c4 10             	add    $0x10,%esp
+    4ae2:	85 c0                	test   %eax,%eax
+    4ae4:	78 17                	js     4afd <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    4ae6:	83 ec 08             	sub    $0x8,%esp
+    4ae9:	68 24 84 00 00       	push   $0x8424
+    4aee:	6a 01                	push   $0x1
+    4af0:	e8 cb 1d 00 00       	call   68c0 <printf>
+    4af5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4af8:	e8 e7 1b 00 00       	call   66e4 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    4afd:	83 ec 08             	sub    $0x8,%esp
+    4b00:	68 02 02 00 00       	push   $0x202
+    4b05:	68 49 84 00 00       	push   $0x8449
+    4b0a:	e8 15 1c 00 00       	call   6724 <open>
+    4b0f:	83 c4 10             	add    $0x10,%esp
+    4b12:	85 c0                	test   %eax,%eax
+    4b14:	78 17                	js     4b2d <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    4b16:	83 ec 08             	sub    $0x8,%esp
+    4b19:	68 52 84 00 00       	push   $0x8452
+    4b1e:	6a 01                	push   $0x1
+    4b20:	e8 9b 1d 00 00       	call   68c0 <printf>
+    4b25:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b28:	e8 b7 1b 00 00       	call   66e4 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    4b2d:	83 ec 08             	sub    $0x8,%esp
+    4b30:	68 02 02 00 00       	push   $0x202
+    4b35:	68 6e 84 00 00       	push   $0x846e
+    4b3a:	e8 e5 1b 00 00       	call   6724 <open>
+    4b3f:	83 c4 10             	add    $0x10,%esp
+    4b42:	85 c0                	test   %eax,%eax
+    4b44:	78 17                	js     4b5d <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    4b46:	83 ec 08             	sub    $0x8,%esp
+    4b49:	68 77 84 00 00       	push   $0x8477
+    4b4e:	6a 01                	push   $0x1
+    4b50:	e8 6b 1d 00 00       	call   68c0 <printf>
+    4b55:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b58:	e8 87 1b 00 00       	call   66e4 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    4b5d:	83 ec 08             	sub    $0x8,%esp
+    4b60:	68 00 02 00 00       	push   $0x200
+    4b65:	68 3f 82 00 00       	push   $0x823f
+    4b6a:	e8 b5 1b 00 00       	call   6724 <open>
+    4b6f:	83 c4 10             	add    $0x10,%esp
+    4b72:	85 c0                	test   %eax,%eax
+    4b74:	78 17                	js     4b8d <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    4b76:	83 ec 08             	sub    $0x8,%esp
+    4b79:	68 93 84 00 00       	push   $0x8493
+    4b7e:	6a 01                	push   $0x1
+    4b80:	e8 3b 1d 00 00       	call   68c0 <printf>
+    4b85:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b88:	e8 57 1b 00 00       	call   66e4 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    4b8d:	83 ec 08             	sub    $0x8,%esp
+    4b90:	6a 02                	push   $0x2
+    4b92:	68 3f 82 00 00       	push   $0x823f
+    4b97:	e8 88 1b 00 00       	call   6724 <open>
+    4b9c:	83 c4 10             	add    $0x10,%esp
+    4b9f:	85 c0                	test   %eax,%eax
+    4ba1:	78 17                	js     4bba <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    4ba3:	83 ec 08             	sub    $0x8,%esp
+    4ba6:	68 a9 84 00 00       	push   $0x84a9
+    4bab:	6a 01                	push   $0x1
+    4bad:	e8 0e 1d 00 00       	call   68c0 <printf>
+    4bb2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4bb5:	e8 2a 1b 00 00       	call   66e4 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    4bba:	83 ec 08             	sub    $0x8,%esp
+    4bbd:	6a 01                	push   $0x1
+    4bbf:	68 3f 82 00 00       	push   $0x823f
+    4bc4:	e8 5b 1b 00 00       	call   6724 <open>
+    4bc9:	83 c4 10             	add    $0x10,%esp
+    4bcc:	85 c0                	test   %eax,%eax
+    4bce:	78 17                	js     4be7 <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    4bd0:	83 ec 08             	sub    $0x8,%esp
+    4bd3:	68 c2 84 00 00       	push   $0x84c2
+    4bd8:	6a 01                	push   $0x1
+    4bda:	e8 e1 1c 00 00       	call   68c0 <printf>
+    4bdf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4be2:	e8 fd 1a 00 00       	call   66e4 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    4be7:	83 ec 08             	sub    $0x8,%esp
+    4bea:	68 dd 84 00 00       	push   $0x84dd
+    4bef:	68 49 84 00 00       	push   $0x8449
+    4bf4:	e8 4b 1b 00 00       	call   6744 <link>
+    4bf9:	83 c4 10             	add    $0x10,%esp
+    4bfc:	85 c0                	test   %eax,%eax
+    4bfe:	75 17                	jne    4c17 <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    4c00:	83 ec 08             	sub    $0x8,%esp
+    4c03:	68 e8 84 00 00       	push   $0x84e8
+    4c08:	6a 01                	push   $0x1
+    4c0a:	e8 b1 1c 00 00       	call   68c0 <printf>
+    4c0f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c12:	e8 cd 1a 00 00       	call   66e4 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    4c17:	83 ec 08             	sub    $0x8,%esp
+    4c1a:	68 dd 84 00 00       	push   $0x84dd
+    4c1f:	68 6e 84 00 00       	push   $0x846e
+    4c24:	e8 1b 1b 00 00       	call   6744 <link>
+    4c29:	83 c4 10             	add    $0x10,%esp
+    4c2c:	85 c0                	test   %eax,%eax
+    4c2e:	75 17                	jne    4c47 <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    4c30:	83 ec 08             	sub    $0x8,%esp
+    4c33:	68 0c 85 00 00       	push   $0x850c
+    4c38:	6a 01                	push   $0x1
+    4c3a:	e8 81 1c 00 00       	call   68c0 <printf>
+    4c3f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c42:	e8 9d 1a 00 00       	call   66e4 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    4c47:	83 ec 08             	sub    $0x8,%esp
+    4c4a:	68 24 83 00 00       	push   $0x8324
+    4c4f:	68 5a 82 00 00       	push   $0x825a
+    4c54:	e8 eb 1a 00 00       	call   6744 <link>
+    4c59:	83 c4 10             	add    $0x10,%esp
+    4c5c:	85 c0                	test   %eax,%eax
+    4c5e:	75 17                	jne    4c77 <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    4c60:	83 ec 08             	sub    $0x8,%esp
+    4c63:	68 30 85 00 00       	push   $0x8530
+    4c68:	6a 01                	push   $0x1
+    4c6a:	e8 51 1c 00 00       	call   68c0 <printf>
+    4c6f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c72:	e8 6d 1a 00 00       	call   66e4 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    4c77:	83 ec 0c             	sub    $0xc,%esp
+    4c7a:	68 49 84 00 00       	push   $0x8449
+    4c7f:	e8 c8 1a 00 00       	call   674c <mkdir>
+    4c84:	83 c4 10             	add    $0x10,%esp
+    4c87:	85 c0                	test   %eax,%eax
+    4c89:	75 17                	jne    4ca2 <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    4c8b:	83 ec 08             	sub    $0x8,%esp
+    4c8e:	68 52 85 00 00       	push   $0x8552
+    4c93:	6a 01                	push   $0x1
+    4c95:	e8 26 1c 00 00       	call   68c0 <printf>
+    4c9a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c9d:	e8 42 1a 00 00       	call   66e4 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    4ca2:	83 ec 0c             	sub    $0xc,%esp
+    4ca5:	68 6e 84 00 00       	push   $0x846e
+    4caa:	e8 9d 1a 00 00       	call   674c <mkdir>
+    4caf:	83 c4 10             	add    $0x10,%esp
+    4cb2:	85 c0                	test   %eax,%eax
+    4cb4:	75 17                	jne    4ccd <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    4cb6:	83 ec 08             	sub    $0x8,%esp
+    4cb9:	68 6d 85 00 00       	push   $0x856d
+    4cbe:	6a 01                	push   $0x1
+    4cc0:	e8 fb 1b 00 00       	call   68c0 <printf>
+    4cc5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4cc8:	e8 17 1a 00 00       	call   66e4 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    4ccd:	83 ec 0c             	sub    $0xc,%esp
+    4cd0:	68 24 83 00 00       	push   $0x8324
+    4cd5:	e8 72 1a 00 00       	call   674c <mkdir>
+    4cda:	83 c4 10             	add    $0x10,%esp
+    4cdd:	85 c0                	test   %eax,%eax
+    4cdf:	75 17                	jne    4cf8 <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    4ce1:	83 ec 08             	sub    $0x8,%esp
+    4ce4:	68 88 85 00 00       	push   $0x8588
+    4ce9:	6a 01                	push   $0x1
+    4ceb:	e8 d0 1b 00 00       	call   68c0 <printf>
+    4cf0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4cf3:	e8 ec 19 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    4cf8:	83 ec 0c             	sub    $0xc,%esp
+    4cfb:	68 6e 84 00 00       	push   $0x846e
+    4d00:	e8 2f 1a 00 00       	call   6734 <unlink>
+    4d05:	83 c4 10             	add    $0x10,%esp
+    4d08:	85 c0                	test   %eax,%eax
+    4d0a:	75 17                	jne    4d23 <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    4d0c:	83 ec 08             	sub    $0x8,%esp
+    4d0f:	68 a5 85 00 00       	push   $0x85a5
+    4d14:	6a 01                	push   $0x1
+    4d16:	e8 a5 1b 00 00       	call   68c0 <printf>
+    4d1b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d1e:	e8 c1 19 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    4d23:	83 ec 0c             	sub    $0xc,%esp
+    4d26:	68 49 84 00 00       	push   $0x8449
+    4d2b:	e8 04 1a 00 00       	call   6734 <unlink>
+    4d30:	83 c4 10             	add    $0x10,%esp
+    4d33:	85 c0                	test   %eax,%eax
+    4d35:	75 17                	jne    4d4e <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    4d37:	83 ec 08             	sub    $0x8,%esp
+    4d3a:	68 c1 85 00 00       	push   $0x85c1
+    4d3f:	6a 01                	push   $0x1
+    4d41:	e8 7a 1b 00 00       	call   68c0 <printf>
+    4d46:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d49:	e8 96 19 00 00       	call   66e4 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    4d4e:	83 ec 0c             	sub    $0xc,%esp
+    4d51:	68 5a 82 00 00       	push   $0x825a
+    4d56:	e8 f9 19 00 00       	call   6754 <chdir>
+    4d5b:	83 c4 10             	add    $0x10,%esp
+    4d5e:	85 c0                	test   %eax,%eax
+    4d60:	75 17                	jne    4d79 <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    4d62:	83 ec 08             	sub    $0x8,%esp
+    4d65:	68 dd 85 00 00       	push   $0x85dd
+    4d6a:	6a 01                	push   $0x1
+    4d6c:	e8 4f 1b 00 00       	call   68c0 <printf>
+    4d71:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d74:	e8 6b 19 00 00       	call   66e4 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    4d79:	83 ec 0c             	sub    $0xc,%esp
+    4d7c:	68 f5 85 00 00       	push   $0x85f5
+    4d81:	e8 ce 19 00 00       	call   6754 <chdir>
+    4d86:	83 c4 10             	add    $0x10,%esp
+    4d89:	85 c0                	test   %eax,%eax
+    4d8b:	75 17                	jne    4da4 <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    4d8d:	83 ec 08             	sub    $0x8,%esp
+    4d90:	68 fb 85 00 00       	push   $0x85fb
+    4d95:	6a 01                	push   $0x1
+    4d97:	e8 24 1b 00 00       	call   68c0 <printf>
+    4d9c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d9f:	e8 40 19 00 00       	call   66e4 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    4da4:	83 ec 0c             	sub    $0xc,%esp
+    4da7:	68 24 83 00 00       	push   $0x8324
+    4dac:	e8 83 19 00 00       	call   6734 <unlink>
+    4db1:	83 c4 10             	add    $0x10,%esp
+    4db4:	85 c0                	test   %eax,%eax
+    4db6:	74 17                	je     4dcf <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    4db8:	83 ec 08             	sub    $0x8,%esp
+    4dbb:	68 51 83 00 00       	push   $0x8351
+    4dc0:	6a 01                	push   $0x1
+    4dc2:	e8 f9 1a 00 00       	call   68c0 <printf>
+    4dc7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4dca:	e8 15 19 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    4dcf:	83 ec 0c             	sub    $0xc,%esp
+    4dd2:	68 5a 82 00 00       	push   $0x825a
+    4dd7:	e8 58 19 00 00       	call   6734 <unlink>
+    4ddc:	83 c4 10             	add    $0x10,%esp
+    4ddf:	85 c0                	test   %eax,%eax
+    4de1:	74 17                	je     4dfa <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    4de3:	83 ec 08             	sub    $0x8,%esp
+    4de6:	68 13 86 00 00       	push   $0x8613
+    4deb:	6a 01                	push   $0x1
+    4ded:	e8 ce 1a 00 00       	call   68c0 <printf>
+    4df2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4df5:	e8 ea 18 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dd") == 0){
+    4dfa:	83 ec 0c             	sub    $0xc,%esp
+    4dfd:	68 3f 82 00 00       	push   $0x823f
+    4e02:	e8 2d 19 00 00       	call   6734 <unlink>
+    4e07:	83 c4 10             	add    $0x10,%esp
+    4e0a:	85 c0                	test   %eax,%eax
+    4e0c:	75 17                	jne    4e25 <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    4e0e:	83 ec 08             	sub    $0x8,%esp
+    4e11:	68 28 86 00 00       	push   $0x8628
+    4e16:	6a 01                	push   $0x1
+    4e18:	e8 a3 1a 00 00       	call   68c0 <printf>
+    4e1d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e20:	e8 bf 18 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    4e25:	83 ec 0c             	sub    $0xc,%esp
+    4e28:	68 48 86 00 00       	push   $0x8648
+    4e2d:	e8 02 19 00 00       	call   6734 <unlink>
+    4e32:	83 c4 10             	add    $0x10,%esp
+    4e35:	85 c0                	test   %eax,%eax
+    4e37:	79 17                	jns    4e50 <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    4e39:	83 ec 08             	sub    $0x8,%esp
+    4e3c:	68 4e 86 00 00       	push   $0x864e
+    4e41:	6a 01                	push   $0x1
+    4e43:	e8 78 1a 00 00       	call   68c0 <printf>
+    4e48:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e4b:	e8 94 18 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dd") < 0){
+    4e50:	83 ec 0c             	sub    $0xc,%esp
+    4e53:	68 3f 82 00 00       	push   $0x823f
+    4e58:	e8 d7 18 00 00       	call   6734 <unlink>
+    4e5d:	83 c4 10             	add    $0x10,%esp
+    4e60:	85 c0                	test   %eax,%eax
+    4e62:	79 17                	jns    4e7b <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    4e64:	83 ec 08             	sub    $0x8,%esp
+    4e67:	68 63 86 00 00       	push   $0x8663
+    4e6c:	6a 01                	push   $0x1
+    4e6e:	e8 4d 1a 00 00       	call   68c0 <printf>
+    4e73:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e76:	e8 69 18 00 00       	call   66e4 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    4e7b:	83 ec 08             	sub    $0x8,%esp
+    4e7e:	68 75 86 00 00       	push   $0x8675
+    4e83:	6a 01                	push   $0x1
+    4e85:	e8 36 1a 00 00       	call   68c0 <printf>
+    4e8a:	83 c4 10             	add    $0x10,%esp
+}
+    4e8d:	90                   	nop
+    4e8e:	c9                   	leave
+    4e8f:	c3                   	ret
+
+00004e90 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    4e90:	55                   	push   %ebp
+    4e91:	89 e5                	mov    %esp,%ebp
+    4e93:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    4e96:	83 ec 08             	sub    $0x8,%esp
+    4e99:	68 80 86 00 00       	push   $0x8680
+    4e9e:	6a 01                	push   $0x1
+    4ea0:	e8 1b 1a 00 00       	call   68c0 <printf>
+    4ea5:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    4ea8:	83 ec 0c             	sub    $0xc,%esp
+    4eab:	68 8f 86 00 00       	push   $0x868f
+    4eb0:	e8 7f 18 00 00       	call   6734 <unlink>
+    4eb5:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    4eb8:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    4ebf:	e9 a8 00 00 00       	jmp    4f6c <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    4ec4:	83 ec 08             	sub    $0x8,%esp
+    4ec7:	68 02 02 00 00       	push   $0x202
+    4ecc:	68 8f 86 00 00       	push   $0x868f
+    4ed1:	e8 4e 18 00 00       	call   6724 <open>
+    4ed6:	83 c4 10             	add    $0x10,%esp
+    4ed9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    4edc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4ee0:	79 17                	jns    4ef9 <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    4ee2:	83 ec 08             	sub    $0x8,%esp
+    4ee5:	68 98 86 00 00       	push   $0x8698
+    4eea:	6a 01                	push   $0x1
+    4eec:	e8 cf 19 00 00       	call   68c0 <printf>
+    4ef1:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4ef4:	e8 eb 17 00 00       	call   66e4 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    4ef9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4f00:	eb 3f                	jmp    4f41 <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    4f02:	83 ec 04             	sub    $0x4,%esp
+    4f05:	ff 75 f4             	push   -0xc(%ebp)
+    4f08:	68 20 9a 00 00       	push   $0x9a20
+    4f0d:	ff 75 ec             	push   -0x14(%ebp)
+    4f10:	e8 ef 17 00 00       	call   6704 <write>
+    4f15:	83 c4 10             	add    $0x10,%esp
+    4f18:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    4f1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4f1e:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    4f21:	74 1a                	je     4f3d <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    4f23:	ff 75 e8             	push   -0x18(%ebp)
+    4f26:	ff 75 f4             	push   -0xc(%ebp)
+    4f29:	68 b0 86 00 00       	push   $0x86b0
+    4f2e:	6a 01                	push   $0x1
+    4f30:	e8 8b 19 00 00       	call   68c0 <printf>
+    4f35:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4f38:	e8 a7 17 00 00       	call   66e4 <exit>
+    for(i = 0; i < 2; i++){
+    4f3d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4f41:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    4f45:	7e bb                	jle    4f02 <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    4f47:	83 ec 0c             	sub    $0xc,%esp
+    4f4a:	ff 75 ec             	push   -0x14(%ebp)
+    4f4d:	e8 ba 17 00 00       	call   670c <close>
+    4f52:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    4f55:	83 ec 0c             	sub    $0xc,%esp
+    4f58:	68 8f 86 00 00       	push   $0x868f
+    4f5d:	e8 d2 17 00 00       	call   6734 <unlink>
+    4f62:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    4f65:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    4f6c:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    4f73:	0f 8e 4b ff ff ff    	jle    4ec4 <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    4f79:	83 ec 08             	sub    $0x8,%esp
+    4f7c:	68 c2 86 00 00       	push   $0x86c2
+    4f81:	6a 01                	push   $0x1
+    4f83:	e8 38 19 00 00       	call   68c0 <printf>
+    4f88:	83 c4 10             	add    $0x10,%esp
+}
+    4f8b:	90                   	nop
+    4f8c:	c9                   	leave
+    4f8d:	c3                   	ret
+
+00004f8e <bigfile>:
+
+void
+bigfile(void)
+{
+    4f8e:	55                   	push   %ebp
+    4f8f:	89 e5                	mov    %esp,%ebp
+    4f91:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    4f94:	83 ec 08             	sub    $0x8,%esp
+    4f97:	68 cf 86 00 00       	push   $0x86cf
+    4f9c:	6a 01                	push   $0x1
+    4f9e:	e8 1d 19 00 00       	call   68c0 <printf>
+    4fa3:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    4fa6:	83 ec 0c             	sub    $0xc,%esp
+    4fa9:	68 dd 86 00 00       	push   $0x86dd
+    4fae:	e8 81 17 00 00       	call   6734 <unlink>
+    4fb3:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    4fb6:	83 ec 08             	sub    $0x8,%esp
+    4fb9:	68 02 02 00 00       	push   $0x202
+    4fbe:	68 dd 86 00 00       	push   $0x86dd
+    4fc3:	e8 5c 17 00 00       	call   6724 <open>
+    4fc8:	83 c4 10             	add    $0x10,%esp
+    4fcb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    4fce:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4fd2:	79 17                	jns    4feb <bigfile+0x5d>
+    printf(1, "cannot create bigfile");
+    4fd4:	83 ec 08             	sub    $0x8,%esp
+    4fd7:	68 e5 86 00 00       	push   $0x86e5
+    4fdc:	6a 01                	push   $0x1
+    4fde:	e8 dd 18 00 00       	call   68c0 <printf>
+    4fe3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4fe6:	e8 f9 16 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    4feb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4ff2:	eb 52                	jmp    5046 <bigfile+0xb8>
+    memset(buf, i, 600);
+    4ff4:	83 ec 04             	sub    $0x4,%esp
+    4ff7:	68 58 02 00 00       	push   $0x258
+    4ffc:	ff 75 f4             	push   -0xc(%ebp)
+    4fff:	68 20 9a 00 00       	push   $0x9a20
+    5004:	e8 40 15 00 00       	call   6549 <memset>
+    5009:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    500c:	83 ec 04             	sub    $0x4,%esp
+    500f:	68 58 02 00 00       	push   $0x258
+    5014:	68 20 9a 00 00       	push   $0x9a20
+    5019:	ff 75 ec             	push   -0x14(%ebp)
+    501c:	e8 e3 16 00 00       	call   6704 <write>
+    5021:	83 c4 10             	add    $0x10,%esp
+    5024:	3d 58 02 00 00       	cmp    $0x258,%eax
+    5029:	74 17                	je     5042 <bigfile+0xb4>
+      printf(1, "write bigfile failed\n");
+    502b:	83 ec 08             	sub    $0x8,%esp
+    502e:	68 fb 86 00 00       	push   $0x86fb
+    5033:	6a 01                	push   $0x1
+    5035:	e8 86 18 00 00       	call   68c0 <printf>
+    503a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    503d:	e8 a2 16 00 00       	call   66e4 <exit>
+  for(i = 0; i < 20; i++){
+    5042:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5046:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    504a:	7e a8                	jle    4ff4 <bigfile+0x66>
+    }
+  }
+  close(fd);
+    504c:	83 ec 0c             	sub    $0xc,%esp
+    504f:	ff 75 ec             	push   -0x14(%ebp)
+    5052:	e8 b5 16 00 00       	call   670c <close>
+    5057:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bigfile", 0);
+    505a:	83 ec 08             	sub    $0x8,%esp
+    505d:	6a 00                	push   $0x0
+    505f:	68 dd 86 00 00       	push   $0x86dd
+    5064:	e8 bb 16 00 00       	call   6724 <open>
+    5069:	83 c4 10             	add    $0x10,%esp
+    506c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    506f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    5073:	79 17                	jns    508c <bigfile+0xfe>
+    printf(1, "cannot open bigfile\n");
+    5075:	83 ec 08             	sub    $0x8,%esp
+    5078:	68 11 87 00 00       	push   $0x8711
+    507d:	6a 01                	push   $0x1
+    507f:	e8 3c 18 00 00       	call   68c0 <printf>
+    5084:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5087:	e8 58 16 00 00       	call   66e4 <exit>
+  }
+  total = 0;
+    508c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    5093:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    509a:	83 ec 04             	sub    $0x4,%esp
+    509d:	68 2c 01 00 00       	push   $0x12c
+    50a2:	68 20 9a 00 00       	push   $0x9a20
+    50a7:	ff 75 ec             	push   -0x14(%ebp)
+    50aa:	e8 4d 16 00 00       	call   66fc <read>
+    50af:	83 c4 10             	add    $0x10,%esp
+    50b2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(cc < 0){
+    50b5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    50b9:	79 17                	jns    50d2 <bigfile+0x144>
+      printf(1, "read bigfile failed\n");
+    50bb:	83 ec 08             	sub    $0x8,%esp
+    50be:	68 26 87 00 00       	push   $0x8726
+    50c3:	6a 01                	push   $0x1
+    50c5:	e8 f6 17 00 00       	call   68c0 <printf>
+    50ca:	83 c4 10             	add    $0x10,%esp
+      exit();
+    50cd:	e8 12 16 00 00       	call   66e4 <exit>
+    }
+    if(cc == 0)
+    50d2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    50d6:	74 7a                	je     5152 <bigfile+0x1c4>
+      break;
+    if(cc != 300){
+    50d8:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    50df:	74 17                	je     50f8 <bigfile+0x16a>
+      printf(1, "short read bigfile\n");
+    50e1:	83 ec 08             	sub    $0x8,%esp
+    50e4:	68 3b 87 00 00       	push   $0x873b
+    50e9:	6a 01                	push   $0x1
+    50eb:	e8 d0 17 00 00       	call   68c0 <printf>
+    50f0:	83 c4 10             	add    $0x10,%esp
+      exit();
+    50f3:	e8 ec 15 00 00       	call   66e4 <exit>
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    50f8:	0f b6 05 20 9a 00 00 	movzbl 0x9a20,%eax
+    50ff:	0f be d0             	movsbl %al,%edx
+    5102:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5105:	89 c1                	mov    %eax,%ecx
+    5107:	c1 e9 1f             	shr    $0x1f,%ecx
+    510a:	01 c8                	add    %ecx,%eax
+    510c:	d1 f8                	sar    %eax
+    510e:	39 c2                	cmp    %eax,%edx
+    5110:	75 1a                	jne    512c <bigfile+0x19e>
+    5112:	0f b6 05 4b 9b 00 00 	movzbl 0x9b4b,%eax
+    5119:	0f be d0             	movsbl %al,%edx
+    511c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    511f:	89 c1                	mov    %eax,%ecx
+    5121:	c1 e9 1f             	shr    $0x1f,%ecx
+    5124:	01 c8                	add    %ecx,%eax
+    5126:	d1 f8                	sar    %eax
+    5128:	39 c2                	cmp    %eax,%edx
+    512a:	74 17                	je     5143 <bigfile+0x1b5>
+      printf(1, "read bigfile wrong data\n");
+    512c:	83 ec 08             	sub    $0x8,%esp
+    512f:	68 4f 87 00 00       	push   $0x874f
+    5134:	6a 01                	push   $0x1
+    5136:	e8 85 17 00 00       	call   68c0 <printf>
+    513b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    513e:	e8 a1 15 00 00       	call   66e4 <exit>
+    }
+    total += cc;
+    5143:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    5146:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    5149:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    514d:	e9 48 ff ff ff       	jmp    509a <bigfile+0x10c>
+      break;
+    5152:	90                   	nop
+  }
+  close(fd);
+    5153:	83 ec 0c             	sub    $0xc,%esp
+    5156:	ff 75 ec             	push   -0x14(%ebp)
+    5159:	e8 ae 15 00 00       	call   670c <close>
+    515e:	83 c4 10             	add    $0x10,%esp
+  if(total != 20*600){
+    5161:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    5168:	74 17                	je     5181 <bigfile+0x1f3>
+    printf(1, "read bigfile wrong total\n");
+    516a:	83 ec 08             	sub    $0x8,%esp
+    516d:	68 68 87 00 00       	push   $0x8768
+    5172:	6a 01                	push   $0x1
+    5174:	e8 47 17 00 00       	call   68c0 <printf>
+    5179:	83 c4 10             	add    $0x10,%esp
+    exit();
+    517c:	e8 63 15 00 00       	call   66e4 <exit>
+  }
+  unlink("bigfile");
+    5181:	83 ec 0c             	sub    $0xc,%esp
+    5184:	68 dd 86 00 00       	push   $0x86dd
+    5189:	e8 a6 15 00 00       	call   6734 <unlink>
+    518e:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile test ok\n");
+    5191:	83 ec 08             	sub    $0x8,%esp
+    5194:	68 82 87 00 00       	push   $0x8782
+    5199:	6a 01                	push   $0x1
+    519b:	e8 20 17 00 00       	call   68c0 <printf>
+    51a0:	83 c4 10             	add    $0x10,%esp
+}
+    51a3:	90                   	nop
+    51a4:	c9                   	leave
+    51a5:	c3                   	ret
+
+000051a6 <fourteen>:
+
+void
+fourteen(void)
+{
+    51a6:	55                   	push   %ebp
+    51a7:	89 e5                	mov    %esp,%ebp
+    51a9:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    51ac:	83 ec 08             	sub    $0x8,%esp
+    51af:	68 93 87 00 00       	push   $0x8793
+    51b4:	6a 01                	push   $0x1
+    51b6:	e8 05 17 00 00       	call   68c0 <printf>
+    51bb:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    51be:	83 ec 0c             	sub    $0xc,%esp
+    51c1:	68 a2 87 00 00       	push   $0x87a2
+    51c6:	e8 81 15 00 00       	call   674c <mkdir>
+    51cb:	83 c4 10             	add    $0x10,%esp
+    51ce:	85 c0                	test   %eax,%eax
+    51d0:	74 17                	je     51e9 <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    51d2:	83 ec 08             	sub    $0x8,%esp
+    51d5:	68 b1 87 00 00       	push   $0x87b1
+    51da:	6a 01                	push   $0x1
+    51dc:	e8 df 16 00 00       	call   68c0 <printf>
+    51e1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    51e4:	e8 fb 14 00 00       	call   66e4 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    51e9:	83 ec 0c             	sub    $0xc,%esp
+    51ec:	68 d0 87 00 00       	push   $0x87d0
+    51f1:	e8 56 15 00 00       	call   674c <mkdir>
+    51f6:	83 c4 10             	add    $0x10,%esp
+    51f9:	85 c0                	test   %eax,%eax
+    51fb:	74 17                	je     5214 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    51fd:	83 ec 08             	sub    $0x8,%esp
+    5200:	68 f0 87 00 00       	push   $0x87f0
+    5205:	6a 01                	push   $0x1
+    5207:	e8 b4 16 00 00       	call   68c0 <printf>
+    520c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    520f:	e8 d0 14 00 00       	call   66e4 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    5214:	83 ec 08             	sub    $0x8,%esp
+    5217:	68 00 02 00 00       	push   $0x200
+    521c:	68 20 88 00 00       	push   $0x8820
+    5221:	e8 fe 14 00 00       	call   6724 <open>
+    5226:	83 c4 10             	add    $0x10,%esp
+    5229:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    522c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5230:	79 17                	jns    5249 <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    5232:	83 ec 08             	sub    $0x8,%esp
+    5235:	68 50 88 00 00       	push   $0x8850
+    523a:	6a 01                	push   $0x1
+    523c:	e8 7f 16 00 00       	call   68c0 <printf>
+    5241:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5244:	e8 9b 14 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    5249:	83 ec 0c             	sub    $0xc,%esp
+    524c:	ff 75 f4             	push   -0xc(%ebp)
+    524f:	e8 b8 14 00 00       	call   670c <close>
+    5254:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    5257:	83 ec 08             	sub    $0x8,%esp
+    525a:	6a 00                	push   $0x0
+    525c:	68 90 88 00 00       	push   $0x8890
+    5261:	e8 be 14 00 00       	call   6724 <open>
+    5266:	83 c4 10             	add    $0x10,%esp
+    5269:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    526c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5270:	79 17                	jns    5289 <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    5272:	83 ec 08             	sub    $0x8,%esp
+    5275:	68 c0 88 00 00       	push   $0x88c0
+    527a:	6a 01                	push   $0x1
+    527c:	e8 3f 16 00 00       	call   68c0 <printf>
+    5281:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5284:	e8 5b 14 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    5289:	83 ec 0c             	sub    $0xc,%esp
+    528c:	ff 75 f4             	push   -0xc(%ebp)
+    528f:	e8 78 14 00 00       	call   670c <close>
+    5294:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    5297:	83 ec 0c             	sub    $0xc,%esp
+    529a:	68 fa 88 00 00       	push   $0x88fa
+    529f:	e8 a8 14 00 00       	call   674c <mkdir>
+    52a4:	83 c4 10             	add    $0x10,%esp
+    52a7:	85 c0                	test   %eax,%eax
+    52a9:	75 17                	jne    52c2 <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    52ab:	83 ec 08             	sub    $0x8,%esp
+    52ae:	68 18 89 00 00       	push   $0x8918
+    52b3:	6a 01                	push   $0x1
+    52b5:	e8 06 16 00 00       	call   68c0 <printf>
+    52ba:	83 c4 10             	add    $0x10,%esp
+    exit();
+    52bd:	e8 22 14 00 00       	call   66e4 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    52c2:	83 ec 0c             	sub    $0xc,%esp
+    52c5:	68 48 89 00 00       	push   $0x8948
+    52ca:	e8 7d 14 00 00       	call   674c <mkdir>
+    52cf:	83 c4 10             	add    $0x10,%esp
+    52d2:	85 c0                	test   %eax,%eax
+    52d4:	75 17                	jne    52ed <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    52d6:	83 ec 08             	sub    $0x8,%esp
+    52d9:	68 68 89 00 00       	push   $0x8968
+    52de:	6a 01                	push   $0x1
+    52e0:	e8 db 15 00 00       	call   68c0 <printf>
+    52e5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    52e8:	e8 f7 13 00 00       	call   66e4 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    52ed:	83 ec 08             	sub    $0x8,%esp
+    52f0:	68 99 89 00 00       	push   $0x8999
+    52f5:	6a 01                	push   $0x1
+    52f7:	e8 c4 15 00 00       	call   68c0 <printf>
+    52fc:	83 c4 10             	add    $0x10,%esp
+}
+    52ff:	90                   	nop
+    5300:	c9                   	leave
+    5301:	c3                   	ret
+
+00005302 <rmdot>:
+
+void
+rmdot(void)
+{
+    5302:	55                   	push   %ebp
+    5303:	89 e5                	mov    %esp,%ebp
+    5305:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    5308:	83 ec 08             	sub    $0x8,%esp
+    530b:	68 a6 89 00 00       	push   $0x89a6
+    5310:	6a 01                	push   $0x1
+    5312:	e8 a9 15 00 00       	call   68c0 <printf>
+    5317:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    531a:	83 ec 0c             	sub    $0xc,%esp
+    531d:	68 b2 89 00 00       	push   $0x89b2
+    5322:	e8 25 14 00 00       	call   674c <mkdir>
+    5327:	83 c4 10             	add    $0x10,%esp
+    532a:	85 c0                	test   %eax,%eax
+    532c:	74 17                	je     5345 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    532e:	83 ec 08             	sub    $0x8,%esp
+    5331:	68 b7 89 00 00       	push   $0x89b7
+    5336:	6a 01                	push   $0x1
+    5338:	e8 83 15 00 00       	call   68c0 <printf>
+    533d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5340:	e8 9f 13 00 00       	call   66e4 <exit>
+  }
+  if(chdir("dots") != 0){
+    5345:	83 ec 0c             	sub    $0xc,%esp
+    5348:	68 b2 89 00 00       	push   $0x89b2
+    534d:	e8 02 14 00 00       	call   6754 <chdir>
+    5352:	83 c4 10             	add    $0x10,%esp
+    5355:	85 c0                	test   %eax,%eax
+    5357:	74 17                	je     5370 <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    5359:	83 ec 08             	sub    $0x8,%esp
+    535c:	68 ca 89 00 00       	push   $0x89ca
+    5361:	6a 01                	push   $0x1
+    5363:	e8 58 15 00 00       	call   68c0 <printf>
+    5368:	83 c4 10             	add    $0x10,%esp
+    exit();
+    536b:	e8 74 13 00 00       	call   66e4 <exit>
+  }
+  if(unlink(".") == 0){
+    5370:	83 ec 0c             	sub    $0xc,%esp
+    5373:	68 07 80 00 00       	push   $0x8007
+    5378:	e8 b7 13 00 00       	call   6734 <unlink>
+    537d:	83 c4 10             	add    $0x10,%esp
+    5380:	85 c0                	test   %eax,%eax
+    5382:	75 17                	jne    539b <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    5384:	83 ec 08             	sub    $0x8,%esp
+    5387:	68 dd 89 00 00       	push   $0x89dd
+    538c:	6a 01                	push   $0x1
+    538e:	e8 2d 15 00 00       	call   68c0 <printf>
+    5393:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5396:	e8 49 13 00 00       	call   66e4 <exit>
+  }
+  if(unlink("..") == 0){
+    539b:	83 ec 0c             	sub    $0xc,%esp
+    539e:	68 0b 78 00 00       	push   $0x780b
+    53a3:	e8 8c 13 00 00       	call   6734 <unlink>
+    53a8:	83 c4 10             	add    $0x10,%esp
+    53ab:	85 c0                	test   %eax,%eax
+    53ad:	75 17                	jne    53c6 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    53af:	83 ec 08             	sub    $0x8,%esp
+    53b2:	68 eb 89 00 00       	push   $0x89eb
+    53b7:	6a 01                	push   $0x1
+    53b9:	e8 02 15 00 00       	call   68c0 <printf>
+    53be:	83 c4 10             	add    $0x10,%esp
+    exit();
+    53c1:	e8 1e 13 00 00       	call   66e4 <exit>
+  }
+  if(chdir("/") != 0){
+    53c6:	83 ec 0c             	sub    $0xc,%esp
+    53c9:	68 ea 6c 00 00       	push   $0x6cea
+    53ce:	e8 81 13 00 00       	call   6754 <chdir>
+    53d3:	83 c4 10             	add    $0x10,%esp
+    53d6:	85 c0                	test   %eax,%eax
+    53d8:	74 17                	je     53f1 <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    53da:	83 ec 08             	sub    $0x8,%esp
+    53dd:	68 ec 6c 00 00       	push   $0x6cec
+    53e2:	6a 01                	push   $0x1
+    53e4:	e8 d7 14 00 00       	call   68c0 <printf>
+    53e9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    53ec:	e8 f3 12 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    53f1:	83 ec 0c             	sub    $0xc,%esp
+    53f4:	68 fa 89 00 00       	push   $0x89fa
+    53f9:	e8 36 13 00 00       	call   6734 <unlink>
+    53fe:	83 c4 10             	add    $0x10,%esp
+    5401:	85 c0                	test   %eax,%eax
+    5403:	75 17                	jne    541c <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    5405:	83 ec 08             	sub    $0x8,%esp
+    5408:	68 01 8a 00 00       	push   $0x8a01
+    540d:	6a 01                	push   $0x1
+    540f:	e8 ac 14 00 00       	call   68c0 <printf>
+    5414:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5417:	e8 c8 12 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    541c:	83 ec 0c             	sub    $0xc,%esp
+    541f:	68 18 8a 00 00       	push   $0x8a18
+    5424:	e8 0b 13 00 00       	call   6734 <unlink>
+    5429:	83 c4 10             	add    $0x10,%esp
+    542c:	85 c0                	test   %eax,%eax
+    542e:	75 17                	jne    5447 <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    5430:	83 ec 08             	sub    $0x8,%esp
+    5433:	68 20 8a 00 00       	push   $0x8a20
+    5438:	6a 01                	push   $0x1
+    543a:	e8 81 14 00 00       	call   68c0 <printf>
+    543f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5442:	e8 9d 12 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dots") != 0){
+    5447:	83 ec 0c             	sub    $0xc,%esp
+    544a:	68 b2 89 00 00       	push   $0x89b2
+    544f:	e8 e0 12 00 00       	call   6734 <unlink>
+    5454:	83 c4 10             	add    $0x10,%esp
+    5457:	85 c0                	test   %eax,%eax
+    5459:	74 17                	je     5472 <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    545b:	83 ec 08             	sub    $0x8,%esp
+    545e:	68 38 8a 00 00       	push   $0x8a38
+    5463:	6a 01                	push   $0x1
+    5465:	e8 56 14 00 00       	call   68c0 <printf>
+    546a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    546d:	e8 72 12 00 00       	call   66e4 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    5472:	83 ec 08             	sub    $0x8,%esp
+    5475:	68 4d 8a 00 00       	push   $0x8a4d
+    547a:	6a 01                	push   $0x1
+    547c:	e8 3f 14 00 00       	call   68c0 <printf>
+    5481:	83 c4 10             	add    $0x10,%esp
+}
+    5484:	90                   	nop
+    5485:	c9                   	leave
+    5486:	c3                   	ret
+
+00005487 <dirfile>:
+
+void
+dirfile(void)
+{
+    5487:	55                   	push   %ebp
+    5488:	89 e5                	mov    %esp,%ebp
+    548a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    548d:	83 ec 08             	sub    $0x8,%esp
+    5490:	68 57 8a 00 00       	push   $0x8a57
+    5495:	6a 01                	push   $0x1
+    5497:	e8 24 14 00 00       	call   68c0 <printf>
+    549c:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    549f:	83 ec 08             	sub    $0x8,%esp
+    54a2:	68 00 02 00 00       	push   $0x200
+    54a7:	68 64 8a 00 00       	push   $0x8a64
+    54ac:	e8 73 12 00 00       	call   6724 <open>
+    54b1:	83 c4 10             	add    $0x10,%esp
+    54b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    54b7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    54bb:	79 17                	jns    54d4 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    54bd:	83 ec 08             	sub    $0x8,%esp
+    54c0:	68 6c 8a 00 00       	push   $0x8a6c
+    54c5:	6a 01                	push   $0x1
+    54c7:	e8 f4 13 00 00       	call   68c0 <printf>
+    54cc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    54cf:	e8 10 12 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    54d4:	83 ec 0c             	sub    $0xc,%esp
+    54d7:	ff 75 f4             	push   -0xc(%ebp)
+    54da:	e8 2d 12 00 00       	call   670c <close>
+    54df:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    54e2:	83 ec 0c             	sub    $0xc,%esp
+    54e5:	68 64 8a 00 00       	push   $0x8a64
+    54ea:	e8 65 12 00 00       	call   6754 <chdir>
+    54ef:	83 c4 10             	add    $0x10,%esp
+    54f2:	85 c0                	test   %eax,%eax
+    54f4:	75 17                	jne    550d <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    54f6:	83 ec 08             	sub    $0x8,%esp
+    54f9:	68 83 8a 00 00       	push   $0x8a83
+    54fe:	6a 01                	push   $0x1
+    5500:	e8 bb 13 00 00       	call   68c0 <printf>
+    5505:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5508:	e8 d7 11 00 00       	call   66e4 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    550d:	83 ec 08             	sub    $0x8,%esp
+    5510:	6a 00                	push   $0x0
+    5512:	68 9d 8a 00 00       	push   $0x8a9d
+    5517:	e8 08 12 00 00       	call   6724 <open>
+    551c:	83 c4 10             	add    $0x10,%esp
+    551f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    5522:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5526:	78 17                	js     553f <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    5528:	83 ec 08             	sub    $0x8,%esp
+    552b:	68 a8 8a 00 00       	push   $0x8aa8
+    5530:	6a 01                	push   $0x1
+    5532:	e8 89 13 00 00       	call   68c0 <printf>
+    5537:	83 c4 10             	add    $0x10,%esp
+    exit();
+    553a:	e8 a5 11 00 00       	call   66e4 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    553f:	83 ec 08             	sub    $0x8,%esp
+    5542:	68 00 02 00 00       	push   $0x200
+    5547:	68 9d 8a 00 00       	push   $0x8a9d
+    554c:	e8 d3 11 00 00       	call   6724 <open>
+    5551:	83 c4 10             	add    $0x10,%esp
+    5554:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    5557:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    555b:	78 17                	js     5574 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    555d:	83 ec 08             	sub    $0x8,%esp
+    5560:	68 a8 8a 00 00       	push   $0x8aa8
+    5565:	6a 01                	push   $0x1
+    5567:	e8 54 13 00 00       	call   68c0 <printf>
+    556c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    556f:	e8 70 11 00 00       	call   66e4 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    5574:	83 ec 0c             	sub    $0xc,%esp
+    5577:	68 9d 8a 00 00       	push   $0x8a9d
+    557c:	e8 cb 11 00 00       	call   674c <mkdir>
+    5581:	83 c4 10             	add    $0x10,%esp
+    5584:	85 c0                	test   %eax,%eax
+    5586:	75 17                	jne    559f <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    5588:	83 ec 08             	sub    $0x8,%esp
+    558b:	68 c6 8a 00 00       	push   $0x8ac6
+    5590:	6a 01                	push   $0x1
+    5592:	e8 29 13 00 00       	call   68c0 <printf>
+    5597:	83 c4 10             	add    $0x10,%esp
+    exit();
+    559a:	e8 45 11 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    559f:	83 ec 0c             	sub    $0xc,%esp
+    55a2:	68 9d 8a 00 00       	push   $0x8a9d
+    55a7:	e8 88 11 00 00       	call   6734 <unlink>
+    55ac:	83 c4 10             	add    $0x10,%esp
+    55af:	85 c0                	test   %eax,%eax
+    55b1:	75 17                	jne    55ca <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    55b3:	83 ec 08             	sub    $0x8,%esp
+    55b6:	68 e3 8a 00 00       	push   $0x8ae3
+    55bb:	6a 01                	push   $0x1
+    55bd:	e8 fe 12 00 00       	call   68c0 <printf>
+    55c2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    55c5:	e8 1a 11 00 00       	call   66e4 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    55ca:	83 ec 08             	sub    $0x8,%esp
+    55cd:	68 9d 8a 00 00       	push   $0x8a9d
+    55d2:	68 01 8b 00 00       	push   $0x8b01
+    55d7:	e8 68 11 00 00       	call   6744 <link>
+    55dc:	83 c4 10             	add    $0x10,%esp
+    55df:	85 c0                	test   %eax,%eax
+    55e1:	75 17                	jne    55fa <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    55e3:	83 ec 08             	sub    $0x8,%esp
+    55e6:	68 08 8b 00 00       	push   $0x8b08
+    55eb:	6a 01                	push   $0x1
+    55ed:	e8 ce 12 00 00       	call   68c0 <printf>
+    55f2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    55f5:	e8 ea 10 00 00       	call   66e4 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    55fa:	83 ec 0c             	sub    $0xc,%esp
+    55fd:	68 64 8a 00 00       	push   $0x8a64
+    5602:	e8 2d 11 00 00       	call   6734 <unlink>
+    5607:	83 c4 10             	add    $0x10,%esp
+    560a:	85 c0                	test   %eax,%eax
+    560c:	74 17                	je     5625 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    560e:	83 ec 08             	sub    $0x8,%esp
+    5611:	68 27 8b 00 00       	push   $0x8b27
+    5616:	6a 01                	push   $0x1
+    5618:	e8 a3 12 00 00       	call   68c0 <printf>
+    561d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5620:	e8 bf 10 00 00       	call   66e4 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    5625:	83 ec 08             	sub    $0x8,%esp
+    5628:	6a 02                	push   $0x2
+    562a:	68 07 80 00 00       	push   $0x8007
+    562f:	e8 f0 10 00 00       	call   6724 <open>
+    5634:	83 c4 10             	add    $0x10,%esp
+    5637:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    563a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    563e:	78 17                	js     5657 <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    5640:	83 ec 08             	sub    $0x8,%esp
+    5643:	68 40 8b 00 00       	push   $0x8b40
+    5648:	6a 01                	push   $0x1
+    564a:	e8 71 12 00 00       	call   68c0 <printf>
+    564f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5652:	e8 8d 10 00 00       	call   66e4 <exit>
+  }
+  fd = open(".", 0);
+    5657:	83 ec 08             	sub    $0x8,%esp
+    565a:	6a 00                	push   $0x0
+    565c:	68 07 80 00 00       	push   $0x8007
+    5661:	e8 be 10 00 00       	call   6724 <open>
+    5666:	83 c4 10             	add    $0x10,%esp
+    5669:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    566c:	83 ec 04             	sub    $0x4,%esp
+    566f:	6a 01                	push   $0x1
+    5671:	68 c4 78 00 00       	push   $0x78c4
+    5676:	ff 75 f4             	push   -0xc(%ebp)
+    5679:	e8 86 10 00 00       	call   6704 <write>
+    567e:	83 c4 10             	add    $0x10,%esp
+    5681:	85 c0                	test   %eax,%eax
+    5683:	7e 17                	jle    569c <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    5685:	83 ec 08             	sub    $0x8,%esp
+    5688:	68 5f 8b 00 00       	push   $0x8b5f
+    568d:	6a 01                	push   $0x1
+    568f:	e8 2c 12 00 00       	call   68c0 <printf>
+    5694:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5697:	e8 48 10 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    569c:	83 ec 0c             	sub    $0xc,%esp
+    569f:	ff 75 f4             	push   -0xc(%ebp)
+    56a2:	e8 65 10 00 00       	call   670c <close>
+    56a7:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    56aa:	83 ec 08             	sub    $0x8,%esp
+    56ad:	68 73 8b 00 00       	push   $0x8b73
+    56b2:	6a 01                	push   $0x1
+    56b4:	e8 07 12 00 00       	call   68c0 <printf>
+    56b9:	83 c4 10             	add    $0x10,%esp
+}
+    56bc:	90                   	nop
+    56bd:	c9                   	leave
+    56be:	c3                   	ret
+
+000056bf <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    56bf:	55                   	push   %ebp
+    56c0:	89 e5                	mov    %esp,%ebp
+    56c2:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    56c5:	83 ec 08             	sub    $0x8,%esp
+    56c8:	68 83 8b 00 00       	push   $0x8b83
+    56cd:	6a 01                	push   $0x1
+    56cf:	e8 ec 11 00 00       	call   68c0 <printf>
+    56d4:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    56d7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    56de:	e9 e7 00 00 00       	jmp    57ca <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    56e3:	83 ec 0c             	sub    $0xc,%esp
+    56e6:	68 94 8b 00 00       	push   $0x8b94
+    56eb:	e8 5c 10 00 00       	call   674c <mkdir>
+    56f0:	83 c4 10             	add    $0x10,%esp
+    56f3:	85 c0                	test   %eax,%eax
+    56f5:	74 17                	je     570e <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    56f7:	83 ec 08             	sub    $0x8,%esp
+    56fa:	68 9a 8b 00 00       	push   $0x8b9a
+    56ff:	6a 01                	push   $0x1
+    5701:	e8 ba 11 00 00       	call   68c0 <printf>
+    5706:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5709:	e8 d6 0f 00 00       	call   66e4 <exit>
+    }
+    if(chdir("irefd") != 0){
+    570e:	83 ec 0c             	sub    $0xc,%esp
+    5711:	68 94 8b 00 00       	push   $0x8b94
+    5716:	e8 39 10 00 00       	call   6754 <chdir>
+    571b:	83 c4 10             	add    $0x10,%esp
+    571e:	85 c0                	test   %eax,%eax
+    5720:	74 17                	je     5739 <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    5722:	83 ec 08             	sub    $0x8,%esp
+    5725:	68 ae 8b 00 00       	push   $0x8bae
+    572a:	6a 01                	push   $0x1
+    572c:	e8 8f 11 00 00       	call   68c0 <printf>
+    5731:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5734:	e8 ab 0f 00 00       	call   66e4 <exit>
+    }
+
+    mkdir("");
+    5739:	83 ec 0c             	sub    $0xc,%esp
+    573c:	68 c2 8b 00 00       	push   $0x8bc2
+    5741:	e8 06 10 00 00       	call   674c <mkdir>
+    5746:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    5749:	83 ec 08             	sub    $0x8,%esp
+    574c:	68 c2 8b 00 00       	push   $0x8bc2
+    5751:	68 01 8b 00 00       	push   $0x8b01
+    5756:	e8 e9 0f 00 00       	call   6744 <link>
+    575b:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    575e:	83 ec 08             	sub    $0x8,%esp
+    5761:	68 00 02 00 00       	push   $0x200
+    5766:	68 c2 8b 00 00       	push   $0x8bc2
+    576b:	e8 b4 0f 00 00       	call   6724 <open>
+    5770:	83 c4 10             	add    $0x10,%esp
+    5773:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    5776:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    577a:	78 0e                	js     578a <iref+0xcb>
+      close(fd);
+    577c:	83 ec 0c             	sub    $0xc,%esp
+    577f:	ff 75 f0             	push   -0x10(%ebp)
+    5782:	e8 85 0f 00 00       	call   670c <close>
+    5787:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    578a:	83 ec 08             	sub    $0x8,%esp
+    578d:	68 00 02 00 00       	push   $0x200
+    5792:	68 c3 8b 00 00       	push   $0x8bc3
+    5797:	e8 88 0f 00 00       	call   6724 <open>
+    579c:	83 c4 10             	add    $0x10,%esp
+    579f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    57a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    57a6:	78 0e                	js     57b6 <iref+0xf7>
+      close(fd);
+    57a8:	83 ec 0c             	sub    $0xc,%esp
+    57ab:	ff 75 f0             	push   -0x10(%ebp)
+    57ae:	e8 59 0f 00 00       	call   670c <close>
+    57b3:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    57b6:	83 ec 0c             	sub    $0xc,%esp
+    57b9:	68 c3 8b 00 00       	push   $0x8bc3
+    57be:	e8 71 0f 00 00       	call   6734 <unlink>
+    57c3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    57c6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    57ca:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    57ce:	0f 8e 0f ff ff ff    	jle    56e3 <iref+0x24>
+  }
+
+  chdir("/");
+    57d4:	83 ec 0c             	sub    $0xc,%esp
+    57d7:	68 ea 6c 00 00       	push   $0x6cea
+    57dc:	e8 73 0f 00 00       	call   6754 <chdir>
+    57e1:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    57e4:	83 ec 08             	sub    $0x8,%esp
+    57e7:	68 c6 8b 00 00       	push   $0x8bc6
+    57ec:	6a 01                	push   $0x1
+    57ee:	e8 cd 10 00 00       	call   68c0 <printf>
+    57f3:	83 c4 10             	add    $0x10,%esp
+}
+    57f6:	90                   	nop
+    57f7:	c9                   	leave
+    57f8:	c3                   	ret
+
+000057f9 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    57f9:	55                   	push   %ebp
+    57fa:	89 e5                	mov    %esp,%ebp
+    57fc:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    57ff:	83 ec 08             	sub    $0x8,%esp
+    5802:	68 da 8b 00 00       	push   $0x8bda
+    5807:	6a 01                	push   $0x1
+    5809:	e8 b2 10 00 00       	call   68c0 <printf>
+    580e:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    5811:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5818:	eb 1d                	jmp    5837 <forktest+0x3e>
+    pid = fork();
+    581a:	e8 bd 0e 00 00       	call   66dc <fork>
+    581f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    5822:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5826:	78 1a                	js     5842 <forktest+0x49>
+      break;
+    if(pid == 0)
+    5828:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    582c:	75 05                	jne    5833 <forktest+0x3a>
+      exit();
+    582e:	e8 b1 0e 00 00       	call   66e4 <exit>
+  for(n=0; n<1000; n++){
+    5833:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5837:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    583e:	7e da                	jle    581a <forktest+0x21>
+    5840:	eb 01                	jmp    5843 <forktest+0x4a>
+      break;
+    5842:	90                   	nop
+  }
+  
+  if(n == 1000){
+    5843:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    584a:	75 3b                	jne    5887 <forktest+0x8e>
+    printf(1, "fork claimed to work 1000 times!\n");
+    584c:	83 ec 08             	sub    $0x8,%esp
+    584f:	68 e8 8b 00 00       	push   $0x8be8
+    5854:	6a 01                	push   $0x1
+    5856:	e8 65 10 00 00       	call   68c0 <printf>
+    585b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    585e:	e8 81 0e 00 00       	call   66e4 <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+    5863:	e8 84 0e 00 00       	call   66ec <wait>
+    5868:	85 c0                	test   %eax,%eax
+    586a:	79 17                	jns    5883 <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    586c:	83 ec 08             	sub    $0x8,%esp
+    586f:	68 0a 8c 00 00       	push   $0x8c0a
+    5874:	6a 01                	push   $0x1
+    5876:	e8 45 10 00 00       	call   68c0 <printf>
+    587b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    587e:	e8 61 0e 00 00       	call   66e4 <exit>
+  for(; n > 0; n--){
+    5883:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    5887:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    588b:	7f d6                	jg     5863 <forktest+0x6a>
+    }
+  }
+  
+  if(wait() != -1){
+    588d:	e8 5a 0e 00 00       	call   66ec <wait>
+    5892:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5895:	74 17                	je     58ae <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    5897:	83 ec 08             	sub    $0x8,%esp
+    589a:	68 1e 8c 00 00       	push   $0x8c1e
+    589f:	6a 01                	push   $0x1
+    58a1:	e8 1a 10 00 00       	call   68c0 <printf>
+    58a6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    58a9:	e8 36 0e 00 00       	call   66e4 <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+    58ae:	83 ec 08             	sub    $0x8,%esp
+    58b1:	68 31 8c 00 00       	push   $0x8c31
+    58b6:	6a 01                	push   $0x1
+    58b8:	e8 03 10 00 00       	call   68c0 <printf>
+    58bd:	83 c4 10             	add    $0x10,%esp
+}
+    58c0:	90                   	nop
+    58c1:	c9                   	leave
+    58c2:	c3                   	ret
+
+000058c3 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    58c3:	55                   	push   %ebp
+    58c4:	89 e5                	mov    %esp,%ebp
+    58c6:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    58c9:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    58ce:	83 ec 08             	sub    $0x8,%esp
+    58d1:	68 3f 8c 00 00       	push   $0x8c3f
+    58d6:	50                   	push   %eax
+    58d7:	e8 e4 0f 00 00       	call   68c0 <printf>
+    58dc:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    58df:	83 ec 0c             	sub    $0xc,%esp
+    58e2:	6a 00                	push   $0x0
+    58e4:	e8 83 0e 00 00       	call   676c <sbrk>
+    58e9:	83 c4 10             	add    $0x10,%esp
+    58ec:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    58ef:	83 ec 0c             	sub    $0xc,%esp
+    58f2:	6a 00                	push   $0x0
+    58f4:	e8 73 0e 00 00       	call   676c <sbrk>
+    58f9:	83 c4 10             	add    $0x10,%esp
+    58fc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){ 
+    58ff:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    5906:	eb 4f                	jmp    5957 <sbrktest+0x94>
+    b = sbrk(1);
+    5908:	83 ec 0c             	sub    $0xc,%esp
+    590b:	6a 01                	push   $0x1
+    590d:	e8 5a 0e 00 00       	call   676c <sbrk>
+    5912:	83 c4 10             	add    $0x10,%esp
+    5915:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    5918:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    591b:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    591e:	74 24                	je     5944 <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    5920:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5925:	83 ec 0c             	sub    $0xc,%esp
+    5928:	ff 75 d0             	push   -0x30(%ebp)
+    592b:	ff 75 f4             	push   -0xc(%ebp)
+    592e:	ff 75 f0             	push   -0x10(%ebp)
+    5931:	68 4a 8c 00 00       	push   $0x8c4a
+    5936:	50                   	push   %eax
+    5937:	e8 84 0f 00 00       	call   68c0 <printf>
+    593c:	83 c4 20             	add    $0x20,%esp
+      exit();
+    593f:	e8 a0 0d 00 00       	call   66e4 <exit>
+    }
+    *b = 1;
+    5944:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5947:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    594a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    594d:	83 c0 01             	add    $0x1,%eax
+    5950:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){ 
+    5953:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    5957:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    595e:	7e a8                	jle    5908 <sbrktest+0x45>
+  }
+  pid = fork();
+    5960:	e8 77 0d 00 00       	call   66dc <fork>
+    5965:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    5968:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    596c:	79 1b                	jns    5989 <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    596e:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5973:	83 ec 08             	sub    $0x8,%esp
+    5976:	68 65 8c 00 00       	push   $0x8c65
+    597b:	50                   	push   %eax
+    597c:	e8 3f 0f 00 00       	call   68c0 <printf>
+    5981:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5984:	e8 5b 0d 00 00       	call   66e4 <exit>
+  }
+  c = sbrk(1);
+    5989:	83 ec 0c             	sub    $0xc,%esp
+    598c:	6a 01                	push   $0x1
+    598e:	e8 d9 0d 00 00       	call   676c <sbrk>
+    5993:	83 c4 10             	add    $0x10,%esp
+    5996:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    5999:	83 ec 0c             	sub    $0xc,%esp
+    599c:	6a 01                	push   $0x1
+    599e:	e8 c9 0d 00 00       	call   676c <sbrk>
+    59a3:	83 c4 10             	add    $0x10,%esp
+    59a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    59a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    59ac:	83 c0 01             	add    $0x1,%eax
+    59af:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    59b2:	74 1b                	je     59cf <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    59b4:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    59b9:	83 ec 08             	sub    $0x8,%esp
+    59bc:	68 7c 8c 00 00       	push   $0x8c7c
+    59c1:	50                   	push   %eax
+    59c2:	e8 f9 0e 00 00       	call   68c0 <printf>
+    59c7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    59ca:	e8 15 0d 00 00       	call   66e4 <exit>
+  }
+  if(pid == 0)
+    59cf:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    59d3:	75 05                	jne    59da <sbrktest+0x117>
+    exit();
+    59d5:	e8 0a 0d 00 00       	call   66e4 <exit>
+  wait();
+    59da:	e8 0d 0d 00 00       	call   66ec <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    59df:	83 ec 0c             	sub    $0xc,%esp
+    59e2:	6a 00                	push   $0x0
+    59e4:	e8 83 0d 00 00       	call   676c <sbrk>
+    59e9:	83 c4 10             	add    $0x10,%esp
+    59ec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    59ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    59f2:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    59f7:	29 c2                	sub    %eax,%edx
+    59f9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    59fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    59ff:	83 ec 0c             	sub    $0xc,%esp
+    5a02:	50                   	push   %eax
+    5a03:	e8 64 0d 00 00       	call   676c <sbrk>
+    5a08:	83 c4 10             	add    $0x10,%esp
+    5a0b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) { 
+    5a0e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    5a11:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    5a14:	74 1b                	je     5a31 <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    5a16:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5a1b:	83 ec 08             	sub    $0x8,%esp
+    5a1e:	68 98 8c 00 00       	push   $0x8c98
+    5a23:	50                   	push   %eax
+    5a24:	e8 97 0e 00 00       	call   68c0 <printf>
+    5a29:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5a2c:	e8 b3 0c 00 00       	call   66e4 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    5a31:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    5a38:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    5a3b:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    5a3e:	83 ec 0c             	sub    $0xc,%esp
+    5a41:	6a 00                	push   $0x0
+    5a43:	e8 24 0d 00 00       	call   676c <sbrk>
+    5a48:	83 c4 10             	add    $0x10,%esp
+    5a4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    5a4e:	83 ec 0c             	sub    $0xc,%esp
+    5a51:	68 00 f0 ff ff       	push   $0xfffff000
+    5a56:	e8 11 0d 00 00       	call   676c <sbrk>
+    5a5b:	83 c4 10             	add    $0x10,%esp
+    5a5e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    5a61:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    5a65:	75 1b                	jne    5a82 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    5a67:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5a6c:	83 ec 08             	sub    $0x8,%esp
+    5a6f:	68 d6 8c 00 00       	push   $0x8cd6
+    5a74:	50                   	push   %eax
+    5a75:	e8 46 0e 00 00       	call   68c0 <printf>
+    5a7a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5a7d:	e8 62 0c 00 00       	call   66e4 <exit>
+  }
+  c = sbrk(0);
+    5a82:	83 ec 0c             	sub    $0xc,%esp
+    5a85:	6a 00                	push   $0x0
+    5a87:	e8 e0 0c 00 00       	call   676c <sbrk>
+    5a8c:	83 c4 10             	add    $0x10,%esp
+    5a8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    5a92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5a95:	2d 00 10 00 00       	sub    $0x1000,%eax
+    5a9a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    5a9d:	74 1e                	je     5abd <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    5a9f:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5aa4:	ff 75 e4             	push   -0x1c(%ebp)
+    5aa7:	ff 75 f4             	push   -0xc(%ebp)
+    5aaa:	68 f4 8c 00 00       	push   $0x8cf4
+    5aaf:	50                   	push   %eax
+    5ab0:	e8 0b 0e 00 00       	call   68c0 <printf>
+    5ab5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5ab8:	e8 27 0c 00 00       	call   66e4 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    5abd:	83 ec 0c             	sub    $0xc,%esp
+    5ac0:	6a 00                	push   $0x0
+    5ac2:	e8 a5 0c 00 00       	call   676c <sbrk>
+    5ac7:	83 c4 10             	add    $0x10,%esp
+    5aca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    5acd:	83 ec 0c             	sub    $0xc,%esp
+    5ad0:	68 00 10 00 00       	push   $0x1000
+    5ad5:	e8 92 0c 00 00       	call   676c <sbrk>
+    5ada:	83 c4 10             	add    $0x10,%esp
+    5add:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    5ae0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5ae3:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    5ae6:	75 1a                	jne    5b02 <sbrktest+0x23f>
+    5ae8:	83 ec 0c             	sub    $0xc,%esp
+    5aeb:	6a 00                	push   $0x0
+    5aed:	e8 7a 0c 00 00       	call   676c <sbrk>
+    5af2:	83 c4 10             	add    $0x10,%esp
+    5af5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    5af8:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    5afe:	39 d0                	cmp    %edx,%eax
+    5b00:	74 1e                	je     5b20 <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    5b02:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5b07:	ff 75 e4             	push   -0x1c(%ebp)
+    5b0a:	ff 75 f4             	push   -0xc(%ebp)
+    5b0d:	68 2c 8d 00 00       	push   $0x8d2c
+    5b12:	50                   	push   %eax
+    5b13:	e8 a8 0d 00 00       	call   68c0 <printf>
+    5b18:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5b1b:	e8 c4 0b 00 00       	call   66e4 <exit>
+  }
+  if(*lastaddr == 99){
+    5b20:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    5b23:	0f b6 00             	movzbl (%eax),%eax
+    5b26:	3c 63                	cmp    $0x63,%al
+    5b28:	75 1b                	jne    5b45 <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    5b2a:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5b2f:	83 ec 08             	sub    $0x8,%esp
+    5b32:	68 54 8d 00 00       	push   $0x8d54
+    5b37:	50                   	push   %eax
+    5b38:	e8 83 0d 00 00       	call   68c0 <printf>
+    5b3d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5b40:	e8 9f 0b 00 00       	call   66e4 <exit>
+  }
+
+  a = sbrk(0);
+    5b45:	83 ec 0c             	sub    $0xc,%esp
+    5b48:	6a 00                	push   $0x0
+    5b4a:	e8 1d 0c 00 00       	call   676c <sbrk>
+    5b4f:	83 c4 10             	add    $0x10,%esp
+    5b52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    5b55:	83 ec 0c             	sub    $0xc,%esp
+    5b58:	6a 00                	push   $0x0
+    5b5a:	e8 0d 0c 00 00       	call   676c <sbrk>
+    5b5f:	83 c4 10             	add    $0x10,%esp
+    5b62:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    5b65:	29 c2                	sub    %eax,%edx
+    5b67:	83 ec 0c             	sub    $0xc,%esp
+    5b6a:	52                   	push   %edx
+    5b6b:	e8 fc 0b 00 00       	call   676c <sbrk>
+    5b70:	83 c4 10             	add    $0x10,%esp
+    5b73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    5b76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5b79:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    5b7c:	74 1e                	je     5b9c <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    5b7e:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5b83:	ff 75 e4             	push   -0x1c(%ebp)
+    5b86:	ff 75 f4             	push   -0xc(%ebp)
+    5b89:	68 84 8d 00 00       	push   $0x8d84
+    5b8e:	50                   	push   %eax
+    5b8f:	e8 2c 0d 00 00       	call   68c0 <printf>
+    5b94:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5b97:	e8 48 0b 00 00       	call   66e4 <exit>
+  }
+  
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    5b9c:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    5ba3:	eb 76                	jmp    5c1b <sbrktest+0x358>
+    ppid = getpid();
+    5ba5:	e8 ba 0b 00 00       	call   6764 <getpid>
+    5baa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    5bad:	e8 2a 0b 00 00       	call   66dc <fork>
+    5bb2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    5bb5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    5bb9:	79 1b                	jns    5bd6 <sbrktest+0x313>
+      printf(stdout, "fork failed\n");
+    5bbb:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5bc0:	83 ec 08             	sub    $0x8,%esp
+    5bc3:	68 19 6d 00 00       	push   $0x6d19
+    5bc8:	50                   	push   %eax
+    5bc9:	e8 f2 0c 00 00       	call   68c0 <printf>
+    5bce:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5bd1:	e8 0e 0b 00 00       	call   66e4 <exit>
+    }
+    if(pid == 0){
+    5bd6:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    5bda:	75 33                	jne    5c0f <sbrktest+0x34c>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    5bdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5bdf:	0f b6 00             	movzbl (%eax),%eax
+    5be2:	0f be d0             	movsbl %al,%edx
+    5be5:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5bea:	52                   	push   %edx
+    5beb:	ff 75 f4             	push   -0xc(%ebp)
+    5bee:	68 a5 8d 00 00       	push   $0x8da5
+    5bf3:	50                   	push   %eax
+    5bf4:	e8 c7 0c 00 00       	call   68c0 <printf>
+    5bf9:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    5bfc:	83 ec 0c             	sub    $0xc,%esp
+    5bff:	ff 75 d4             	push   -0x2c(%ebp)
+    5c02:	e8 0d 0b 00 00       	call   6714 <kill>
+    5c07:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5c0a:	e8 d5 0a 00 00       	call   66e4 <exit>
+    }
+    wait();
+    5c0f:	e8 d8 0a 00 00       	call   66ec <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    5c14:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    5c1b:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    5c22:	76 81                	jbe    5ba5 <sbrktest+0x2e2>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    5c24:	83 ec 0c             	sub    $0xc,%esp
+    5c27:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    5c2a:	50                   	push   %eax
+    5c2b:	e8 c4 0a 00 00       	call   66f4 <pipe>
+    5c30:	83 c4 10             	add    $0x10,%esp
+    5c33:	85 c0                	test   %eax,%eax
+    5c35:	74 17                	je     5c4e <sbrktest+0x38b>
+    printf(1, "pipe() failed\n");
+    5c37:	83 ec 08             	sub    $0x8,%esp
+    5c3a:	68 5f 78 00 00       	push   $0x785f
+    5c3f:	6a 01                	push   $0x1
+    5c41:	e8 7a 0c 00 00       	call   68c0 <printf>
+    5c46:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5c49:	e8 96 0a 00 00       	call   66e4 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5c4e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    5c55:	e9 86 00 00 00       	jmp    5ce0 <sbrktest+0x41d>
+    if((pids[i] = fork()) == 0){
+    5c5a:	e8 7d 0a 00 00       	call   66dc <fork>
+    5c5f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    5c62:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    5c66:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5c69:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    5c6d:	85 c0                	test   %eax,%eax
+    5c6f:	75 4a                	jne    5cbb <sbrktest+0x3f8>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    5c71:	83 ec 0c             	sub    $0xc,%esp
+    5c74:	6a 00                	push   $0x0
+    5c76:	e8 f1 0a 00 00       	call   676c <sbrk>
+    5c7b:	83 c4 10             	add    $0x10,%esp
+    5c7e:	89 c2                	mov    %eax,%edx
+    5c80:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    5c85:	29 d0                	sub    %edx,%eax
+    5c87:	83 ec 0c             	sub    $0xc,%esp
+    5c8a:	50                   	push   %eax
+    5c8b:	e8 dc 0a 00 00       	call   676c <sbrk>
+    5c90:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    5c93:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    5c96:	83 ec 04             	sub    $0x4,%esp
+    5c99:	6a 01                	push   $0x1
+    5c9b:	68 c4 78 00 00       	push   $0x78c4
+    5ca0:	50                   	push   %eax
+    5ca1:	e8 5e 0a 00 00       	call   6704 <write>
+    5ca6:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    5ca9:	83 ec 0c             	sub    $0xc,%esp
+    5cac:	68 e8 03 00 00       	push   $0x3e8
+    5cb1:	e8 be 0a 00 00       	call   6774 <sleep>
+    5cb6:	83 c4 10             	add    $0x10,%esp
+    5cb9:	eb ee                	jmp    5ca9 <sbrktest+0x3e6>
+    }
+    if(pids[i] != -1)
+    5cbb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5cbe:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    5cc2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5cc5:	74 15                	je     5cdc <sbrktest+0x419>
+      read(fds[0], &scratch, 1);
+    5cc7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    5cca:	83 ec 04             	sub    $0x4,%esp
+    5ccd:	6a 01                	push   $0x1
+    5ccf:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    5cd2:	52                   	push   %edx
+    5cd3:	50                   	push   %eax
+    5cd4:	e8 23 0a 00 00       	call   66fc <read>
+    5cd9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5cdc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    5ce0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5ce3:	83 f8 09             	cmp    $0x9,%eax
+    5ce6:	0f 86 6e ff ff ff    	jbe    5c5a <sbrktest+0x397>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    5cec:	83 ec 0c             	sub    $0xc,%esp
+    5cef:	68 00 10 00 00       	push   $0x1000
+    5cf4:	e8 73 0a 00 00       	call   676c <sbrk>
+    5cf9:	83 c4 10             	add    $0x10,%esp
+    5cfc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5cff:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    5d06:	eb 2b                	jmp    5d33 <sbrktest+0x470>
+    if(pids[i] == -1)
+    5d08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5d0b:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    5d0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5d12:	74 1a                	je     5d2e <sbrktest+0x46b>
+      continue;
+    kill(pids[i]);
+    5d14:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5d17:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    5d1b:	83 ec 0c             	sub    $0xc,%esp
+    5d1e:	50                   	push   %eax
+    5d1f:	e8 f0 09 00 00       	call   6714 <kill>
+    5d24:	83 c4 10             	add    $0x10,%esp
+    wait();
+    5d27:	e8 c0 09 00 00       	call   66ec <wait>
+    5d2c:	eb 01                	jmp    5d2f <sbrktest+0x46c>
+      continue;
+    5d2e:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5d2f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    5d33:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5d36:	83 f8 09             	cmp    $0x9,%eax
+    5d39:	76 cd                	jbe    5d08 <sbrktest+0x445>
+  }
+  if(c == (char*)0xffffffff){
+    5d3b:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    5d3f:	75 1b                	jne    5d5c <sbrktest+0x499>
+    printf(stdout, "failed sbrk leaked memory\n");
+    5d41:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5d46:	83 ec 08             	sub    $0x8,%esp
+    5d49:	68 be 8d 00 00       	push   $0x8dbe
+    5d4e:	50                   	push   %eax
+    5d4f:	e8 6c 0b 00 00       	call   68c0 <printf>
+    5d54:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5d57:	e8 88 09 00 00       	call   66e4 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    5d5c:	83 ec 0c             	sub    $0xc,%esp
+    5d5f:	6a 00                	push   $0x0
+    5d61:	e8 06 0a 00 00       	call   676c <sbrk>
+    5d66:	83 c4 10             	add    $0x10,%esp
+    5d69:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    5d6c:	73 1e                	jae    5d8c <sbrktest+0x4c9>
+    sbrk(-(sbrk(0) - oldbrk));
+    5d6e:	83 ec 0c             	sub    $0xc,%esp
+    5d71:	6a 00                	push   $0x0
+    5d73:	e8 f4 09 00 00       	call   676c <sbrk>
+    5d78:	83 c4 10             	add    $0x10,%esp
+    5d7b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    5d7e:	29 c2                	sub    %eax,%edx
+    5d80:	83 ec 0c             	sub    $0xc,%esp
+    5d83:	52                   	push   %edx
+    5d84:	e8 e3 09 00 00       	call   676c <sbrk>
+    5d89:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    5d8c:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5d91:	83 ec 08             	sub    $0x8,%esp
+    5d94:	68 d9 8d 00 00       	push   $0x8dd9
+    5d99:	50                   	push   %eax
+    5d9a:	e8 21 0b 00 00       	call   68c0 <printf>
+    5d9f:	83 c4 10             	add    $0x10,%esp
+}
+    5da2:	90                   	nop
+    5da3:	c9                   	leave
+    5da4:	c3                   	ret
+
+00005da5 <validateint>:
+
+void
+validateint(int *p)
+{
+    5da5:	55                   	push   %ebp
+    5da6:	89 e5                	mov    %esp,%ebp
+    5da8:	53                   	push   %ebx
+    5da9:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    5dac:	b8 0d 00 00 00       	mov    $0xd,%eax
+    5db1:	8b 55 08             	mov    0x8(%ebp),%edx
+    5db4:	89 d1                	mov    %edx,%ecx
+    5db6:	89 e3                	mov    %esp,%ebx
+    5db8:	89 cc                	mov    %ecx,%esp
+    5dba:	cd 40                	int    $0x40
+    5dbc:	89 dc                	mov    %ebx,%esp
+    5dbe:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    5dc1:	90                   	nop
+    5dc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5dc5:	c9                   	leave
+    5dc6:	c3                   	ret
+
+00005dc7 <validatetest>:
+
+void
+validatetest(void)
+{
+    5dc7:	55                   	push   %ebp
+    5dc8:	89 e5                	mov    %esp,%ebp
+    5dca:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    5dcd:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5dd2:	83 ec 08             	sub    $0x8,%esp
+    5dd5:	68 e7 8d 00 00       	push   $0x8de7
+    5dda:	50                   	push   %eax
+    5ddb:	e8 e0 0a 00 00       	call   68c0 <printf>
+    5de0:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    5de3:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5dea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5df1:	e9 8a 00 00 00       	jmp    5e80 <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    5df6:	e8 e1 08 00 00       	call   66dc <fork>
+    5dfb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    5dfe:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    5e02:	75 14                	jne    5e18 <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    5e04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5e07:	83 ec 0c             	sub    $0xc,%esp
+    5e0a:	50                   	push   %eax
+    5e0b:	e8 95 ff ff ff       	call   5da5 <validateint>
+    5e10:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5e13:	e8 cc 08 00 00       	call   66e4 <exit>
+    }
+    sleep(0);
+    5e18:	83 ec 0c             	sub    $0xc,%esp
+    5e1b:	6a 00                	push   $0x0
+    5e1d:	e8 52 09 00 00       	call   6774 <sleep>
+    5e22:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    5e25:	83 ec 0c             	sub    $0xc,%esp
+    5e28:	6a 00                	push   $0x0
+    5e2a:	e8 45 09 00 00       	call   6774 <sleep>
+    5e2f:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    5e32:	83 ec 0c             	sub    $0xc,%esp
+    5e35:	ff 75 ec             	push   -0x14(%ebp)
+    5e38:	e8 d7 08 00 00       	call   6714 <kill>
+    5e3d:	83 c4 10             	add    $0x10,%esp
+    wait();
+    5e40:	e8 a7 08 00 00       	call   66ec <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    5e45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5e48:	83 ec 08             	sub    $0x8,%esp
+    5e4b:	50                   	push   %eax
+    5e4c:	68 f6 8d 00 00       	push   $0x8df6
+    5e51:	e8 ee 08 00 00       	call   6744 <link>
+    5e56:	83 c4 10             	add    $0x10,%esp
+    5e59:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5e5c:	74 1b                	je     5e79 <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    5e5e:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5e63:	83 ec 08             	sub    $0x8,%esp
+    5e66:	68 01 8e 00 00       	push   $0x8e01
+    5e6b:	50                   	push   %eax
+    5e6c:	e8 4f 0a 00 00       	call   68c0 <printf>
+    5e71:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5e74:	e8 6b 08 00 00       	call   66e4 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5e79:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    5e80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5e83:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    5e86:	0f 83 6a ff ff ff    	jae    5df6 <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    5e8c:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5e91:	83 ec 08             	sub    $0x8,%esp
+    5e94:	68 1a 8e 00 00       	push   $0x8e1a
+    5e99:	50                   	push   %eax
+    5e9a:	e8 21 0a 00 00       	call   68c0 <printf>
+    5e9f:	83 c4 10             	add    $0x10,%esp
+}
+    5ea2:	90                   	nop
+    5ea3:	c9                   	leave
+    5ea4:	c3                   	ret
+
+00005ea5 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    5ea5:	55                   	push   %ebp
+    5ea6:	89 e5                	mov    %esp,%ebp
+    5ea8:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    5eab:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5eb0:	83 ec 08             	sub    $0x8,%esp
+    5eb3:	68 27 8e 00 00       	push   $0x8e27
+    5eb8:	50                   	push   %eax
+    5eb9:	e8 02 0a 00 00       	call   68c0 <printf>
+    5ebe:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    5ec1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5ec8:	eb 2e                	jmp    5ef8 <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    5eca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5ecd:	05 c0 c4 00 00       	add    $0xc4c0,%eax
+    5ed2:	0f b6 00             	movzbl (%eax),%eax
+    5ed5:	84 c0                	test   %al,%al
+    5ed7:	74 1b                	je     5ef4 <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    5ed9:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5ede:	83 ec 08             	sub    $0x8,%esp
+    5ee1:	68 31 8e 00 00       	push   $0x8e31
+    5ee6:	50                   	push   %eax
+    5ee7:	e8 d4 09 00 00       	call   68c0 <printf>
+    5eec:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5eef:	e8 f0 07 00 00       	call   66e4 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    5ef4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5ef8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5efb:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    5f00:	76 c8                	jbe    5eca <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    5f02:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5f07:	83 ec 08             	sub    $0x8,%esp
+    5f0a:	68 42 8e 00 00       	push   $0x8e42
+    5f0f:	50                   	push   %eax
+    5f10:	e8 ab 09 00 00       	call   68c0 <printf>
+    5f15:	83 c4 10             	add    $0x10,%esp
+}
+    5f18:	90                   	nop
+    5f19:	c9                   	leave
+    5f1a:	c3                   	ret
+
+00005f1b <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    5f1b:	55                   	push   %ebp
+    5f1c:	89 e5                	mov    %esp,%ebp
+    5f1e:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    5f21:	83 ec 0c             	sub    $0xc,%esp
+    5f24:	68 4f 8e 00 00       	push   $0x8e4f
+    5f29:	e8 06 08 00 00       	call   6734 <unlink>
+    5f2e:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    5f31:	e8 a6 07 00 00       	call   66dc <fork>
+    5f36:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    5f39:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5f3d:	0f 85 97 00 00 00    	jne    5fda <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    5f43:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5f4a:	eb 12                	jmp    5f5e <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    5f4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5f4f:	c7 04 85 e0 eb 00 00 	movl   $0x8e5c,0xebe0(,%eax,4)
+    5f56:	5c 8e 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    5f5a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5f5e:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    5f62:	7e e8                	jle    5f4c <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    5f64:	c7 05 5c ec 00 00 00 	movl   $0x0,0xec5c
+    5f6b:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    5f6e:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5f73:	83 ec 08             	sub    $0x8,%esp
+    5f76:	68 39 8f 00 00       	push   $0x8f39
+    5f7b:	50                   	push   %eax
+    5f7c:	e8 3f 09 00 00       	call   68c0 <printf>
+    5f81:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    5f84:	83 ec 08             	sub    $0x8,%esp
+    5f87:	68 e0 eb 00 00       	push   $0xebe0
+    5f8c:	68 78 6c 00 00       	push   $0x6c78
+    5f91:	e8 86 07 00 00       	call   671c <exec>
+    5f96:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    5f99:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5f9e:	83 ec 08             	sub    $0x8,%esp
+    5fa1:	68 46 8f 00 00       	push   $0x8f46
+    5fa6:	50                   	push   %eax
+    5fa7:	e8 14 09 00 00       	call   68c0 <printf>
+    5fac:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    5faf:	83 ec 08             	sub    $0x8,%esp
+    5fb2:	68 00 02 00 00       	push   $0x200
+    5fb7:	68 4f 8e 00 00       	push   $0x8e4f
+    5fbc:	e8 63 07 00 00       	call   6724 <open>
+    5fc1:	83 c4 10             	add    $0x10,%esp
+    5fc4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    5fc7:	83 ec 0c             	sub    $0xc,%esp
+    5fca:	ff 75 ec             	push   -0x14(%ebp)
+    5fcd:	e8 3a 07 00 00       	call   670c <close>
+    5fd2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5fd5:	e8 0a 07 00 00       	call   66e4 <exit>
+  } else if(pid < 0){
+    5fda:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5fde:	79 1b                	jns    5ffb <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    5fe0:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    5fe5:	83 ec 08             	sub    $0x8,%esp
+    5fe8:	68 56 8f 00 00       	push   $0x8f56
+    5fed:	50                   	push   %eax
+    5fee:	e8 cd 08 00 00       	call   68c0 <printf>
+    5ff3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5ff6:	e8 e9 06 00 00       	call   66e4 <exit>
+  }
+  wait();
+    5ffb:	e8 ec 06 00 00       	call   66ec <wait>
+  fd = open("bigarg-ok", 0);
+    6000:	83 ec 08             	sub    $0x8,%esp
+    6003:	6a 00                	push   $0x0
+    6005:	68 4f 8e 00 00       	push   $0x8e4f
+    600a:	e8 15 07 00 00       	call   6724 <open>
+    600f:	83 c4 10             	add    $0x10,%esp
+    6012:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    6015:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    6019:	79 1b                	jns    6036 <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    601b:	a1 04 9a 00 00       	mov    0x9a04,%eax
+    6020:	83 ec 08             	sub    $0x8,%esp
+    6023:	68 6f 8f 00 00       	push   $0x8f6f
+    6028:	50                   	push   %eax
+    6029:	e8 92 08 00 00       	call   68c0 <printf>
+    602e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    6031:	e8 ae 06 00 00       	call   66e4 <exit>
+  }
+  close(fd);
+    6036:	83 ec 0c             	sub    $0xc,%esp
+    6039:	ff 75 ec             	push   -0x14(%ebp)
+    603c:	e8 cb 06 00 00       	call   670c <close>
+    6041:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    6044:	83 ec 0c             	sub    $0xc,%esp
+    6047:	68 4f 8e 00 00       	push   $0x8e4f
+    604c:	e8 e3 06 00 00       	call   6734 <unlink>
+    6051:	83 c4 10             	add    $0x10,%esp
+}
+    6054:	90                   	nop
+    6055:	c9                   	leave
+    6056:	c3                   	ret
+
+00006057 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    6057:	55                   	push   %ebp
+    6058:	89 e5                	mov    %esp,%ebp
+    605a:	53                   	push   %ebx
+    605b:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    605e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    6065:	83 ec 08             	sub    $0x8,%esp
+    6068:	68 84 8f 00 00       	push   $0x8f84
+    606d:	6a 01                	push   $0x1
+    606f:	e8 4c 08 00 00       	call   68c0 <printf>
+    6074:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    6077:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    607e:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    6082:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    6085:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    608a:	89 c8                	mov    %ecx,%eax
+    608c:	f7 ea                	imul   %edx
+    608e:	c1 fa 06             	sar    $0x6,%edx
+    6091:	89 c8                	mov    %ecx,%eax
+    6093:	c1 f8 1f             	sar    $0x1f,%eax
+    6096:	29 c2                	sub    %eax,%edx
+    6098:	89 d0                	mov    %edx,%eax
+    609a:	83 c0 30             	add    $0x30,%eax
+    609d:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    60a0:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    60a3:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    60a8:	89 d8                	mov    %ebx,%eax
+    60aa:	f7 ea                	imul   %edx
+    60ac:	c1 fa 06             	sar    $0x6,%edx
+    60af:	89 d8                	mov    %ebx,%eax
+    60b1:	c1 f8 1f             	sar    $0x1f,%eax
+    60b4:	89 d1                	mov    %edx,%ecx
+    60b6:	29 c1                	sub    %eax,%ecx
+    60b8:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    60be:	29 c3                	sub    %eax,%ebx
+    60c0:	89 d9                	mov    %ebx,%ecx
+    60c2:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    60c7:	89 c8                	mov    %ecx,%eax
+    60c9:	f7 ea                	imul   %edx
+    60cb:	c1 fa 05             	sar    $0x5,%edx
+    60ce:	89 c8                	mov    %ecx,%eax
+    60d0:	c1 f8 1f             	sar    $0x1f,%eax
+    60d3:	29 c2                	sub    %eax,%edx
+    60d5:	89 d0                	mov    %edx,%eax
+    60d7:	83 c0 30             	add    $0x30,%eax
+    60da:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    60dd:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    60e0:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    60e5:	89 d8                	mov    %ebx,%eax
+    60e7:	f7 ea                	imul   %edx
+    60e9:	c1 fa 05             	sar    $0x5,%edx
+    60ec:	89 d8                	mov    %ebx,%eax
+    60ee:	c1 f8 1f             	sar    $0x1f,%eax
+    60f1:	89 d1                	mov    %edx,%ecx
+    60f3:	29 c1                	sub    %eax,%ecx
+    60f5:	6b c1 64             	imul   $0x64,%ecx,%eax
+    60f8:	29 c3                	sub    %eax,%ebx
+    60fa:	89 d9                	mov    %ebx,%ecx
+    60fc:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    6101:	89 c8                	mov    %ecx,%eax
+    6103:	f7 ea                	imul   %edx
+    6105:	c1 fa 02             	sar    $0x2,%edx
+    6108:	89 c8                	mov    %ecx,%eax
+    610a:	c1 f8 1f             	sar    $0x1f,%eax
+    610d:	29 c2                	sub    %eax,%edx
+    610f:	89 d0                	mov    %edx,%eax
+    6111:	83 c0 30             	add    $0x30,%eax
+    6114:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    6117:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    611a:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    611f:	89 c8                	mov    %ecx,%eax
+    6121:	f7 ea                	imul   %edx
+    6123:	c1 fa 02             	sar    $0x2,%edx
+    6126:	89 c8                	mov    %ecx,%eax
+    6128:	c1 f8 1f             	sar    $0x1f,%eax
+    612b:	29 c2                	sub    %eax,%edx
+    612d:	89 d0                	mov    %edx,%eax
+    612f:	c1 e0 02             	shl    $0x2,%eax
+    6132:	01 d0                	add    %edx,%eax
+    6134:	01 c0                	add    %eax,%eax
+    6136:	29 c1                	sub    %eax,%ecx
+    6138:	89 ca                	mov    %ecx,%edx
+    613a:	89 d0                	mov    %edx,%eax
+    613c:	83 c0 30             	add    $0x30,%eax
+    613f:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    6142:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    6146:	83 ec 04             	sub    $0x4,%esp
+    6149:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    614c:	50                   	push   %eax
+    614d:	68 91 8f 00 00       	push   $0x8f91
+    6152:	6a 01                	push   $0x1
+    6154:	e8 67 07 00 00       	call   68c0 <printf>
+    6159:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    615c:	83 ec 08             	sub    $0x8,%esp
+    615f:	68 02 02 00 00       	push   $0x202
+    6164:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    6167:	50                   	push   %eax
+    6168:	e8 b7 05 00 00       	call   6724 <open>
+    616d:	83 c4 10             	add    $0x10,%esp
+    6170:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    6173:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    6177:	79 18                	jns    6191 <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    6179:	83 ec 04             	sub    $0x4,%esp
+    617c:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    617f:	50                   	push   %eax
+    6180:	68 9d 8f 00 00       	push   $0x8f9d
+    6185:	6a 01                	push   $0x1
+    6187:	e8 34 07 00 00       	call   68c0 <printf>
+    618c:	83 c4 10             	add    $0x10,%esp
+      break;
+    618f:	eb 6b                	jmp    61fc <fsfull+0x1a5>
+    }
+    int total = 0;
+    6191:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    6198:	83 ec 04             	sub    $0x4,%esp
+    619b:	68 00 02 00 00       	push   $0x200
+    61a0:	68 20 9a 00 00       	push   $0x9a20
+    61a5:	ff 75 e8             	push   -0x18(%ebp)
+    61a8:	e8 57 05 00 00       	call   6704 <write>
+    61ad:	83 c4 10             	add    $0x10,%esp
+    61b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    61b3:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    61ba:	7e 0c                	jle    61c8 <fsfull+0x171>
+        break;
+      total += cc;
+    61bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    61bf:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    61c2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    61c6:	eb d0                	jmp    6198 <fsfull+0x141>
+        break;
+    61c8:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    61c9:	83 ec 04             	sub    $0x4,%esp
+    61cc:	ff 75 ec             	push   -0x14(%ebp)
+    61cf:	68 ad 8f 00 00       	push   $0x8fad
+    61d4:	6a 01                	push   $0x1
+    61d6:	e8 e5 06 00 00       	call   68c0 <printf>
+    61db:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    61de:	83 ec 0c             	sub    $0xc,%esp
+    61e1:	ff 75 e8             	push   -0x18(%ebp)
+    61e4:	e8 23 05 00 00       	call   670c <close>
+    61e9:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    61ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    61f0:	74 09                	je     61fb <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    61f2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    61f6:	e9 83 fe ff ff       	jmp    607e <fsfull+0x27>
+      break;
+    61fb:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    61fc:	e9 db 00 00 00       	jmp    62dc <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    6201:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    6205:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    6208:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    620d:	89 c8                	mov    %ecx,%eax
+    620f:	f7 ea                	imul   %edx
+    6211:	c1 fa 06             	sar    $0x6,%edx
+    6214:	89 c8                	mov    %ecx,%eax
+    6216:	c1 f8 1f             	sar    $0x1f,%eax
+    6219:	29 c2                	sub    %eax,%edx
+    621b:	89 d0                	mov    %edx,%eax
+    621d:	83 c0 30             	add    $0x30,%eax
+    6220:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    6223:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    6226:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    622b:	89 d8                	mov    %ebx,%eax
+    622d:	f7 ea                	imul   %edx
+    622f:	c1 fa 06             	sar    $0x6,%edx
+    6232:	89 d8                	mov    %ebx,%eax
+    6234:	c1 f8 1f             	sar    $0x1f,%eax
+    6237:	89 d1                	mov    %edx,%ecx
+    6239:	29 c1                	sub    %eax,%ecx
+    623b:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    6241:	29 c3                	sub    %eax,%ebx
+    6243:	89 d9                	mov    %ebx,%ecx
+    6245:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    624a:	89 c8                	mov    %ecx,%eax
+    624c:	f7 ea                	imul   %edx
+    624e:	c1 fa 05             	sar    $0x5,%edx
+    6251:	89 c8                	mov    %ecx,%eax
+    6253:	c1 f8 1f             	sar    $0x1f,%eax
+    6256:	29 c2                	sub    %eax,%edx
+    6258:	89 d0                	mov    %edx,%eax
+    625a:	83 c0 30             	add    $0x30,%eax
+    625d:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    6260:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    6263:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    6268:	89 d8                	mov    %ebx,%eax
+    626a:	f7 ea                	imul   %edx
+    626c:	c1 fa 05             	sar    $0x5,%edx
+    626f:	89 d8                	mov    %ebx,%eax
+    6271:	c1 f8 1f             	sar    $0x1f,%eax
+    6274:	89 d1                	mov    %edx,%ecx
+    6276:	29 c1                	sub    %eax,%ecx
+    6278:	6b c1 64             	imul   $0x64,%ecx,%eax
+    627b:	29 c3                	sub    %eax,%ebx
+    627d:	89 d9                	mov    %ebx,%ecx
+    627f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    6284:	89 c8                	mov    %ecx,%eax
+    6286:	f7 ea                	imul   %edx
+    6288:	c1 fa 02             	sar    $0x2,%edx
+    628b:	89 c8                	mov    %ecx,%eax
+    628d:	c1 f8 1f             	sar    $0x1f,%eax
+    6290:	29 c2                	sub    %eax,%edx
+    6292:	89 d0                	mov    %edx,%eax
+    6294:	83 c0 30             	add    $0x30,%eax
+    6297:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    629a:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    629d:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    62a2:	89 c8                	mov    %ecx,%eax
+    62a4:	f7 ea                	imul   %edx
+    62a6:	c1 fa 02             	sar    $0x2,%edx
+    62a9:	89 c8                	mov    %ecx,%eax
+    62ab:	c1 f8 1f             	sar    $0x1f,%eax
+    62ae:	29 c2                	sub    %eax,%edx
+    62b0:	89 d0                	mov    %edx,%eax
+    62b2:	c1 e0 02             	shl    $0x2,%eax
+    62b5:	01 d0                	add    %edx,%eax
+    62b7:	01 c0                	add    %eax,%eax
+    62b9:	29 c1                	sub    %eax,%ecx
+    62bb:	89 ca                	mov    %ecx,%edx
+    62bd:	89 d0                	mov    %edx,%eax
+    62bf:	83 c0 30             	add    $0x30,%eax
+    62c2:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    62c5:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    62c9:	83 ec 0c             	sub    $0xc,%esp
+    62cc:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    62cf:	50                   	push   %eax
+    62d0:	e8 5f 04 00 00       	call   6734 <unlink>
+    62d5:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    62d8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    62dc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    62e0:	0f 89 1b ff ff ff    	jns    6201 <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    62e6:	83 ec 08             	sub    $0x8,%esp
+    62e9:	68 bd 8f 00 00       	push   $0x8fbd
+    62ee:	6a 01                	push   $0x1
+    62f0:	e8 cb 05 00 00       	call   68c0 <printf>
+    62f5:	83 c4 10             	add    $0x10,%esp
+}
+    62f8:	90                   	nop
+    62f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    62fc:	c9                   	leave
+    62fd:	c3                   	ret
+
+000062fe <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    62fe:	55                   	push   %ebp
+    62ff:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    6301:	a1 08 9a 00 00       	mov    0x9a08,%eax
+    6306:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    630c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    6311:	a3 08 9a 00 00       	mov    %eax,0x9a08
+  return randstate;
+    6316:	a1 08 9a 00 00       	mov    0x9a08,%eax
+}
+    631b:	5d                   	pop    %ebp
+    631c:	c3                   	ret
+
+0000631d <main>:
+
+int
+main(int argc, char *argv[])
+{
+    631d:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    6321:	83 e4 f0             	and    $0xfffffff0,%esp
+    6324:	ff 71 fc             	push   -0x4(%ecx)
+    6327:	55                   	push   %ebp
+    6328:	89 e5                	mov    %esp,%ebp
+    632a:	51                   	push   %ecx
+    632b:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    632e:	83 ec 08             	sub    $0x8,%esp
+    6331:	68 d3 8f 00 00       	push   $0x8fd3
+    6336:	6a 01                	push   $0x1
+    6338:	e8 83 05 00 00       	call   68c0 <printf>
+    633d:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    6340:	83 ec 08             	sub    $0x8,%esp
+    6343:	6a 00                	push   $0x0
+    6345:	68 e7 8f 00 00       	push   $0x8fe7
+    634a:	e8 d5 03 00 00       	call   6724 <open>
+    634f:	83 c4 10             	add    $0x10,%esp
+    6352:	85 c0                	test   %eax,%eax
+    6354:	78 17                	js     636d <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    6356:	83 ec 08             	sub    $0x8,%esp
+    6359:	68 f8 8f 00 00       	push   $0x8ff8
+    635e:	6a 01                	push   $0x1
+    6360:	e8 5b 05 00 00       	call   68c0 <printf>
+    6365:	83 c4 10             	add    $0x10,%esp
+    exit();
+    6368:	e8 77 03 00 00       	call   66e4 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    636d:	83 ec 08             	sub    $0x8,%esp
+    6370:	68 00 02 00 00       	push   $0x200
+    6375:	68 e7 8f 00 00       	push   $0x8fe7
+    637a:	e8 a5 03 00 00       	call   6724 <open>
+    637f:	83 c4 10             	add    $0x10,%esp
+    6382:	83 ec 0c             	sub    $0xc,%esp
+    6385:	50                   	push   %eax
+    6386:	e8 81 03 00 00       	call   670c <close>
+    638b:	83 c4 10             	add    $0x10,%esp
+
+  createdelete();
+    638e:	e8 34 d4 ff ff       	call   37c7 <createdelete>
+  linkunlink();
+    6393:	e8 59 de ff ff       	call   41f1 <linkunlink>
+  concreate();
+    6398:	e8 a0 da ff ff       	call   3e3d <concreate>
+  fourfiles();
+    639d:	e8 d4 d1 ff ff       	call   3576 <fourfiles>
+  sharedfd();
+    63a2:	e8 20 cd ff ff       	call   30c7 <sharedfd>
+  sharedread();
+    63a7:	e8 fe ce ff ff       	call   32aa <sharedread>
+
+  bigargtest();
+    63ac:	e8 6a fb ff ff       	call   5f1b <bigargtest>
+  bigwrite();
+    63b1:	e8 da ea ff ff       	call   4e90 <bigwrite>
+  bigargtest();
+    63b6:	e8 60 fb ff ff       	call   5f1b <bigargtest>
+  bsstest();
+    63bb:	e8 e5 fa ff ff       	call   5ea5 <bsstest>
+  sbrktest();
+    63c0:	e8 fe f4 ff ff       	call   58c3 <sbrktest>
+  validatetest();
+    63c5:	e8 fd f9 ff ff       	call   5dc7 <validatetest>
+
+  opentest();
+    63ca:	e8 4a 9f ff ff       	call   319 <opentest>
+  writetest();
+    63cf:	e8 f4 9f ff ff       	call   3c8 <writetest>
+  writetest1();
+    63d4:	e8 ff a1 ff ff       	call   5d8 <writetest1>
+  statfstest();
+    63d9:	e8 7a aa ff ff       	call   e58 <statfstest>
+  bcachetest();
+    63de:	e8 ca ab ff ff       	call   fad <bcachetest>
+  bcstattest();
+    63e3:	e8 d7 ad ff ff       	call   11bf <bcstattest>
+  logopstest();
+    63e8:	e8 7f b0 ff ff       	call   146c <logopstest>
+  readaheadtest();
+    63ed:	e8 2b b2 ff ff       	call   161d <readaheadtest>
+  synctest();
+    63f2:	e8 7b b4 ff ff       	call   1872 <synctest>
+  installtest();
+    63f7:	e8 ba b6 ff ff       	call   1ab6 <installtest>
+  createtest();
+    63fc:	e8 f1 b9 ff ff       	call   1df2 <createtest>
+  dcachetest();
+    6401:	e8 af ba ff ff       	call   1eb5 <dcachetest>
+
+  openiputtest();
+    6406:	e8 ff 9d ff ff       	call   20a <openiputtest>
+  exitiputtest();
+    640b:	e8 fb 9c ff ff       	call   10b <exitiputtest>
+  iputtest();
+    6410:	e8 05 9c ff ff       	call   1a <iputtest>
+
+  mem();
+    6415:	e8 bc cb ff ff       	call   2fd6 <mem>
+  pipe1();
+    641a:	e8 83 be ff ff       	call   22a2 <pipe1>
+  preempt();
+    641f:	e8 67 c0 ff ff       	call   248b <preempt>
+  exitwait();
+    6424:	e8 c8 c1 ff ff       	call   25f1 <exitwait>
+  clonetest();
+    6429:	e8 79 c2 ff ff       	call   26a7 <clonetest>
+  futextest();
+    642e:	e8 9f c5 ff ff       	call   29d2 <futextest>
+  affinitytest();
+    6433:	e8 15 c7 ff ff       	call   2b4d <affinitytest>
+  rusagetest();
+    6438:	e8 43 c8 ff ff       	call   2c80 <rusagetest>
+  lockstattest();
+    643d:	e8 bb c9 ff ff       	call   2dfd <lockstattest>
+
+  rmdot();
+    6442:	e8 bb ee ff ff       	call   5302 <rmdot>
+  fourteen();
+    6447:	e8 5a ed ff ff       	call   51a6 <fourteen>
+  bigfile();
+    644c:	e8 3d eb ff ff       	call   4f8e <bigfile>
+  subdir();
+    6451:	e8 f6 e2 ff ff       	call   474c <subdir>
+  linktest();
+    6456:	e8 a0 d7 ff ff       	call   3bfb <linktest>
+  unlinkread();
+    645b:	e8 d9 d5 ff ff       	call   3a39 <unlinkread>
+  dirfile();
+    6460:	e8 22 f0 ff ff       	call   5487 <dirfile>
+  iref();
+    6465:	e8 55 f2 ff ff       	call   56bf <iref>
+  forktest();
+    646a:	e8 8a f3 ff ff       	call   57f9 <forktest>
+  dxdottest();
+    646f:	e8 b4 de ff ff       	call   4328 <dxdottest>
+  bigdir(); // slow
+    6474:	e8 52 e1 ff ff       	call   45cb <bigdir>
+  tindirtest(); // slow
+    6479:	e8 55 a3 ff ff       	call   7d3 <tindirtest>
+  fragwritetest(); // slow
+    647e:	e8 f6 a5 ff ff       	call   a79 <fragwritetest>
+  exectest();
+    6483:	e8 c7 bd ff ff       	call   224f <exectest>
+
+  exit();
+    6488:	e8 57 02 00 00       	call   66e4 <exit>
+
+0000648d <stosb>:
+{
+    648d:	55                   	push   %ebp
+    648e:	89 e5                	mov    %esp,%ebp
+    6490:	57                   	push   %edi
+    6491:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    6492:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    6495:	8b 55 10             	mov    0x10(%ebp),%edx
+    6498:	8b 45 0c             	mov    0xc(%ebp),%eax
+    649b:	89 cb                	mov    %ecx,%ebx
+    649d:	89 df                	mov    %ebx,%edi
+    649f:	89 d1                	mov    %edx,%ecx
+    64a1:	fc                   	cld
+    64a2:	f3 aa                	rep stos %al,%es:(%edi)
+    64a4:	89 ca                	mov    %ecx,%edx
+    64a6:	89 fb                	mov    %edi,%ebx
+    64a8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    64ab:	89 55 10             	mov    %edx,0x10(%ebp)
+}
+    64ae:	90                   	nop
+    64af:	5b                   	pop    %ebx
+    64b0:	5f                   	pop    %edi
+    64b1:	5d                   	pop    %ebp
+    64b2:	c3                   	ret
+
+000064b3 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    64b3:	55                   	push   %ebp
+    64b4:	89 e5                	mov    %esp,%ebp
+    64b6:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    64b9:	8b 45 08             	mov    0x8(%ebp),%eax
+    64bc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    64bf:	90                   	nop
+    64c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    64c3:	8d 42 01             	lea    0x1(%edx),%eax
+    64c6:	89 45 0c             	mov    %eax,0xc(%ebp)
+    64c9:	8b 45 08             	mov    0x8(%ebp),%eax
+    64cc:	8d 48 01             	lea    0x1(%eax),%ecx
+    64cf:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    64d2:	0f b6 12             	movzbl (%edx),%edx
+    64d5:	88 10                	mov    %dl,(%eax)
+    64d7:	0f b6 00             	movzbl (%eax),%eax
+    64da:	84 c0                	test   %al,%al
+    64dc:	75 e2                	jne    64c0 <strcpy+0xd>
+    ;
+  return os;
+    64de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    64e1:	c9                   	leave
+    64e2:	c3                   	ret
+
+000064e3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    64e3:	55                   	push   %ebp
+    64e4:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    64e6:	eb 08                	jmp    64f0 <strcmp+0xd>
+    p++, q++;
+    64e8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    64ec:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    64f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    64f3:	0f b6 00             	movzbl (%eax),%eax
+    64f6:	84 c0                	test   %al,%al
+    64f8:	74 10                	je     650a <strcmp+0x27>
+    64fa:	8b 45 08             	mov    0x8(%ebp),%eax
+    64fd:	0f b6 10             	movzbl (%eax),%edx
+    6500:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6503:	0f b6 00             	movzbl (%eax),%eax
+    6506:	38 c2                	cmp    %al,%dl
+    6508:	74 de                	je     64e8 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    650a:	8b 45 08             	mov    0x8(%ebp),%eax
+    650d:	0f b6 00             	movzbl (%eax),%eax
+    6510:	0f b6 d0             	movzbl %al,%edx
+    6513:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6516:	0f b6 00             	movzbl (%eax),%eax
+    6519:	0f b6 c0             	movzbl %al,%eax
+    651c:	29 c2                	sub    %eax,%edx
+    651e:	89 d0                	mov    %edx,%eax
+}
+    6520:	5d                   	pop    %ebp
+    6521:	c3                   	ret
+
+00006522 <strlen>:
+
+uint
+strlen(char *s)
+{
+    6522:	55                   	push   %ebp
+    6523:	89 e5                	mov    %esp,%ebp
+    6525:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+    6528:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    652f:	eb 04                	jmp    6535 <strlen+0x13>
+    6531:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    6535:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    6538:	8b 45 08             	mov    0x8(%ebp),%eax
+    653b:	01 d0                	add    %edx,%eax
+    653d:	0f b6 00             	movzbl (%eax),%eax
+    6540:	84 c0                	test   %al,%al
+    6542:	75 ed                	jne    6531 <strlen+0xf>
+    ;
+  return n;
+    6544:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    6547:	c9                   	leave
+    6548:	c3                   	ret
+
+00006549 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    6549:	55                   	push   %ebp
+    654a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    654c:	8b 45 10             	mov    0x10(%ebp),%eax
+    654f:	50                   	push   %eax
+    6550:	ff 75 0c             	push   0xc(%ebp)
+    6553:	ff 75 08             	push   0x8(%ebp)
+    6556:	e8 32 ff ff ff       	call   648d <stosb>
+    655b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    655e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    6561:	c9                   	leave
+    6562:	c3                   	ret
+
+00006563 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    6563:	55                   	push   %ebp
+    6564:	89 e5                	mov    %esp,%ebp
+    6566:	83 ec 04             	sub    $0x4,%esp
+    6569:	8b 45 0c             	mov    0xc(%ebp),%eax
+    656c:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    656f:	eb 14                	jmp    6585 <strchr+0x22>
+    if(*s == c)
+    6571:	8b 45 08             	mov    0x8(%ebp),%eax
+    6574:	0f b6 00             	movzbl (%eax),%eax
+    6577:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    657a:	75 05                	jne    6581 <strchr+0x1e>
+      return (char*)s;
+    657c:	8b 45 08             	mov    0x8(%ebp),%eax
+    657f:	eb 13                	jmp    6594 <strchr+0x31>
+  for(; *s; s++)
+    6581:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    6585:	8b 45 08             	mov    0x8(%ebp),%eax
+    6588:	0f b6 00             	movzbl (%eax),%eax
+    658b:	84 c0                	test   %al,%al
+    658d:	75 e2                	jne    6571 <strchr+0xe>
+  return 0;
+    658f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    6594:	c9                   	leave
+    6595:	c3                   	ret
+
+00006596 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    6596:	55                   	push   %ebp
+    6597:	89 e5                	mov    %esp,%ebp
+    6599:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    659c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    65a3:	eb 42                	jmp    65e7 <gets+0x51>
+    cc = read(0, &c, 1);
+    65a5:	83 ec 04             	sub    $0x4,%esp
+    65a8:	6a 01                	push   $0x1
+    65aa:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    65ad:	50                   	push   %eax
+    65ae:	6a 00                	push   $0x0
+    65b0:	e8 47 01 00 00       	call   66fc <read>
+    65b5:	83 c4 10             	add    $0x10,%esp
+    65b8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    65bb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    65bf:	7e 33                	jle    65f4 <gets+0x5e>
+      break;
+    buf[i++] = c;
+    65c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    65c4:	8d 50 01             	lea    0x1(%eax),%edx
+    65c7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    65ca:	89 c2                	mov    %eax,%edx
+    65cc:	8b 45 08             	mov    0x8(%ebp),%eax
+    65cf:	01 c2                	add    %eax,%edx
+    65d1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    65d5:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    65d7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    65db:	3c 0a                	cmp    $0xa,%al
+    65dd:	74 16                	je     65f5 <gets+0x5f>
+    65df:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    65e3:	3c 0d                	cmp    $0xd,%al
+    65e5:	74 0e                	je     65f5 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    65e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    65ea:	83 c0 01             	add    $0x1,%eax
+    65ed:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    65f0:	7f b3                	jg     65a5 <gets+0xf>
+    65f2:	eb 01                	jmp    65f5 <gets+0x5f>
+      break;
+    65f4:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    65f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    65f8:	8b 45 08             	mov    0x8(%ebp),%eax
+    65fb:	01 d0                	add    %edx,%eax
+    65fd:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    6600:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    6603:	c9                   	leave
+    6604:	c3                   	ret
+
+00006605 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    6605:	55                   	push   %ebp
+    6606:	89 e5                	mov    %esp,%ebp
+    6608:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    660b:	83 ec 08             	sub    $0x8,%esp
+    660e:	6a 00                	push   $0x0
+    6610:	ff 75 08             	push   0x8(%ebp)
+    6613:	e8 0c 01 00 00       	call   6724 <open>
+    6618:	83 c4 10             	add    $0x10,%esp
+    661b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    661e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    6622:	79 07                	jns    662b <stat+0x26>
+    return -1;
+    6624:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6629:	eb 25                	jmp    6650 <stat+0x4b>
+  r = fstat(fd, st);
+    662b:	83 ec 08             	sub    $0x8,%esp
+    662e:	ff 75 0c             	push   0xc(%ebp)
+    6631:	ff 75 f4             	push   -0xc(%ebp)
+    6634:	e8 03 01 00 00       	call   673c <fstat>
+    6639:	83 c4 10             	add    $0x10,%esp
+    663c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    663f:	83 ec 0c             	sub    $0xc,%esp
+    6642:	ff 75 f4             	push   -0xc(%ebp)
+    6645:	e8 c2 00 00 00       	call   670c <close>
+    664a:	83 c4 10             	add    $0x10,%esp
+  return r;
+    664d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    6650:	c9                   	leave
+    6651:	c3                   	ret
+
+00006652 <atoi>:
+
+int
+atoi(const char *s)
+{
+    6652:	55                   	push   %ebp
+    6653:	89 e5                	mov    %esp,%ebp
+    6655:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    6658:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    665f:	eb 25                	jmp    6686 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    6661:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    6664:	89 d0                	mov    %edx,%eax
+    6666:	c1 e0 02             	shl    $0x2,%eax
+    6669:	01 d0                	add    %edx,%eax
+    666b:	01 c0                	add    %eax,%eax
+    666d:	89 c1                	mov    %eax,%ecx
+    666f:	8b 45 08             	mov    0x8(%ebp),%eax
+    6672:	8d 50 01             	lea    0x1(%eax),%edx
+    6675:	89 55 08             	mov    %edx,0x8(%ebp)
+    6678:	0f b6 00             	movzbl (%eax),%eax
+    667b:	0f be c0             	movsbl %al,%eax
+    667e:	01 c8                	add    %ecx,%eax
+    6680:	83 e8 30             	sub    $0x30,%eax
+    6683:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    6686:	8b 45 08             	mov    0x8(%ebp),%eax
+    6689:	0f b6 00             	movzbl (%eax),%eax
+    668c:	3c 2f                	cmp    $0x2f,%al
+    668e:	7e 0a                	jle    669a <atoi+0x48>
+    6690:	8b 45 08             	mov    0x8(%ebp),%eax
+    6693:	0f b6 00             	movzbl (%eax),%eax
+    6696:	3c 39                	cmp    $0x39,%al
+    6698:	7e c7                	jle    6661 <atoi+0xf>
+  return n;
+    669a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    669d:	c9                   	leave
+    669e:	c3                   	ret
+
+0000669f <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    669f:	55                   	push   %ebp
+    66a0:	89 e5                	mov    %esp,%ebp
+    66a2:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    66a5:	8b 45 08             	mov    0x8(%ebp),%eax
+    66a8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    66ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+    66ae:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    66b1:	eb 17                	jmp    66ca <memmove+0x2b>
+    *dst++ = *src++;
+    66b3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    66b6:	8d 42 01             	lea    0x1(%edx),%eax
+    66b9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    66bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    66bf:	8d 48 01             	lea    0x1(%eax),%ecx
+    66c2:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    66c5:	0f b6 12             	movzbl (%edx),%edx
+    66c8:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    66ca:	8b 45 10             	mov    0x10(%ebp),%eax
+    66cd:	8d 50 ff             	lea    -0x1(%eax),%edx
+    66d0:	89 55 10             	mov    %edx,0x10(%ebp)
+    66d3:	85 c0                	test   %eax,%eax
+    66d5:	7f dc                	jg     66b3 <memmove+0x14>
+  return vdst;
+    66d7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    66da:	c9                   	leave
+    66db:	c3                   	ret
+
+000066dc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    66dc:	b8 01 00 00 00       	mov    $0x1,%eax
+    66e1:	cd 40                	int    $0x40
+    66e3:	c3                   	ret
+
+000066e4 <exit>:
+SYSCALL(exit)
+    66e4:	b8 02 00 00 00       	mov    $0x2,%eax
+    66e9:	cd 40                	int    $0x40
+    66eb:	c3                   	ret
+
+000066ec <wait>:
+SYSCALL(wait)
+    66ec:	b8 03 00 00 00       	mov    $0x3,%eax
+    66f1:	cd 40                	int    $0x40
+    66f3:	c3                   	ret
+
+000066f4 <pipe>:
+SYSCALL(pipe)
+    66f4:	b8 04 00 00 00       	mov    $0x4,%eax
+    66f9:	cd 40                	int    $0x40
+    66fb:	c3                   	ret
+
+000066fc <read>:
+SYSCALL(read)
+    66fc:	b8 05 00 00 00       	mov    $0x5,%eax
+    6701:	cd 40                	int    $0x40
+    6703:	c3                   	ret
+
+00006704 <write>:
+SYSCALL(write)
+    6704:	b8 10 00 00 00       	mov    $0x10,%eax
+    6709:	cd 40                	int    $0x40
+    670b:	c3                   	ret
+
+0000670c <close>:
+SYSCALL(close)
+    670c:	b8 15 00 00 00       	mov    $0x15,%eax
+    6711:	cd 40                	int    $0x40
+    6713:	c3                   	ret
+
+00006714 <kill>:
+SYSCALL(kill)
+    6714:	b8 06 00 00 00       	mov    $0x6,%eax
+    6719:	cd 40                	int    $0x40
+    671b:	c3                   	ret
+
+0000671c <exec>:
+SYSCALL(exec)
+    671c:	b8 07 00 00 00       	mov    $0x7,%eax
+    6721:	cd 40                	int    $0x40
+    6723:	c3                   	ret
+
+00006724 <open>:
+SYSCALL(open)
+    6724:	b8 0f 00 00 00       	mov    $0xf,%eax
+    6729:	cd 40                	int    $0x40
+    672b:	c3                   	ret
+
+0000672c <mknod>:
+SYSCALL(mknod)
+    672c:	b8 11 00 00 00       	mov    $0x11,%eax
+    6731:	cd 40                	int    $0x40
+    6733:	c3                   	ret
+
+00006734 <unlink>:
+SYSCALL(unlink)
+    6734:	b8 12 00 00 00       	mov    $0x12,%eax
+    6739:	cd 40                	int    $0x40
+    673b:	c3                   	ret
+
+0000673c <fstat>:
+SYSCALL(fstat)
+    673c:	b8 08 00 00 00       	mov    $0x8,%eax
+    6741:	cd 40                	int    $0x40
+    6743:	c3                   	ret
+
+00006744 <link>:
+SYSCALL(link)
+    6744:	b8 13 00 00 00       	mov    $0x13,%eax
+    6749:	cd 40                	int    $0x40
+    674b:	c3                   	ret
+
+0000674c <mkdir>:
+SYSCALL(mkdir)
+    674c:	b8 14 00 00 00       	mov    $0x14,%eax
+    6751:	cd 40                	int    $0x40
+    6753:	c3                   	ret
+
+00006754 <chdir>:
+SYSCALL(chdir)
+    6754:	b8 09 00 00 00       	mov    $0x9,%eax
+    6759:	cd 40                	int    $0x40
+    675b:	c3                   	ret
+
+0000675c <dup>:
+SYSCALL(dup)
+    675c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    6761:	cd 40                	int    $0x40
+    6763:	c3                   	ret
+
+00006764 <getpid>:
+SYSCALL(getpid)
+    6764:	b8 0b 00 00 00       	mov    $0xb,%eax
+    6769:	cd 40                	int    $0x40
+    676b:	c3                   	ret
+
+0000676c <sbrk>:
+SYSCALL(sbrk)
+    676c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    6771:	cd 40                	int    $0x40
+    6773:	c3                   	ret
+
+00006774 <sleep>:
+SYSCALL(sleep)
+    6774:	b8 0d 00 00 00       	mov    $0xd,%eax
+    6779:	cd 40                	int    $0x40
+    677b:	c3                   	ret
+
+0000677c <uptime>:
+SYSCALL(uptime)
+    677c:	b8 0e 00 00 00       	mov    $0xe,%eax
+    6781:	cd 40                	int    $0x40
+    6783:	c3                   	ret
+
+00006784 <clone>:
+SYSCALL(clone)
+    6784:	b8 16 00 00 00       	mov    $0x16,%eax
+    6789:	cd 40                	int    $0x40
+    678b:	c3                   	ret
+
+0000678c <join>:
+SYSCALL(join)
+    678c:	b8 17 00 00 00       	mov    $0x17,%eax
+    6791:	cd 40                	int    $0x40
+    6793:	c3                   	ret
+
+00006794 <futex_wait>:
+SYSCALL(futex_wait)
+    6794:	b8 18 00 00 00       	mov    $0x18,%eax
+    6799:	cd 40                	int    $0x40
+    679b:	c3                   	ret
+
+0000679c <futex_wake>:
+SYSCALL(futex_wake)
+    679c:	b8 19 00 00 00       	mov    $0x19,%eax
+    67a1:	cd 40                	int    $0x40
+    67a3:	c3                   	ret
+
+000067a4 <setaffinity>:
+SYSCALL(setaffinity)
+    67a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    67a9:	cd 40                	int    $0x40
+    67ab:	c3                   	ret
+
+000067ac <getaffinity>:
+SYSCALL(getaffinity)
+    67ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    67b1:	cd 40                	int    $0x40
+    67b3:	c3                   	ret
+
+000067b4 <getrusage>:
+SYSCALL(getrusage)
+    67b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    67b9:	cd 40                	int    $0x40
+    67bb:	c3                   	ret
+
+000067bc <lockstat>:
+SYSCALL(lockstat)
+    67bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    67c1:	cd 40                	int    $0x40
+    67c3:	c3                   	ret
+
+000067c4 <statfs>:
+SYSCALL(statfs)
+    67c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    67c9:	cd 40                	int    $0x40
+    67cb:	c3                   	ret
+
+000067cc <bcachesize>:
+SYSCALL(bcachesize)
+    67cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    67d1:	cd 40                	int    $0x40
+    67d3:	c3                   	ret
+
+000067d4 <bcstat>:
+SYSCALL(bcstat)
+    67d4:	b8 20 00 00 00       	mov    $0x20,%eax
+    67d9:	cd 40                	int    $0x40
+    67db:	c3                   	ret
+
+000067dc <sync>:
+SYSCALL(sync)
+    67dc:	b8 21 00 00 00       	mov    $0x21,%eax
+    67e1:	cd 40                	int    $0x40
+    67e3:	c3                   	ret
+
+000067e4 <fsync>:
+SYSCALL(fsync)
+    67e4:	b8 22 00 00 00       	mov    $0x22,%eax
+    67e9:	cd 40                	int    $0x40
+    67eb:	c3                   	ret
+
+000067ec <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    67ec:	55                   	push   %ebp
+    67ed:	89 e5                	mov    %esp,%ebp
+    67ef:	83 ec 18             	sub    $0x18,%esp
+    67f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    67f5:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    67f8:	83 ec 04             	sub    $0x4,%esp
+    67fb:	6a 01                	push   $0x1
+    67fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    6800:	50                   	push   %eax
+    6801:	ff 75 08             	push   0x8(%ebp)
+    6804:	e8 fb fe ff ff       	call   6704 <write>
+    6809:	83 c4 10             	add    $0x10,%esp
+}
+    680c:	90                   	nop
+    680d:	c9                   	leave
+    680e:	c3                   	ret
+
+0000680f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    680f:	55                   	push   %ebp
+    6810:	89 e5                	mov    %esp,%ebp
+    6812:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    6815:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    681c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    6820:	74 17                	je     6839 <printint+0x2a>
+    6822:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    6826:	79 11                	jns    6839 <printint+0x2a>
+    neg = 1;
+    6828:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    682f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6832:	f7 d8                	neg    %eax
+    6834:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    6837:	eb 06                	jmp    683f <printint+0x30>
+  } else {
+    x = xx;
+    6839:	8b 45 0c             	mov    0xc(%ebp),%eax
+    683c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    683f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    6846:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    6849:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    684c:	ba 00 00 00 00       	mov    $0x0,%edx
+    6851:	f7 f1                	div    %ecx
+    6853:	89 d1                	mov    %edx,%ecx
+    6855:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6858:	8d 50 01             	lea    0x1(%eax),%edx
+    685b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    685e:	0f b6 91 0c 9a 00 00 	movzbl 0x9a0c(%ecx),%edx
+    6865:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    6869:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    686c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    686f:	ba 00 00 00 00       	mov    $0x0,%edx
+    6874:	f7 f1                	div    %ecx
+    6876:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    6879:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    687d:	75 c7                	jne    6846 <printint+0x37>
+  if(neg)
+    687f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    6883:	74 2d                	je     68b2 <printint+0xa3>
+    buf[i++] = '-';
+    6885:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6888:	8d 50 01             	lea    0x1(%eax),%edx
+    688b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    688e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    6893:	eb 1d                	jmp    68b2 <printint+0xa3>
+    putc(fd, buf[i]);
+    6895:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    6898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    689b:	01 d0                	add    %edx,%eax
+    689d:	0f b6 00             	movzbl (%eax),%eax
+    68a0:	0f be c0             	movsbl %al,%eax
+    68a3:	83 ec 08             	sub    $0x8,%esp
+    68a6:	50                   	push   %eax
+    68a7:	ff 75 08             	push   0x8(%ebp)
+    68aa:	e8 3d ff ff ff       	call   67ec <putc>
+    68af:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    68b2:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    68b6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    68ba:	79 d9                	jns    6895 <printint+0x86>
+}
+    68bc:	90                   	nop
+    68bd:	90                   	nop
+    68be:	c9                   	leave
+    68bf:	c3                   	ret
+
+000068c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    68c0:	55                   	push   %ebp
+    68c1:	89 e5                	mov    %esp,%ebp
+    68c3:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    68c6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    68cd:	8d 45 0c             	lea    0xc(%ebp),%eax
+    68d0:	83 c0 04             	add    $0x4,%eax
+    68d3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    68d6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    68dd:	e9 59 01 00 00       	jmp    6a3b <printf+0x17b>
+    c = fmt[i] & 0xff;
+    68e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    68e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    68e8:	01 d0                	add    %edx,%eax
+    68ea:	0f b6 00             	movzbl (%eax),%eax
+    68ed:	0f be c0             	movsbl %al,%eax
+    68f0:	25 ff 00 00 00       	and    $0xff,%eax
+    68f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    68f8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    68fc:	75 2c                	jne    692a <printf+0x6a>
+      if(c == '%'){
+    68fe:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    6902:	75 0c                	jne    6910 <printf+0x50>
+        state = '%';
+    6904:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    690b:	e9 27 01 00 00       	jmp    6a37 <printf+0x177>
+      } else {
+        putc(fd, c);
+    6910:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    6913:	0f be c0             	movsbl %al,%eax
+    6916:	83 ec 08             	sub    $0x8,%esp
+    6919:	50                   	push   %eax
+    691a:	ff 75 08             	push   0x8(%ebp)
+    691d:	e8 ca fe ff ff       	call   67ec <putc>
+    6922:	83 c4 10             	add    $0x10,%esp
+    6925:	e9 0d 01 00 00       	jmp    6a37 <printf+0x177>
+      }
+    } else if(state == '%'){
+    692a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    692e:	0f 85 03 01 00 00    	jne    6a37 <printf+0x177>
+      if(c == 'd'){
+    6934:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    6938:	75 1e                	jne    6958 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    693a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    693d:	8b 00                	mov    (%eax),%eax
+    693f:	6a 01                	push   $0x1
+    6941:	6a 0a                	push   $0xa
+    6943:	50                   	push   %eax
+    6944:	ff 75 08             	push   0x8(%ebp)
+    6947:	e8 c3 fe ff ff       	call   680f <printint>
+    694c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    694f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    6953:	e9 d8 00 00 00       	jmp    6a30 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    6958:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    695c:	74 06                	je     6964 <printf+0xa4>
+    695e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    6962:	75 1e                	jne    6982 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    6964:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6967:	8b 00                	mov    (%eax),%eax
+    6969:	6a 00                	push   $0x0
+    696b:	6a 10                	push   $0x10
+    696d:	50                   	push   %eax
+    696e:	ff 75 08             	push   0x8(%ebp)
+    6971:	e8 99 fe ff ff       	call   680f <printint>
+    6976:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    6979:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    697d:	e9 ae 00 00 00       	jmp    6a30 <printf+0x170>
+      } else if(c == 's'){
+    6982:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    6986:	75 43                	jne    69cb <printf+0x10b>
+        s = (char*)*ap;
+    6988:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    698b:	8b 00                	mov    (%eax),%eax
+    698d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    6990:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    6994:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    6998:	75 25                	jne    69bf <printf+0xff>
+          s = "(null)";
+    699a:	c7 45 f4 22 90 00 00 	movl   $0x9022,-0xc(%ebp)
+        while(*s != 0){
+    69a1:	eb 1c                	jmp    69bf <printf+0xff>
+          putc(fd, *s);
+    69a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    69a6:	0f b6 00             	movzbl (%eax),%eax
+    69a9:	0f be c0             	movsbl %al,%eax
+    69ac:	83 ec 08             	sub    $0x8,%esp
+    69af:	50                   	push   %eax
+    69b0:	ff 75 08             	push   0x8(%ebp)
+    69b3:	e8 34 fe ff ff       	call   67ec <putc>
+    69b8:	83 c4 10             	add    $0x10,%esp
+          s++;
+    69bb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    69bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    69c2:	0f b6 00             	movzbl (%eax),%eax
+    69c5:	84 c0                	test   %al,%al
+    69c7:	75 da                	jne    69a3 <printf+0xe3>
+    69c9:	eb 65                	jmp    6a30 <printf+0x170>
+        }
+      } else if(c == 'c'){
+    69cb:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    69cf:	75 1d                	jne    69ee <printf+0x12e>
+        putc(fd, *ap);
+    69d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    69d4:	8b 00                	mov    (%eax),%eax
+    69d6:	0f be c0             	movsbl %al,%eax
+    69d9:	83 ec 08             	sub    $0x8,%esp
+    69dc:	50                   	push   %eax
+    69dd:	ff 75 08             	push   0x8(%ebp)
+    69e0:	e8 07 fe ff ff       	call   67ec <putc>
+    69e5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    69e8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    69ec:	eb 42                	jmp    6a30 <printf+0x170>
+      } else if(c == '%'){
+    69ee:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    69f2:	75 17                	jne    6a0b <printf+0x14b>
+        putc(fd, c);
+    69f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    69f7:	0f be c0             	movsbl %al,%eax
+    69fa:	83 ec 08             	sub    $0x8,%esp
+    69fd:	50                   	push   %eax
+    69fe:	ff 75 08             	push   0x8(%ebp)
+    6a01:	e8 e6 fd ff ff       	call   67ec <putc>
+    6a06:	83 c4 10             	add    $0x10,%esp
+    6a09:	eb 25                	jmp    6a30 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    6a0b:	83 ec 08             	sub    $0x8,%esp
+    6a0e:	6a 25                	push   $0x25
+    6a10:	ff 75 08             	push   0x8(%ebp)
+    6a13:	e8 d4 fd ff ff       	call   67ec <putc>
+    6a18:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    6a1b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    6a1e:	0f be c0             	movsbl %al,%eax
+    6a21:	83 ec 08             	sub    $0x8,%esp
+    6a24:	50                   	push   %eax
+    6a25:	ff 75 08             	push   0x8(%ebp)
+    6a28:	e8 bf fd ff ff       	call   67ec <putc>
+    6a2d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    6a30:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    6a37:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    6a3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+    6a3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6a41:	01 d0                	add    %edx,%eax
+    6a43:	0f b6 00             	movzbl (%eax),%eax
+    6a46:	84 c0                	test   %al,%al
+    6a48:	0f 85 94 fe ff ff    	jne    68e2 <printf+0x22>
+    }
+  }
+}
+    6a4e:	90                   	nop
+    6a4f:	90                   	nop
+    6a50:	c9                   	leave
+    6a51:	c3                   	ret
+
+00006a52 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    6a52:	55                   	push   %ebp
+    6a53:	89 e5                	mov    %esp,%ebp
+    6a55:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    6a58:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a5b:	83 e8 08             	sub    $0x8,%eax
+    6a5e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6a61:	a1 68 ec 00 00       	mov    0xec68,%eax
+    6a66:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    6a69:	eb 24                	jmp    6a8f <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    6a6b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6a6e:	8b 00                	mov    (%eax),%eax
+    6a70:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    6a73:	72 12                	jb     6a87 <free+0x35>
+    6a75:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6a78:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    6a7b:	72 24                	jb     6aa1 <free+0x4f>
+    6a7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6a80:	8b 00                	mov    (%eax),%eax
+    6a82:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    6a85:	72 1a                	jb     6aa1 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6a87:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6a8a:	8b 00                	mov    (%eax),%eax
+    6a8c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    6a8f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6a92:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    6a95:	73 d4                	jae    6a6b <free+0x19>
+    6a97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6a9a:	8b 00                	mov    (%eax),%eax
+    6a9c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    6a9f:	73 ca                	jae    6a6b <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    6aa1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6aa4:	8b 40 04             	mov    0x4(%eax),%eax
+    6aa7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    6aae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6ab1:	01 c2                	add    %eax,%edx
+    6ab3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6ab6:	8b 00                	mov    (%eax),%eax
+    6ab8:	39 c2                	cmp    %eax,%edx
+    6aba:	75 24                	jne    6ae0 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    6abc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6abf:	8b 50 04             	mov    0x4(%eax),%edx
+    6ac2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6ac5:	8b 00                	mov    (%eax),%eax
+    6ac7:	8b 40 04             	mov    0x4(%eax),%eax
+    6aca:	01 c2                	add    %eax,%edx
+    6acc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6acf:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    6ad2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6ad5:	8b 00                	mov    (%eax),%eax
+    6ad7:	8b 10                	mov    (%eax),%edx
+    6ad9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6adc:	89 10                	mov    %edx,(%eax)
+    6ade:	eb 0a                	jmp    6aea <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    6ae0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6ae3:	8b 10                	mov    (%eax),%edx
+    6ae5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6ae8:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    6aea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6aed:	8b 40 04             	mov    0x4(%eax),%eax
+    6af0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    6af7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6afa:	01 d0                	add    %edx,%eax
+    6afc:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    6aff:	75 20                	jne    6b21 <free+0xcf>
+    p->s.size += bp->s.size;
+    6b01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6b04:	8b 50 04             	mov    0x4(%eax),%edx
+    6b07:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6b0a:	8b 40 04             	mov    0x4(%eax),%eax
+    6b0d:	01 c2                	add    %eax,%edx
+    6b0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6b12:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    6b15:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6b18:	8b 10                	mov    (%eax),%edx
+    6b1a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6b1d:	89 10                	mov    %edx,(%eax)
+    6b1f:	eb 08                	jmp    6b29 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    6b21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6b24:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    6b27:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    6b29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6b2c:	a3 68 ec 00 00       	mov    %eax,0xec68
+}
+    6b31:	90                   	nop
+    6b32:	c9                   	leave
+    6b33:	c3                   	ret
+
+00006b34 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    6b34:	55                   	push   %ebp
+    6b35:	89 e5                	mov    %esp,%ebp
+    6b37:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    6b3a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    6b41:	77 07                	ja     6b4a <morecore+0x16>
+    nu = 4096;
+    6b43:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    6b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+    6b4d:	c1 e0 03             	shl    $0x3,%eax
+    6b50:	83 ec 0c             	sub    $0xc,%esp
+    6b53:	50                   	push   %eax
+    6b54:	e8 13 fc ff ff       	call   676c <sbrk>
+    6b59:	83 c4 10             	add    $0x10,%esp
+    6b5c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    6b5f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    6b63:	75 07                	jne    6b6c <morecore+0x38>
+    return 0;
+    6b65:	b8 00 00 00 00       	mov    $0x0,%eax
+    6b6a:	eb 26                	jmp    6b92 <morecore+0x5e>
+  hp = (Header*)p;
+    6b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6b6f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    6b72:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6b75:	8b 55 08             	mov    0x8(%ebp),%edx
+    6b78:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    6b7b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6b7e:	83 c0 08             	add    $0x8,%eax
+    6b81:	83 ec 0c             	sub    $0xc,%esp
+    6b84:	50                   	push   %eax
+    6b85:	e8 c8 fe ff ff       	call   6a52 <free>
+    6b8a:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    6b8d:	a1 68 ec 00 00       	mov    0xec68,%eax
+}
+    6b92:	c9                   	leave
+    6b93:	c3                   	ret
+
+00006b94 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    6b94:	55                   	push   %ebp
+    6b95:	89 e5                	mov    %esp,%ebp
+    6b97:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    6b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+    6b9d:	83 c0 07             	add    $0x7,%eax
+    6ba0:	c1 e8 03             	shr    $0x3,%eax
+    6ba3:	83 c0 01             	add    $0x1,%eax
+    6ba6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    6ba9:	a1 68 ec 00 00       	mov    0xec68,%eax
+    6bae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    6bb1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    6bb5:	75 23                	jne    6bda <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    6bb7:	c7 45 f0 60 ec 00 00 	movl   $0xec60,-0x10(%ebp)
+    6bbe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6bc1:	a3 68 ec 00 00       	mov    %eax,0xec68
+    6bc6:	a1 68 ec 00 00       	mov    0xec68,%eax
+    6bcb:	a3 60 ec 00 00       	mov    %eax,0xec60
+    base.s.size = 0;
+    6bd0:	c7 05 64 ec 00 00 00 	movl   $0x0,0xec64
+    6bd7:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6bda:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6bdd:	8b 00                	mov    (%eax),%eax
+    6bdf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    6be2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6be5:	8b 40 04             	mov    0x4(%eax),%eax
+    6be8:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    6beb:	72 4d                	jb     6c3a <malloc+0xa6>
+      if(p->s.size == nunits)
+    6bed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6bf0:	8b 40 04             	mov    0x4(%eax),%eax
+    6bf3:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    6bf6:	75 0c                	jne    6c04 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    6bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6bfb:	8b 10                	mov    (%eax),%edx
+    6bfd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6c00:	89 10                	mov    %edx,(%eax)
+    6c02:	eb 26                	jmp    6c2a <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    6c04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c07:	8b 40 04             	mov    0x4(%eax),%eax
+    6c0a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    6c0d:	89 c2                	mov    %eax,%edx
+    6c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c12:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    6c15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c18:	8b 40 04             	mov    0x4(%eax),%eax
+    6c1b:	c1 e0 03             	shl    $0x3,%eax
+    6c1e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    6c21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c24:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    6c27:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    6c2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6c2d:	a3 68 ec 00 00       	mov    %eax,0xec68
+      return (void*)(p + 1);
+    6c32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c35:	83 c0 08             	add    $0x8,%eax
+    6c38:	eb 3b                	jmp    6c75 <malloc+0xe1>
+    }
+    if(p == freep)
+    6c3a:	a1 68 ec 00 00       	mov    0xec68,%eax
+    6c3f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    6c42:	75 1e                	jne    6c62 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    6c44:	83 ec 0c             	sub    $0xc,%esp
+    6c47:	ff 75 ec             	push   -0x14(%ebp)
+    6c4a:	e8 e5 fe ff ff       	call   6b34 <morecore>
+    6c4f:	83 c4 10             	add    $0x10,%esp
+    6c52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    6c55:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    6c59:	75 07                	jne    6c62 <malloc+0xce>
+        return 0;
+    6c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+    6c60:	eb 13                	jmp    6c75 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6c62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c65:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    6c68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c6b:	8b 00                	mov    (%eax),%eax
+    6c6d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    6c70:	e9 6d ff ff ff       	jmp    6be2 <malloc+0x4e>
+  }
+}
+    6c75:	c9                   	leave
+    6c76:	c3                   	ret
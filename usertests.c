@@ -1,12 +1,16 @@
 #include "param.h"
 #include "types.h"
 #include "stat.h"
+#include "rusage.h"
+#include "bcstat.h"
+#include "lockstat.h"
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "x86.h"
 
 char buf[8192];
 char name[3];
@@ -184,6 +188,8 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+#define NBIGBLOCKS 170  // needs a double-indirect block with 512-byte blocks
+
 void
 writetest1(void)
 {
@@ -197,7 +203,8 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  // Enough blocks to need a double-indirect block.
+  for(i = 0; i < NBIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +224,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != NBIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -241,6 +248,507 @@ writetest1(void)
   printf(stdout, "big files ok\n");
 }
 
+// A file big enough to need its triple-indirect block should
+// read back, and give all its blocks back when removed.
+void
+tindirtest(void)
+{
+  struct statfs st0, st1;
+  int i, fd, n, nind, nblocks;
+
+  printf(stdout, "triple-indirect test\n");
+  fd = open("tindir", O_CREATE|O_RDWR);
+  sync();
+  if(fd < 0 || statfs("/", &st0) < 0){
+    printf(stdout, "error: creat tindir failed!\n");
+    exit();
+  }
+  // Fill the direct, indirect and double-indirect blocks and
+  // two indirect blocks under the triple-indirect one.
+  nind = st0.bsize / sizeof(uint);
+  nblocks = NDIRECT + nind + nind*nind + nind + 1;
+  if(nblocks + nind + 6 > st0.bfree){
+    printf(stdout, "triple-indirect test skipped: file system too small\n");
+    close(fd);
+    unlink("tindir");
+    return;
+  }
+
+  for(i = 0; i < nblocks; i++){
+    ((int*)buf)[0] = i;
+    if(write(fd, buf, st0.bsize) != st0.bsize){
+      printf(stdout, "error: write tindir block %d failed\n", i);
+      exit();
+    }
+  }
+  close(fd);
+
+  fd = open("tindir", O_RDONLY);
+  if(fd < 0){
+    printf(stdout, "error: open tindir failed!\n");
+    exit();
+  }
+  for(i = 0; (n = read(fd, buf, st0.bsize)) == st0.bsize; i++){
+    if(((int*)buf)[0] != i){
+      printf(stdout, "read content of block %d is %d\n", i, ((int*)buf)[0]);
+      exit();
+    }
+  }
+  close(fd);
+  if(n != 0 || i != nblocks){
+    printf(stdout, "read only %d blocks from tindir\n", i);
+    exit();
+  }
+
+  if(unlink("tindir") < 0){
+    printf(stdout, "unlink tindir failed\n");
+    exit();
+  }
+  sync();
+  statfs("/", &st1);
+  if(st1.bfree < st0.bfree){
+    printf(stdout, "tindir blocks not all freed: %d of %d\n",
+           st1.bfree, st0.bfree);
+    exit();
+  }
+  printf(stdout, "triple-indirect ok\n");
+}
+
+// With 512-byte blocks, one bitmap block covers 4096 blocks.
+// Leave free blocks every so often all over the disk, so that
+// one large write() allocates under several bitmap blocks:
+// more than one transaction may log, so filewrite() must
+// split it up.
+#define FRAGRUN 40  // blocks between the free ones
+#define FRAGBIG (128*1024)
+
+void
+fragwritetest(void)
+{
+  struct statfs st;
+  char *p;
+  int i, fda, fdb, fd, nbmap;
+
+  printf(stdout, "fragmented write test\n");
+  if(statfs("/", &st) < 0){
+    printf(stdout, "statfs failed\n");
+    exit();
+  }
+  nbmap = st.blocks / (st.bsize*8);
+  if(st.bsize != 512 || nbmap < 3 || st.bfree < nbmap*st.bsize*8/2){
+    printf(stdout, "fragmented write test skipped: needs a large 512-byte-block file system\n");
+    return;
+  }
+  p = malloc(FRAGBIG);
+  fda = open("fraga", O_CREATE|O_RDWR);
+  fdb = open("fragb", O_CREATE|O_RDWR);
+  if(p == 0 || fda < 0 || fdb < 0){
+    printf(stdout, "fragwrite: setup failed\n");
+    exit();
+  }
+  memset(p, 'f', FRAGBIG);
+  // fraga and fragb allocate after their last blocks, so they
+  // take turns: one block of fraga, then FRAGRUN of fragb.
+  while(statfs("/", &st) == 0 && st.bfree > 4*FRAGRUN){
+    if(write(fda, p, 512) != 512 ||
+       write(fdb, p, FRAGRUN*512) != FRAGRUN*512){
+      printf(stdout, "fragwrite: fill failed\n");
+      exit();
+    }
+  }
+  close(fda);
+  close(fdb);
+  unlink("fraga");
+  sync();
+  statfs("/", &st);
+  if(st.bfree < FRAGBIG/512 + 4*FRAGRUN){
+    printf(stdout, "fragwrite: only %d blocks free\n", st.bfree);
+    exit();
+  }
+
+  fd = open("fragc", O_CREATE|O_RDWR);
+  for(i = 0; i < FRAGBIG; i++)
+    p[i] = i % 251;
+  if(fd < 0 || write(fd, p, FRAGBIG) != FRAGBIG){
+    printf(stdout, "fragwrite: large write failed\n");
+    exit();
+  }
+  close(fd);
+  memset(p, 0, FRAGBIG);
+  fd = open("fragc", O_RDONLY);
+  if(fd < 0 || read(fd, p, FRAGBIG) != FRAGBIG){
+    printf(stdout, "fragwrite: read failed\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < FRAGBIG; i++){
+    if(p[i] != (char)(i % 251)){
+      printf(stdout, "fragwrite: wrong data at %d\n", i);
+      exit();
+    }
+  }
+  free(p);
+  unlink("fragb");
+  unlink("fragc");
+  printf(stdout, "fragmented write ok\n");
+}
+
+// statfs() should see blocks and an inode go and come back.
+void
+statfstest(void)
+{
+  struct statfs st0, st1, st2;
+  int fd, i;
+
+  printf(stdout, "statfs test\n");
+  if(statfs("/", &st0) < 0 || st0.bsize < 512 || st0.bfree > st0.blocks){
+    printf(stdout, "statfs failed\n");
+    exit();
+  }
+  fd = open("statfs", O_CREATE|O_RDWR);
+  for(i = 0; i < 10; i++)
+    write(fd, buf, st0.bsize);
+  close(fd);
+  statfs("/", &st1);
+  unlink("statfs");
+  sync();  // freed blocks are only free once the unlink commits
+  statfs("/", &st2);
+  if(st1.bfree > st0.bfree - 10 || st1.ffree != st0.ffree - 1 ||
+     st2.bfree < st1.bfree + 10 || st2.ffree != st0.ffree){
+    printf(stdout, "statfs counts wrong\n");
+    exit();
+  }
+  printf(stdout, "statfs ok\n");
+}
+
+// Files should read back the same through a buffer cache
+// shrunk as far as it goes, and the cache should grow back.
+void
+bcachetest(void)
+{
+  int n0, n1, fd, i, j;
+
+  printf(stdout, "bcache test\n");
+  n0 = bcachesize(0);
+  n1 = bcachesize(1);
+  if(n0 <= 0 || n1 <= 0 || n1 > n0){
+    printf(stdout, "bcachesize failed %d %d\n", n0, n1);
+    exit();
+  }
+  fd = open("bcache", O_CREATE|O_RDWR);
+  for(i = 0; i < 2*n1; i++){
+    memset(buf, i, 512);
+    if(write(fd, buf, 512) != 512){
+      printf(stdout, "bcache write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  fd = open("bcache", O_RDONLY);
+  for(i = 0; i < 2*n1; i++){
+    if(read(fd, buf, 512) != 512){
+      printf(stdout, "bcache read failed\n");
+      exit();
+    }
+    for(j = 0; j < 512; j++)
+      if(buf[j] != (char)i){
+        printf(stdout, "bcache wrong data\n");
+        exit();
+      }
+  }
+  close(fd);
+  unlink("bcache");
+  if(bcachesize(n0) < n0){
+    printf(stdout, "bcache did not grow back\n");
+    exit();
+  }
+  printf(stdout, "bcache ok\n");
+}
+
+// bcstat() should see 2Q at work in a small cache: a scan
+// of a file larger than the cache evicts from in; a block
+// read again after that goes on am, and later reads of it
+// hit there; and a reset clears the counters.
+void
+bcstattest(void)
+{
+  struct bcstat st0, st1;
+  int n0, n1, fd, i;
+
+  printf(stdout, "bcstat test\n");
+  n0 = bcachesize(0);
+  n1 = bcachesize(1);
+  fd = open("bcstat", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "create bcstat failed\n");
+    exit();
+  }
+  for(i = 0; i < 2*n1; i++){
+    if(write(fd, buf, 512) != 512){
+      printf(stdout, "bcstat write failed\n");
+      exit();
+    }
+  }
+  fsync(fd);
+  close(fd);
+
+  bcstat(&st0, 1);
+  fd = open("bcstat", O_RDONLY);
+  for(i = 0; i < 2*n1; i++)
+    read(fd, buf, 512);
+  close(fd);
+  bcstat(&st0, 0);
+  if(st0.evicts[BQ_IN] == 0){
+    printf(stdout, "bcstat: scan evicted nothing from in\n");
+    exit();
+  }
+  for(i = 0; i < 2; i++){
+    fd = open("bcstat", O_RDONLY);
+    read(fd, buf, 512);
+    close(fd);
+    if(i == 0)
+      bcstat(&st0, 0);
+  }
+  bcstat(&st1, 0);
+  if(st0.ghosthits == 0 || st0.misses[BQ_AM] == 0 ||
+     st1.hits[BQ_AM] <= st0.hits[BQ_AM]){
+    printf(stdout, "bcstat: re-read did not go through am\n");
+    exit();
+  }
+
+  bcstat(&st0, 1);
+  bcstat(&st0, 0);
+  if(st0.evicts[BQ_IN] != 0 || st0.ghosthits != 0 ||
+     st0.misses[BQ_AM] != 0){
+    printf(stdout, "bcstat: reset did not clear counters\n");
+    exit();
+  }
+  unlink("bcstat");
+  bcachesize(n0);
+  printf(stdout, "bcstat ok\n");
+}
+
+// the log should let more than two file system calls into a
+// transaction at once: writers of one file wait for its lock
+// inside their operations.
+void
+logopstest(void)
+{
+  struct bcstat st;
+  int fd, i, k, pid;
+
+  printf(stdout, "log ops test\n");
+  if(bcstat(&st, 1) < 0 || st.logsize < 3*MAXOPBLOCKS){
+    printf(stdout, "log too small for 3 ops: %d\n", st.logsize);
+    exit();
+  }
+  close(open("logops", O_CREATE|O_RDWR));
+  for(k = 0; k < 6; k++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+    fd = open("logops", O_RDWR);
+    for(i = 0; i < 20; i++){
+      if(write(fd, buf, 4096) != 4096){
+        printf(stdout, "logops write failed\n");
+        exit();
+      }
+    }
+    close(fd);
+    exit();
+  }
+  for(k = 0; k < 6; k++)
+    wait();
+  unlink("logops");
+  bcstat(&st, 0);
+  if(st.maxops <= 2){
+    printf(stdout, "only %d ops in a transaction at once\n", st.maxops);
+    exit();
+  }
+  printf(stdout, "log ops ok\n");
+}
+
+// three processes read the same file sequentially at once
+// through a small cache, so that their read-ahead races with
+// each other's reads; a buffer left locked would hang them.
+void
+readaheadtest(void)
+{
+  int n0, n1, fd, i, j, k, pid;
+
+  printf(stdout, "readahead test\n");
+  n0 = bcachesize(0);
+  n1 = bcachesize(1);
+  fd = open("readahead", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "create readahead failed\n");
+    exit();
+  }
+  for(i = 0; i < 4*n1; i++){
+    memset(buf, i, 512);
+    if(write(fd, buf, 512) != 512){
+      printf(stdout, "readahead write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  for(k = 0; k < 3; k++){
+    pid = k < 2 ? fork() : 0;
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+    fd = open("readahead", O_RDONLY);
+    for(i = 0; i < 4*n1; i++){
+      if(read(fd, buf, 512) != 512){
+        printf(stdout, "readahead read failed\n");
+        exit();
+      }
+      for(j = 0; j < 512; j++){
+        if(buf[j] != (char)i){
+          printf(stdout, "readahead wrong data\n");
+          exit();
+        }
+      }
+    }
+    close(fd);
+    if(k < 2)
+      exit();
+    wait();
+    wait();
+  }
+  unlink("readahead");
+  bcachesize(n0);
+  printf(stdout, "readahead ok\n");
+}
+
+// fsync() should refuse pipes, and sync() should commit: the
+// blocks of an unlinked file are only free once it has.
+void
+synctest(void)
+{
+  struct statfs st0, st1;
+  int fd, i, p[2];
+
+  printf(stdout, "sync test\n");
+  if(statfs("/", &st0) < 0){
+    printf(stdout, "statfs failed\n");
+    exit();
+  }
+  fd = open("sync", O_CREATE|O_RDWR);
+  memset(buf, 's', st0.bsize);
+  for(i = 0; i < 10 && fd >= 0; i++){
+    if(write(fd, buf, st0.bsize) != st0.bsize){
+      printf(stdout, "sync write failed\n");
+      exit();
+    }
+  }
+  if(fd < 0 || fsync(fd) < 0){
+    printf(stdout, "fsync failed\n");
+    exit();
+  }
+  close(fd);
+  if(pipe(p) < 0 || fsync(p[0]) >= 0){
+    printf(stdout, "fsync of a pipe succeeded\n");
+    exit();
+  }
+  close(p[0]);
+  close(p[1]);
+  statfs("/", &st0);
+  unlink("sync");
+  if(sync() < 0){
+    printf(stdout, "sync failed\n");
+    exit();
+  }
+  statfs("/", &st1);
+  if(st1.bfree < st0.bfree + 10){
+    printf(stdout, "sync did not commit the unlink\n");
+    exit();
+  }
+  fd = open("sync", O_RDONLY);
+  if(fd >= 0){
+    printf(stdout, "sync: unlinked file still there\n");
+    exit();
+  }
+  printf(stdout, "sync ok\n");
+}
+
+// one process rewrites a file and commits it while another
+// reads it.  install_trans() writes the committed blocks
+// home a batch at a time and releases each as soon as its
+// write is done (bwaitany()), so the reader must never see
+// a block half old and half new.
+void
+installtest(void)
+{
+  struct statfs st;
+  struct bcstat bs0, bs1;
+  int fd, i, j, k, pid;
+
+  printf(stdout, "install test\n");
+  if(statfs("/", &st) < 0 || st.bsize > sizeof(buf)){
+    printf(stdout, "statfs failed\n");
+    exit();
+  }
+  fd = open("install", O_CREATE|O_RDWR);
+  memset(buf, 'a', st.bsize);
+  for(i = 0; i < 10 && fd >= 0; i++)
+    write(fd, buf, st.bsize);
+  if(fd < 0 || fsync(fd) < 0){
+    printf(stdout, "create install failed\n");
+    exit();
+  }
+  close(fd);
+  bcstat(&bs0, 0);
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  for(k = 0; k < 20; k++){
+    fd = open("install", O_RDWR);
+    if(fd < 0){
+      printf(stdout, "open install failed\n");
+      exit();
+    }
+    for(i = 0; i < 10; i++){
+      if(pid > 0)
+        memset(buf, 'a' + k, st.bsize);
+      if((pid > 0 ? write(fd, buf, st.bsize) : read(fd, buf, st.bsize)) != st.bsize){
+        printf(stdout, "install read/write failed\n");
+        exit();
+      }
+      for(j = 1; j < st.bsize; j++){
+        if(buf[j] != buf[0] || buf[0] < 'a' || buf[0] >= 'a' + 20){
+          printf(stdout, "install: block %d torn\n", i);
+          exit();
+        }
+      }
+    }
+    if(pid > 0 && fsync(fd) < 0){
+      printf(stdout, "install fsync failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  if(pid == 0)
+    exit();
+  wait();
+  bcstat(&bs1, 0);
+  if(bs1.commits < bs0.commits + 20){
+    printf(stdout, "install: only %d commits\n", bs1.commits - bs0.commits);
+    exit();
+  }
+  unlink("install");
+  printf(stdout, "install ok\n");
+}
+
 void
 createtest(void)
 {
@@ -264,6 +772,78 @@ createtest(void)
   printf(stdout, "many creates, followed by unlink; ok\n");
 }
 
+// the name cache remembers names that are not there, and
+// lock-free lookups may find names in the cache: a create
+// must replace a cached miss, and an unlink must hide the
+// name from later lookups, even while another process keeps
+// looking the name up.
+void
+dcachetest(void)
+{
+  int fd, i, pid;
+
+  printf(stdout, "dcache test\n");
+  if(mkdir("dcdir") < 0){
+    printf(stdout, "mkdir dcdir failed\n");
+    exit();
+  }
+  for(i = 0; i < 2; i++){
+    if(open("dcdir/f", O_RDONLY) >= 0){
+      printf(stdout, "dcache: open of missing file succeeded\n");
+      exit();
+    }
+  }
+  fd = open("dcdir/f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "dcache: create after failed open failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("dcdir/f", O_RDONLY);
+  if(fd < 0){
+    printf(stdout, "dcache: open after create failed\n");
+    exit();
+  }
+  close(fd);
+
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(;;){
+      fd = open("dcdir/f", O_RDONLY);
+      if(fd >= 0)
+        close(fd);
+    }
+  }
+  for(i = 0; i < 100; i++){
+    if(unlink("dcdir/f") < 0){
+      printf(stdout, "dcache: unlink failed\n");
+      exit();
+    }
+    fd = open("dcdir/f", O_RDONLY);
+    if(fd >= 0){
+      printf(stdout, "dcache: open after unlink succeeded\n");
+      exit();
+    }
+    fd = open("dcdir/f", O_CREATE|O_RDWR);
+    if(fd < 0){
+      printf(stdout, "dcache: create after unlink failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  kill(pid);
+  wait();
+  if(unlink("dcdir/f") < 0 || unlink("dcdir") < 0){
+    printf(stdout, "dcache: cleanup failed\n");
+    exit();
+  }
+  printf(stdout, "dcache ok\n");
+}
+
 void dirtest(void)
 {
   printf(stdout, "mkdir test\n");
@@ -424,6 +1004,277 @@ exitwait(void)
   printf(1, "exitwait ok\n");
 }
 
+// threads created by clone() share memory with their creator
+int clonevar;
+
+void
+clonechild(void *arg)
+{
+  clonevar = (int)arg;
+  sbrk(4096);
+  exit();
+}
+
+// shrinks memory while its creator is blocked in join()
+void
+cloneshrink(void *arg)
+{
+  sbrk(-4096);
+  exit();
+}
+
+void
+clonetest(void)
+{
+  char *p, *stack, *oldbrk;
+  void *ustack;
+  int pid;
+
+  printf(1, "clone test\n");
+  p = sbrk(0);
+  if((uint)p % 4096)
+    sbrk(4096 - (uint)p % 4096);
+  stack = sbrk(4096);
+  oldbrk = sbrk(0);
+
+  clonevar = 0;
+  pid = clone(clonechild, (void*)42, stack);
+  if(pid < 0){
+    printf(1, "clone failed\n");
+    exit();
+  }
+  if(join(&ustack) != pid || ustack != stack){
+    printf(1, "join wrong pid or stack\n");
+    exit();
+  }
+  if(clonevar != 42){
+    printf(1, "clone child did not share memory\n");
+    exit();
+  }
+  if(sbrk(0) != oldbrk + 4096){
+    printf(1, "clone child sbrk not shared\n");
+    exit();
+  }
+  oldbrk[0] = 1;
+  if(clone(cloneshrink, 0, stack) < 0 || join(&ustack) < 0){
+    printf(1, "clone shrink failed\n");
+    exit();
+  }
+  if(sbrk(0) != oldbrk){
+    printf(1, "clone child sbrk(-4096) not shared\n");
+    exit();
+  }
+  if(sbrk(4096) != oldbrk || oldbrk[0] != 0){
+    printf(1, "regrown memory not zeroed\n");
+    exit();
+  }
+  sbrk(-4096);
+  if(join(&ustack) != -1 || wait() != -1){
+    printf(1, "join got too many\n");
+    exit();
+  }
+  printf(1, "clone test ok\n");
+}
+
+// a futex-based mutex: 0 unlocked, 1 locked, 2 locked with waiters
+uint futexmu;
+int futexcount;
+
+void
+futexlock(uint *m)
+{
+  if(xchg(m, 1) == 0)
+    return;
+  while(xchg(m, 2) != 0)
+    futex_wait(m, 2);
+}
+
+void
+futexunlock(uint *m)
+{
+  if(xchg(m, 0) == 2)
+    futex_wake(m, 1);
+}
+
+void
+futexchild(void *arg)
+{
+  int i, n;
+
+  for(i = 0; i < 500; i++){
+    futexlock(&futexmu);
+    n = futexcount;
+    if(i % 50 == 0)
+      sleep(1);
+    futexcount = n + 1;
+    futexunlock(&futexmu);
+  }
+  exit();
+}
+
+void
+futextest(void)
+{
+  char *p, *stacks;
+  void *ustack;
+  int i;
+
+  printf(1, "futex test\n");
+  p = sbrk(0);
+  if((uint)p % 4096)
+    sbrk(4096 - (uint)p % 4096);
+  stacks = sbrk(4*4096);
+
+  futexmu = 0;
+  futexcount = 0;
+  for(i = 0; i < 4; i++){
+    if(clone(futexchild, 0, stacks + i*4096) < 0){
+      printf(1, "futex clone failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++){
+    if(join(&ustack) < 0){
+      printf(1, "futex join failed\n");
+      exit();
+    }
+  }
+  if(futexcount != 4*500){
+    printf(1, "futex count %d, expected %d\n", futexcount, 4*500);
+    exit();
+  }
+  futexmu = 5;
+  if(futex_wait(&futexmu, 6) != -1){
+    printf(1, "futex_wait did not check value\n");
+    exit();
+  }
+  printf(1, "futex test ok\n");
+}
+
+// pin to one CPU and back; a child inherits the mask.
+void
+affinitytest(void)
+{
+  int all, pid;
+
+  printf(1, "affinity test\n");
+  all = getaffinity(0);
+  if(all == 0 || all == -1){
+    printf(1, "getaffinity failed\n");
+    exit();
+  }
+  if(setaffinity(0, 0) != -1){
+    printf(1, "setaffinity accepted empty mask\n");
+    exit();
+  }
+  if(setaffinity(0, 1) < 0 || getaffinity(getpid()) != 1){
+    printf(1, "setaffinity failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    if(getaffinity(0) != 1)
+      printf(1, "affinity not inherited\n");
+    exit();
+  }
+  wait();
+  if(setaffinity(0, all) < 0){
+    printf(1, "setaffinity restore failed\n");
+    exit();
+  }
+  printf(1, "affinity test ok\n");
+}
+
+// a waited-for child's system calls show up in RUSAGE_CHILDREN.
+void
+rusagetest(void)
+{
+  struct rusage ru;
+  int fd;
+
+  printf(1, "rusage test\n");
+  if(fork() == 0){
+    // The flusher writes the block, but the child is charged.
+    fd = open("rusage", O_CREATE|O_RDWR);
+    write(fd, "x", 1);
+    close(fd);
+    unlink("rusage");
+    exit();
+  }
+  wait();
+  if(getrusage(RUSAGE_CHILDREN, &ru) < 0 || ru.nsyscall < 2 ||
+     ru.oublock < 1){
+    printf(1, "getrusage failed\n");
+    exit();
+  }
+  printf(1, "rusage test ok\n");
+}
+
+struct lockstat lst[NLOCKSTAT];
+
+// Sum the counters of all lock classes after lockstat().
+static void
+lockstatsum(int reset, uint *acquires, uint *waits)
+{
+  int i, n;
+
+  n = lockstat(lst, NLOCKSTAT, reset);
+  if(n <= 0 || n > NLOCKSTAT){
+    printf(stdout, "lockstat failed: %d\n", n);
+    exit();
+  }
+  *acquires = *waits = 0;
+  for(i = 0; i < n; i++){
+    *acquires += lst[i].acquires;
+    *waits += lst[i].contended + lst[i].sleeps;
+  }
+}
+
+// four processes append to one file at once, so that they
+// wait for each other's locks; lockstat() should count that,
+// and count from zero again after a reset.
+void
+lockstattest(void)
+{
+  uint a0, w0, a1, w1;
+  int fd, i, k, pid;
+
+  printf(stdout, "lockstat test\n");
+  lockstatsum(1, &a0, &w0);
+  close(open("lockstat", O_CREATE|O_RDWR));
+  for(k = 0; k < 4; k++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+    fd = open("lockstat", O_RDWR);
+    for(i = 0; i < 100; i++){
+      if(write(fd, buf, 512) != 512){
+        printf(stdout, "lockstat write failed\n");
+        exit();
+      }
+    }
+    close(fd);
+    exit();
+  }
+  for(k = 0; k < 4; k++)
+    wait();
+  unlink("lockstat");
+  lockstatsum(1, &a0, &w0);
+  if(a0 == 0 || w0 == 0){
+    printf(stdout, "lockstat: %d acquires, %d waits\n", a0, w0);
+    exit();
+  }
+  lockstatsum(0, &a1, &w1);
+  if(a1 >= a0 || w1 >= w0){
+    printf(stdout, "lockstat: reset did not clear counters\n");
+    exit();
+  }
+  printf(stdout, "lockstat ok\n");
+}
 void
 mem(void)
 {
@@ -512,6 +1363,73 @@ sharedfd(void)
   }
 }
 
+// three processes read a file while a fourth rewrites it, so
+// that readers share its blocks and the writer waits for them;
+// each 512-byte piece read must come from a single write.
+void
+sharedread(void)
+{
+  int fd, pid, i, j, k, n;
+  char buf[512];
+
+  printf(1, "sharedread test\n");
+
+  unlink("sharedread");
+  fd = open("sharedread", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create sharedread failed\n");
+    exit();
+  }
+  memset(buf, 'a', sizeof(buf));
+  for(i = 0; i < 8; i++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "write sharedread failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  for(k = 0; k < 4; k++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+    for(j = 0; j < 20; j++){
+      fd = open("sharedread", k == 0 ? O_RDWR : O_RDONLY);
+      if(fd < 0){
+        printf(1, "open sharedread failed\n");
+        exit();
+      }
+      for(i = 0; i < 8; i++){
+        if(k == 0){
+          memset(buf, 'a' + (i + j) % 26, sizeof(buf));
+          n = write(fd, buf, sizeof(buf));
+        } else
+          n = read(fd, buf, sizeof(buf));
+        if(n != sizeof(buf)){
+          printf(1, "sharedread i/o failed\n");
+          exit();
+        }
+        for(n = 1; n < sizeof(buf); n++){
+          if(buf[n] != buf[0]){
+            printf(1, "sharedread saw a torn write\n");
+            exit();
+          }
+        }
+      }
+      close(fd);
+    }
+    exit();
+  }
+  for(k = 0; k < 4; k++)
+    wait();
+  unlink("sharedread");
+  printf(1, "sharedread ok\n");
+}
+
 // four processes write different files at the same
 // time, to test block allocation.
 void
@@ -889,6 +1807,59 @@ linkunlink()
 }
 
 // directory that uses indirect blocks
+// "." and ".." must still be found once a directory has
+// grown big enough to be hash-indexed.
+void
+dxdottest(void)
+{
+  struct stat st0, st1, st2;
+  char path[16];
+  int i, fd;
+
+  printf(1, "indexed dot test\n");
+  if(mkdir("dxdot") < 0){
+    printf(1, "mkdir dxdot failed\n");
+    exit();
+  }
+  strcpy(path, "dxdot/f00");
+  for(i = 0; i < 100; i++){
+    path[7] = '0' + i / 10;
+    path[8] = '0' + i % 10;
+    if((fd = open(path, O_CREATE)) < 0){
+      printf(1, "create in dxdot failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  if(stat("dxdot", &st0) < 0 || stat("dxdot/.", &st1) < 0 ||
+     st1.ino != st0.ino){
+    printf(1, "dxdot/. not found\n");
+    exit();
+  }
+  if(stat(".", &st0) < 0 || stat("dxdot/..", &st2) < 0 ||
+     st2.ino != st0.ino){
+    printf(1, "dxdot/.. not found\n");
+    exit();
+  }
+  if(chdir("dxdot") < 0 || chdir("..") < 0){
+    printf(1, "chdir dxdot/.. failed\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    path[7] = '0' + i / 10;
+    path[8] = '0' + i % 10;
+    if(unlink(path) < 0){
+      printf(1, "unlink in dxdot failed\n");
+      exit();
+    }
+  }
+  if(unlink("dxdot") < 0){
+    printf(1, "unlink dxdot failed\n");
+    exit();
+  }
+  printf(1, "indexed dot ok\n");
+}
+
 void
 bigdir(void)
 {
@@ -1719,6 +2690,7 @@ main(int argc, char *argv[])
   concreate();
   fourfiles();
   sharedfd();
+  sharedread();
 
   bigargtest();
   bigwrite();
@@ -1730,7 +2702,15 @@ main(int argc, char *argv[])
   opentest();
   writetest();
   writetest1();
+  statfstest();
+  bcachetest();
+  bcstattest();
+  logopstest();
+  readaheadtest();
+  synctest();
+  installtest();
   createtest();
+  dcachetest();
 
   openiputtest();
   exitiputtest();
@@ -1740,6 +2720,11 @@ main(int argc, char *argv[])
   pipe1();
   preempt();
   exitwait();
+  clonetest();
+  futextest();
+  affinitytest();
+  rusagetest();
+  lockstattest();
 
   rmdot();
   fourteen();
@@ -1750,7 +2735,10 @@ main(int argc, char *argv[])
   dirfile();
   iref();
   forktest();
+  dxdottest();
   bigdir(); // slow
+  tindirtest(); // slow
+  fragwritetest(); // slow
   exectest();
 
   exit();
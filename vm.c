@@ -4,6 +4,7 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "rusage.h"
 #include "proc.h"
 #include "elf.h"
 
@@ -245,7 +246,8 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
+// process size.  Also frees pages left behind by unmapuvm().
+// Returns the new process size.
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
@@ -260,7 +262,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a += (NPTENTRIES - 1) * PGSIZE;
-    else if((*pte & PTE_P) != 0){
+    else if(*pte != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
@@ -272,6 +274,30 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Make the user pages between newsz and oldsz inaccessible
+// without freeing them: clear PTE_P but keep the physical
+// address in the PTE for a later deallocuvm().  Used when
+// other CPUs may still hold the old translations in their
+// TLBs, which must be flushed before the pages can be reused.
+void
+unmapuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  pte_t *pte;
+  uint a;
+
+  if(newsz >= oldsz)
+    return;
+
+  a = PGROUNDUP(newsz);
+  for(; a  < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a += (NPTENTRIES - 1) * PGSIZE;
+    else
+      *pte &= ~PTE_P;
+  }
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
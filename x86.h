@@ -130,6 +130,48 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically add n to *addr and return the old value.
+static inline uint
+xadd(volatile uint *addr, uint n)
+{
+  asm volatile("lock; xaddl %0, %1" :
+               "+r" (n), "+m" (*addr) :
+               :
+               "memory", "cc");
+  return n;
+}
+
+// Atomically set *addr to newval if it holds old.
+// Return the value *addr held.
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+               "=a" (result), "+m" (*addr) :
+               "r" (newval), "0" (old) :
+               "memory", "cc");
+  return result;
+}
+
+// Spin-wait hint; also makes gcc reload memory in a spin loop.
+static inline void
+pause(void)
+{
+  asm volatile("pause" : : : "memory");
+}
+
+// Read the time-stamp counter (CPU cycles since reset).
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+  return t;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +186,14 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
@@ -0,0 +1,1173 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 65 02 00 00       	call   27b <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 ef 02 00 00       	call   313 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 57 02 00 00       	call   283 <exit>
+
+0000002c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+    ;
+  return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  85:	eb 08                	jmp    8f <strcmp+0xd>
+    p++, q++;
+  87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  92:	0f b6 00             	movzbl (%eax),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 10                	je     a9 <strcmp+0x27>
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	38 c2                	cmp    %al,%dl
+  a7:	74 de                	je     87 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  ac:	0f b6 00             	movzbl (%eax),%eax
+  af:	0f b6 d0             	movzbl %al,%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	0f b6 00             	movzbl (%eax),%eax
+  b8:	0f b6 c0             	movzbl %al,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	89 d0                	mov    %edx,%eax
+}
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+
+000000c1 <strlen>:
+
+uint
+strlen(char *s)
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  ce:	eb 04                	jmp    d4 <strlen+0x13>
+  d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	01 d0                	add    %edx,%eax
+  dc:	0f b6 00             	movzbl (%eax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 ed                	jne    d0 <strlen+0xf>
+    ;
+  return n;
+  e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 0c             	push   0xc(%ebp)
+  f2:	ff 75 08             	push   0x8(%ebp)
+  f5:	e8 32 ff ff ff       	call   2c <stosb>
+  fa:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 100:	c9                   	leave
+ 101:	c3                   	ret
+
+00000102 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 102:	55                   	push   %ebp
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 10e:	eb 14                	jmp    124 <strchr+0x22>
+    if(*s == c)
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	0f b6 00             	movzbl (%eax),%eax
+ 116:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 119:	75 05                	jne    120 <strchr+0x1e>
+      return (char*)s;
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	eb 13                	jmp    133 <strchr+0x31>
+  for(; *s; s++)
+ 120:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 00             	movzbl (%eax),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	75 e2                	jne    110 <strchr+0xe>
+  return 0;
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 13b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 142:	eb 42                	jmp    186 <gets+0x51>
+    cc = read(0, &c, 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 14c:	50                   	push   %eax
+ 14d:	6a 00                	push   $0x0
+ 14f:	e8 47 01 00 00       	call   29b <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 15a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 15e:	7e 33                	jle    193 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 163:	8d 50 01             	lea    0x1(%eax),%edx
+ 166:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 169:	89 c2                	mov    %eax,%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	01 c2                	add    %eax,%edx
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 176:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17a:	3c 0a                	cmp    $0xa,%al
+ 17c:	74 16                	je     194 <gets+0x5f>
+ 17e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 182:	3c 0d                	cmp    $0xd,%al
+ 184:	74 0e                	je     194 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 189:	83 c0 01             	add    $0x1,%eax
+ 18c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 18f:	7f b3                	jg     144 <gets+0xf>
+ 191:	eb 01                	jmp    194 <gets+0x5f>
+      break;
+ 193:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	ff 75 08             	push   0x8(%ebp)
+ 1b2:	e8 0c 01 00 00       	call   2c3 <open>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c1:	79 07                	jns    1ca <stat+0x26>
+    return -1;
+ 1c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c8:	eb 25                	jmp    1ef <stat+0x4b>
+  r = fstat(fd, st);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	ff 75 0c             	push   0xc(%ebp)
+ 1d0:	ff 75 f4             	push   -0xc(%ebp)
+ 1d3:	e8 03 01 00 00       	call   2db <fstat>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1de:	83 ec 0c             	sub    $0xc,%esp
+ 1e1:	ff 75 f4             	push   -0xc(%ebp)
+ 1e4:	e8 c2 00 00 00       	call   2ab <close>
+ 1e9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 1fe:	eb 25                	jmp    225 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	c1 e0 02             	shl    $0x2,%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	01 c0                	add    %eax,%eax
+ 20c:	89 c1                	mov    %eax,%ecx
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	8d 50 01             	lea    0x1(%eax),%edx
+ 214:	89 55 08             	mov    %edx,0x8(%ebp)
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	0f be c0             	movsbl %al,%eax
+ 21d:	01 c8                	add    %ecx,%eax
+ 21f:	83 e8 30             	sub    $0x30,%eax
+ 222:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	3c 2f                	cmp    $0x2f,%al
+ 22d:	7e 0a                	jle    239 <atoi+0x48>
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	3c 39                	cmp    $0x39,%al
+ 237:	7e c7                	jle    200 <atoi+0xf>
+  return n;
+ 239:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 250:	eb 17                	jmp    269 <memmove+0x2b>
+    *dst++ = *src++;
+ 252:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 255:	8d 42 01             	lea    0x1(%edx),%eax
+ 258:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 25b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 25e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 261:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 264:	0f b6 12             	movzbl (%edx),%edx
+ 267:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 269:	8b 45 10             	mov    0x10(%ebp),%eax
+ 26c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 26f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 272:	85 c0                	test   %eax,%eax
+ 274:	7f dc                	jg     252 <memmove+0x14>
+  return vdst;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+
+0000027b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 27b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <exit>:
+SYSCALL(exit)
+ 283:	b8 02 00 00 00       	mov    $0x2,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <wait>:
+SYSCALL(wait)
+ 28b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <pipe>:
+SYSCALL(pipe)
+ 293:	b8 04 00 00 00       	mov    $0x4,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <read>:
+SYSCALL(read)
+ 29b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <write>:
+SYSCALL(write)
+ 2a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <close>:
+SYSCALL(close)
+ 2ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <kill>:
+SYSCALL(kill)
+ 2b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <exec>:
+SYSCALL(exec)
+ 2bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <open>:
+SYSCALL(open)
+ 2c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <mknod>:
+SYSCALL(mknod)
+ 2cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <unlink>:
+SYSCALL(unlink)
+ 2d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <fstat>:
+SYSCALL(fstat)
+ 2db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <link>:
+SYSCALL(link)
+ 2e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <mkdir>:
+SYSCALL(mkdir)
+ 2eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <chdir>:
+SYSCALL(chdir)
+ 2f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <dup>:
+SYSCALL(dup)
+ 2fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <getpid>:
+SYSCALL(getpid)
+ 303:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <sbrk>:
+SYSCALL(sbrk)
+ 30b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <sleep>:
+SYSCALL(sleep)
+ 313:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <uptime>:
+SYSCALL(uptime)
+ 31b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <clone>:
+SYSCALL(clone)
+ 323:	b8 16 00 00 00       	mov    $0x16,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <join>:
+SYSCALL(join)
+ 32b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <futex_wait>:
+SYSCALL(futex_wait)
+ 333:	b8 18 00 00 00       	mov    $0x18,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <futex_wake>:
+SYSCALL(futex_wake)
+ 33b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <setaffinity>:
+SYSCALL(setaffinity)
+ 343:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <getaffinity>:
+SYSCALL(getaffinity)
+ 34b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <getrusage>:
+SYSCALL(getrusage)
+ 353:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <lockstat>:
+SYSCALL(lockstat)
+ 35b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <statfs>:
+SYSCALL(statfs)
+ 363:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <bcachesize>:
+SYSCALL(bcachesize)
+ 36b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <bcstat>:
+SYSCALL(bcstat)
+ 373:	b8 20 00 00 00       	mov    $0x20,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <sync>:
+SYSCALL(sync)
+ 37b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <fsync>:
+SYSCALL(fsync)
+ 383:	b8 22 00 00 00       	mov    $0x22,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 38b:	55                   	push   %ebp
+ 38c:	89 e5                	mov    %esp,%ebp
+ 38e:	83 ec 18             	sub    $0x18,%esp
+ 391:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 394:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 397:	83 ec 04             	sub    $0x4,%esp
+ 39a:	6a 01                	push   $0x1
+ 39c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 39f:	50                   	push   %eax
+ 3a0:	ff 75 08             	push   0x8(%ebp)
+ 3a3:	e8 fb fe ff ff       	call   2a3 <write>
+ 3a8:	83 c4 10             	add    $0x10,%esp
+}
+ 3ab:	90                   	nop
+ 3ac:	c9                   	leave
+ 3ad:	c3                   	ret
+
+000003ae <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3ae:	55                   	push   %ebp
+ 3af:	89 e5                	mov    %esp,%ebp
+ 3b1:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 3b4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 3bb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 3bf:	74 17                	je     3d8 <printint+0x2a>
+ 3c1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 3c5:	79 11                	jns    3d8 <printint+0x2a>
+    neg = 1;
+ 3c7:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 3ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d1:	f7 d8                	neg    %eax
+ 3d3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3d6:	eb 06                	jmp    3de <printint+0x30>
+  } else {
+    x = xx;
+ 3d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 3de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 3e5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 3eb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3f0:	f7 f1                	div    %ecx
+ 3f2:	89 d1                	mov    %edx,%ecx
+ 3f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3f7:	8d 50 01             	lea    0x1(%eax),%edx
+ 3fa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3fd:	0f b6 91 64 0a 00 00 	movzbl 0xa64(%ecx),%edx
+ 404:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 408:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 40e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 413:	f7 f1                	div    %ecx
+ 415:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 418:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 41c:	75 c7                	jne    3e5 <printint+0x37>
+  if(neg)
+ 41e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 422:	74 2d                	je     451 <printint+0xa3>
+    buf[i++] = '-';
+ 424:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 427:	8d 50 01             	lea    0x1(%eax),%edx
+ 42a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 42d:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 432:	eb 1d                	jmp    451 <printint+0xa3>
+    putc(fd, buf[i]);
+ 434:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 437:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 43a:	01 d0                	add    %edx,%eax
+ 43c:	0f b6 00             	movzbl (%eax),%eax
+ 43f:	0f be c0             	movsbl %al,%eax
+ 442:	83 ec 08             	sub    $0x8,%esp
+ 445:	50                   	push   %eax
+ 446:	ff 75 08             	push   0x8(%ebp)
+ 449:	e8 3d ff ff ff       	call   38b <putc>
+ 44e:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 451:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 455:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 459:	79 d9                	jns    434 <printint+0x86>
+}
+ 45b:	90                   	nop
+ 45c:	90                   	nop
+ 45d:	c9                   	leave
+ 45e:	c3                   	ret
+
+0000045f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 45f:	55                   	push   %ebp
+ 460:	89 e5                	mov    %esp,%ebp
+ 462:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 465:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 46c:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 46f:	83 c0 04             	add    $0x4,%eax
+ 472:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 475:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 47c:	e9 59 01 00 00       	jmp    5da <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 481:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 484:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 487:	01 d0                	add    %edx,%eax
+ 489:	0f b6 00             	movzbl (%eax),%eax
+ 48c:	0f be c0             	movsbl %al,%eax
+ 48f:	25 ff 00 00 00       	and    $0xff,%eax
+ 494:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 497:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 49b:	75 2c                	jne    4c9 <printf+0x6a>
+      if(c == '%'){
+ 49d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4a1:	75 0c                	jne    4af <printf+0x50>
+        state = '%';
+ 4a3:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 4aa:	e9 27 01 00 00       	jmp    5d6 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 4af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4b2:	0f be c0             	movsbl %al,%eax
+ 4b5:	83 ec 08             	sub    $0x8,%esp
+ 4b8:	50                   	push   %eax
+ 4b9:	ff 75 08             	push   0x8(%ebp)
+ 4bc:	e8 ca fe ff ff       	call   38b <putc>
+ 4c1:	83 c4 10             	add    $0x10,%esp
+ 4c4:	e9 0d 01 00 00       	jmp    5d6 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 4c9:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 4cd:	0f 85 03 01 00 00    	jne    5d6 <printf+0x177>
+      if(c == 'd'){
+ 4d3:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 4d7:	75 1e                	jne    4f7 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 4d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4dc:	8b 00                	mov    (%eax),%eax
+ 4de:	6a 01                	push   $0x1
+ 4e0:	6a 0a                	push   $0xa
+ 4e2:	50                   	push   %eax
+ 4e3:	ff 75 08             	push   0x8(%ebp)
+ 4e6:	e8 c3 fe ff ff       	call   3ae <printint>
+ 4eb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 4ee:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 4f2:	e9 d8 00 00 00       	jmp    5cf <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 4f7:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 4fb:	74 06                	je     503 <printf+0xa4>
+ 4fd:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 501:	75 1e                	jne    521 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 503:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 506:	8b 00                	mov    (%eax),%eax
+ 508:	6a 00                	push   $0x0
+ 50a:	6a 10                	push   $0x10
+ 50c:	50                   	push   %eax
+ 50d:	ff 75 08             	push   0x8(%ebp)
+ 510:	e8 99 fe ff ff       	call   3ae <printint>
+ 515:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 518:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 51c:	e9 ae 00 00 00       	jmp    5cf <printf+0x170>
+      } else if(c == 's'){
+ 521:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 525:	75 43                	jne    56a <printf+0x10b>
+        s = (char*)*ap;
+ 527:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 52a:	8b 00                	mov    (%eax),%eax
+ 52c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 52f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 533:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 537:	75 25                	jne    55e <printf+0xff>
+          s = "(null)";
+ 539:	c7 45 f4 16 08 00 00 	movl   $0x816,-0xc(%ebp)
+        while(*s != 0){
+ 540:	eb 1c                	jmp    55e <printf+0xff>
+          putc(fd, *s);
+ 542:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 545:	0f b6 00             	movzbl (%eax),%eax
+ 548:	0f be c0             	movsbl %al,%eax
+ 54b:	83 ec 08             	sub    $0x8,%esp
+ 54e:	50                   	push   %eax
+ 54f:	ff 75 08             	push   0x8(%ebp)
+ 552:	e8 34 fe ff ff       	call   38b <putc>
+ 557:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 55a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 55e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 561:	0f b6 00             	movzbl (%eax),%eax
+ 564:	84 c0                	test   %al,%al
+ 566:	75 da                	jne    542 <printf+0xe3>
+ 568:	eb 65                	jmp    5cf <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 56a:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 56e:	75 1d                	jne    58d <printf+0x12e>
+        putc(fd, *ap);
+ 570:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 573:	8b 00                	mov    (%eax),%eax
+ 575:	0f be c0             	movsbl %al,%eax
+ 578:	83 ec 08             	sub    $0x8,%esp
+ 57b:	50                   	push   %eax
+ 57c:	ff 75 08             	push   0x8(%ebp)
+ 57f:	e8 07 fe ff ff       	call   38b <putc>
+ 584:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 587:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 58b:	eb 42                	jmp    5cf <printf+0x170>
+      } else if(c == '%'){
+ 58d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 591:	75 17                	jne    5aa <printf+0x14b>
+        putc(fd, c);
+ 593:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 596:	0f be c0             	movsbl %al,%eax
+ 599:	83 ec 08             	sub    $0x8,%esp
+ 59c:	50                   	push   %eax
+ 59d:	ff 75 08             	push   0x8(%ebp)
+ 5a0:	e8 e6 fd ff ff       	call   38b <putc>
+ 5a5:	83 c4 10             	add    $0x10,%esp
+ 5a8:	eb 25                	jmp    5cf <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5aa:	83 ec 08             	sub    $0x8,%esp
+ 5ad:	6a 25                	push   $0x25
+ 5af:	ff 75 08             	push   0x8(%ebp)
+ 5b2:	e8 d4 fd ff ff       	call   38b <putc>
+ 5b7:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 5ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5bd:	0f be c0             	movsbl %al,%eax
+ 5c0:	83 ec 08             	sub    $0x8,%esp
+ 5c3:	50                   	push   %eax
+ 5c4:	ff 75 08             	push   0x8(%ebp)
+ 5c7:	e8 bf fd ff ff       	call   38b <putc>
+ 5cc:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 5cf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5d6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 5da:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5e0:	01 d0                	add    %edx,%eax
+ 5e2:	0f b6 00             	movzbl (%eax),%eax
+ 5e5:	84 c0                	test   %al,%al
+ 5e7:	0f 85 94 fe ff ff    	jne    481 <printf+0x22>
+    }
+  }
+}
+ 5ed:	90                   	nop
+ 5ee:	90                   	nop
+ 5ef:	c9                   	leave
+ 5f0:	c3                   	ret
+
+000005f1 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5f1:	55                   	push   %ebp
+ 5f2:	89 e5                	mov    %esp,%ebp
+ 5f4:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fa:	83 e8 08             	sub    $0x8,%eax
+ 5fd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 600:	a1 80 0a 00 00       	mov    0xa80,%eax
+ 605:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 608:	eb 24                	jmp    62e <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 60a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 60d:	8b 00                	mov    (%eax),%eax
+ 60f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 612:	72 12                	jb     626 <free+0x35>
+ 614:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 617:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 61a:	72 24                	jb     640 <free+0x4f>
+ 61c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 61f:	8b 00                	mov    (%eax),%eax
+ 621:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 624:	72 1a                	jb     640 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 626:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 629:	8b 00                	mov    (%eax),%eax
+ 62b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 62e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 631:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 634:	73 d4                	jae    60a <free+0x19>
+ 636:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 639:	8b 00                	mov    (%eax),%eax
+ 63b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 63e:	73 ca                	jae    60a <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 640:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 643:	8b 40 04             	mov    0x4(%eax),%eax
+ 646:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 64d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 650:	01 c2                	add    %eax,%edx
+ 652:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 655:	8b 00                	mov    (%eax),%eax
+ 657:	39 c2                	cmp    %eax,%edx
+ 659:	75 24                	jne    67f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 65b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 65e:	8b 50 04             	mov    0x4(%eax),%edx
+ 661:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 664:	8b 00                	mov    (%eax),%eax
+ 666:	8b 40 04             	mov    0x4(%eax),%eax
+ 669:	01 c2                	add    %eax,%edx
+ 66b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 66e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 671:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 674:	8b 00                	mov    (%eax),%eax
+ 676:	8b 10                	mov    (%eax),%edx
+ 678:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 67b:	89 10                	mov    %edx,(%eax)
+ 67d:	eb 0a                	jmp    689 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 67f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 682:	8b 10                	mov    (%eax),%edx
+ 684:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 687:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 689:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68c:	8b 40 04             	mov    0x4(%eax),%eax
+ 68f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 696:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 699:	01 d0                	add    %edx,%eax
+ 69b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 69e:	75 20                	jne    6c0 <free+0xcf>
+    p->s.size += bp->s.size;
+ 6a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a3:	8b 50 04             	mov    0x4(%eax),%edx
+ 6a6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6a9:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ac:	01 c2                	add    %eax,%edx
+ 6ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6b4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6b7:	8b 10                	mov    (%eax),%edx
+ 6b9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6bc:	89 10                	mov    %edx,(%eax)
+ 6be:	eb 08                	jmp    6c8 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 6c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6c6:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 6c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6cb:	a3 80 0a 00 00       	mov    %eax,0xa80
+}
+ 6d0:	90                   	nop
+ 6d1:	c9                   	leave
+ 6d2:	c3                   	ret
+
+000006d3 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6d3:	55                   	push   %ebp
+ 6d4:	89 e5                	mov    %esp,%ebp
+ 6d6:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6d9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 6e0:	77 07                	ja     6e9 <morecore+0x16>
+    nu = 4096;
+ 6e2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ec:	c1 e0 03             	shl    $0x3,%eax
+ 6ef:	83 ec 0c             	sub    $0xc,%esp
+ 6f2:	50                   	push   %eax
+ 6f3:	e8 13 fc ff ff       	call   30b <sbrk>
+ 6f8:	83 c4 10             	add    $0x10,%esp
+ 6fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 6fe:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 702:	75 07                	jne    70b <morecore+0x38>
+    return 0;
+ 704:	b8 00 00 00 00       	mov    $0x0,%eax
+ 709:	eb 26                	jmp    731 <morecore+0x5e>
+  hp = (Header*)p;
+ 70b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 70e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 711:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 714:	8b 55 08             	mov    0x8(%ebp),%edx
+ 717:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 71a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 71d:	83 c0 08             	add    $0x8,%eax
+ 720:	83 ec 0c             	sub    $0xc,%esp
+ 723:	50                   	push   %eax
+ 724:	e8 c8 fe ff ff       	call   5f1 <free>
+ 729:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 72c:	a1 80 0a 00 00       	mov    0xa80,%eax
+}
+ 731:	c9                   	leave
+ 732:	c3                   	ret
+
+00000733 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 733:	55                   	push   %ebp
+ 734:	89 e5                	mov    %esp,%ebp
+ 736:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 739:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73c:	83 c0 07             	add    $0x7,%eax
+ 73f:	c1 e8 03             	shr    $0x3,%eax
+ 742:	83 c0 01             	add    $0x1,%eax
+ 745:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 748:	a1 80 0a 00 00       	mov    0xa80,%eax
+ 74d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 750:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 754:	75 23                	jne    779 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 756:	c7 45 f0 78 0a 00 00 	movl   $0xa78,-0x10(%ebp)
+ 75d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 760:	a3 80 0a 00 00       	mov    %eax,0xa80
+ 765:	a1 80 0a 00 00       	mov    0xa80,%eax
+ 76a:	a3 78 0a 00 00       	mov    %eax,0xa78
+    base.s.size = 0;
+ 76f:	c7 05 7c 0a 00 00 00 	movl   $0x0,0xa7c
+ 776:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 779:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 77c:	8b 00                	mov    (%eax),%eax
+ 77e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 781:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 784:	8b 40 04             	mov    0x4(%eax),%eax
+ 787:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 78a:	72 4d                	jb     7d9 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 78c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78f:	8b 40 04             	mov    0x4(%eax),%eax
+ 792:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 795:	75 0c                	jne    7a3 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79a:	8b 10                	mov    (%eax),%edx
+ 79c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 79f:	89 10                	mov    %edx,(%eax)
+ 7a1:	eb 26                	jmp    7c9 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 7a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a6:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a9:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7ac:	89 c2                	mov    %eax,%edx
+ 7ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b1:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b7:	8b 40 04             	mov    0x4(%eax),%eax
+ 7ba:	c1 e0 03             	shl    $0x3,%eax
+ 7bd:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 7c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7c6:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 7c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7cc:	a3 80 0a 00 00       	mov    %eax,0xa80
+      return (void*)(p + 1);
+ 7d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d4:	83 c0 08             	add    $0x8,%eax
+ 7d7:	eb 3b                	jmp    814 <malloc+0xe1>
+    }
+    if(p == freep)
+ 7d9:	a1 80 0a 00 00       	mov    0xa80,%eax
+ 7de:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 7e1:	75 1e                	jne    801 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	ff 75 ec             	push   -0x14(%ebp)
+ 7e9:	e8 e5 fe ff ff       	call   6d3 <morecore>
+ 7ee:	83 c4 10             	add    $0x10,%esp
+ 7f1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 7f4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7f8:	75 07                	jne    801 <malloc+0xce>
+        return 0;
+ 7fa:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7ff:	eb 13                	jmp    814 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 801:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 804:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 807:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80a:	8b 00                	mov    (%eax),%eax
+ 80c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 80f:	e9 6d ff ff ff       	jmp    781 <malloc+0x4e>
+  }
+}
+ 814:	c9                   	leave
+ 815:	c3                   	ret